@@ -0,0 +1,157 @@
+/**
+ * \file alloc_bench.cpp
+ * \brief Allocation benchmark: heap versus arena allocation of AST and sep nodes.
+ *
+ * Usage: alloc-bench [--repeat N] [--commands N] [file ...]
+ * Each input is parsed and translated to the sep representation, once with
+ * regular heap allocation and once with an arena. For both modes, the benchmark
+ * reports the number of heap allocations, the best parse and translation times,
+ * and the peak memory usage. Every mode runs in a separate process, so that the
+ * peak memory usage of one does not hide that of the other.
+ * Without input files, a synthetic SL-COMP script with the given number of
+ * commands is generated in the working directory and used instead.
+ */
+
+#include "bench_util.h"
+
+#include "ast/ast_script.h"
+#include "parser/smtlib_parser.h"
+#include "sep/sep_script.h"
+#include "transl/sep_translator.h"
+#include "util/arena.h"
+#include "util/resource_usage.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace smtlib;
+
+namespace {
+    const char* SYNTHETIC_FILE = "alloc-bench-synthetic.sl2";
+
+    struct RunResult {
+        long parseAllocs;
+        long translateAllocs;
+        double parseMs;
+        double translateMs;
+    };
+
+    /** Parse and translate a file once */
+    bool run(const string& file, bool useArena, RunResult& result) {
+        ArenaPtr arena;
+        if (useArena)
+            arena = make_shared<Arena>();
+
+        Parser parser;
+        parser.setArena(arena);
+
+        long long allocsBefore = ResourceUsage::current().allocations;
+        auto start = chrono::steady_clock::now();
+        ast::ScriptPtr script = ast::nodeCast<ast::Script>(parser.parse(file));
+        auto parsed = chrono::steady_clock::now();
+        long long allocsParsed = ResourceUsage::current().allocations;
+
+        if (!script) {
+            cerr << file << ": parsing failed" << endl;
+            return false;
+        }
+
+        sep::Translator translator(arena);
+        sep::ScriptPtr sepScript = translator.translate(script);
+        auto translated = chrono::steady_clock::now();
+
+        result.parseAllocs = allocsParsed - allocsBefore;
+        result.translateAllocs = ResourceUsage::current().allocations - allocsParsed;
+        result.parseMs = chrono::duration<double, milli>(parsed - start).count();
+        result.translateMs = chrono::duration<double, milli>(translated - parsed).count();
+
+        return true;
+    }
+
+    /** Run one mode in a child process and print its results */
+    bool runMode(const string& file, bool useArena, long repeat) {
+        fflush(stdout);
+
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            return false;
+        }
+
+        if (pid == 0) {
+            RunResult best = {0, 0, 0, 0};
+            for (long r = 0; r < repeat; r++) {
+                RunResult current;
+                if (!run(file, useArena, current))
+                    _exit(1);
+
+                if (r == 0 || current.parseMs < best.parseMs) {
+                    best.parseMs = current.parseMs;
+                    best.parseAllocs = current.parseAllocs;
+                }
+                if (r == 0 || current.translateMs < best.translateMs) {
+                    best.translateMs = current.translateMs;
+                    best.translateAllocs = current.translateAllocs;
+                }
+            }
+
+            printf("%-6s %13ld %13.2f %13ld %13.2f %13ld\n", useArena ? "arena" : "heap",
+                   best.parseAllocs, best.parseMs, best.translateAllocs, best.translateMs, peakRssKb());
+            fflush(stdout);
+            _exit(0);
+        }
+
+        int status = 0;
+        waitpid(pid, &status, 0);
+        return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    long repeat = 3;
+    long commands = 200000;
+    vector<string> files;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--commands") == 0 && i + 1 < argc) {
+            commands = atol(argv[++i]);
+        } else {
+            files.push_back(string(argv[i]));
+        }
+    }
+
+    if (repeat < 1)
+        repeat = 1;
+
+    bool synthetic = files.empty();
+    if (synthetic) {
+        generateScript(SYNTHETIC_FILE, commands);
+        files.push_back(SYNTHETIC_FILE);
+    }
+
+    bool ok = true;
+    for (const auto& file : files) {
+        printf("%s (best of %ld runs)\n", file.c_str(), repeat);
+        printf("%-6s %13s %13s %13s %13s %13s\n",
+               "mode", "parse allocs", "parse ms", "transl allocs", "transl ms", "peak RSS KB");
+
+        ok = runMode(file, false, repeat) && ok;
+        ok = runMode(file, true, repeat) && ok;
+    }
+
+    if (synthetic)
+        remove(SYNTHETIC_FILE);
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,39 @@
+#include "bench_util.h"
+
+#include "parser/smtlib-glue.h"
+#include "parser/smtlib-bison-parser.y.h"
+#include "parser/smtlib_parser.h"
+
+using namespace std;
+using namespace smtlib;
+
+/** Scanner entry point, called by the generated parser */
+extern "C" int smt_yylex(SMT_YYSTYPE* lvalp, SMT_YYLTYPE* llocp, SmtScanner scanner);
+
+long scanTokens(vector<char>& buffer, size_t size) {
+    Parser parser;
+    SmtScanner scanner;
+    smt_yylex_init_extra(&parser, &scanner);
+    smt_yy_scan_buffer(buffer.data(), size + 2, scanner);
+    smt_yyset_lineno(1, scanner);
+    smt_yyset_column(0, scanner);
+
+    SMT_YYSTYPE value;
+    SMT_YYLTYPE location;
+    long tokens = 0;
+
+    while (true) {
+        value.ptr = nullptr;
+        if (smt_yylex(&value, &location, scanner) == 0)
+            break;
+
+        // Release the nodes created for literals, symbols and keywords
+        if (value.ptr)
+            parser.claimNode(value.ptr);
+
+        tokens++;
+    }
+
+    smt_yylex_destroy(scanner);
+    return tokens;
+}
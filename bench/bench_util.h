@@ -0,0 +1,57 @@
+/**
+ * \file bench_util.h
+ * \brief Helpers shared by the benchmarks.
+ */
+
+#ifndef SLCOMP_PARSER_BENCH_UTIL_H
+#define SLCOMP_PARSER_BENCH_UTIL_H
+
+#include <sys/resource.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+/** Write a script of roughly the given number of commands, in the shape of the SL-COMP benchmarks */
+inline void generateScript(const std::string& filename, long commands) {
+    std::ofstream out(filename);
+
+    out << "(set-logic SEPLOG)\n"
+        << "(declare-sort RefGTyp 0)\n"
+        << "(declare-datatypes ((GTyp 0)) (((c_GTyp (f0 RefGTyp) (f1 RefGTyp)))))\n"
+        << "(declare-heap (RefGTyp GTyp))\n"
+        << "(define-fun-rec RList ((x RefGTyp)(y RefGTyp)) Bool\n"
+        << "  (or (and (distinct (as nil RefGTyp) x) (pto x (c_GTyp y (as nil RefGTyp))))\n"
+        << "      (exists ((xp RefGTyp)) (and (distinct (as nil RefGTyp) xp)\n"
+        << "        (sep (pto x (c_GTyp xp (as nil RefGTyp))) (RList xp y))))))\n";
+
+    long vars = commands / 2;
+    for (long i = 0; i <= vars; i++) {
+        out << "(declare-const x" << i << " RefGTyp)\n";
+    }
+
+    for (long i = 0; i < vars; i++) {
+        out << "(assert (sep (pto x" << i << " (c_GTyp x" << i + 1 << " (as nil RefGTyp)))\n"
+            << "             (RList x" << i + 1 << " (as nil RefGTyp))\n"
+            << "             (wand (pto x" << i + 1 << " (c_GTyp x" << i << " x" << i << ")) (_ emp RefGTyp GTyp))))\n";
+    }
+
+    out << "(check-unsat)\n";
+}
+
+/** Peak resident set size of the process, in kilobytes */
+inline long peakRssKb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/**
+ * Split a buffer into tokens with the scanner alone, without parsing.
+ * \param buffer   Input, followed by two NUL characters, which the scanner may modify
+ * \param size     Size of the input, without the NUL characters
+ * \return Number of tokens
+ */
+long scanTokens(std::vector<char>& buffer, size_t size);
+
+#endif //SLCOMP_PARSER_BENCH_UTIL_H
@@ -0,0 +1,109 @@
+/**
+ * \file lex_bench.cpp
+ * \brief Lexer benchmark: scanning throughput on large inputs, without parsing.
+ *
+ * Usage: lex-bench [--repeat N] [--commands N] [file ...]
+ * Each input is loaded into memory and split into tokens by the scanner alone,
+ * and the benchmark reports the best scanning time, in MB/s and tokens/s.
+ * Without input files, a synthetic SL-COMP script with the given number of
+ * commands is generated in the working directory and scanned instead.
+ * Besides the commands, the synthetic script contains comments, string literals
+ * and quoted symbols spanning several lines.
+ */
+
+#include "bench_util.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    const char* SYNTHETIC_FILE = "lex-bench-synthetic.sl2";
+
+    /** Append comments, string literals and quoted symbols to a synthetic script */
+    void appendLexicalItems(const string& filename, long count) {
+        ofstream out(filename, ios::app);
+
+        for (long i = 0; i < count; i++) {
+            out << "; Comment " << i << ", which the scanner skips as a whole\n"
+                << "(set-info :source |\n"
+                << "  Quoted symbol " << i << ", spanning\n"
+                << "  several lines\n"
+                << "|)\n"
+                << "(echo \"String literal " << i << " with an \"\"escaped\"\" quote\")\n\n";
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    long repeat = 5;
+    long commands = 400000;
+    vector<string> files;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--commands") == 0 && i + 1 < argc) {
+            commands = atol(argv[++i]);
+        } else {
+            files.push_back(string(argv[i]));
+        }
+    }
+
+    if (repeat < 1)
+        repeat = 1;
+
+    bool synthetic = files.empty();
+    if (synthetic) {
+        generateScript(SYNTHETIC_FILE, commands);
+        appendLexicalItems(SYNTHETIC_FILE, commands / 10);
+        files.push_back(SYNTHETIC_FILE);
+    }
+
+    bool ok = true;
+    for (const auto& file : files) {
+        ifstream in(file, ios::binary);
+        if (!in) {
+            cerr << file << ": unable to read file" << endl;
+            ok = false;
+            continue;
+        }
+
+        vector<char> input((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+        size_t size = input.size();
+
+        double best = 0;
+        long tokens = 0;
+
+        for (long r = 0; r < repeat; r++) {
+            // The scanner needs a writable copy ending in two NUL characters
+            vector<char> buffer(input);
+            buffer.resize(size + 2, '\0');
+
+            auto start = chrono::steady_clock::now();
+            tokens = scanTokens(buffer, size);
+            chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+            if (r == 0 || elapsed.count() < best)
+                best = elapsed.count();
+        }
+
+        double mb = size / (1024.0 * 1024.0);
+        printf("%s: %.2f MB, %ld tokens, best %.2f ms over %ld runs, %.1f MB/s, %.2f Mtokens/s\n",
+               file.c_str(), mb, tokens, best * 1000, repeat,
+               best > 0 ? mb / best : 0.0, best > 0 ? tokens / best / 1e6 : 0.0);
+    }
+
+    if (synthetic)
+        remove(SYNTHETIC_FILE);
+
+    return ok ? 0 : 1;
+}
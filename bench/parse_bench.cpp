@@ -0,0 +1,79 @@
+/**
+ * \file parse_bench.cpp
+ * \brief Parser benchmark: parse time and peak memory on large scripts.
+ *
+ * Usage: parse-bench [--repeat N] [--commands N] [file ...]
+ * Without input files, a synthetic SL-COMP script with the given number of
+ * commands is generated in the working directory and parsed instead.
+ */
+
+#include "bench_util.h"
+
+#include "parser/smtlib_parser.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace smtlib;
+
+namespace {
+    const char* SYNTHETIC_FILE = "parse-bench-synthetic.sl2";
+}
+
+int main(int argc, char** argv) {
+    long repeat = 5;
+    long commands = 200000;
+    vector<string> files;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--commands") == 0 && i + 1 < argc) {
+            commands = atol(argv[++i]);
+        } else {
+            files.push_back(string(argv[i]));
+        }
+    }
+
+    bool synthetic = files.empty();
+    if (synthetic) {
+        generateScript(SYNTHETIC_FILE, commands);
+        files.push_back(SYNTHETIC_FILE);
+    }
+
+    for (const auto& file : files) {
+        double best = 0, total = 0;
+
+        for (long r = 0; r < repeat; r++) {
+            Parser parser;
+            auto start = chrono::steady_clock::now();
+            ast::NodePtr ast = parser.parse(file);
+            chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+
+            if (!ast) {
+                cerr << file << ": parsing failed" << endl;
+                return 1;
+            }
+
+            total += elapsed.count();
+            if (r == 0 || elapsed.count() < best)
+                best = elapsed.count();
+        }
+
+        printf("%s: best %.2f ms, mean %.2f ms over %ld runs\n",
+               file.c_str(), best, repeat > 0 ? total / repeat : 0.0, repeat);
+    }
+
+    printf("peak RSS: %ld KB\n", peakRssKb());
+
+    if (synthetic)
+        remove(SYNTHETIC_FILE);
+
+    return 0;
+}
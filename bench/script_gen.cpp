@@ -0,0 +1,77 @@
+/**
+ * \file script_gen.cpp
+ * \brief Generator of synthetic SL-COMP scripts, for scaling tests.
+ *
+ * Usage: script-gen [--logic SEPLOG|SEPLOGLIA] [--records N] [--heap-pairs N] [--fanout N]
+ *                   [--predicates N] [--constants N] [--assertions N] [--depth N]
+ *                   [--binders N] [--seed N] [--output FILE]
+ * Writes a script of the given shape (see ScriptShape) to the output file, or to the
+ * standard output. The same options always give the same script.
+ */
+
+#include "script_generator.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+int main(int argc, char** argv) {
+    ScriptShape shape;
+    string output;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+
+        if (strcmp(argv[i], "--logic") == 0 && hasValue) {
+            shape.logic = argv[++i];
+        } else if (strcmp(argv[i], "--records") == 0 && hasValue) {
+            shape.records = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--heap-pairs") == 0 && hasValue) {
+            shape.heapPairs = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--fanout") == 0 && hasValue) {
+            shape.fanout = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--predicates") == 0 && hasValue) {
+            shape.predicates = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--constants") == 0 && hasValue) {
+            shape.constants = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--assertions") == 0 && hasValue) {
+            shape.assertions = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--depth") == 0 && hasValue) {
+            shape.depth = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--binders") == 0 && hasValue) {
+            shape.binders = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && hasValue) {
+            shape.seed = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--output") == 0 && hasValue) {
+            output = argv[++i];
+        } else {
+            cerr << "Unknown option '" << argv[i] << "'" << endl;
+            return 2;
+        }
+    }
+
+    string error;
+    bool ok;
+
+    if (output.empty()) {
+        ok = writeScript(cout, shape, error);
+    } else {
+        ofstream out(output);
+        if (!out) {
+            cerr << output << ": unable to write file" << endl;
+            return 1;
+        }
+        ok = writeScript(out, shape, error);
+    }
+
+    if (!ok) {
+        cerr << "Invalid script shape: " << error << endl;
+        return 2;
+    }
+
+    return 0;
+}
@@ -0,0 +1,240 @@
+#include "script_generator.h"
+
+#include <random>
+#include <sstream>
+
+using namespace std;
+
+namespace {
+    /** Builds the commands of a script, once its shape has been validated */
+    class ScriptWriter {
+    private:
+        const ScriptShape& shape;
+        ostream& out;
+        mt19937 rng;
+        bool withInts;
+
+        long pick(long count) {
+            return (long) (rng() % (unsigned long) count);
+        }
+
+        string locSort(long pair) {
+            return "Ref" + to_string(pair);
+        }
+
+        string dataSort(long record) {
+            return "Rec" + to_string(record);
+        }
+
+        /** Sort of a location field of a record */
+        long fieldPair(long record, long field) {
+            return (record + field) % shape.heapPairs;
+        }
+
+        string constant(long pair) {
+            return "x" + to_string(pair) + "_" + to_string(pick(shape.constants));
+        }
+
+        string nil(long pair) {
+            return "(as nil " + locSort(pair) + ")";
+        }
+
+        string emp(long pair) {
+            return "(_ emp " + locSort(pair) + " " + dataSort(pair) + ")";
+        }
+
+        string predicate(long index) {
+            return "P" + to_string(index);
+        }
+
+        /** Heap pair over which a predicate is defined */
+        long predicatePair(long index) {
+            return index % shape.heapPairs;
+        }
+
+        /** Points-to term for a location of the given pair, with random fields */
+        string pto(long pair, const string& loc) {
+            stringstream ss;
+            ss << "(pto " << loc << " (c_" << dataSort(pair);
+            for (long k = 0; k < shape.fanout; k++) {
+                long target = fieldPair(pair, k);
+                ss << " " << (pick(4) == 0 ? nil(target) : constant(target));
+            }
+            if (withInts)
+                ss << " " << pick(100);
+            ss << "))";
+            return ss.str();
+        }
+
+        /** Random atomic formula, pointing from the given location if there is one */
+        string leaf(const string& loc) {
+            if (!loc.empty())
+                return pto(0, loc);
+
+            long pair = pick(shape.heapPairs);
+            long kind = pick(shape.predicates > 0 ? 8 : 5);
+
+            if (kind < 3)
+                return pto(pair, constant(pair));
+            if (kind == 3)
+                return emp(pair);
+            if (kind == 4)
+                return "(distinct " + constant(pair) + " " + constant(pair) + ")";
+
+            long index = pick(shape.predicates);
+            long predPair = predicatePair(index);
+            stringstream ss;
+            ss << "(" << predicate(index) << " " << constant(predPair) << " " << constant(predPair);
+            if (withInts)
+                ss << " " << pick(100);
+            ss << ")";
+            return ss.str();
+        }
+
+        /** Nested sep and wand terms, alternating at each level, with an atomic formula on the right */
+        string formula(long depth, const string& loc) {
+            if (depth == 0)
+                return leaf(loc);
+
+            const char* op = depth % 2 ? "sep" : "wand";
+            return string("(") + op + " " + formula(depth - 1, loc) + " " + leaf("") + ")";
+        }
+
+        /** Alternating exists and let binders around a formula, the innermost variable being used in it */
+        string bind(long level, const string& previous) {
+            if (level == shape.binders)
+                return formula(shape.depth, previous);
+
+            string var = (level % 2 ? "l" : "e") + to_string(level);
+            if (level % 2 == 0) {
+                return "(exists ((" + var + " " + locSort(0) + ")) "
+                       + bind(level + 1, var) + ")";
+            }
+
+            return "(let ((" + var + " " + previous + ")) " + bind(level + 1, var) + ")";
+        }
+
+        void writeDeclarations() {
+            out << "(set-logic " << shape.logic << ")\n\n";
+
+            for (long i = 0; i < shape.heapPairs; i++) {
+                out << "(declare-sort " << locSort(i) << " 0)\n";
+            }
+
+            out << "\n(declare-datatypes (";
+            for (long i = 0; i < shape.records; i++) {
+                out << "(" << dataSort(i) << " 0)";
+            }
+            out << ")\n  (";
+
+            for (long i = 0; i < shape.records; i++) {
+                out << "\n   ((c_" << dataSort(i);
+                for (long k = 0; k < shape.fanout; k++) {
+                    out << " (f" << i << "_" << k << " " << locSort(fieldPair(i, k)) << ")";
+                }
+                if (withInts)
+                    out << " (d" << i << " Int)";
+                out << "))";
+            }
+            out << "))\n\n";
+
+            out << "(declare-heap";
+            for (long i = 0; i < shape.heapPairs; i++) {
+                out << " (" << locSort(i) << " " << dataSort(i) << ")";
+            }
+            out << ")\n\n";
+        }
+
+        void writePredicates() {
+            if (shape.predicates == 0)
+                return;
+
+            out << "(define-funs-rec (";
+            for (long j = 0; j < shape.predicates; j++) {
+                long pair = predicatePair(j);
+                out << "\n  (" << predicate(j) << " ((x " << locSort(pair) << ") (y " << locSort(pair) << ")";
+                if (withInts)
+                    out << " (k Int)";
+                out << ") Bool)";
+            }
+            out << ")\n (";
+
+            for (long j = 0; j < shape.predicates; j++) {
+                long pair = predicatePair(j);
+
+                // The next predicate is called on the second field, if they are over the same location sort
+                long next = (j + 1) % shape.predicates;
+                bool callNext = shape.predicates > 1 && shape.fanout > 1
+                                && predicatePair(next) == fieldPair(pair, 1);
+
+                out << "\n  (or (and (= x y) " << emp(pair) << ")"
+                    << "\n      (exists (";
+                for (long k = 0; k < shape.fanout; k++) {
+                    out << "(n" << k << " " << locSort(fieldPair(pair, k)) << ")";
+                }
+                out << ")\n        (and (distinct x y)\n             (sep (pto x (c_" << dataSort(pair);
+                for (long k = 0; k < shape.fanout; k++) {
+                    out << " n" << k;
+                }
+                if (withInts)
+                    out << " k";
+                out << ")) (" << predicate(j) << " n0 y" << (withInts ? " (+ k 1)" : "") << ")";
+                if (callNext) {
+                    out << " (" << predicate(next) << " n1 " << nil(fieldPair(pair, 1))
+                        << (withInts ? " k" : "") << ")";
+                }
+                out << "))))";
+            }
+            out << "))\n\n";
+        }
+
+        void writeAssertions() {
+            for (long i = 0; i < shape.heapPairs; i++) {
+                for (long m = 0; m < shape.constants; m++) {
+                    out << "(declare-const x" << i << "_" << m << " " << locSort(i) << ")\n";
+                }
+            }
+            out << "\n";
+
+            for (long a = 0; a < shape.assertions; a++) {
+                out << "(assert " << bind(0, "") << ")\n";
+            }
+
+            out << "\n(check-unsat)\n";
+        }
+
+    public:
+        ScriptWriter(const ScriptShape& shape, ostream& out)
+                : shape(shape), out(out), rng((mt19937::result_type) shape.seed)
+                , withInts(shape.logic == "SEPLOGLIA") {}
+
+        void write() {
+            writeDeclarations();
+            writePredicates();
+            writeAssertions();
+        }
+    };
+}
+
+bool writeScript(ostream& out, const ScriptShape& shape, string& error) {
+    if (shape.logic != "SEPLOG" && shape.logic != "SEPLOGLIA")
+        error = "the logic must be SEPLOG or SEPLOGLIA";
+    else if (shape.records < 1)
+        error = "there must be at least one record";
+    else if (shape.heapPairs < 1 || shape.heapPairs > shape.records)
+        error = "the number of heap pairs must be between 1 and the number of records";
+    else if (shape.fanout < 1)
+        error = "the fan-out must be at least 1";
+    else if (shape.constants < 1)
+        error = "there must be at least one constant for each location sort";
+    else if (shape.predicates < 0 || shape.assertions < 0 || shape.depth < 0 || shape.binders < 0)
+        error = "the numbers of predicates and assertions, the depth and the binders cannot be negative";
+    else
+        error.clear();
+
+    if (!error.empty())
+        return false;
+
+    ScriptWriter(shape, out).write();
+    return true;
+}
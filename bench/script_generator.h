@@ -0,0 +1,54 @@
+/**
+ * \file script_generator.h
+ * \brief Generator of synthetic SL-COMP scripts, for scaling tests.
+ */
+
+#ifndef SLCOMP_PARSER_SCRIPT_GENERATOR_H
+#define SLCOMP_PARSER_SCRIPT_GENERATOR_H
+
+#include <ostream>
+#include <string>
+
+/** Shape of a generated script */
+struct ScriptShape {
+    /** Logic of the script, SEPLOG or SEPLOGLIA (which adds integer data to the records) */
+    std::string logic = "SEPLOG";
+
+    /** Number of record datatypes, each with its own location sort */
+    long records = 2;
+
+    /** Number of location-data pairs in the heap, one for each of the first records */
+    long heapPairs = 2;
+
+    /** Number of location fields of each record, which is also the number of pto arguments */
+    long fanout = 2;
+
+    /** Number of inductive predicates, all defined in one define-funs-rec */
+    long predicates = 2;
+
+    /** Number of constants declared for each location sort */
+    long constants = 8;
+
+    /** Number of assertions */
+    long assertions = 100;
+
+    /** Depth of the sep and wand terms in each assertion */
+    long depth = 3;
+
+    /** Depth of the exists and let binders around each assertion */
+    long binders = 1;
+
+    /** Seed for the choices made when building the assertions */
+    unsigned long seed = 1;
+};
+
+/**
+ * Write a script of the given shape.
+ * The script is well-sorted in its logic and only uses the location-data pairs of its heap,
+ * so it passes all checks.
+ * \param error   Set to the reason why the shape is invalid, if it is
+ * \return Whether the shape is valid (otherwise, nothing is written)
+ */
+bool writeScript(std::ostream& out, const ScriptShape& shape, std::string& error);
+
+#endif //SLCOMP_PARSER_SCRIPT_GENERATOR_H
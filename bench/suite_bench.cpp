@@ -0,0 +1,429 @@
+/**
+ * \file suite_bench.cpp
+ * \brief Benchmark suite: every stage of the pipeline, alone and as a whole.
+ *
+ * Usage: suite-bench [--repeat N] [--commands N] [--scripts DIR] [--filter TEXT]
+ *                    [--output FILE] [--compare FILE] [--tolerance PERCENT]
+ *
+ * Micro-benchmarks run each stage on its own, over a synthetic SL-COMP script with
+ * the given number of commands: the scanner, the parser, a bare traversal of the tree
+ * (through the visitors that share ownership of the nodes and through those that do not),
+ * the syntax check, the sortedness check, the translation to the sep representation (with and without hash-consing the terms)
+ * and the heap check. Every stage runs
+ * on the output of the previous one, which is prepared beforehand.
+ * Macro-benchmarks run all checks on each script in the scripts directory (input/Scripts
+ * by default) and on two synthetic scripts, one with the given number of commands and
+ * one four times larger, which are also checked one command at a time (as with --fused).
+ * Their messages are not printed.
+ *
+ * Each benchmark runs the given number of times and reports the best and median times,
+ * and the heap allocations of one run. The results are printed as a table and,
+ * with --output, written as JSON. With --compare, the median times are compared against
+ * those in a JSON file written by an earlier run, and the exit code is non-zero if any
+ * benchmark got slower by more than the tolerance (10% by default).
+ * The suite must run from the project directory, where the theory and logic files are.
+ */
+
+#include "bench_util.h"
+
+#include "ast/ast_script.h"
+#include "exec/execution.h"
+#include "sep/sep_script.h"
+#include "transl/sep_translator.h"
+#include "util/global_values.h"
+#include "util/logger.h"
+#include "util/resource_usage.h"
+#include "visitor/ast_sortedness_checker.h"
+#include "visitor/ast_syntax_checker.h"
+#include "visitor/ast_visitor.h"
+#include "visitor/sep_heap_checker.h"
+
+#include <dirent.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace slcompparser;
+using namespace smtlib;
+
+namespace {
+    const char* SYNTHETIC_FILE = "suite-bench-synthetic.sl2";
+    const char* LARGE_SYNTHETIC_FILE = "suite-bench-synthetic-large.sl2";
+
+    struct Options {
+        long repeat = 5;
+        long commands = 50000;
+        string scripts = "input/Scripts";
+        string filter;
+        string output;
+        string compare;
+        double tolerance = 10;
+    };
+
+    struct BenchResult {
+        string name;
+        long runs;
+        double bestMs;
+        double medianMs;
+        long long allocations;
+    };
+
+    /** Walks a tree through the visitors that share ownership of the nodes, without doing anything else */
+    class Traversal : public ast::DummyVisitor0 {
+    public:
+        void run(const ast::NodePtr& node) {
+            visit0(node);
+        }
+    };
+
+    /** Walks a tree through the visitors that do not share ownership of the nodes (see RawVisitor0) */
+    class RawTraversal : public ast::DummyRawVisitor0 {
+    public:
+        void run(const ast::NodePtr& node) {
+            visit0(node);
+        }
+    };
+
+    /**
+     * Run a benchmark the given number of times.
+     * \param run   Runs the benchmark once, returning whether it succeeded
+     */
+    bool runBench(const string& name, const Options& options,
+                  const function<bool()>& run, vector<BenchResult>& results) {
+        if (!options.filter.empty() && name.find(options.filter) == string::npos)
+            return true;
+
+        vector<double> times;
+        long long allocations = 0;
+
+        for (long r = 0; r < options.repeat; r++) {
+            ResourceUsage before = ResourceUsage::current();
+            bool success = run();
+            ResourceUsage after = ResourceUsage::current();
+
+            if (!success) {
+                cerr << name << ": failed" << endl;
+                return false;
+            }
+
+            times.push_back((after.wallNs - before.wallNs) / 1e6);
+            allocations = after.allocations - before.allocations;
+        }
+
+        sort(times.begin(), times.end());
+
+        BenchResult result;
+        result.name = name;
+        result.runs = (long) times.size();
+        result.bestMs = times.front();
+        result.medianMs = times[times.size() / 2];
+        result.allocations = allocations;
+        results.push_back(result);
+
+        printf("%-44s %8ld %12.3f %12.3f %14lld\n", name.c_str(), result.runs,
+               result.bestMs, result.medianMs, result.allocations);
+        fflush(stdout);
+
+        return true;
+    }
+
+    /** Run each stage on its own over a file */
+    bool runMicro(const string& file, const Options& options, vector<BenchResult>& results) {
+        ifstream in(file, ios::binary);
+        vector<char> input((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+        size_t size = input.size();
+        bool ok = true;
+
+        ok = runBench("micro/lex", options, [&] {
+            // The scanner needs a writable copy ending in two NUL characters
+            vector<char> buffer(input);
+            buffer.resize(size + 2, '\0');
+            return scanTokens(buffer, size) > 0;
+        }, results) && ok;
+
+        ok = runBench("micro/parse", options, [&] {
+            Parser parser;
+            return (bool) parser.parse(file);
+        }, results) && ok;
+
+        Parser parser;
+        ast::NodePtr ast = parser.parse(file);
+        ast::ScriptPtr script = ast::nodeCast<ast::Script>(ast);
+        if (!script) {
+            cerr << file << ": parsing failed" << endl;
+            return false;
+        }
+
+        ok = runBench("micro/traverse", options, [&] {
+            Traversal traversal;
+            traversal.run(ast);
+            return true;
+        }, results) && ok;
+
+        ok = runBench("micro/traverse-raw", options, [&] {
+            RawTraversal traversal;
+            traversal.run(ast);
+            return true;
+        }, results) && ok;
+
+        ok = runBench("micro/syntax", options, [&] {
+            ast::SyntaxCheckerPtr chk = make_shared<ast::SyntaxChecker>();
+            return chk->check(ast);
+        }, results) && ok;
+
+        ok = runBench("micro/sortedness", options, [&] {
+            ast::SortednessCheckerPtr chk = make_shared<ast::SortednessChecker>();
+            chk->loadTheory(THEORY_CORE);
+            return chk->check(ast);
+        }, results) && ok;
+
+        ok = runBench("micro/translate", options, [&] {
+            sep::Translator translator;
+            return (bool) translator.translate(script);
+        }, results) && ok;
+
+        ok = runBench("micro/translate-shared", options, [&] {
+            sep::Translator translator(nullptr, make_shared<sep::TermTable>());
+            return (bool) translator.translate(script);
+        }, results) && ok;
+
+        sep::Translator translator;
+        sep::ScriptPtr sepScript = translator.translate(script);
+
+        ok = runBench("micro/heap", options, [&] {
+            sep::HeapCheckerPtr chk = make_shared<sep::HeapChecker>();
+            return chk->check(sepScript);
+        }, results) && ok;
+
+        return ok;
+    }
+
+    /**
+     * Run all checks on a file, without printing their messages.
+     * \param fused    Whether each command goes through all checks before the next one
+     */
+    bool runMacro(const string& name, const string& file, const Options& options,
+                  vector<BenchResult>& results, bool fused = false) {
+        return runBench(name, options, [&] {
+            ExecutionSettingsPtr settings = make_shared<ExecutionSettings>();
+            settings->setInputFromFile(file);
+            settings->setFusedEnabled(fused);
+
+            // Scripts may contain errors on purpose, so only parsing errors count as failures
+            LogBuffer output;
+            Logger::setThreadBuffer(&output);
+            {
+                Execution exec(settings);
+                exec.checkHeap();
+            }
+            Logger::setThreadBuffer(nullptr);
+
+            return !output.hasParsingError();
+        }, results);
+    }
+
+    vector<string> listScripts(const string& dir) {
+        vector<string> files;
+
+        if (DIR* d = opendir(dir.c_str())) {
+            while (struct dirent* entry = readdir(d)) {
+                string name = entry->d_name;
+                if (name != "." && name != "..")
+                    files.push_back(dir + "/" + name);
+            }
+            closedir(d);
+        }
+
+        sort(files.begin(), files.end());
+        return files;
+    }
+
+    string escapeJson(const string& str) {
+        string result;
+        for (char c : str) {
+            if (c == '"' || c == '\\')
+                result += '\\';
+            result += c;
+        }
+        return result;
+    }
+
+    /** Write the results as JSON, one benchmark per line */
+    bool writeResults(const string& path, const vector<BenchResult>& results) {
+        ofstream out(path);
+        if (!out)
+            return false;
+
+        out << "{\"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); i++) {
+            const BenchResult& result = results[i];
+
+            char times[96];
+            snprintf(times, sizeof(times), "\"best_ms\": %.3f, \"median_ms\": %.3f",
+                     result.bestMs, result.medianMs);
+
+            out << "  {\"name\": \"" << escapeJson(result.name) << "\", \"runs\": " << result.runs
+                << ", " << times << ", \"allocations\": " << result.allocations << "}"
+                << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        out << "]}\n";
+
+        return (bool) out;
+    }
+
+    /** Find the string value of a field in a line of JSON written by writeResults() */
+    bool findString(const string& line, const string& field, string& value) {
+        string key = "\"" + field + "\": \"";
+        size_t start = line.find(key);
+        if (start == string::npos)
+            return false;
+
+        value.clear();
+        for (size_t i = start + key.size(); i < line.size(); i++) {
+            if (line[i] == '\\' && i + 1 < line.size()) {
+                value += line[++i];
+            } else if (line[i] == '"') {
+                return true;
+            } else {
+                value += line[i];
+            }
+        }
+
+        return false;
+    }
+
+    /** Find the numeric value of a field in a line of JSON written by writeResults() */
+    bool findNumber(const string& line, const string& field, double& value) {
+        string key = "\"" + field + "\": ";
+        size_t start = line.find(key);
+        if (start == string::npos)
+            return false;
+
+        value = atof(line.c_str() + start + key.size());
+        return true;
+    }
+
+    /** Read the median times of the benchmarks in a file written by writeResults() */
+    bool readBaseline(const string& path, map<string, double>& medians) {
+        ifstream in(path);
+        if (!in)
+            return false;
+
+        string line;
+        while (getline(in, line)) {
+            string name;
+            double median;
+            if (findString(line, "name", name) && findNumber(line, "median_ms", median))
+                medians[name] = median;
+        }
+
+        return true;
+    }
+
+    /**
+     * Compare the median times against a baseline.
+     * \return Whether no benchmark got slower by more than the tolerance
+     */
+    bool compareResults(const vector<BenchResult>& results,
+                        const map<string, double>& baseline, double tolerance) {
+        printf("\n%-44s %12s %12s %9s\n", "benchmark", "baseline ms", "current ms", "change");
+
+        bool ok = true;
+        for (const auto& result : results) {
+            auto it = baseline.find(result.name);
+            if (it == baseline.end()) {
+                printf("%-44s %12s %12.3f %9s\n", result.name.c_str(), "-", result.medianMs, "new");
+                continue;
+            }
+
+            double change = it->second > 0 ? (result.medianMs / it->second - 1) * 100 : 0;
+            bool regression = change > tolerance;
+            ok = ok && !regression;
+
+            printf("%-44s %12.3f %12.3f %+8.1f%%%s\n", result.name.c_str(), it->second,
+                   result.medianMs, change, regression ? "  REGRESSION" : "");
+        }
+
+        return ok;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            options.repeat = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--commands") == 0 && i + 1 < argc) {
+            options.commands = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--scripts") == 0 && i + 1 < argc) {
+            options.scripts = argv[++i];
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            options.output = argv[++i];
+        } else if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc) {
+            options.compare = argv[++i];
+        } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            options.tolerance = atof(argv[++i]);
+        } else {
+            cerr << "Unknown option '" << argv[i] << "'" << endl;
+            return 2;
+        }
+    }
+
+    if (options.repeat < 1)
+        options.repeat = 1;
+
+    map<string, double> baseline;
+    if (!options.compare.empty() && !readBaseline(options.compare, baseline)) {
+        cerr << options.compare << ": unable to read baseline" << endl;
+        return 2;
+    }
+
+    generateScript(SYNTHETIC_FILE, options.commands);
+    generateScript(LARGE_SYNTHETIC_FILE, options.commands * 4);
+
+    printf("%-44s %8s %12s %12s %14s\n", "benchmark", "runs", "best ms", "median ms", "allocations");
+
+    vector<BenchResult> results;
+    bool ok = runMicro(SYNTHETIC_FILE, options, results);
+
+    for (const auto& file : listScripts(options.scripts)) {
+        ok = runMacro("macro/" + file, file, options, results) && ok;
+    }
+
+    ok = runMacro("macro/synthetic-" + to_string(options.commands),
+                  SYNTHETIC_FILE, options, results) && ok;
+    ok = runMacro("macro/synthetic-" + to_string(options.commands * 4),
+                  LARGE_SYNTHETIC_FILE, options, results) && ok;
+    ok = runMacro("macro/synthetic-" + to_string(options.commands) + "-fused",
+                  SYNTHETIC_FILE, options, results, true) && ok;
+    ok = runMacro("macro/synthetic-" + to_string(options.commands * 4) + "-fused",
+                  LARGE_SYNTHETIC_FILE, options, results, true) && ok;
+
+    remove(SYNTHETIC_FILE);
+    remove(LARGE_SYNTHETIC_FILE);
+
+    if (!options.output.empty() && !writeResults(options.output, results)) {
+        cerr << options.output << ": unable to write results" << endl;
+        ok = false;
+    }
+
+    if (!options.compare.empty() && !compareResults(results, baseline, options.tolerance))
+        return 1;
+
+    return ok ? 0 : 2;
+}
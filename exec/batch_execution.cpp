@@ -0,0 +1,180 @@
+#include "batch_execution.h"
+
+#include "execution.h"
+#include "util/logger.h"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+using namespace slcompparser;
+
+namespace {
+    /** Files waiting to be checked by one thread, given by their index in the batch */
+    struct WorkQueue {
+        mutex lock;
+        deque<size_t> files;
+    };
+
+    /** Outcome of checking one file */
+    struct FileResult {
+        LogBuffer output;
+        bool success = false;
+        bool done = false;
+    };
+
+    /** State shared by the threads checking a batch */
+    struct BatchState {
+        vector<unique_ptr<WorkQueue>> queues;
+        vector<FileResult> results;
+
+        mutex resultLock;
+        condition_variable resultDone;
+
+        /** Files after this index are skipped, because the batch has ended before them */
+        atomic<size_t> lastFile;
+
+        explicit BatchState(size_t fileCount) : results(fileCount), lastFile(fileCount) {}
+
+        /** Stop checking the files after the given one */
+        void stopAfter(size_t file) {
+            size_t last = lastFile.load();
+            while (file < last && !lastFile.compare_exchange_weak(last, file));
+        }
+    };
+
+    long getFileSize(const string& path) {
+        struct stat info;
+        if (stat(path.c_str(), &info) != 0)
+            return 0;
+        return (long) info.st_size;
+    }
+
+    /**
+     * Take the next file for a thread, from its own queue or, if that is empty, from another queue.
+     * Files are taken from the front of all queues, so that the largest pending file is always started first.
+     */
+    bool takeFile(BatchState& state, size_t thread, size_t& file) {
+        size_t count = state.queues.size();
+
+        for (size_t i = 0; i < count; i++) {
+            WorkQueue& queue = *state.queues[(thread + i) % count];
+            lock_guard<mutex> lock(queue.lock);
+
+            if (!queue.files.empty()) {
+                file = queue.files.front();
+                queue.files.pop_front();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void checkFiles(BatchState& state, const ExecutionSettingsPtr& settings,
+                    const vector<string>& files, size_t thread) {
+        size_t file;
+        while (takeFile(state, thread, file)) {
+            FileResult& result = state.results[file];
+            bool success = false;
+
+            if (file <= state.lastFile) {
+                ExecutionSettingsPtr fileSettings = make_shared<ExecutionSettings>(settings);
+                fileSettings->setInputFromFile(files[file]);
+
+                Logger::setThreadBuffer(&result.output);
+                {
+                    Execution exec(fileSettings);
+                    success = exec.checkHeap();
+
+                    if (settings->isStatsEnabled())
+                        Logger::message(exec.getStats().toJson(files[file]).c_str());
+                }
+                Logger::setThreadBuffer(nullptr);
+
+                if (result.output.hasParsingError())
+                    state.stopAfter(file);
+            }
+
+            {
+                lock_guard<mutex> lock(state.resultLock);
+                result.success = success;
+                result.done = true;
+            }
+            state.resultDone.notify_all();
+        }
+    }
+}
+
+BatchExecution::BatchExecution(const ExecutionSettingsPtr& settings,
+                               vector<string> files, size_t jobs)
+        : settings(settings)
+        , files(std::move(files))
+        , jobs(jobs)
+        , parsingErrorFound(false) {}
+
+bool BatchExecution::checkHeap() {
+    parsingErrorFound = false;
+
+    if (files.empty())
+        return true;
+
+    size_t threadCount = std::max<size_t>(1, std::min(jobs, files.size()));
+    BatchState state(files.size());
+
+    // Deal the files largest first, so that long files do not end up being checked last
+    vector<long> sizes;
+    vector<size_t> order;
+    for (size_t i = 0; i < files.size(); i++) {
+        sizes.push_back(getFileSize(files[i]));
+        order.push_back(i);
+    }
+
+    stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return sizes[a] > sizes[b];
+    });
+
+    for (size_t i = 0; i < threadCount; i++) {
+        state.queues.emplace_back(new WorkQueue());
+    }
+
+    for (size_t i = 0; i < order.size(); i++) {
+        state.queues[i % threadCount]->files.push_back(order[i]);
+    }
+
+    vector<thread> threads;
+    for (size_t i = 0; i < threadCount; i++) {
+        threads.emplace_back(checkFiles, ref(state), cref(settings), cref(files), i);
+    }
+
+    // Print the output for each file as soon as the output for all the previous ones has been printed
+    bool success = true;
+    for (size_t i = 0; i < files.size(); i++) {
+        FileResult& result = state.results[i];
+        {
+            unique_lock<mutex> lock(state.resultLock);
+            state.resultDone.wait(lock, [&] { return result.done; });
+        }
+
+        result.output.flush();
+        success = success && result.success;
+
+        if (result.output.hasParsingError()) {
+            parsingErrorFound = true;
+            success = false;
+            break;
+        }
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    return success;
+}
@@ -0,0 +1,57 @@
+/**
+ * \file batch_execution.h
+ * \brief Execution handling for a batch of input files, checked in parallel.
+ */
+
+#ifndef SLCOMP_PARSER_BATCH_EXECUTION_H
+#define SLCOMP_PARSER_BATCH_EXECUTION_H
+
+#include "execution_settings.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace slcompparser {
+    /**
+     * Class handling the execution of a batch of input files over several threads.
+     * Each file is checked by its own Execution, while the theories and logics they load
+     * are shared by all threads (see LayerCache).
+     * Files are scheduled largest first: they are dealt in this order to the queues of the threads,
+     * and a thread whose queue runs empty steals the next file from the queues of the others.
+     * The output for each file is captured and printed in the order of the input files,
+     * as if the files had been checked one after another.
+     */
+    class BatchExecution {
+    private:
+        ExecutionSettingsPtr settings;
+        std::vector<std::string> files;
+        size_t jobs;
+
+        bool parsingErrorFound;
+
+    public:
+        /**
+         * \param settings  Settings for each file (the input is set separately for each of them)
+         * \param files     Input files
+         * \param jobs      Number of threads
+         */
+        BatchExecution(const ExecutionSettingsPtr& settings,
+                       std::vector<std::string> files, size_t jobs);
+
+        /**
+         * Check the heap constraints of all input files (see Execution::checkHeap()).
+         * As when the files are checked one after another, a parsing error ends the batch:
+         * the output is printed up to the error and the remaining files are skipped.
+         * \return Whether the checks succeeded for all files
+         */
+        bool checkHeap();
+
+        /** Whether the batch was ended by a parsing error */
+        inline bool hasParsingError() { return parsingErrorFound; }
+    };
+
+    typedef std::shared_ptr<BatchExecution> BatchExecutionPtr;
+}
+
+#endif //SLCOMP_PARSER_BATCH_EXECUTION_H
@@ -4,6 +4,7 @@
 #include "sep/sep_script.h"
 #include "transl/sep_translator.h"
 #include "util/global_values.h"
+#include "util/thread_pool.h"
 #include "visitor/ast_syntax_checker.h"
 #include "visitor/ast_sortedness_checker.h"
 #include "visitor/sep_heap_checker.h"
@@ -15,6 +16,48 @@ using namespace slcompparser;
 using namespace smtlib;
 using namespace smtlib::ast;
 
+namespace {
+    /** Body of a command checked in parallel, on a snapshot of the stack taken before the command */
+    template<class Cmd, class Snapshot>
+    struct ParallelBody {
+        /** Index of the command in the script */
+        size_t index;
+
+        std::shared_ptr<Cmd> cmd;
+        std::shared_ptr<const Snapshot> snapshot;
+    };
+
+    /** Whether the checks may keep nodes of a command once it is checked (e.g. in the symbol stack) */
+    bool isDeclaration(const CommandPtr& cmd) {
+        switch (cmd->getKind()) {
+            case NodeKind::ASSERT_COMMAND:
+            case NodeKind::CHECK_SAT_COMMAND:
+            case NodeKind::CHECK_UNSAT_COMMAND:
+            case NodeKind::CHECK_SAT_ASSUM_COMMAND:
+            case NodeKind::ECHO_COMMAND:
+            case NodeKind::EXIT_COMMAND:
+            case NodeKind::GET_ASSERTS_COMMAND:
+            case NodeKind::GET_ASSIGNS_COMMAND:
+            case NodeKind::GET_INFO_COMMAND:
+            case NodeKind::GET_MODEL_COMMAND:
+            case NodeKind::GET_OPTION_COMMAND:
+            case NodeKind::GET_PROOF_COMMAND:
+            case NodeKind::GET_UNSAT_ASSUMS_COMMAND:
+            case NodeKind::GET_UNSAT_CORE_COMMAND:
+            case NodeKind::GET_VALUE_COMMAND:
+            case NodeKind::POP_COMMAND:
+            case NodeKind::PUSH_COMMAND:
+            case NodeKind::RESET_COMMAND:
+            case NodeKind::RESET_ASSERTS_COMMAND:
+            case NodeKind::SET_INFO_COMMAND:
+            case NodeKind::SET_OPTION_COMMAND:
+                return false;
+            default:
+                return true;
+        }
+    }
+}
+
 Execution::Execution()
         : settings(make_shared<ExecutionSettings>()) {
     parseAttempted = false;
@@ -23,6 +66,8 @@ Execution::Execution()
     syntaxCheckSuccessful = false;
     sortednessCheckAttempted = false;
     sortednessCheckSuccessful = false;
+    heapCheckAttempted = false;
+    heapCheckSuccessful = false;
 }
 
 Execution::Execution(const ExecutionSettingsPtr& settings)
@@ -36,10 +81,17 @@ Execution::Execution(const ExecutionSettingsPtr& settings)
         parseSuccessful = false;
     }
 
+    if (settings->isArenaEnabled())
+        arena = make_shared<Arena>();
+
+    stats.setEnabled(settings->isStatsEnabled());
+
     syntaxCheckAttempted = false;
     syntaxCheckSuccessful = false;
     sortednessCheckAttempted = false;
     sortednessCheckSuccessful = false;
+    heapCheckAttempted = false;
+    heapCheckSuccessful = false;
 }
 
 bool Execution::parse() {
@@ -54,8 +106,12 @@ bool Execution::parse() {
     }
 
     if (settings->getInputMethod() == ExecutionSettings::InputMethod::INPUT_FILE) {
+        ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_PARSE);
+
         ParserPtr parser = make_shared<Parser>();
+        parser->setArena(arena);
         ast = parser->parse(settings->getInputFile());
+        sources = parser->getSourceMap();
         if (ast) {
             parseSuccessful = true;
         } else {
@@ -77,6 +133,8 @@ bool Execution::checkSyntax() {
         return false;
     }
 
+    ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_SYNTAX);
+
     SyntaxCheckerPtr chk = make_shared<SyntaxChecker>();
     syntaxCheckSuccessful = chk->check(ast);
 
@@ -92,6 +150,28 @@ bool Execution::checkSyntax() {
     return syntaxCheckSuccessful;
 }
 
+SortednessCheckerPtr Execution::createSortednessChecker() {
+    SortednessCheckerPtr chk;
+
+    if (settings->getSortCheckContext())
+        chk = make_shared<SortednessChecker>(settings->getSortCheckContext());
+    else
+        chk = make_shared<SortednessChecker>();
+
+    if (settings->isCoreTheoryEnabled())
+        chk->loadTheory(THEORY_CORE);
+
+    return chk;
+}
+
+sep::TranslatorPtr Execution::createTranslator(const ArenaPtr& arena) {
+    sep::TermTablePtr terms;
+    if (settings->isTermSharingEnabled())
+        terms = make_shared<sep::TermTable>();
+
+    return make_shared<sep::Translator>(arena, terms);
+}
+
 bool Execution::checkSortedness() {
     if (sortednessCheckAttempted)
         return sortednessCheckSuccessful;
@@ -103,15 +183,9 @@ bool Execution::checkSortedness() {
         return false;
     }
 
-    SortednessCheckerPtr chk;
+    ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_SORTEDNESS);
 
-    if (settings->getSortCheckContext())
-        chk = make_shared<SortednessChecker>(settings->getSortCheckContext());
-    else
-        chk = make_shared<SortednessChecker>();
-
-    if (settings->isCoreTheoryEnabled())
-        chk->loadTheory(THEORY_CORE);
+    SortednessCheckerPtr chk = createSortednessChecker();
     sortednessCheckSuccessful = chk->check(ast);
 
     if (!sortednessCheckSuccessful) {
@@ -130,6 +204,18 @@ bool Execution::checkHeap() {
     if (heapCheckAttempted)
         return heapCheckSuccessful;
 
+    if (settings->isStreamingEnabled()
+        && settings->getInputMethod() == ExecutionSettings::InputMethod::INPUT_FILE) {
+        return checkStreaming();
+    }
+
+    // Parallel and fused checking need a script, whose commands they go through
+    if (settings->getJobs() > 1 && parse() && nodeCast<Script>(ast))
+        return checkParallel();
+
+    if (settings->isFusedEnabled() && parse() && nodeCast<Script>(ast))
+        return checkFused();
+
     heapCheckAttempted = true;
 
     if (!checkSortedness()) {
@@ -137,11 +223,16 @@ bool Execution::checkHeap() {
         return false;
     }
 
-    ast::ScriptPtr astScript = dynamic_pointer_cast<Script>(ast);
+    ast::ScriptPtr astScript = nodeCast<Script>(ast);
     if (astScript) {
-        sep::TranslatorPtr transl = make_shared<sep::Translator>();
-        sep::ScriptPtr sepScript = transl->translate(astScript);
+        sep::ScriptPtr sepScript;
+        {
+            ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_TRANSLATION);
+            sep::TranslatorPtr transl = createTranslator(arena);
+            sepScript = transl->translate(astScript);
+        }
 
+        ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_HEAP);
         sep::HeapCheckerPtr checker = make_shared<sep::HeapChecker>();
         heapCheckSuccessful = checker->check(sepScript);
 
@@ -152,3 +243,363 @@ bool Execution::checkHeap() {
 
     return heapCheckSuccessful;
 }
+
+bool Execution::checkStreaming() {
+    if (heapCheckAttempted)
+        return heapCheckSuccessful;
+
+    parseAttempted = true;
+    syntaxCheckAttempted = true;
+    sortednessCheckAttempted = true;
+    heapCheckAttempted = true;
+
+    if (settings->getInputMethod() != ExecutionSettings::InputMethod::INPUT_FILE) {
+        Logger::error("SmtExecution::checkStreaming()", "No input file provided");
+        return false;
+    }
+
+    string file = settings->getInputFile();
+
+    SyntaxCheckerPtr syntaxChk = make_shared<SyntaxChecker>();
+
+    SortednessCheckerPtr sortChk;
+    {
+        ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_SORTEDNESS);
+        sortChk = createSortednessChecker();
+    }
+
+    // No arena or term table here: they would keep every command alive until the end of the file
+    sep::TranslatorPtr transl = make_shared<sep::Translator>();
+    sep::HeapCheckerPtr heapChk = make_shared<sep::HeapChecker>();
+
+    syntaxCheckSuccessful = true;
+    sortednessCheckSuccessful = true;
+    heapCheckSuccessful = true;
+
+    ParserPtr parser = make_shared<Parser>();
+    parser->setCommandHandler([&](const CommandPtr& cmd) {
+        NodePtr node = cmd;
+
+        // Only the spans of the commands the checks may keep are needed past the command
+        if (!isDeclaration(cmd))
+            parser->releaseCommandSpans();
+
+        {
+            ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_SYNTAX);
+            if (!syntaxChk->check(node)) {
+                syntaxCheckSuccessful = false;
+                Logger::syntaxError("SmtExecution::checkStreaming()",
+                                    file.c_str(), syntaxChk->getErrors().c_str());
+                syntaxChk->clearErrors();
+            }
+        }
+
+        if (!syntaxCheckSuccessful)
+            return;
+
+        {
+            ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_SORTEDNESS);
+            if (!sortChk->check(node)) {
+                sortednessCheckSuccessful = false;
+                Logger::sortednessError("SmtExecution::checkStreaming()",
+                                        file.c_str(), sortChk->getErrors().c_str());
+                sortChk->clearErrors();
+            }
+        }
+
+        if (!sortednessCheckSuccessful)
+            return;
+
+        sep::CommandPtr sepCmd;
+        {
+            ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_TRANSLATION);
+            sepCmd = transl->translate(cmd);
+        }
+
+        ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_HEAP);
+        if (!heapChk->check(sepCmd)) {
+            heapCheckSuccessful = false;
+            Logger::heapError("SmtExecution::checkStreaming()", heapChk->getErrors().c_str());
+            heapChk->clearErrors();
+        }
+    });
+
+    // The checks run by the command handler are counted separately from the parsing itself
+    {
+        ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_PARSE);
+        ast = parser->parse(file);
+        sources = parser->getSourceMap();
+    }
+
+    parseSuccessful = (bool) ast;
+
+    // As in the non-streaming checks, a check only succeeds if the previous ones did
+    syntaxCheckSuccessful = syntaxCheckSuccessful && parseSuccessful;
+    sortednessCheckSuccessful = sortednessCheckSuccessful && syntaxCheckSuccessful;
+    heapCheckSuccessful = heapCheckSuccessful && sortednessCheckSuccessful;
+
+    return heapCheckSuccessful;
+}
+
+bool Execution::checkFused() {
+    if (heapCheckAttempted)
+        return heapCheckSuccessful;
+
+    syntaxCheckAttempted = true;
+    sortednessCheckAttempted = true;
+    heapCheckAttempted = true;
+
+    if (!parse()) {
+        //Logger::error("SmtExecution::checkFused()", "Stopped due to previous errors");
+        return false;
+    }
+
+    ast::ScriptPtr astScript = nodeCast<Script>(ast);
+    if (!astScript) {
+        Logger::error("SmtExecution::checkFused()", "The input is not a script");
+        return false;
+    }
+
+    SyntaxCheckerPtr syntaxChk = make_shared<SyntaxChecker>();
+
+    SortednessCheckerPtr sortChk;
+    {
+        ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_SORTEDNESS);
+        sortChk = createSortednessChecker();
+    }
+
+    sep::TranslatorPtr transl = createTranslator(arena);
+    sep::HeapCheckerPtr heapChk = make_shared<sep::HeapChecker>();
+
+    syntaxCheckSuccessful = true;
+    sortednessCheckSuccessful = true;
+    heapCheckSuccessful = true;
+
+    // The errors of each check accumulate over the commands, and stop mattering once an earlier check fails
+    for (const auto& cmd : astScript->commands) {
+        NodePtr node = cmd;
+
+        {
+            ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_SYNTAX);
+            syntaxCheckSuccessful = syntaxChk->check(node) && syntaxCheckSuccessful;
+        }
+
+        if (!syntaxCheckSuccessful)
+            continue;
+
+        {
+            ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_SORTEDNESS);
+            sortednessCheckSuccessful = sortChk->check(node) && sortednessCheckSuccessful;
+        }
+
+        if (!sortednessCheckSuccessful)
+            continue;
+
+        sep::CommandPtr sepCmd;
+        {
+            ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_TRANSLATION);
+            sepCmd = transl->translate(cmd);
+        }
+
+        ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_HEAP);
+        heapCheckSuccessful = heapChk->check(sepCmd) && heapCheckSuccessful;
+    }
+
+    sortednessCheckSuccessful = sortednessCheckSuccessful && syntaxCheckSuccessful;
+    heapCheckSuccessful = heapCheckSuccessful && sortednessCheckSuccessful;
+
+    bool fromAst = settings->getInputMethod() == ExecutionSettings::InputMethod::INPUT_AST;
+
+    if (!syntaxCheckSuccessful) {
+        if (fromAst) {
+            Logger::syntaxError("SmtExecution::checkFused()", syntaxChk->getErrors().c_str());
+        } else {
+            Logger::syntaxError("SmtExecution::checkFused()",
+                                settings->getInputFile().c_str(), syntaxChk->getErrors().c_str());
+        }
+    } else if (!sortednessCheckSuccessful) {
+        if (fromAst) {
+            Logger::sortednessError("SmtExecution::checkFused()", sortChk->getErrors().c_str());
+        } else {
+            Logger::sortednessError("SmtExecution::checkFused()",
+                                    settings->getInputFile().c_str(), sortChk->getErrors().c_str());
+        }
+    } else if (!heapCheckSuccessful) {
+        Logger::heapError("SmtExecution::checkFused()", heapChk->getErrors().c_str());
+    }
+
+    return heapCheckSuccessful;
+}
+
+bool Execution::checkParallel() {
+    if (heapCheckAttempted)
+        return heapCheckSuccessful;
+
+    sortednessCheckAttempted = true;
+    heapCheckAttempted = true;
+
+    if (!parse()) {
+        //Logger::error("SmtExecution::checkParallel()", "Stopped due to previous errors");
+        return false;
+    }
+
+    ast::ScriptPtr astScript = nodeCast<Script>(ast);
+    if (!astScript) {
+        Logger::error("SmtExecution::checkParallel()", "The input is not a script");
+        return false;
+    }
+
+    const vector<CommandPtr>& commands = astScript->commands;
+    size_t count = commands.size();
+
+    ThreadPool pool(settings->getJobs());
+
+    {
+        ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_SORTEDNESS);
+
+        // The checker goes through the commands, passing on their bodies, and then gathers all errors
+        SortednessCheckerPtr chk = createSortednessChecker();
+        vector<SortednessChecker::ErrorMap> cmdErrors(count);
+
+        typedef ParallelBody<Command, SymbolSnapshot> Body;
+        vector<Body> bodies;
+        size_t index = 0;
+
+        chk->setBodyHandler([&](const CommandPtr& cmd) {
+            bodies.push_back(Body { index, cmd, chk->getStack()->snapshot() });
+        });
+
+        for (index = 0; index < count; index++) {
+            NodePtr node = commands[index];
+            chk->check(node);
+            cmdErrors[index] = chk->takeErrors();
+        }
+
+        chk->setBodyHandler(SortednessChecker::BodyHandler());
+
+        vector<SortednessCheckerPtr> workers(pool.getSize());
+        vector<SortednessChecker::ErrorMap> bodyErrors(bodies.size());
+
+        pool.run(bodies.size(), [&](size_t i, size_t thread) {
+            SortednessCheckerPtr& worker = workers[thread];
+            if (!worker)
+                worker = make_shared<SortednessChecker>();
+
+            worker->getStack()->restore(bodies[i].snapshot);
+            worker->checkBody(bodies[i].cmd);
+            bodyErrors[i] = worker->takeErrors();
+        });
+
+        // The errors in the body of a command follow those found for the rest of it
+        sortednessCheckSuccessful = true;
+        for (size_t i = 0, j = 0; i < count; i++) {
+            sortednessCheckSuccessful = sortednessCheckSuccessful && cmdErrors[i].empty();
+            chk->addErrors(cmdErrors[i]);
+
+            for (; j < bodies.size() && bodies[j].index == i; j++) {
+                sortednessCheckSuccessful = sortednessCheckSuccessful && bodyErrors[j].empty();
+                chk->addErrors(bodyErrors[j]);
+            }
+        }
+
+        if (!sortednessCheckSuccessful) {
+            if (settings->getInputMethod() == ExecutionSettings::InputMethod::INPUT_AST) {
+                Logger::sortednessError("SmtExecution::checkParallel()", chk->getErrors().c_str());
+            } else {
+                Logger::sortednessError("SmtExecution::checkParallel()",
+                                        settings->getInputFile().c_str(), chk->getErrors().c_str());
+            }
+
+            return false;
+        }
+    }
+
+    vector<sep::CommandPtr> sepCommands(count);
+    {
+        ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_TRANSLATION);
+
+        // Each thread has its own translator, and the calling thread keeps using the arena of the parser
+        vector<sep::TranslatorPtr> translators(pool.getSize());
+        vector<LogBuffer> outputs(count);
+
+        ThreadPool::Iteration translate = [&](size_t i, size_t thread) {
+            sep::TranslatorPtr& transl = translators[thread];
+            if (!transl) {
+                ArenaPtr threadArena = arena;
+                if (arena && thread != 0)
+                    threadArena = make_shared<Arena>();
+                transl = createTranslator(threadArena);
+            }
+
+            LogBuffer* previous = Logger::getThreadBuffer();
+            Logger::setThreadBuffer(&outputs[i]);
+            sepCommands[i] = transl->translate(commands[i]);
+            Logger::setThreadBuffer(previous);
+        };
+
+        // Shared terms are reported at their first occurrence, so they go into a single table,
+        // in the order of the commands
+        if (settings->isTermSharingEnabled()) {
+            for (size_t i = 0; i < count; i++) {
+                translate(i, 0);
+            }
+        } else {
+            pool.run(count, translate);
+        }
+
+        for (auto& output : outputs) {
+            output.flush();
+        }
+    }
+
+    ExecutionStats::Scope scope(stats, ExecutionStats::PHASE_HEAP);
+
+    // As for the sortedness check, the checker goes through the commands and gathers all errors
+    sep::HeapCheckerPtr heapChk = make_shared<sep::HeapChecker>();
+    vector<vector<sep::HeapChecker::NodeErrorPtr>> cmdErrors(count);
+
+    typedef ParallelBody<sep::Command, sep::SymbolSnapshot> Body;
+    vector<Body> bodies;
+
+    for (size_t i = 0; i < count; i++) {
+        const sep::CommandPtr& cmd = sepCommands[i];
+        if (!cmd)
+            continue;
+
+        if (sep::nodeCast<sep::AssertCommand>(cmd) && heapChk->getStack()->getDepth() == 0) {
+            bodies.push_back(Body { i, cmd, heapChk->getStack()->snapshot() });
+        } else {
+            heapChk->check(cmd);
+            cmdErrors[i] = heapChk->takeErrors();
+        }
+    }
+
+    vector<sep::HeapCheckerPtr> workers(pool.getSize());
+    vector<vector<sep::HeapChecker::NodeErrorPtr>> bodyErrors(bodies.size());
+
+    pool.run(bodies.size(), [&](size_t i, size_t thread) {
+        sep::HeapCheckerPtr& worker = workers[thread];
+        if (!worker)
+            worker = make_shared<sep::HeapChecker>();
+
+        worker->getStack()->restore(bodies[i].snapshot);
+        worker->check(bodies[i].cmd);
+        bodyErrors[i] = worker->takeErrors();
+    });
+
+    for (size_t i = 0; i < bodies.size(); i++) {
+        cmdErrors[bodies[i].index] = std::move(bodyErrors[i]);
+    }
+
+    heapCheckSuccessful = true;
+    for (const auto& errs : cmdErrors) {
+        heapCheckSuccessful = heapCheckSuccessful && errs.empty();
+        heapChk->addErrors(errs);
+    }
+
+    if (!heapCheckSuccessful) {
+        Logger::heapError("SmtExecution::checkParallel()", heapChk->getErrors().c_str());
+    }
+
+    return heapCheckSuccessful;
+}
@@ -7,8 +7,12 @@
 #define SLCOMP_PARSER_EXECUTION_H
 
 #include "execution_settings.h"
+#include "execution_stats.h"
 
 #include "parser/smtlib_parser.h"
+#include "transl/sep_translator.h"
+#include "visitor/ast_sortedness_checker.h"
+#include "util/arena.h"
 #include "util/global_typedef.h"
 
 #include <memory>
@@ -20,11 +24,26 @@ namespace slcompparser {
         ExecutionSettingsPtr settings;
         smtlib::ast::NodePtr ast;
 
+        /** Arena shared by the nodes created during this execution, if enabled */
+        ArenaPtr arena;
+
+        /** Source spans of the nodes parsed during this execution, released with it */
+        SourceMapPtr sources;
+
+        /** Resources used by each phase, if enabled in the settings */
+        ExecutionStats stats;
+
         bool parseAttempted, parseSuccessful;
         bool syntaxCheckAttempted, syntaxCheckSuccessful;
         bool sortednessCheckAttempted, sortednessCheckSuccessful;
         bool heapCheckAttempted, heapCheckSuccessful;
 
+        /** Create a sortedness checker according to the settings */
+        smtlib::ast::SortednessCheckerPtr createSortednessChecker();
+
+        /** Create a translator to the sep representation according to the settings, using the given arena (if any) */
+        smtlib::sep::TranslatorPtr createTranslator(const ArenaPtr& arena);
+
     public:
         /** Execution instance with default settings */
         Execution();
@@ -41,7 +60,51 @@ namespace slcompparser {
         /** Check the sortedness of an input file */
         bool checkSortedness();
 
+        /**
+         * Check the heap constraints of an input file.
+         * If streaming is enabled, this runs all checks one command at a time (see checkStreaming()).
+         * Otherwise, if several jobs are set, this checks the commands of the parsed script in parallel
+         * (see checkParallel()). Otherwise, if fused checking is enabled, this runs all checks one command
+         * at a time on the parsed script (see checkFused())
+         */
         bool checkHeap();
+
+        /**
+         * Parse an input file and run all checks one command at a time.
+         * Each top-level command goes through the syntax, sortedness and heap checks
+         * as soon as it is parsed, and is released afterwards.
+         * Errors are reported as they are found.
+         * Once a check fails, the subsequent checks are skipped for the rest of the file.
+         */
+        bool checkStreaming();
+
+        /**
+         * Parse an input file and run all checks one command at a time on the parsed script.
+         * Each top-level command goes through the syntax, sortedness and heap checks
+         * before the next one, while its nodes are still in the cache, and its translation
+         * is released afterwards.
+         * Errors are reported once all commands are checked, as the separate checks would
+         * report them: a check only runs (and reports its errors) if the previous ones succeeded.
+         */
+        bool checkFused();
+
+        /**
+         * Parse an input file and run the sortedness check, the translation and the heap check
+         * of the parsed script over several threads (see ExecutionSettings::getJobs()).
+         * In each check, the commands are gone through in order, building the symbol stack,
+         * while the bodies of assertions (and, in the sortedness check, of function definitions)
+         * are checked in parallel, each on a snapshot of the stack taken before its command
+         * (see SymbolStack::snapshot()). Commands are translated in parallel.
+         * Errors are merged back in the order of the commands, so that they are reported
+         * exactly as the separate checks would report them.
+         */
+        bool checkParallel();
+
+        /** Get the source spans of the parsed nodes, which need to be kept as long as the nodes are used */
+        inline const SourceMapPtr& getSourceMap() { return sources; }
+
+        /** Get the resources used by each phase so far (collected only if enabled in the settings) */
+        inline const ExecutionStats& getStats() { return stats; }
     };
 
     typedef std::shared_ptr<Execution> ExecutionPtr;
@@ -7,10 +7,22 @@ using namespace smtlib::ast;
 
 ExecutionSettings::ExecutionSettings()
         : coreTheoryEnabled(true)
+        , streamingEnabled(false)
+        , fusedEnabled(false)
+        , arenaEnabled(false)
+        , termSharingEnabled(false)
+        , statsEnabled(false)
+        , jobs(1)
         , inputMethod(INPUT_NONE) {}
 
 ExecutionSettings::ExecutionSettings(const ExecutionSettingsPtr& settings) {
     this->coreTheoryEnabled = settings->coreTheoryEnabled;
+    this->streamingEnabled = settings->streamingEnabled;
+    this->fusedEnabled = settings->fusedEnabled;
+    this->arenaEnabled = settings->arenaEnabled;
+    this->termSharingEnabled = settings->termSharingEnabled;
+    this->statsEnabled = settings->statsEnabled;
+    this->jobs = settings->jobs;
     this->inputMethod = settings->inputMethod;
     this->filename = settings->filename;
     this->ast = settings->ast;
@@ -25,6 +25,12 @@ namespace slcompparser {
         };
     private:
         bool coreTheoryEnabled;
+        bool streamingEnabled;
+        bool fusedEnabled;
+        bool arenaEnabled;
+        bool termSharingEnabled;
+        bool statsEnabled;
+        size_t jobs;
         std::string filename;
 
         smtlib::ast::NodePtr ast;
@@ -46,6 +52,51 @@ namespace slcompparser {
         inline void setCoreTheoryEnabled(bool enabled) { coreTheoryEnabled = enabled; }
 
 
+        /** Whether input files are parsed and checked one command at a time */
+        inline bool isStreamingEnabled() { return streamingEnabled; }
+
+        /** Set whether input files are parsed and checked one command at a time */
+        inline void setStreamingEnabled(bool enabled) { streamingEnabled = enabled; }
+
+
+        /** Whether each command of a parsed script goes through all checks before the next one */
+        inline bool isFusedEnabled() { return fusedEnabled; }
+
+        /** Set whether each command of a parsed script goes through all checks before the next one */
+        inline void setFusedEnabled(bool enabled) { fusedEnabled = enabled; }
+
+
+        /** Whether the AST and sep nodes are allocated from an arena (not used when streaming) */
+        inline bool isArenaEnabled() { return arenaEnabled; }
+
+        /** Set whether the AST and sep nodes are allocated from an arena */
+        inline void setArenaEnabled(bool enabled) { arenaEnabled = enabled; }
+
+
+        /** Whether equal sep terms are hash-consed into shared nodes (not used when streaming) */
+        inline bool isTermSharingEnabled() { return termSharingEnabled; }
+
+        /** Set whether equal sep terms are hash-consed into shared nodes */
+        inline void setTermSharingEnabled(bool enabled) { termSharingEnabled = enabled; }
+
+
+        /** Whether statistics are collected for each phase of the execution (see ExecutionStats) */
+        inline bool isStatsEnabled() { return statsEnabled; }
+
+        /** Set whether statistics are collected for each phase of the execution */
+        inline void setStatsEnabled(bool enabled) { statsEnabled = enabled; }
+
+
+        /**
+         * Number of threads checking the commands of a script in parallel (see Execution::checkParallel()),
+         * or 1 if they are checked one after another
+         */
+        inline size_t getJobs() { return jobs; }
+
+        /** Set the number of threads checking the commands of a script in parallel */
+        inline void setJobs(size_t jobs) { this->jobs = jobs; }
+
+
         /** Get the input method */
         inline InputMethod getInputMethod() { return inputMethod; }
 
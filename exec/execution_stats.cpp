@@ -0,0 +1,110 @@
+#include "execution_stats.h"
+
+#include <cstdio>
+#include <sstream>
+
+using namespace std;
+using namespace slcompparser;
+
+namespace {
+    /** Escape a string for a JSON string literal */
+    string escapeJson(const string& str) {
+        stringstream ss;
+        for (char c : str) {
+            switch (c) {
+                case '"': ss << "\\\""; break;
+                case '\\': ss << "\\\\"; break;
+                case '\n': ss << "\\n"; break;
+                case '\r': ss << "\\r"; break;
+                case '\t': ss << "\\t"; break;
+                default:
+                    if ((unsigned char) c < 0x20) {
+                        char buffer[8];
+                        snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                        ss << buffer;
+                    } else {
+                        ss << c;
+                    }
+            }
+        }
+        return ss.str();
+    }
+
+    /** Format a duration given in nanoseconds as milliseconds */
+    string formatMs(long long ns) {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.3f", ns / 1e6);
+        return buffer;
+    }
+}
+
+ExecutionStats::ExecutionStats() : enabled(false), resumed() {}
+
+void ExecutionStats::pauseCurrent(const ResourceUsage& now) {
+    PhaseStats& current = phases[running.back()];
+    current.wallNs += now.wallNs - resumed.wallNs;
+    current.cpuNs += now.cpuNs - resumed.cpuNs;
+    current.allocations += now.allocations - resumed.allocations;
+    current.allocatedBytes += now.allocatedBytes - resumed.allocatedBytes;
+    current.nodes += now.nodes - resumed.nodes;
+    current.peakRssDeltaKb += now.peakRssKb - resumed.peakRssKb;
+}
+
+void ExecutionStats::begin(Phase phase) {
+    if (!enabled)
+        return;
+
+    ResourceUsage now = ResourceUsage::current();
+    if (!running.empty())
+        pauseCurrent(now);
+
+    running.push_back(phase);
+    phases[phase].runs++;
+    resumed = now;
+}
+
+void ExecutionStats::end() {
+    if (!enabled || running.empty())
+        return;
+
+    ResourceUsage now = ResourceUsage::current();
+    pauseCurrent(now);
+
+    running.pop_back();
+    resumed = now;
+}
+
+const char* ExecutionStats::getPhaseName(Phase phase) {
+    switch (phase) {
+        case PHASE_PARSE: return "parse";
+        case PHASE_SYNTAX: return "syntax";
+        case PHASE_SORTEDNESS: return "sortedness";
+        case PHASE_TRANSLATION: return "translation";
+        case PHASE_HEAP: return "heap";
+        default: return "";
+    }
+}
+
+string ExecutionStats::toJson(const string& file) const {
+    stringstream ss;
+    ss << "{\"file\": \"" << escapeJson(file) << "\", \"phases\": {";
+
+    for (int i = 0; i < PHASE_COUNT; i++) {
+        const PhaseStats& stats = phases[i];
+
+        if (i > 0)
+            ss << ", ";
+
+        ss << "\"" << getPhaseName((Phase) i) << "\": {"
+           << "\"runs\": " << stats.runs
+           << ", \"wall_ms\": " << formatMs(stats.wallNs)
+           << ", \"cpu_ms\": " << formatMs(stats.cpuNs)
+           << ", \"allocations\": " << stats.allocations
+           << ", \"allocated_bytes\": " << stats.allocatedBytes
+           << ", \"nodes\": " << stats.nodes
+           << ", \"peak_rss_delta_kb\": " << stats.peakRssDeltaKb << "}";
+    }
+
+    ss << "}}";
+    return ss.str();
+}
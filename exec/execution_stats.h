@@ -0,0 +1,94 @@
+/**
+ * \file execution_stats.h
+ * \brief Time, allocations, nodes and memory used by each phase of an execution.
+ */
+
+#ifndef SLCOMP_PARSER_EXECUTION_STATS_H
+#define SLCOMP_PARSER_EXECUTION_STATS_H
+
+#include "util/resource_usage.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace slcompparser {
+    /**
+     * Resources used by each phase of an execution (see ResourceUsage).
+     * Phases may be nested, e.g. when commands are checked while the file is being parsed.
+     * The resources used by a nested phase are only counted for that phase,
+     * and the enclosing phase is paused until the nested one ends.
+     */
+    class ExecutionStats {
+    public:
+        enum Phase {
+            PHASE_PARSE = 0, PHASE_SYNTAX, PHASE_SORTEDNESS, PHASE_TRANSLATION, PHASE_HEAP, PHASE_COUNT
+        };
+
+        /** Resources used by a phase, accumulated over all the times it ran */
+        struct PhaseStats {
+            long runs = 0;
+            long long wallNs = 0;
+            long long cpuNs = 0;
+            long long allocations = 0;
+            long long allocatedBytes = 0;
+            long long nodes = 0;
+            long long peakRssDeltaKb = 0;
+        };
+
+        /** Begins a phase when created and ends it when destroyed */
+        class Scope {
+        private:
+            ExecutionStats& stats;
+        public:
+            inline Scope(ExecutionStats& stats, Phase phase) : stats(stats) { stats.begin(phase); }
+
+            inline ~Scope() { stats.end(); }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        };
+
+    private:
+        bool enabled;
+        PhaseStats phases[PHASE_COUNT];
+
+        /** Phases currently running, innermost last */
+        std::vector<Phase> running;
+
+        /** Resources used when the innermost running phase was last resumed */
+        ResourceUsage resumed;
+
+        /** Count the resources used since the last resume for the innermost running phase */
+        void pauseCurrent(const ResourceUsage& now);
+
+    public:
+        /** Statistics which are not collected until enabled */
+        ExecutionStats();
+
+        /** Whether statistics are collected */
+        inline bool isEnabled() const { return enabled; }
+
+        /** Set whether statistics are collected */
+        inline void setEnabled(bool enabled) { this->enabled = enabled; }
+
+        /** Begin a phase, pausing the one currently running */
+        void begin(Phase phase);
+
+        /** End the innermost running phase, resuming the enclosing one */
+        void end();
+
+        /** Get the resources used by a phase */
+        inline const PhaseStats& get(Phase phase) const { return phases[phase]; }
+
+        /** Get the name of a phase */
+        static const char* getPhaseName(Phase phase);
+
+        /** Get a JSON representation of the statistics, on a single line */
+        std::string toJson(const std::string& file) const;
+    };
+
+    typedef std::shared_ptr<ExecutionStats> ExecutionStatsPtr;
+}
+
+#endif //SLCOMP_PARSER_EXECUTION_STATS_H
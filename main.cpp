@@ -1,9 +1,13 @@
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <memory>
 #include <regex>
+#include <thread>
 #include <vector>
 
+#include "exec/batch_execution.h"
 #include "exec/execution.h"
 #include "util/error_messages.h"
 #include "util/logger.h"
@@ -15,6 +19,7 @@ using namespace smtlib;
 int main(int argc, char **argv) {
     ExecutionSettingsPtr settings = make_shared<ExecutionSettings>();
     vector<string> files;
+    long jobs = 1;
 
     for (int i = 1; i < argc; i++) {
         string argstr = string(argv[i]);
@@ -22,6 +27,30 @@ int main(int argc, char **argv) {
 
         if (strcmp(argv[i], "--no-core") == 0) {
             settings->setCoreTheoryEnabled(false);
+        } else if (strcmp(argv[i], "--stream") == 0) {
+            settings->setStreamingEnabled(true);
+        } else if (strcmp(argv[i], "--fused") == 0) {
+            settings->setFusedEnabled(true);
+        } else if (strcmp(argv[i], "--arena") == 0) {
+            settings->setArenaEnabled(true);
+        } else if (strcmp(argv[i], "--share-terms") == 0) {
+            settings->setTermSharingEnabled(true);
+        } else if (strcmp(argv[i], "--stats=json") == 0) {
+            settings->setStatsEnabled(true);
+        } else if (strncmp(argv[i], "--stats=", 8) == 0) {
+            Logger::error("main()", "Unknown statistics format (only 'json' is supported)");
+            return 1;
+        } else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) {
+            char* end;
+            jobs = strtol(argv[++i], &end, 10);
+            if (*end || jobs < 0) {
+                Logger::error("main()", "Invalid number of jobs");
+                return 1;
+            }
+
+            // Zero means one thread per core
+            if (jobs == 0)
+                jobs = std::max(1u, thread::hardware_concurrency());
         } else {
             files.push_back(string(argv[i]));
         }
@@ -32,10 +61,27 @@ int main(int argc, char **argv) {
         return 1;
     }
 
+    if (jobs > 1 && files.size() > 1) {
+        BatchExecution batch(settings, files, (size_t) jobs);
+        batch.checkHeap();
+        return batch.hasParsingError() ? Logger::ErrorCode::ERR_PARSE : 0;
+    }
+
+    // A single file, or files checked one after another, may have their commands checked in parallel
+    settings->setJobs((size_t) jobs);
+
+    if (jobs > 1 && settings->isFusedEnabled()) {
+        Logger::warning("main()", "Ignoring --fused, since the commands are checked in parallel (--jobs)");
+        settings->setFusedEnabled(false);
+    }
+
     for (const auto& file : files) {
         settings->setInputFromFile(file);
         Execution exec(settings);
         exec.checkHeap();
+
+        if (settings->isStatsEnabled())
+            Logger::message(exec.getStats().toJson(file).c_str());
     }
 
     return 0;
@@ -9,6 +9,9 @@
 #include "ast_classes.h"
 
 #include "visitor/ast_visitor.h"
+#include "util/interner.h"
+#include "util/resource_usage.h"
+#include "util/source_map.h"
 
 #include <string>
 #include <memory>
@@ -19,21 +22,67 @@ namespace smtlib {
         /** Node of the SMT-LIB abstract syntax tree */
         class Node {
         public:
-            int rowLeft{0};
-            int rowRight{0};
-            int colLeft{0};
-            int colRight{0};
-            std::shared_ptr<std::string> filename;
+            /** Location of the node in its source file (see SourceMap) */
+            SpanId span { SourceMap::NO_SPAN };
 
-            inline Node() = default;
+            inline Node() { ResourceUsage::countNode(); }
+
+            inline int getRowLeft() { return SourceMap::getSpan(span).rowLeft; }
+            inline int getColLeft() { return SourceMap::getSpan(span).colLeft; }
+            inline int getRowRight() { return SourceMap::getSpan(span).rowRight; }
+            inline int getColRight() { return SourceMap::getSpan(span).colRight; }
+
+            /** Get the name of the source file, or null if the node does not come from a file */
+            inline const std::string* getFilename() {
+                if (span == SourceMap::NO_SPAN)
+                    return nullptr;
+                return &Interner::lookup(SourceMap::getFileId(span));
+            }
+
+            /** Get the kind of the node, which identifies its concrete class */
+            virtual NodeKind getKind() = 0;
 
             /** Accept a visitor */
             virtual void accept(class Visitor0* visitor) = 0;
 
+            /** Accept a visitor that does not share ownership of the nodes (see RawVisitor0) */
+            virtual void accept(class RawVisitor0* visitor) = 0;
+
             /** Get string representation of the node */
             virtual std::string toString() = 0;
         };
 
+        /**
+         * Kinds of the nodes of a class, checked by nodeCast().
+         * A concrete class has a single kind, its KIND. Abstract classes that nodes are cast to
+         * specialize this with the kinds of their concrete classes (see FunSymbolDeclaration).
+         */
+        template<class T>
+        struct NodeKinds {
+            static inline bool contains(NodeKind kind) {
+                return kind == T::KIND;
+            }
+
+            /** Get the T part of a node whose kind is one of these */
+            static inline T* cast(Node* node) {
+                // Node may be a virtual base, so go through the most derived object
+                return static_cast<T*>(dynamic_cast<void*>(node));
+            }
+        };
+
+        /**
+         * Cast a node to one of the classes of the hierarchy.
+         * Checks the kind of the node instead of searching the class hierarchy like dynamic_pointer_cast.
+         * \return Pointer sharing ownership with the node, or an empty pointer if the node is not a T
+         */
+        template<class T, class U>
+        inline std::shared_ptr<T> nodeCast(const std::shared_ptr<U>& node) {
+            if (!node || !NodeKinds<T>::contains(node->getKind()))
+                return std::shared_ptr<T>();
+
+            return std::shared_ptr<T>(node, NodeKinds<T>::cast(node.get()));
+        }
+
         /** Root of the SMT-LIB abstract syntax tree */
         class Root : public Node {
         };
@@ -11,6 +11,10 @@ void Attribute::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void Attribute::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string Attribute::toString() {
     stringstream ss;
     ss << keyword->toString();
@@ -27,6 +31,10 @@ void CompAttributeValue::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void CompAttributeValue::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string CompAttributeValue::toString() {
     stringstream ss;
     ss << "(";
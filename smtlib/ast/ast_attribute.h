@@ -21,6 +21,8 @@ namespace smtlib {
         class Attribute : public Node,
                           public std::enable_shared_from_this<Attribute> {
         public:
+            static constexpr NodeKind KIND = NodeKind::ATTRIBUTE;
+
             KeywordPtr keyword;
             AttributeValuePtr value;
 
@@ -33,7 +35,10 @@ namespace smtlib {
                     : keyword(std::move(keyword))
                     , value(std::move(value)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -43,12 +48,17 @@ namespace smtlib {
         class CompAttributeValue : public AttributeValue,
                                    public std::enable_shared_from_this<CompAttributeValue> {
         public:
+            static constexpr NodeKind KIND = NodeKind::COMP_ATTRIBUTE_VALUE;
+
             std::vector<AttributeValuePtr> values;
 
             explicit inline CompAttributeValue(std::vector<AttributeValuePtr> values)
                 : values(std::move(values)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
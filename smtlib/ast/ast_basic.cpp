@@ -13,6 +13,10 @@ void Symbol::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void Symbol::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string Symbol::toString() {
     return value;
 }
@@ -23,6 +27,10 @@ void Keyword::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void Keyword::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string Keyword::toString() {
     return value;
 }
@@ -33,6 +41,10 @@ void MetaSpecConstant::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void MetaSpecConstant::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string MetaSpecConstant::toString() {
     return (type == Type::STRING) ? MSCONST_STRING
                                   : (type == Type::NUMERAL ? MSCONST_NUMERAL
@@ -45,6 +57,10 @@ void BooleanValue::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void BooleanValue::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string BooleanValue::toString() {
     if (value)
         return CONST_TRUE;
@@ -58,6 +74,10 @@ void PropLiteral::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void PropLiteral::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string PropLiteral::toString() {
     if (negated) {
         stringstream ss;
@@ -9,6 +9,8 @@
 #include "ast_abstract.h"
 #include "ast_interfaces.h"
 
+#include "util/interner.h"
+
 #include <memory>
 #include <string>
 
@@ -26,15 +28,25 @@ namespace smtlib {
                        public Constructor,
                        public std::enable_shared_from_this<Symbol> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SYMBOL;
+
             std::string value;
+            /** Interned identifier of the value */
+            SymbolId id;
+            /** Whether the lexer matched the value as a simple symbol, so that it is known to be well-formed */
+            bool wellFormed { false };
 
             /**
              * \param value     Textual value of the symbol
              */
             inline explicit Symbol(std::string value)
-                    : value(std::move(value)) {}
+                    : value(std::move(value))
+                    , id(Interner::intern(this->value)) {}
+
+            inline NodeKind getKind() override { return KIND; }
 
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -48,15 +60,25 @@ namespace smtlib {
                         public SExpression,
                         public std::enable_shared_from_this<Keyword> {
         public:
+            static constexpr NodeKind KIND = NodeKind::KEYWORD;
+
             std::string value;
+            /** Interned identifier of the value */
+            SymbolId id;
+            /** Whether the lexer matched the value as a keyword, so that it is known to be well-formed */
+            bool wellFormed { false };
 
             /**
              * \param value     Textual value of the keyword
              */
             inline explicit Keyword(std::string value)
-                    : value(std::move(value)) {}
+                    : value(std::move(value))
+                    , id(Interner::intern(this->value)) {}
+
+            inline NodeKind getKind() override { return KIND; }
 
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -68,6 +90,8 @@ namespace smtlib {
         class MetaSpecConstant : public Node,
                                  public std::enable_shared_from_this<MetaSpecConstant> {
         public:
+            static constexpr NodeKind KIND = NodeKind::META_SPEC_CONSTANT;
+
             /**
              * Types of meta specification constants
              */
@@ -85,7 +109,10 @@ namespace smtlib {
             inline explicit MetaSpecConstant(Type type)
                     : type(type) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
 
             std::string toString() override;
@@ -100,6 +127,8 @@ namespace smtlib {
                              public AttributeValue,
                              public std::enable_shared_from_this<BooleanValue> {
         public:
+            static constexpr NodeKind KIND = NodeKind::BOOLEAN_VALUE;
+
             bool value;
 
             /**
@@ -108,7 +137,10 @@ namespace smtlib {
             inline explicit BooleanValue(bool value)
                     : value(value) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -118,6 +150,8 @@ namespace smtlib {
         class PropLiteral : public Node,
                             public std::enable_shared_from_this<PropLiteral> {
         public:
+            static constexpr NodeKind KIND = NodeKind::PROP_LITERAL;
+
             SymbolPtr symbol;
             bool negated;
 
@@ -129,7 +163,10 @@ namespace smtlib {
                     : symbol(std::move(symbol))
                     , negated(negated) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
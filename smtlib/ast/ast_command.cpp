@@ -13,6 +13,10 @@ void AssertCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void AssertCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string AssertCommand::toString() {
     stringstream ss;
     ss << "(" << KW_ASSERT << " " << term->toString() << ")";
@@ -25,6 +29,10 @@ void CheckSatCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void CheckSatCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string CheckSatCommand::toString() {
     stringstream ss;
     ss << "(" << KW_CHK_SAT << ")";
@@ -37,6 +45,10 @@ void CheckUnsatCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void CheckUnsatCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string CheckUnsatCommand::toString() {
     stringstream ss;
     ss << "(" << KW_CHK_UNSAT << ")";
@@ -49,6 +61,10 @@ void CheckSatAssumCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void CheckSatAssumCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string CheckSatAssumCommand::toString() {
     stringstream ss;
     ss << "(" << KW_CHK_SAT_ASSUM << " (";
@@ -70,6 +86,10 @@ void DeclareConstCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DeclareConstCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DeclareConstCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DECL_CONST << " " << symbol->toString() << " " << sort->toString() << ")";
@@ -82,6 +102,10 @@ void DeclareDatatypeCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DeclareDatatypeCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DeclareDatatypeCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DECL_DATATYPE << " " << symbol->toString() << " " << declaration->toString() << ")";
@@ -94,6 +118,10 @@ void DeclareDatatypesCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DeclareDatatypesCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DeclareDatatypesCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DECL_DATATYPES << " (";
@@ -124,6 +152,10 @@ void DeclareFunCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DeclareFunCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DeclareFunCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DECL_FUN << " " << symbol->toString() << " (";
@@ -145,6 +177,10 @@ void DeclareSortCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DeclareSortCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DeclareSortCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DECL_SORT << " " << symbol->toString() << " " << arity->toString() << ")";
@@ -157,6 +193,10 @@ void DeclareHeapCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DeclareHeapCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DeclareHeapCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DECL_HEAP << " ";
@@ -175,6 +215,10 @@ void DefineFunCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DefineFunCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DefineFunCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DEF_FUN << " " << definition->toString() << ")";
@@ -187,6 +231,10 @@ void DefineFunRecCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DefineFunRecCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DefineFunRecCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DEF_FUN_REC << " " << definition->toString() << ")";
@@ -199,6 +247,10 @@ void DefineFunsRecCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DefineFunsRecCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DefineFunsRecCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DEF_FUNS_REC << " (";
@@ -229,6 +281,10 @@ void DefineSortCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DefineSortCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DefineSortCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DEF_SORT << " " << symbol->toString() << " (";
@@ -250,6 +306,10 @@ void EchoCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void EchoCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string EchoCommand::toString() {
     stringstream ss;
     ss << "(" << KW_ECHO << " " << message << ")";
@@ -262,6 +322,10 @@ void ExitCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ExitCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ExitCommand::toString() {
     stringstream ss;
     ss << "(" << KW_EXIT << ")";
@@ -274,6 +338,10 @@ void GetAssertsCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetAssertsCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetAssertsCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_ASSERTS << ")";
@@ -286,6 +354,10 @@ void GetAssignsCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetAssignsCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetAssignsCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_ASSIGNS << ")";
@@ -298,6 +370,10 @@ void GetInfoCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetInfoCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetInfoCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_INFO << " " << flag->toString() << ")";
@@ -310,6 +386,10 @@ void GetModelCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetModelCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetModelCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_MODEL << ")";
@@ -322,6 +402,10 @@ void GetOptionCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetOptionCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetOptionCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_OPT << " " << option->toString() << ")";
@@ -334,6 +418,10 @@ void GetProofCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetProofCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetProofCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_PROOF << ")";
@@ -346,6 +434,10 @@ void GetUnsatAssumsCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetUnsatAssumsCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetUnsatAssumsCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_UNSAT_ASSUMS << ")";
@@ -358,6 +450,10 @@ void GetUnsatCoreCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetUnsatCoreCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetUnsatCoreCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_UNSAT_CORE << ")";
@@ -370,6 +466,10 @@ void GetValueCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetValueCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetValueCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_VALUE << " (";
@@ -391,6 +491,10 @@ void PopCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void PopCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string PopCommand::toString() {
     stringstream ss;
     ss << "(" << KW_POP << " " << numeral->toString() << ")";
@@ -403,6 +507,10 @@ void PushCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void PushCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string PushCommand::toString() {
     stringstream ss;
     ss << "(" << KW_PUSH << " " << numeral->toString() << ")";
@@ -415,6 +523,10 @@ void ResetCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ResetCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ResetCommand::toString() {
     stringstream ss;
     ss << "(" << KW_RESET << ")";
@@ -427,6 +539,10 @@ void ResetAssertsCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ResetAssertsCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ResetAssertsCommand::toString() {
     stringstream ss;
     ss << "(" << KW_RESET_ASSERTS << ")";
@@ -439,6 +555,10 @@ void SetInfoCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SetInfoCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SetInfoCommand::toString() {
     stringstream ss;
     ss << "(" << KW_SET_INFO << " " << info->keyword->toString()
@@ -452,6 +572,10 @@ void SetLogicCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SetLogicCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SetLogicCommand::toString() {
     stringstream ss;
     ss << "(" << KW_SET_LOGIC << " " << logic->toString() << ")";
@@ -464,6 +588,10 @@ void SetOptionCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SetOptionCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SetOptionCommand::toString() {
     stringstream ss;
     ss << "(" << KW_SET_OPT << " " << option->keyword->toString()
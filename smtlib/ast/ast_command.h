@@ -30,6 +30,8 @@ namespace smtlib {
         class AssertCommand : public Command,
                               public std::enable_shared_from_this<AssertCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::ASSERT_COMMAND;
+
             TermPtr term;
 
             /**
@@ -38,7 +40,10 @@ namespace smtlib {
             inline explicit AssertCommand(TermPtr term)
                     : term(std::move(term)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -48,9 +53,14 @@ namespace smtlib {
         class CheckSatCommand : public Command,
                                 public std::enable_shared_from_this<CheckSatCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::CHECK_SAT_COMMAND;
+
             inline CheckSatCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -60,9 +70,14 @@ namespace smtlib {
         class CheckUnsatCommand : public Command,
                                 public std::enable_shared_from_this<CheckUnsatCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::CHECK_UNSAT_COMMAND;
+
             inline CheckUnsatCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -72,6 +87,8 @@ namespace smtlib {
         class CheckSatAssumCommand : public Command,
                                      public std::enable_shared_from_this<CheckSatAssumCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::CHECK_SAT_ASSUM_COMMAND;
+
             std::vector<PropLiteralPtr> assumptions;
 
             /**
@@ -80,7 +97,10 @@ namespace smtlib {
             explicit inline CheckSatAssumCommand(std::vector<PropLiteralPtr> assumptions)
                     : assumptions(std::move(assumptions)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -90,6 +110,8 @@ namespace smtlib {
         class DeclareConstCommand : public Command,
                                     public std::enable_shared_from_this<DeclareConstCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECLARE_CONST_COMMAND;
+
             SymbolPtr symbol;
             SortPtr sort;
 
@@ -101,7 +123,10 @@ namespace smtlib {
                     : symbol(std::move(symbol))
                     , sort(std::move(sort)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -111,6 +136,8 @@ namespace smtlib {
         class DeclareDatatypeCommand : public Command,
                                        public std::enable_shared_from_this<DeclareDatatypeCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECLARE_DATATYPE_COMMAND;
+
             SymbolPtr symbol;
             DatatypeDeclarationPtr declaration;
 
@@ -123,7 +150,10 @@ namespace smtlib {
                     : symbol(std::move(symbol))
                     , declaration(std::move(declaration)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -133,6 +163,8 @@ namespace smtlib {
         class DeclareDatatypesCommand : public Command,
                                         public std::enable_shared_from_this<DeclareDatatypesCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECLARE_DATATYPES_COMMAND;
+
             std::vector<SortDeclarationPtr> sorts;
             std::vector<DatatypeDeclarationPtr> declarations;
 
@@ -144,7 +176,10 @@ namespace smtlib {
                                            std::vector<DatatypeDeclarationPtr> declarations)
                     : sorts(std::move(sorts))
                     , declarations(std::move(declarations)) {}
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -154,6 +189,8 @@ namespace smtlib {
         class DeclareFunCommand : public Command,
                                   public std::enable_shared_from_this<DeclareFunCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECLARE_FUN_COMMAND;
+
             SymbolPtr symbol;
             std::vector<SortPtr> parameters;
             SortPtr sort;
@@ -168,7 +205,10 @@ namespace smtlib {
                     , sort(std::move(sort))
                     , parameters(std::move(parameters)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -178,6 +218,8 @@ namespace smtlib {
         class DeclareSortCommand : public Command,
                                    public std::enable_shared_from_this<DeclareSortCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECLARE_SORT_COMMAND;
+
             SymbolPtr symbol;
             NumeralLiteralPtr arity;
 
@@ -189,7 +231,10 @@ namespace smtlib {
                     : symbol(std::move(symbol))
                     , arity(std::move(arity)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -199,6 +244,8 @@ namespace smtlib {
         class DeclareHeapCommand : public Command,
                                    public std::enable_shared_from_this<DeclareHeapCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECLARE_HEAP_COMMAND;
+
             std::vector<std::pair<SortPtr,SortPtr>> locDataPairs;
 
             /**
@@ -208,7 +255,10 @@ namespace smtlib {
             inline explicit DeclareHeapCommand(std::vector<std::pair<SortPtr,SortPtr>> locDataPairs)
                     : locDataPairs(std::move(locDataPairs)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -218,6 +268,8 @@ namespace smtlib {
         class DefineFunCommand : public Command,
                                  public std::enable_shared_from_this<DefineFunCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DEFINE_FUN_COMMAND;
+
             FunctionDefinitionPtr definition;
 
             /**
@@ -248,7 +300,10 @@ namespace smtlib {
                                                                       std::move(sort),
                                                                       std::move(body))) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -258,6 +313,8 @@ namespace smtlib {
         class DefineFunRecCommand : public Command,
                                     public std::enable_shared_from_this<DefineFunRecCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DEFINE_FUN_REC_COMMAND;
+
             FunctionDefinitionPtr definition;
 
             /**
@@ -288,7 +345,10 @@ namespace smtlib {
                                                                       std::move(sort),
                                                                       std::move(body))) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -298,6 +358,8 @@ namespace smtlib {
         class DefineFunsRecCommand : public Command,
                                      public std::enable_shared_from_this<DefineFunsRecCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DEFINE_FUNS_REC_COMMAND;
+
             std::vector<FunctionDeclarationPtr> declarations;
             std::vector<TermPtr> bodies;
 
@@ -310,7 +372,10 @@ namespace smtlib {
                     : declarations(std::move(declarations))
                     , bodies(std::move(bodies)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -320,6 +385,8 @@ namespace smtlib {
         class DefineSortCommand : public Command,
                                   public std::enable_shared_from_this<DefineSortCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DEFINE_SORT_COMMAND;
+
             SymbolPtr symbol;
             std::vector<SymbolPtr> parameters;
             SortPtr sort;
@@ -336,7 +403,10 @@ namespace smtlib {
                     , sort(std::move(sort))
                     , parameters(std::move(parameters)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -346,6 +416,8 @@ namespace smtlib {
         class EchoCommand : public Command,
                             public std::enable_shared_from_this<EchoCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::ECHO_COMMAND;
+
             std::string message;
 
             /**
@@ -354,7 +426,10 @@ namespace smtlib {
             inline explicit EchoCommand(std::string message)
                     : message(std::move(message)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -364,9 +439,14 @@ namespace smtlib {
         class ExitCommand : public Command,
                             public std::enable_shared_from_this<ExitCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::EXIT_COMMAND;
+
             inline ExitCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -376,9 +456,14 @@ namespace smtlib {
         class GetAssertsCommand : public Command,
                                   public std::enable_shared_from_this<GetAssertsCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_ASSERTS_COMMAND;
+
             inline GetAssertsCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -388,9 +473,14 @@ namespace smtlib {
         class GetAssignsCommand : public Command,
                                   public std::enable_shared_from_this<GetAssignsCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_ASSIGNS_COMMAND;
+
             inline GetAssignsCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -400,6 +490,8 @@ namespace smtlib {
         class GetInfoCommand : public Command,
                                public std::enable_shared_from_this<GetInfoCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_INFO_COMMAND;
+
             KeywordPtr flag;
 
             /**
@@ -408,7 +500,10 @@ namespace smtlib {
             inline explicit GetInfoCommand(KeywordPtr flag)
                     : flag(std::move(flag)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -418,9 +513,14 @@ namespace smtlib {
         class GetModelCommand : public Command,
                                 public std::enable_shared_from_this<GetModelCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_MODEL_COMMAND;
+
             inline GetModelCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -430,6 +530,8 @@ namespace smtlib {
         class GetOptionCommand : public Command,
                                  public std::enable_shared_from_this<GetOptionCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_OPTION_COMMAND;
+
             KeywordPtr option;
 
             /**
@@ -438,7 +540,10 @@ namespace smtlib {
             inline explicit GetOptionCommand(KeywordPtr option)
                     : option(std::move(option)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -448,9 +553,14 @@ namespace smtlib {
         class GetProofCommand : public Command,
                                 public std::enable_shared_from_this<GetProofCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_PROOF_COMMAND;
+
             inline GetProofCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -460,9 +570,14 @@ namespace smtlib {
         class GetUnsatAssumsCommand : public Command,
                                       public std::enable_shared_from_this<GetUnsatAssumsCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_UNSAT_ASSUMS_COMMAND;
+
             inline GetUnsatAssumsCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -472,9 +587,14 @@ namespace smtlib {
         class GetUnsatCoreCommand : public Command,
                                     public std::enable_shared_from_this<GetUnsatCoreCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_UNSAT_CORE_COMMAND;
+
             inline GetUnsatCoreCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -484,6 +604,8 @@ namespace smtlib {
         class GetValueCommand : public Command,
                                 public std::enable_shared_from_this<GetValueCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_VALUE_COMMAND;
+
             std::vector<TermPtr> terms;
             /**
              * \param terms Terms to evaluate
@@ -491,7 +613,10 @@ namespace smtlib {
             explicit inline GetValueCommand(std::vector<TermPtr> terms)
                     : terms(std::move(terms)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -501,6 +626,8 @@ namespace smtlib {
         class PopCommand : public Command,
                            public std::enable_shared_from_this<PopCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::POP_COMMAND;
+
             NumeralLiteralPtr numeral;
 
             /**
@@ -509,7 +636,10 @@ namespace smtlib {
             inline explicit PopCommand(NumeralLiteralPtr numeral)
                     : numeral(std::move(numeral)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -519,6 +649,8 @@ namespace smtlib {
         class PushCommand : public Command,
                             public std::enable_shared_from_this<PushCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::PUSH_COMMAND;
+
             NumeralLiteralPtr numeral;
 
             /**
@@ -527,7 +659,10 @@ namespace smtlib {
             inline explicit PushCommand(NumeralLiteralPtr numeral)
                     : numeral(std::move(numeral)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -537,9 +672,14 @@ namespace smtlib {
         class ResetCommand : public Command,
                              public std::enable_shared_from_this<ResetCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::RESET_COMMAND;
+
             inline ResetCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -549,9 +689,14 @@ namespace smtlib {
         class ResetAssertsCommand : public Command,
                                     public std::enable_shared_from_this<ResetAssertsCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::RESET_ASSERTS_COMMAND;
+
             inline ResetAssertsCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -561,6 +706,8 @@ namespace smtlib {
         class SetInfoCommand : public Command,
                                public std::enable_shared_from_this<SetInfoCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SET_INFO_COMMAND;
+
             AttributePtr info;
 
             /**
@@ -569,7 +716,10 @@ namespace smtlib {
             inline explicit SetInfoCommand(AttributePtr info)
                     : info(std::move(info)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -579,6 +729,8 @@ namespace smtlib {
         class SetLogicCommand : public Command,
                                 public std::enable_shared_from_this<SetLogicCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SET_LOGIC_COMMAND;
+
             SymbolPtr logic;
 
             /**
@@ -587,7 +739,10 @@ namespace smtlib {
             inline explicit SetLogicCommand(SymbolPtr logic)
                     : logic(std::move(logic)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -597,6 +752,8 @@ namespace smtlib {
         class SetOptionCommand : public Command,
                                  public std::enable_shared_from_this<SetOptionCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SET_OPTION_COMMAND;
+
             AttributePtr option;
 
             /**
@@ -605,7 +762,10 @@ namespace smtlib {
             inline explicit SetOptionCommand(AttributePtr option)
                     : option(std::move(option)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
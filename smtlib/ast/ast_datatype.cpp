@@ -12,6 +12,10 @@ void SortDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SortDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SortDeclaration::toString() {
     stringstream ss;
     ss << "(" << symbol->toString() << " " << arity->toString() << ")";
@@ -24,6 +28,10 @@ void SelectorDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SelectorDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SelectorDeclaration::toString() {
     stringstream ss;
     ss << "(" << symbol->toString() << " " << sort->toString() << ")";
@@ -36,6 +44,10 @@ void ConstructorDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ConstructorDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ConstructorDeclaration::toString() {
     stringstream ss;
     ss << "(" << symbol->toString();
@@ -54,6 +66,10 @@ void SimpleDatatypeDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SimpleDatatypeDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SimpleDatatypeDeclaration::toString() {
     stringstream ss;
     ss << "(";
@@ -75,6 +91,10 @@ void ParametricDatatypeDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ParametricDatatypeDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ParametricDatatypeDeclaration::toString() {
     stringstream ss;
     ss << "(par (";
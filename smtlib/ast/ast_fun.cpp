@@ -11,6 +11,10 @@ void FunctionDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void FunctionDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string FunctionDeclaration::toString() {
     stringstream ss;
     ss << symbol->toString() << " (";
@@ -32,6 +36,10 @@ void FunctionDefinition::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void FunctionDefinition::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string FunctionDefinition::toString() {
     stringstream ss;
     ss << signature->toString() << " " << body->toString();
@@ -24,6 +24,8 @@ namespace smtlib {
         class FunctionDeclaration : public Node,
                                     public std::enable_shared_from_this<FunctionDeclaration> {
         public:
+            static constexpr NodeKind KIND = NodeKind::FUNCTION_DECLARATION;
+
             SymbolPtr symbol;
             std::vector<SortedVariablePtr> parameters;
             SortPtr sort;
@@ -40,7 +42,10 @@ namespace smtlib {
                     , sort(std::move(sort))
                     , parameters(std::move(parameters)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -50,6 +55,8 @@ namespace smtlib {
         class FunctionDefinition : public Node,
                                    public std::enable_shared_from_this<FunctionDefinition> {
         public:
+            static constexpr NodeKind KIND = NodeKind::FUNCTION_DEFINITION;
+
             FunctionDeclarationPtr signature;
             TermPtr body;
 
@@ -76,7 +83,10 @@ namespace smtlib {
                                                                       std::move(parameters),
                                                                       std::move(sort))) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -11,10 +11,21 @@ bool SimpleIdentifier::isIndexed() {
     return !indices.empty();
 }
 
+SymbolId SimpleIdentifier::getNameId() {
+    if (!isIndexed())
+        return symbol->id;
+
+    return Interner::intern(toString());
+}
+
 void SimpleIdentifier::accept(Visitor0 *visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SimpleIdentifier::accept(RawVisitor0 *visitor) {
+    visitor->visit(this);
+}
+
 string SimpleIdentifier::toString() {
     if (!isIndexed())
         return symbol->toString();
@@ -38,6 +49,10 @@ void QualifiedIdentifier::accept(Visitor0 *visitor) {
     visitor->visit(shared_from_this());
 }
 
+void QualifiedIdentifier::accept(RawVisitor0 *visitor) {
+    visitor->visit(this);
+}
+
 string QualifiedIdentifier::toString() {
     stringstream ss;
     ss << "(as " << identifier->toString() << " " << sort->toString() << ")";
@@ -23,6 +23,8 @@ namespace smtlib {
         class SimpleIdentifier : public Identifier,
                                  public std::enable_shared_from_this<SimpleIdentifier> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SIMPLE_IDENTIFIER;
+
             SymbolPtr symbol;
             std::vector<IndexPtr> indices;
 
@@ -47,7 +49,16 @@ namespace smtlib {
              */
             bool isIndexed();
 
+            /**
+             * Interned identifier of the textual representation, as used to key symbol tables.
+             * Does not build the string for unindexed identifiers.
+             */
+            SymbolId getNameId();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -57,6 +68,8 @@ namespace smtlib {
         class QualifiedIdentifier : public Identifier,
                                     public std::enable_shared_from_this<QualifiedIdentifier> {
         public:
+            static constexpr NodeKind KIND = NodeKind::QUALIFIED_IDENTIFIER;
+
             SimpleIdentifierPtr identifier;
             SortPtr sort;
 
@@ -68,7 +81,10 @@ namespace smtlib {
                     : identifier(std::move(identifier))
                     , sort(std::move(sort)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -18,6 +18,12 @@ namespace smtlib {
         };
 
         class Term : public virtual Node {
+        public:
+            /**
+             * Sort of the term, annotated by the sortedness check
+             * (empty if the term was not checked, or has no sort)
+             */
+            SortPtr inferredSort;
         };
 
         class Identifier : public virtual Node,
@@ -14,6 +14,10 @@ void NumeralLiteral::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void NumeralLiteral::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string NumeralLiteral::toString() {
     stringstream ss;
 
@@ -46,6 +50,10 @@ void DecimalLiteral::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DecimalLiteral::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DecimalLiteral::toString() {
     stringstream ss;
     ss << value;
@@ -57,6 +65,10 @@ void StringLiteral::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void StringLiteral::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string StringLiteral::toString() {
     return value;
 }
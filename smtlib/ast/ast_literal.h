@@ -37,13 +37,18 @@ namespace smtlib {
                                public SpecConstant,
                                public std::enable_shared_from_this<NumeralLiteral> {
         public:
+            static constexpr NodeKind KIND = NodeKind::NUMERAL_LITERAL;
+
             unsigned int base;
         
             inline NumeralLiteral(long value, unsigned int base)
                     : Literal(value)
                     , base(base) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -57,10 +62,15 @@ namespace smtlib {
                                public SpecConstant,
                                public std::enable_shared_from_this<DecimalLiteral> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECIMAL_LITERAL;
+
             inline explicit DecimalLiteral(double value)
                     : Literal(value) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -74,10 +84,15 @@ namespace smtlib {
                               public SpecConstant,
                               public std::enable_shared_from_this<StringLiteral> {
         public:
+            static constexpr NodeKind KIND = NodeKind::STRING_LITERAL;
+
             inline explicit StringLiteral(std::string value)
                     : Literal(std::move(value)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -9,6 +9,10 @@ void Logic::accept(Visitor0 *visitor) {
     visitor->visit(shared_from_this());
 }
 
+void Logic::accept(RawVisitor0 *visitor) {
+    visitor->visit(this);
+}
+
 string Logic::toString() {
     stringstream ss;
     ss << "(logic  " << name->toString();
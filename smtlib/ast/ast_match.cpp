@@ -11,6 +11,10 @@ void QualifiedConstructor::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void QualifiedConstructor::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string QualifiedConstructor::toString() {
     stringstream ss;
     ss << "(as " << symbol->toString() << " " << sort->toString() << ")";
@@ -23,6 +27,10 @@ void QualifiedPattern::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void QualifiedPattern::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string QualifiedPattern::toString() {
     stringstream ss;
     ss << "(" << constructor->toString();
@@ -40,6 +48,10 @@ void MatchCase::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void MatchCase::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string MatchCase::toString() {
     stringstream ss;
     ss << "(" << pattern->toString() << " " << term->toString() << ")";
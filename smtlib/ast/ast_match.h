@@ -19,6 +19,8 @@ namespace smtlib {
         class QualifiedConstructor : public Constructor,
                                      public std::enable_shared_from_this<QualifiedConstructor> {
         public:
+            static constexpr NodeKind KIND = NodeKind::QUALIFIED_CONSTRUCTOR;
+
             SymbolPtr symbol;
             SortPtr sort;
 
@@ -26,7 +28,10 @@ namespace smtlib {
                     : symbol(std::move(symbol))
                     , sort(std::move(sort)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -36,6 +41,8 @@ namespace smtlib {
         class QualifiedPattern : public Pattern,
                                  public std::enable_shared_from_this<QualifiedPattern> {
         public:
+            static constexpr NodeKind KIND = NodeKind::QUALIFIED_PATTERN;
+
             ConstructorPtr constructor;
             std::vector<SymbolPtr> symbols;
 
@@ -43,7 +50,10 @@ namespace smtlib {
                     : constructor(std::move(constructor))
                     , symbols(std::move(symbols)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -53,6 +63,8 @@ namespace smtlib {
         class MatchCase : public Node,
                           public std::enable_shared_from_this<MatchCase> {
         public:
+            static constexpr NodeKind KIND = NodeKind::MATCH_CASE;
+
             PatternPtr pattern;
             TermPtr term;
 
@@ -60,7 +72,10 @@ namespace smtlib {
                     : pattern(std::move(pattern))
                     , term(std::move(term)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
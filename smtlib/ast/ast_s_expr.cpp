@@ -1,4 +1,7 @@
 #include "ast_s_expr.h"
+
+#include "util/stack_guard.h"
+
 #include <sstream>
 
 using namespace std;
@@ -8,7 +11,14 @@ void CompSExpression::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void CompSExpression::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string CompSExpression::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(";
 
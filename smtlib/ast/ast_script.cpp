@@ -9,6 +9,10 @@ void Script::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void Script::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string Script::toString() {
     stringstream ss;
 
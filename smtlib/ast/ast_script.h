@@ -22,6 +22,8 @@ namespace smtlib {
         class Script : public Root,
                        public std::enable_shared_from_this<Script> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SCRIPT;
+
             std::vector<CommandPtr> commands;
         
             /**
@@ -35,7 +37,10 @@ namespace smtlib {
             inline explicit Script(std::vector<CommandPtr> commands)
                     : commands(std::move(commands)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -11,6 +11,9 @@
 #include "ast_identifier.h"
 #include "ast_interfaces.h"
 
+#include "util/sort_table.h"
+
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -20,6 +23,8 @@ namespace smtlib {
         class Sort : public Index,
                      public std::enable_shared_from_this<Sort> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SORT;
+
             SimpleIdentifierPtr identifier;
             std::vector<SortPtr> arguments;
 
@@ -42,9 +47,21 @@ namespace smtlib {
             /** Checks whether the sort has arguments */
             bool hasArgs();
 
+            /**
+             * Get the canonical form of the sort, which is the same object for all equal sorts.
+             * It is computed on first use, so the sort must not be modified afterwards.
+             */
+            const CanonicalSort* getCanonical();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
+
+        private:
+            std::atomic<const CanonicalSort*> canonical { nullptr };
         };
     }
 }
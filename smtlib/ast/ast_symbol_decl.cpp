@@ -11,6 +11,10 @@ void SortSymbolDeclaration::accept(Visitor0 *visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SortSymbolDeclaration::accept(RawVisitor0 *visitor) {
+    visitor->visit(this);
+}
+
 string SortSymbolDeclaration::toString() {
     stringstream ss;
     ss << "(" << identifier->toString() << " " << arity->toString();
@@ -29,6 +33,10 @@ void SpecConstFunDeclaration::accept(Visitor0 *visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SpecConstFunDeclaration::accept(RawVisitor0 *visitor) {
+    visitor->visit(this);
+}
+
 string SpecConstFunDeclaration::toString() {
     stringstream ss;
     ss << "(" << constant->toString() << " " << sort->toString();
@@ -47,6 +55,10 @@ void MetaSpecConstFunDeclaration::accept(Visitor0 *visitor) {
     visitor->visit(shared_from_this());
 }
 
+void MetaSpecConstFunDeclaration::accept(RawVisitor0 *visitor) {
+    visitor->visit(this);
+}
+
 string MetaSpecConstFunDeclaration::toString() {
     stringstream ss;
     ss << "(" << constant->toString() << " " << sort->toString();
@@ -65,6 +77,10 @@ void SimpleFunDeclaration::accept(Visitor0 *visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SimpleFunDeclaration::accept(RawVisitor0 *visitor) {
+    visitor->visit(this);
+}
+
 string SimpleFunDeclaration::toString() {
     stringstream ss;
     ss << "(" << identifier->toString();
@@ -87,6 +103,10 @@ void ParametricFunDeclaration::accept(Visitor0 *visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ParametricFunDeclaration::accept(RawVisitor0 *visitor) {
+    visitor->visit(this);
+}
+
 string ParametricFunDeclaration::toString() {
     stringstream ss;
     ss << "(par (";
@@ -1,5 +1,7 @@
 #include "ast_term.h"
 
+#include "util/stack_guard.h"
+
 #include <sstream>
 
 using namespace std;
@@ -7,11 +9,23 @@ using namespace smtlib::ast;
 
 /* ================================== QualifiedTerm =================================== */
 
+QualifiedTerm::~QualifiedTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { terms.clear(); });
+}
+
 void QualifiedTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void QualifiedTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string QualifiedTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(" << identifier->toString() << " ";
 
@@ -28,11 +42,27 @@ string QualifiedTerm::toString() {
 
 /* ===================================== LetTerm ====================================== */
 
+LetTerm::~LetTerm() {
+    if (StackGuard::isLow()) {
+        StackGuard::runOnNewSegment([this] {
+            bindings.clear();
+            term.reset();
+        });
+    }
+}
+
 void LetTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void LetTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string LetTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(let (";
 
@@ -49,11 +79,23 @@ string LetTerm::toString() {
 
 /* ==================================== ForallTerm ==================================== */
 
+ForallTerm::~ForallTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { term.reset(); });
+}
+
 void ForallTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ForallTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ForallTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(forall (";
 
@@ -70,11 +112,23 @@ string ForallTerm::toString() {
 
 /* ==================================== ExistsTerm ==================================== */
 
+ExistsTerm::~ExistsTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { term.reset(); });
+}
+
 void ExistsTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ExistsTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ExistsTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(exists (";
 
@@ -91,11 +145,27 @@ string ExistsTerm::toString() {
 
 /* ==================================== MatchTerm ===================================== */
 
+MatchTerm::~MatchTerm() {
+    if (StackGuard::isLow()) {
+        StackGuard::runOnNewSegment([this] {
+            term.reset();
+            cases.clear();
+        });
+    }
+}
+
 void MatchTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void MatchTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string MatchTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(match " << term->toString();
 
@@ -109,11 +179,23 @@ string MatchTerm::toString() {
 
 /* ================================== AnnotatedTerm =================================== */
 
+AnnotatedTerm::~AnnotatedTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { term.reset(); });
+}
+
 void AnnotatedTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void AnnotatedTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string AnnotatedTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "( ! " << term->toString() << " ";
 
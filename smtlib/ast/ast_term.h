@@ -22,6 +22,8 @@ namespace smtlib {
         class QualifiedTerm : public Term,
                               public std::enable_shared_from_this<QualifiedTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::QUALIFIED_TERM;
+
             IdentifierPtr identifier;
             std::vector<TermPtr> terms;
 
@@ -33,7 +35,12 @@ namespace smtlib {
                     : identifier(std::move(identifier))
                     , terms(std::move(terms)) {}
 
+            ~QualifiedTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0 *visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -43,6 +50,8 @@ namespace smtlib {
         class LetTerm : public Term,
                         public std::enable_shared_from_this<LetTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::LET_TERM;
+
             std::vector<VariableBindingPtr> bindings;
             TermPtr term;
 
@@ -54,7 +63,12 @@ namespace smtlib {
                     : bindings(std::move(bindings))
                     , term(std::move(term)) {}
 
+            ~LetTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0 *visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -64,6 +78,8 @@ namespace smtlib {
         class ForallTerm : public Term,
                            public std::enable_shared_from_this<ForallTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::FORALL_TERM;
+
             std::vector<SortedVariablePtr> bindings;
             TermPtr term;
 
@@ -75,7 +91,12 @@ namespace smtlib {
                     : bindings(std::move(bindings))
                     , term(std::move(term)) {}
 
+            ~ForallTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0 *visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -85,6 +106,8 @@ namespace smtlib {
         class ExistsTerm : public Term,
                            public std::enable_shared_from_this<ExistsTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::EXISTS_TERM;
+
             std::vector<SortedVariablePtr> bindings;
             TermPtr term;
 
@@ -96,7 +119,12 @@ namespace smtlib {
                     : bindings(std::move(bindings))
                     , term(std::move(term)) {}
 
+            ~ExistsTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0 *visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -106,6 +134,8 @@ namespace smtlib {
         class MatchTerm : public Term,
                           public std::enable_shared_from_this<MatchTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::MATCH_TERM;
+
             TermPtr term;
             std::vector<MatchCasePtr> cases;
 
@@ -117,7 +147,12 @@ namespace smtlib {
                     : term(std::move(term))
                     , cases(std::move(cases)) {}
 
+            ~MatchTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0 *visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -127,6 +162,8 @@ namespace smtlib {
         class AnnotatedTerm : public Term,
                               public std::enable_shared_from_this<AnnotatedTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::ANNOTATED_TERM;
+
             TermPtr term;
             std::vector<AttributePtr> attributes;
 
@@ -138,7 +175,12 @@ namespace smtlib {
                     : term(std::move(term))
                     , attributes(std::move(attributes)) {}
 
+            ~AnnotatedTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0 *visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -22,6 +22,8 @@ namespace smtlib {
         class Theory : public Root,
                        public std::enable_shared_from_this<Theory> {
         public:
+            static constexpr NodeKind KIND = NodeKind::THEORY;
+
             SymbolPtr name;
             std::vector<AttributePtr> attributes;
 
@@ -41,7 +43,10 @@ namespace smtlib {
                     : name(std::move(name))
                     , attributes(std::move(attributes)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -19,6 +19,8 @@ namespace smtlib {
         /** A sorted variable. */
         struct SortedVariable : public Node,
                                 public std::enable_shared_from_this<SortedVariable> {
+            static constexpr NodeKind KIND = NodeKind::SORTED_VARIABLE;
+
             SymbolPtr symbol;
             SortPtr sort;
 
@@ -30,7 +32,10 @@ namespace smtlib {
                     : symbol(std::move(symbol))
                     , sort(std::move(sort)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0 *visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -39,6 +44,8 @@ namespace smtlib {
         /** A variable binding. */
         struct VariableBinding : public Node,
                                  public std::enable_shared_from_this<VariableBinding> {
+            static constexpr NodeKind KIND = NodeKind::VARIABLE_BINDING;
+
             SymbolPtr symbol;
             TermPtr term;
 
@@ -50,7 +57,10 @@ namespace smtlib {
                     : symbol(std::move(symbol))
                     , term(std::move(term)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0 *visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -3,94 +3,230 @@
 using namespace std;
 using namespace smtlib::ast;
 
-SymbolStack::SymbolStack() {
-    push();
-}
-
-SymbolTablePtr SymbolStack::getTopLevel() {
-    return stack[stack.size() - 1];
+namespace {
+    /** Append the function entries of a table for a symbol */
+    void appendFunEntries(const SymbolTablePtr& table, SymbolId id, std::vector<FunEntryPtr>& entries) {
+        FunEntryMap& funs = table->getFuns();
+        auto it = funs.find(id);
+        if (it != funs.end())
+            entries.insert(entries.end(), it->second.begin(), it->second.end());
+    }
 }
 
-std::vector<SymbolTablePtr>& SymbolStack::getLevels() {
-    return stack;
-}
+SymbolStack::SymbolStack()
+        : global(make_shared<SymbolTable>()) {}
 
 bool SymbolStack::push() {
-    size_t size = stack.size();
-    stack.push_back(make_shared<SymbolTable>());
-    return (stack.size() == size + 1);
+    sorts.push();
+    funs.push();
+    vars.push();
+    return true;
 }
 
 bool SymbolStack::push(size_t levels) {
-    size_t size = stack.size();
-    for (int i = 0; i < levels; i++)
-        stack.push_back(make_shared<SymbolTable>());
-    return (stack.size() == size + levels);
+    for (size_t i = 0; i < levels; i++)
+        push();
+    return true;
 }
 
 bool SymbolStack::pop() {
-    if (stack.size() <= 1) {
+    if (sorts.getDepth() == 0)
         return false;
-    } else {
-        size_t size = stack.size();
-        stack.erase(stack.begin() + (stack.size() - 1));
-        return (stack.size() == size - 1);
-    }
+
+    if (sorts.hasScopeBindings())
+        expansions.clear();
+    if (funs.hasScopeBindings())
+        instances.clear();
+
+    sorts.pop();
+    funs.pop();
+    vars.pop();
+    return true;
 }
 
 bool SymbolStack::pop(size_t levels) {
-    if (stack.size() <= 1 + levels || levels == 0) {
+    if (levels == 0 || sorts.getDepth() < levels)
         return false;
+
+    for (size_t i = 0; i < levels; i++)
+        pop();
+    return true;
+}
+
+void SymbolStack::reset() {
+    sorts.clear();
+    funs.clear();
+    vars.clear();
+    expansions.clear();
+    instances.clear();
+
+    // Sealed tables may be shared with other stacks, so only the entries kept on reset are copied out of them
+    if (!sealed.empty()) {
+        SymbolTablePtr table = make_shared<SymbolTable>();
+        for (const auto& sealedTable : sealed) {
+            table->mergeTheoryEntries(sealedTable);
+        }
+        table->mergeTheoryEntries(global);
+
+        global = table;
+        sealed.clear();
+        current.reset();
     } else {
-        size_t size = stack.size();
-        stack.erase(stack.begin() + (stack.size() - levels), stack.begin() + (stack.size() - 1));
-        return (stack.size() == size - levels);
+        global->reset();
     }
 }
 
-void SymbolStack::reset() {
-    pop(stack.size() - 1);
-    getTopLevel()->reset();
+void SymbolStack::mount(const SymbolTablePtr& layer) {
+    layers.push_back(layer);
+    current.reset();
+    expansions.clear();
+}
+
+SymbolTablePtr SymbolStack::mountTopLevel() {
+    SymbolTablePtr layer = global;
+    global = make_shared<SymbolTable>();
+    mount(layer);
+    return layer;
+}
+
+std::vector<SymbolTablePtr> SymbolStack::getLayers() {
+    return layers;
+}
+
+void SymbolStack::keepSourceMap(const SourceMapPtr& sources) {
+    if (sources)
+        sourceMaps.push_back(sources);
+}
+
+const std::vector<SourceMapPtr>& SymbolStack::getSourceMaps() {
+    return sourceMaps;
+}
+
+bool SymbolStack::isEmpty() {
+    return sorts.getDepth() == 0 && sealed.empty() && global->isEmpty();
+}
+
+size_t SymbolStack::getDepth() {
+    return sorts.getDepth();
+}
+
+void SymbolStack::seal() {
+    SymbolTablePtr table = global;
+    global = make_shared<SymbolTable>();
+
+    while (!sealed.empty() && sealed.back()->getSize() <= table->getSize()) {
+        SymbolTablePtr merged = make_shared<SymbolTable>();
+        merged->merge(sealed.back());
+        merged->merge(table);
+
+        sealed.pop_back();
+        table = merged;
+    }
+
+    sealed.push_back(table);
+    current.reset();
+}
+
+SymbolSnapshotPtr SymbolStack::snapshot() {
+    if (!global->isEmpty())
+        seal();
+
+    if (!current) {
+        auto result = make_shared<SymbolSnapshot>();
+        result->layers = layers;
+        result->sealed = sealed;
+        current = result;
+    }
+
+    return current;
+}
+
+void SymbolStack::restore(const SymbolSnapshotPtr& snapshot) {
+    pop(getDepth());
+
+    // Memoized expansions and instances stay valid while the entries are the same
+    if (snapshot == current && global->isEmpty())
+        return;
+
+    layers = snapshot->layers;
+    sealed = snapshot->sealed;
+    global = make_shared<SymbolTable>();
+    current = snapshot;
+
+    expansions.clear();
+    instances.clear();
 }
 
 SortEntryPtr SymbolStack::getSortEntry(const string& name) {
-    for (const auto& lvl : stack) {
-        SortEntryPtr entry = lvl->getSortEntry(name);
-        if (entry)
-            return entry;
+    SymbolId id;
+    if (!Interner::find(name, id))
+        return SortEntryPtr();
+    return getSortEntry(id);
+}
+
+SortEntryPtr SymbolStack::getSortEntry(SymbolId id) {
+    SortEntryPtr entry = sorts.get(id);
+    if (!entry)
+        entry = global->getSortEntry(id);
+
+    for (auto it = sealed.rbegin(); !entry && it != sealed.rend(); it++) {
+        entry = (*it)->getSortEntry(id);
     }
-    return SortEntryPtr();
+
+    for (auto it = layers.rbegin(); !entry && it != layers.rend(); it++) {
+        entry = (*it)->getSortEntry(id);
+    }
+    return entry;
 }
 
 std::vector<FunEntryPtr> SymbolStack::getFunEntry(const string& name) {
+    SymbolId id;
+    if (!Interner::find(name, id))
+        return std::vector<FunEntryPtr>();
+    return getFunEntry(id);
+}
+
+std::vector<FunEntryPtr> SymbolStack::getFunEntry(SymbolId id) {
     std::vector<FunEntryPtr> result;
-    for (const auto& lvl : stack) {
-        std::vector<FunEntryPtr> entries = lvl->getFunEntry(name);
-        result.insert(result.end(), entries.begin(), entries.end());
+    for (const auto& layer : layers) {
+        appendFunEntries(layer, id, result);
+    }
+    for (const auto& table : sealed) {
+        appendFunEntries(table, id, result);
     }
+    appendFunEntries(global, id, result);
+    funs.getAll(id, result);
     return result;
 }
 
 VarEntryPtr SymbolStack::getVarEntry(const string& name) {
-    for (const auto& lvl : stack) {
-        VarEntryPtr entry = lvl->getVarEntry(name);
-        if (entry)
-            return entry;
+    SymbolId id;
+    if (!Interner::find(name, id))
+        return VarEntryPtr();
+    return getVarEntry(id);
+}
+
+VarEntryPtr SymbolStack::getVarEntry(SymbolId id) {
+    VarEntryPtr entry = vars.get(id);
+    if (!entry)
+        entry = global->getVarEntry(id);
+
+    for (auto it = sealed.rbegin(); !entry && it != sealed.rend(); it++) {
+        entry = (*it)->getVarEntry(id);
     }
-    return VarEntryPtr();
+
+    for (auto it = layers.rbegin(); !entry && it != layers.rend(); it++) {
+        entry = (*it)->getVarEntry(id);
+    }
+    return entry;
 }
 
 SortEntryPtr SymbolStack::findDuplicate(const SortEntryPtr& entry) {
-    for (const auto& lvl : stack) {
-        SortEntryPtr dup = lvl->getSortEntry(entry->name);
-        if (dup)
-            return dup;
-    }
-    return SortEntryPtr();
+    return getSortEntry(entry->id);
 }
 
 FunEntryPtr SymbolStack::findDuplicate(const FunEntryPtr& entry) {
-    std::vector<FunEntryPtr> knownFuns = getFunEntry(entry->name);
+    std::vector<FunEntryPtr> knownFuns = getFunEntry(entry->id);
     for (const auto& fun : knownFuns) {
         if (entry->params.empty() && fun->params.empty()) {
             if (equal(entry->signature, fun->signature)) {
@@ -106,7 +242,14 @@ FunEntryPtr SymbolStack::findDuplicate(const FunEntryPtr& entry) {
 }
 
 VarEntryPtr SymbolStack::findDuplicate(const VarEntryPtr& entry) {
-    return getTopLevel()->getVarEntry(entry->name);
+    if (vars.getDepth() > 0)
+        return vars.getInScope(entry->id);
+
+    VarEntryPtr dup = global->getVarEntry(entry->id);
+    for (auto it = sealed.rbegin(); !dup && it != sealed.rend(); it++) {
+        dup = (*it)->getVarEntry(entry->id);
+    }
+    return dup;
 }
 
 SortPtr SymbolStack::replace(const SortPtr& sort,
@@ -143,17 +286,52 @@ SortPtr SymbolStack::expand(const SortPtr& sort) {
     if (!sort)
         return sort;
 
-    SortEntryPtr entry = getSortEntry(sort->identifier->toString());
+    // Expansions only depend on the sort entries, so they are memoized until these change
+    const CanonicalSort* canonical = sort->getCanonical();
+    auto it = expansions.find(canonical);
+    if (it == expansions.end()) {
+        // Expanding may add the expanded forms of the sort arguments, so the result is inserted afterwards
+        SortPtr result = expandUncached(sort);
+        it = expansions.emplace(canonical, result).first;
+    }
+
+    const SortPtr& expanded = it->second;
+    if (!expanded)
+        return SortPtr();
+
+    // Sorts without definitions to expand are returned as they are
+    if (expanded->getCanonical() == canonical)
+        return sort;
+
+    // Expanded sorts carry the location of the sort they were expanded from
+    if (expanded->span == sort->span)
+        return expanded;
+
+    SortPtr newsort = make_shared<Sort>(expanded->identifier, expanded->arguments);
+    newsort->span = sort->span;
+    return newsort;
+}
+
+SortPtr& SymbolStack::getInstance(const FunEntryPtr& entry, const std::vector<SortPtr>& argSorts, bool& known) {
+    std::vector<const CanonicalSort*> key;
+    key.reserve(argSorts.size());
+    for (const auto& argSort : argSorts) {
+        key.push_back(argSort->getCanonical());
+    }
+
+    auto inserted = instances[entry.get()].emplace(std::move(key), SortPtr());
+    known = !inserted.second;
+    return inserted.first->second;
+}
+
+SortPtr SymbolStack::expandUncached(const SortPtr& sort) {
+    SortEntryPtr entry = getSortEntry(sort->identifier->getNameId());
     if (!sort->hasArgs()) {
         if (entry && entry->definition) {
             if (entry->definition->params.empty()) {
                 SortPtr newsort = make_shared<Sort>(entry->definition->sort->identifier,
                                                     entry->definition->sort->arguments);
-                newsort->rowLeft = sort->rowLeft;
-                newsort->colLeft = sort->colLeft;
-                newsort->rowRight = sort->rowRight;
-                newsort->colRight = sort->colRight;
-                newsort->filename = sort->filename;
+                newsort->span = sort->span;
 
                 return newsort;
             } else {
@@ -166,19 +344,12 @@ SortPtr SymbolStack::expand(const SortPtr& sort) {
         if (entry && entry->definition) {
             if (entry->definition->params.size() == sort->arguments.size()) {
                 unordered_map<string, SortPtr> mapping;
-                for (int i = 0; i < entry->definition->params.size(); i++) {
+                for (size_t i = 0; i < entry->definition->params.size(); i++) {
                     mapping[entry->definition->params[i]->toString()] = sort->arguments[i];
                 }
 
-                SortPtr newsort = replace(entry->definition->sort, mapping);
-                newsort = expand(newsort);
-                newsort->rowLeft = sort->rowLeft;
-                newsort->colLeft = sort->colLeft;
-                newsort->rowRight = sort->rowRight;
-                newsort->colRight = sort->colRight;
-                newsort->filename = sort->filename;
-
-                return newsort;
+                // The location of the sort is set by expand(), as the result may be memoized
+                return expand(replace(entry->definition->sort, mapping));
             } else {
                 return SortPtr();
             }
@@ -201,11 +372,7 @@ SortPtr SymbolStack::expand(const SortPtr& sort) {
 
             if (changed) {
                 SortPtr newsort = make_shared<Sort>(sort->identifier, newargs);
-                newsort->rowLeft = sort->rowLeft;
-                newsort->colLeft = sort->colLeft;
-                newsort->rowRight = sort->rowRight;
-                newsort->colRight = sort->colRight;
-                newsort->filename = sort->filename;
+                newsort->span = sort->span;
 
                 return newsort;
             } else {
@@ -217,7 +384,7 @@ SortPtr SymbolStack::expand(const SortPtr& sort) {
 
 bool SymbolStack::equal(const SortPtr& sort1, const SortPtr& sort2) {
     if (sort1 && sort2) {
-        return sort1->toString() == sort2->toString();
+        return sort1->getCanonical() == sort2->getCanonical();
     } else {
         return false;
     }
@@ -260,7 +427,7 @@ bool SymbolStack::equal(const std::vector<SymbolPtr>& params1, const SortPtr& so
             return equal(sort1, sort2);
         }
     } else {
-        if (sort1->identifier->toString() != sort2->identifier->toString())
+        if (sort1->identifier->getNameId() != sort2->identifier->getNameId())
             return false;
 
         for (size_t k = 0, sz = sort1->arguments.size(); k < sz; k++) {
@@ -306,21 +473,34 @@ bool SymbolStack::equal(const std::vector<SymbolPtr>& params1,
 
 SortEntryPtr SymbolStack::tryAdd(const SortEntryPtr& entry) {
     SortEntryPtr dup = findDuplicate(entry);
-    if (!dup)
-        getTopLevel()->add(entry);
+    if (!dup) {
+        expansions.clear();
+        if (sorts.getDepth() == 0)
+            global->add(entry);
+        else
+            sorts.add(entry->id, entry);
+    }
     return dup;
 }
 
 FunEntryPtr SymbolStack::tryAdd(const FunEntryPtr& entry) {
     FunEntryPtr dup = findDuplicate(entry);
-    if (!dup)
-        getTopLevel()->add(entry);
+    if (!dup) {
+        if (funs.getDepth() == 0)
+            global->add(entry);
+        else
+            funs.add(entry->id, entry);
+    }
     return dup;
 }
 
 VarEntryPtr SymbolStack::tryAdd(const VarEntryPtr& entry) {
     VarEntryPtr dup = findDuplicate(entry);
-    if (!dup)
-        getTopLevel()->add(entry);
+    if (!dup) {
+        if (vars.getDepth() == 0)
+            global->add(entry);
+        else
+            vars.add(entry->id, entry);
+    }
     return dup;
 }
\ No newline at end of file
@@ -3,11 +3,25 @@
 #include "ast/ast_command.h"
 #include "ast/ast_symbol_decl.h"
 
+#include <algorithm>
+
 using namespace std;
 using namespace smtlib::ast;
 
-SortEntryPtr SymbolTable::getSortEntry(const string& name) {
-    auto it = sorts.find(name);
+namespace {
+    /** Whether a sort entry comes from a theory file, and is thus kept on reset */
+    inline bool isTheoryEntry(const SortEntryPtr& entry) {
+        return (bool) nodeCast<SortSymbolDeclaration>(entry->source);
+    }
+
+    /** Whether a function entry comes from a theory file, and is thus kept on reset */
+    inline bool isTheoryEntry(const FunEntryPtr& entry) {
+        return (bool) nodeCast<FunSymbolDeclaration>(entry->source);
+    }
+}
+
+SortEntryPtr SymbolTable::getSortEntry(SymbolId id) {
+    auto it = sorts.find(id);
     if (it != sorts.end()) {
         return it->second;
     } else {
@@ -16,8 +30,8 @@ SortEntryPtr SymbolTable::getSortEntry(const string& name) {
     }
 }
 
-std::vector<FunEntryPtr> SymbolTable::getFunEntry(const string& name) {
-    auto it = funs.find(name);
+std::vector<FunEntryPtr> SymbolTable::getFunEntry(SymbolId id) {
+    auto it = funs.find(id);
     if (it != funs.end()) {
         return it->second;
     } else {
@@ -26,8 +40,8 @@ std::vector<FunEntryPtr> SymbolTable::getFunEntry(const string& name) {
     }
 }
 
-VarEntryPtr SymbolTable::getVarEntry(const string& name) {
-    auto it = vars.find(name);
+VarEntryPtr SymbolTable::getVarEntry(SymbolId id) {
+    auto it = vars.find(id);
     if (it != vars.end()) {
         return it->second;
     } else {
@@ -37,8 +51,8 @@ VarEntryPtr SymbolTable::getVarEntry(const string& name) {
 }
 
 bool SymbolTable::add(const SortEntryPtr& entry) {
-    if(sorts.find(entry->name) == sorts.end()) {
-        sorts[entry->name] = entry;
+    if(sorts.find(entry->id) == sorts.end()) {
+        sorts[entry->id] = entry;
         return true;
     } else {
         return false;
@@ -46,51 +60,74 @@ bool SymbolTable::add(const SortEntryPtr& entry) {
 }
 
 bool SymbolTable::add(const FunEntryPtr& entry) {
-    funs[entry->name].push_back(entry);
+    funs[entry->id].push_back(entry);
     return true;
 }
 
 bool SymbolTable::add(const VarEntryPtr& entry) {
-    if(vars.find(entry->name) == vars.end()) {
-        vars[entry->name] = entry;
+    if(vars.find(entry->id) == vars.end()) {
+        vars[entry->id] = entry;
         return true;
     } else {
         return false;
     }
 }
 
-void SymbolTable::reset() {
-    // Clear all variables
-    vars.clear();
+void SymbolTable::merge(const SymbolTablePtr& table) {
+    // The entries of the global level are never duplicated, so only overloads need ordering
+    sorts.insert(table->sorts.begin(), table->sorts.end());
+    vars.insert(table->vars.begin(), table->vars.end());
+
+    for (const auto& fun : table->funs) {
+        std::vector<FunEntryPtr>& entries = funs[fun.first];
+        entries.insert(entries.end(), fun.second.begin(), fun.second.end());
+    }
+}
 
-    // Erase sort information that does not come from theory files
-    std::vector<SortEntryPtr> sortEntries;
-    for (const auto& sort : sorts) {
-        sortEntries.push_back(sort.second);
+void SymbolTable::mergeTheoryEntries(const SymbolTablePtr& table) {
+    for (const auto& sort : table->sorts) {
+        if (isTheoryEntry(sort.second))
+            sorts.insert(sort);
     }
 
-    for (const auto& sortEntry : sortEntries) {
-        if(!dynamic_pointer_cast<SortSymbolDeclaration>(sortEntry->source)) {
-            sorts.erase(sortEntry->name);
+    for (const auto& fun : table->funs) {
+        for (const auto& entry : fun.second) {
+            if (isTheoryEntry(entry))
+                funs[fun.first].push_back(entry);
         }
     }
+}
+
+void SymbolTable::reset() {
+    // Clear all variables
+    vars.clear();
 
-    // Erase function information that does not come from theory files
-    vector<string> funKeys;
-    vector<std::vector<FunEntryPtr>> funEntry;
-    for (const auto& fun : funs) {
-        funKeys.push_back(fun.first);
-        funEntry.push_back(fun.second);
+    // Erase sort entries that do not come from theory files
+    for (auto it = sorts.begin(); it != sorts.end();) {
+        if (!isTheoryEntry(it->second))
+            it = sorts.erase(it);
+        else
+            it++;
     }
 
-    for (int i = 0; i < funKeys.size(); i++) {
-        std::vector<FunEntryPtr>& entry = funs[funKeys[i]];
-        for (int j = 0; j < funEntry[i].size(); j++) {
-            if(!dynamic_pointer_cast<FunSymbolDeclaration>(funEntry[i][j]->source)) {
-                entry.erase(entry.begin() + j);
-            }
-        }
-        if(entry.empty())
-            funs.erase(funKeys[i]);
+    // Erase function entries that do not come from theory files
+    for (auto it = funs.begin(); it != funs.end();) {
+        std::vector<FunEntryPtr>& entries = it->second;
+        entries.erase(remove_if(entries.begin(), entries.end(),
+                                [](const FunEntryPtr& entry) { return !isTheoryEntry(entry); }),
+                      entries.end());
+
+        if (entries.empty())
+            it = funs.erase(it);
+        else
+            it++;
     }
-}
\ No newline at end of file
+}
+
+bool SymbolTable::isEmpty() {
+    return sorts.empty() && funs.empty() && vars.empty();
+}
+
+size_t SymbolTable::getSize() {
+    return sorts.size() + funs.size() + vars.size();
+}
@@ -9,9 +9,12 @@
 
 namespace smtlib {
     namespace ast {
-        typedef std::unordered_map<std::string, SortEntryPtr> SortEntryMap;
-        typedef std::unordered_map<std::string, std::vector<FunEntryPtr>> FunEntryMap;
-        typedef std::unordered_map<std::string, VarEntryPtr> VarEntryMap;
+        typedef std::unordered_map<SymbolId, SortEntryPtr> SortEntryMap;
+        typedef std::unordered_map<SymbolId, std::vector<FunEntryPtr>> FunEntryMap;
+        typedef std::unordered_map<SymbolId, VarEntryPtr> VarEntryMap;
+
+        class SymbolTable;
+        typedef std::shared_ptr<SymbolTable> SymbolTablePtr;
 
         class SymbolTable {
         private:
@@ -32,18 +35,29 @@ namespace smtlib {
                 return vars;
             }
 
-            SortEntryPtr getSortEntry(const std::string& name);
-            std::vector<FunEntryPtr> getFunEntry(const std::string& name);
-            VarEntryPtr getVarEntry(const std::string& name);
+            SortEntryPtr getSortEntry(SymbolId id);
+            std::vector<FunEntryPtr> getFunEntry(SymbolId id);
+            VarEntryPtr getVarEntry(SymbolId id);
 
             bool add(const SortEntryPtr& entry);
             bool add(const FunEntryPtr& entry);
             bool add(const VarEntryPtr& entry);
 
+            /** Add the entries of another table, after the entries of this one */
+            void merge(const SymbolTablePtr& table);
+
+            /** Add the entries of another table that are kept on reset (i.e. declared in theory files) */
+            void mergeTheoryEntries(const SymbolTablePtr& table);
+
+            /** Erase the entries that are not declared in theory files */
             void reset();
-        };
 
-        typedef std::shared_ptr<SymbolTable> SymbolTablePtr;
+            /** Whether the table has no entries */
+            bool isEmpty();
+
+            /** Number of entries in the table */
+            size_t getSize();
+        };
     }
 }
 
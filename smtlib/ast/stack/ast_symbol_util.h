@@ -4,6 +4,8 @@
 #include "ast/ast_basic.h"
 #include "ast/ast_term.h"
 
+#include "util/interner.h"
+
 #include <memory>
 #include <string>
 
@@ -13,12 +15,15 @@ namespace smtlib {
         class SymbolEntry {
         public:
             std::string name;
+            /** Interned identifier of the name, used as symbol table key */
+            SymbolId id { 0 };
             ast::NodePtr source;
 
             inline SymbolEntry() = default;
 
             inline SymbolEntry(std::string name, ast::NodePtr source)
                     : name(std::move(name))
+                    , id(Interner::intern(this->name))
                     , source(std::move(source)) {}
 
             virtual ~SymbolEntry();
@@ -168,6 +173,41 @@ namespace smtlib {
                     , params(std::move(params))
                     , attributes(std::move(attributes))
                     , body(std::move(body)) {}
+
+            /**
+             * Whether the function can be applied to a number of arguments.
+             * With at least two arguments, associative, chainable and pairwise functions take any number of them
+             */
+            inline bool acceptsArity(size_t count) const {
+                return isVariadic(count) || signature.size() == count + 1;
+            }
+
+            /**
+             * Sort of an argument of the function, when applied to a number of arguments.
+             * Accounts for its attributes, without expanding the signature to one sort per argument
+             */
+            inline const ast::SortPtr& getArgumentSort(size_t index, size_t count) const {
+                if (!isVariadic(count))
+                    return signature[index];
+
+                if (assocL)
+                    return signature[index == 0 ? 0 : 1];
+
+                if (assocR)
+                    return signature[index + 1 < count ? 0 : 1];
+
+                return signature[0];
+            }
+
+            /** Sort returned by the function, when applied to a number of arguments */
+            inline const ast::SortPtr& getResultSort(size_t count) const {
+                return isVariadic(count) ? signature[2] : signature.back();
+            }
+
+        private:
+            inline bool isVariadic(size_t count) const {
+                return count >= 2 && (assocL || assocR || chainable || pairwise);
+            }
         };
 
         typedef std::shared_ptr<FunEntry> FunEntryPtr;
@@ -21,8 +21,8 @@ SortednessChecker::NodeErrorPtr SortednessChecker::addError(const string& messag
     if (!err) {
         err = std::move(make_shared<NodeError>(std::move(make_shared<Error>(message)), node));
 
-        if (node && node->filename)
-            errors[*(node->filename)].push_back(err);
+        if (node && node->getFilename())
+            errors[*(node->getFilename())].push_back(err);
         else
             errors[""].push_back(err);
     } else {
@@ -38,8 +38,8 @@ SortednessChecker::NodeErrorPtr SortednessChecker::addError(const string& messag
                                                             SortednessChecker::NodeErrorPtr& err) {
     if (!err) {
         err = std::move(make_shared<NodeError>(std::move(make_shared<Error>(message, entry)), node));
-        if (node && node->filename)
-            errors[*(node->filename)].push_back(err);
+        if (node && node->getFilename())
+            errors[*(node->getFilename())].push_back(err);
         else
             errors[""].push_back(err);
     } else {
@@ -51,8 +51,8 @@ SortednessChecker::NodeErrorPtr SortednessChecker::addError(const string& messag
 
 void SortednessChecker::addError(const string& message, const NodePtr& node) {
     NodeErrorPtr err = std::move(make_shared<NodeError>(std::move(make_shared<Error>(message)), node));
-    if (node && node->filename)
-        errors[*(node->filename)].push_back(std::move(err));
+    if (node && node->getFilename())
+        errors[*(node->getFilename())].push_back(std::move(err));
     else
         errors[""].push_back(std::move(err));
 }
@@ -60,49 +60,52 @@ void SortednessChecker::addError(const string& message, const NodePtr& node) {
 void SortednessChecker::addError(const string& message, const NodePtr& node,
                                  const SymbolEntryPtr& entry) {
     NodeErrorPtr err = std::move(make_shared<NodeError>(std::move(make_shared<Error>(message, entry)), node));
-    errors[*(node->filename)].push_back(std::move(err));
+    if (node && node->getFilename())
+        errors[*(node->getFilename())].push_back(std::move(err));
+    else
+        errors[""].push_back(std::move(err));
 }
 
-SortEntryPtr SortednessChecker::getEntry(const DeclareSortCommandPtr& node) {
+SortEntryPtr SortednessChecker::getEntry(DeclareSortCommand* node) {
     return make_shared<SortEntry>(std::move(node->symbol->toString()),
-                                 node->arity->value, node);
+                                 node->arity->value, node->shared_from_this());
 }
 
-SortEntryPtr SortednessChecker::getEntry(const DefineSortCommandPtr& node) {
+SortEntryPtr SortednessChecker::getEntry(DefineSortCommand* node) {
     return make_shared<SortEntry>(std::move(node->symbol->toString()),
                                  node->parameters.size(),
                                  node->parameters,
-                                 ctx->getStack()->expand(node->sort), node);
+                                 ctx->getStack()->expand(node->sort), node->shared_from_this());
 }
 
-SortEntryPtr SortednessChecker::getEntry(const SortSymbolDeclarationPtr& node) {
+SortEntryPtr SortednessChecker::getEntry(SortSymbolDeclaration* node) {
     return make_shared<SortEntry>(std::move(node->identifier->toString()),
                                  node->arity->value,
-                                 node->attributes, node);
+                                 node->attributes, node->shared_from_this());
 }
 
-FunEntryPtr SortednessChecker::getEntry(const SpecConstFunDeclarationPtr& node) {
+FunEntryPtr SortednessChecker::getEntry(SpecConstFunDeclaration* node) {
     std::vector<SortPtr> sig;
     sig.push_back(ctx->getStack()->expand(node->sort));
     return make_shared<FunEntry>(std::move(node->constant->toString()),
-                                sig, node->attributes, node);
+                                sig, node->attributes, node->shared_from_this());
 }
 
-FunEntryPtr SortednessChecker::getEntry(const MetaSpecConstFunDeclarationPtr& node) {
+FunEntryPtr SortednessChecker::getEntry(MetaSpecConstFunDeclaration* node) {
     std::vector<SortPtr> sig;
     sig.push_back(ctx->getStack()->expand(node->sort));
     return make_shared<FunEntry>(std::move(node->constant->toString()),
-                                sig, node->attributes, node);
+                                sig, node->attributes, node->shared_from_this());
 }
 
-FunEntryPtr SortednessChecker::getEntry(const SimpleFunDeclarationPtr& node) {
+FunEntryPtr SortednessChecker::getEntry(SimpleFunDeclaration* node) {
     std::vector<SortPtr> newsig;
     for (const auto& sort : node->signature) {
         newsig.push_back(ctx->getStack()->expand(sort));
     }
 
     FunEntryPtr funEntry = make_shared<FunEntry>(std::move(node->identifier->toString()),
-                                              newsig, node->attributes, node);
+                                              newsig, node->attributes, node->shared_from_this());
     for (const auto& attr : node->attributes) {
         string attrString = attr->toString();
         if (attrString == KW_RIGHT_ASSOC) {
@@ -125,14 +128,14 @@ FunEntryPtr SortednessChecker::getEntry(const SimpleFunDeclarationPtr& node) {
     return funEntry;
 }
 
-FunEntryPtr SortednessChecker::getEntry(const ParametricFunDeclarationPtr& node) {
+FunEntryPtr SortednessChecker::getEntry(ParametricFunDeclaration* node) {
     std::vector<SortPtr> newsig;
     for (const auto& sort : node->signature) {
         newsig.push_back(ctx->getStack()->expand(sort));
     }
 
     FunEntryPtr funEntry = make_shared<FunEntry>(std::move(node->identifier->toString()), newsig,
-                                              node->parameters, node->attributes, node);
+                                              node->parameters, node->attributes, node->shared_from_this());
 
     for (const auto& attr : node->attributes) {
         string attrString = attr->toString();
@@ -156,14 +159,14 @@ FunEntryPtr SortednessChecker::getEntry(const ParametricFunDeclarationPtr& node)
     return funEntry;
 }
 
-FunEntryPtr SortednessChecker::getEntry(const DeclareConstCommandPtr& node) {
+FunEntryPtr SortednessChecker::getEntry(DeclareConstCommand* node) {
     std::vector<SortPtr> newsig;
     newsig.push_back(ctx->getStack()->expand(node->sort));
 
-    return make_shared<FunEntry>(node->symbol->toString(), newsig, node);
+    return make_shared<FunEntry>(node->symbol->toString(), newsig, node->shared_from_this());
 }
 
-FunEntryPtr SortednessChecker::getEntry(const DeclareFunCommandPtr& node) {
+FunEntryPtr SortednessChecker::getEntry(DeclareFunCommand* node) {
     std::vector<SortPtr> newsig;
     for (const auto& param : node->parameters) {
         SortPtr itsort = ctx->getStack()->expand(param);
@@ -172,10 +175,10 @@ FunEntryPtr SortednessChecker::getEntry(const DeclareFunCommandPtr& node) {
     SortPtr retsort = ctx->getStack()->expand(node->sort);
     newsig.push_back(retsort);
 
-    return make_shared<FunEntry>(node->symbol->toString(), newsig, node);
+    return make_shared<FunEntry>(node->symbol->toString(), newsig, node->shared_from_this());
 }
 
-FunEntryPtr SortednessChecker::getEntry(const DefineFunCommandPtr& node) {
+FunEntryPtr SortednessChecker::getEntry(DefineFunCommand* node) {
     std::vector<SortPtr> newsig;
     for (const auto& param : node->definition->signature->parameters) {
         newsig.push_back(ctx->getStack()->expand(param->sort));
@@ -183,10 +186,10 @@ FunEntryPtr SortednessChecker::getEntry(const DefineFunCommandPtr& node) {
     newsig.push_back(ctx->getStack()->expand(node->definition->signature->sort));
 
     return make_shared<FunEntry>(node->definition->signature->symbol->toString(),
-                                newsig, node->definition->body, node);
+                                newsig, node->definition->body, node->shared_from_this());
 }
 
-FunEntryPtr SortednessChecker::getEntry(const DefineFunRecCommandPtr& node) {
+FunEntryPtr SortednessChecker::getEntry(DefineFunRecCommand* node) {
     std::vector<SortPtr> newsig;
 
     for (const auto& param : node->definition->signature->parameters) {
@@ -195,10 +198,10 @@ FunEntryPtr SortednessChecker::getEntry(const DefineFunRecCommandPtr& node) {
     newsig.push_back(ctx->getStack()->expand(node->definition->signature->sort));
 
     return make_shared<FunEntry>(std::move(node->definition->signature->symbol->toString()),
-                                newsig, node->definition->body, node);
+                                newsig, node->definition->body, node->shared_from_this());
 }
 
-std::vector<FunEntryPtr> SortednessChecker::getEntry(const DefineFunsRecCommandPtr& node) {
+std::vector<FunEntryPtr> SortednessChecker::getEntry(DefineFunsRecCommand* node) {
     std::vector<FunEntryPtr> entries;
     for (size_t i = 0, sz = node->declarations.size(); i < sz; i++) {
         std::vector<SortPtr> newsig;
@@ -208,22 +211,22 @@ std::vector<FunEntryPtr> SortednessChecker::getEntry(const DefineFunsRecCommandP
         newsig.push_back(ctx->getStack()->expand(node->declarations[i]->sort));
 
         entries.push_back(make_shared<FunEntry>(node->declarations[i]->symbol->toString(),
-                                             newsig, node->bodies[i], node));
+                                             newsig, node->bodies[i], node->shared_from_this()));
     }
 
     return entries;
 }
 
-std::vector<SymbolEntryPtr> SortednessChecker::getEntry(const DeclareDatatypeCommandPtr& node) {
+std::vector<SymbolEntryPtr> SortednessChecker::getEntry(DeclareDatatypeCommand* node) {
     std::vector<SymbolEntryPtr> entry;
     string typeName = node->symbol->toString();
 
     ParametricDatatypeDeclarationPtr pdecl =
-            dynamic_pointer_cast<ParametricDatatypeDeclaration>(node->declaration);
+            nodeCast<ParametricDatatypeDeclaration>(node->declaration);
 
     if (pdecl) {
         // Add datatype (parametric) sort entry
-        entry.push_back(make_shared<SortEntry>(typeName, pdecl->parameters.size(), node));
+        entry.push_back(make_shared<SortEntry>(typeName, pdecl->parameters.size(), node->shared_from_this()));
 
         // Build a sort representing the datatype (to be used in the signatures of the constructors and selectors)
         SortPtr typeSort = make_shared<Sort>(std::move(make_shared<SimpleIdentifier>(node->symbol)));
@@ -251,24 +254,24 @@ std::vector<SymbolEntryPtr> SortednessChecker::getEntry(const DeclareDatatypeCom
                 selSig.push_back(ctx->getStack()->expand(sel->sort));
 
                 // Add selector function entry
-                entry.push_back(make_shared<FunEntry>(selName, selSig, pdecl->parameters, node));
+                entry.push_back(make_shared<FunEntry>(selName, selSig, pdecl->parameters, node->shared_from_this()));
             }
 
             // Add constructor function entry
             consSig.push_back(typeSort);
-            entry.push_back(make_shared<FunEntry>(consName, consSig, pdecl->parameters, node));
+            entry.push_back(make_shared<FunEntry>(consName, consSig, pdecl->parameters, node->shared_from_this()));
         }
 
     } else {
         // Add datatype (non-parametric) sort entry
-        entry.push_back(make_shared<SortEntry>(typeName, 0, node));
+        entry.push_back(make_shared<SortEntry>(typeName, 0, node->shared_from_this()));
 
         // Build a sort representing the datatype (to be used in the signatures of the constructors and selectors)
         SortPtr typeSort = make_shared<Sort>(make_shared<SimpleIdentifier>(node->symbol));
         typeSort = ctx->getStack()->expand(typeSort);
 
         SimpleDatatypeDeclarationPtr sdecl =
-                dynamic_pointer_cast<SimpleDatatypeDeclaration>(node->declaration);
+                nodeCast<SimpleDatatypeDeclaration>(node->declaration);
 
         for (const auto& cons : sdecl->constructors) {
             // Start building function entry for current constructor
@@ -286,19 +289,19 @@ std::vector<SymbolEntryPtr> SortednessChecker::getEntry(const DeclareDatatypeCom
                 selSig.push_back(ctx->getStack()->expand(sel->sort));
 
                 // Add selector function entry
-                entry.push_back(make_shared<FunEntry>(selName, selSig, node));
+                entry.push_back(make_shared<FunEntry>(selName, selSig, node->shared_from_this()));
             }
 
             // Add constructor function entry
             consSig.push_back(typeSort);
-            entry.push_back(make_shared<FunEntry>(consName, consSig, node));
+            entry.push_back(make_shared<FunEntry>(consName, consSig, node->shared_from_this()));
         }
     }
 
     return entry;
 }
 
-std::vector<SymbolEntryPtr> SortednessChecker::getEntry(const DeclareDatatypesCommandPtr& node) {
+std::vector<SymbolEntryPtr> SortednessChecker::getEntry(DeclareDatatypesCommand* node) {
     std::vector<SymbolEntryPtr> entries;
 
     std::vector<SortDeclarationPtr>& datatypeSorts = node->sorts;
@@ -307,12 +310,12 @@ std::vector<SymbolEntryPtr> SortednessChecker::getEntry(const DeclareDatatypesCo
         size_t arity = (size_t) sort->arity->value;
 
         // Add datatype sort info
-        entries.push_back(make_shared<SortEntry>(typeName, arity, node));
+        entries.push_back(make_shared<SortEntry>(typeName, arity, node->shared_from_this()));
     }
 
     for (size_t i = 0, sz = node->sorts.size(); i < sz; i++) {
         ParametricDatatypeDeclarationPtr pdecl =
-                dynamic_pointer_cast<ParametricDatatypeDeclaration>(node->declarations[i]);
+                nodeCast<ParametricDatatypeDeclaration>(node->declarations[i]);
         if (pdecl) {
             // Build a sort representing the datatype (to be used in the signatures of the constructors and selectors)
             SortPtr typeSort =
@@ -341,12 +344,14 @@ std::vector<SymbolEntryPtr> SortednessChecker::getEntry(const DeclareDatatypesCo
                     selSig.push_back(ctx->getStack()->expand(sel->sort));
 
                     // Add selector function entry
-                    entries.push_back(make_shared<FunEntry>(selName, selSig, pdecl->parameters, node));
+                    entries.push_back(make_shared<FunEntry>(selName, selSig, pdecl->parameters,
+                                                            node->shared_from_this()));
                 }
 
                 // Add constructor function entry
                 consSig.push_back(typeSort);
-                entries.push_back(make_shared<FunEntry>(consName, consSig, pdecl->parameters, node));
+                entries.push_back(make_shared<FunEntry>(consName, consSig, pdecl->parameters,
+                                                        node->shared_from_this()));
             }
         } else {
             // Build a sort representing the datatype (to be used in the signatures of the constructors and selectors)
@@ -355,7 +360,7 @@ std::vector<SymbolEntryPtr> SortednessChecker::getEntry(const DeclareDatatypesCo
             typeSort = ctx->getStack()->expand(typeSort);
 
             SimpleDatatypeDeclarationPtr sdecl =
-                    dynamic_pointer_cast<SimpleDatatypeDeclaration>(node->declarations[i]);
+                    nodeCast<SimpleDatatypeDeclaration>(node->declarations[i]);
 
             for (const auto& cons : sdecl->constructors) {
                 // Start building function entry for current constructor
@@ -373,12 +378,12 @@ std::vector<SymbolEntryPtr> SortednessChecker::getEntry(const DeclareDatatypesCo
                     selSig.push_back(ctx->getStack()->expand(sel->sort));
 
                     // Add selector function entry
-                    entries.push_back(make_shared<FunEntry>(selName, selSig, node));
+                    entries.push_back(make_shared<FunEntry>(selName, selSig, node->shared_from_this()));
                 }
 
                 // Add constructor function entry
                 consSig.push_back(typeSort);
-                entries.push_back(make_shared<FunEntry>(consName, consSig, node));
+                entries.push_back(make_shared<FunEntry>(consName, consSig, node->shared_from_this()));
             }
         }
     }
@@ -398,6 +403,22 @@ void SortednessChecker::loadTheory(const string& theory, const NodePtr& node, No
     if (f) {
         fclose(f);
 
+        // Without any declarations in the stack, loading the theory only depends on the mounted layers
+        SymbolStackPtr stack = ctx->getStack();
+        FileTime time;
+        bool cacheable = stack->isEmpty() && getFileTime(path, time);
+
+        SymbolLayerCache::Entry cached;
+        if (cacheable && SymbolLayerCache::find(path, time, stack->getLayers(), cached)) {
+            for (const auto& layer : cached.layers) {
+                stack->mount(layer);
+            }
+            for (const auto& sources : cached.sourceMaps) {
+                stack->keepSourceMap(sources);
+            }
+            return;
+        }
+
         ExecutionSettingsPtr settings = make_shared<ExecutionSettings>();
         settings->setInputFromFile(path);
         settings->setCoreTheoryEnabled(false);
@@ -405,8 +426,14 @@ void SortednessChecker::loadTheory(const string& theory, const NodePtr& node, No
 
         Execution exec(settings);
         if (exec.parse()) {
-            if (exec.checkSortedness()) {
-                //currentTheories[theory] = true;
+            stack->keepSourceMap(exec.getSourceMap());
+
+            if (exec.checkSortedness() && cacheable) {
+                SymbolLayerCache::Entry entry;
+                entry.bases = stack->getLayers();
+                entry.layers.push_back(stack->mountTopLevel());
+                entry.sourceMaps.push_back(exec.getSourceMap());
+                SymbolLayerCache::add(path, time, entry);
             }
         } else {
             addError(ErrorMessages::buildTheoryUnloadable(theory), node, err);
@@ -423,6 +450,25 @@ void SortednessChecker::loadLogic(const string& logic, const NodePtr& node, Node
     if (f) {
         fclose(f);
 
+        SymbolStackPtr stack = ctx->getStack();
+        FileTime time;
+        bool cacheable = stack->isEmpty() && ctx->getCurrentTheories().empty() && getFileTime(path, time);
+
+        SymbolLayerCache::Entry cached;
+        if (cacheable && SymbolLayerCache::find(path, time, stack->getLayers(), cached)) {
+            for (const auto& layer : cached.layers) {
+                stack->mount(layer);
+            }
+            for (const auto& sources : cached.sourceMaps) {
+                stack->keepSourceMap(sources);
+            }
+            ctx->getCurrentTheories() = cached.theories;
+            return;
+        }
+
+        std::vector<SymbolTablePtr> bases = stack->getLayers();
+        size_t keptSourceMaps = stack->getSourceMaps().size();
+
         ExecutionSettingsPtr settings = make_shared<ExecutionSettings>();
         settings->setInputFromFile(path);
         settings->setCoreTheoryEnabled(false);
@@ -430,7 +476,22 @@ void SortednessChecker::loadLogic(const string& logic, const NodePtr& node, Node
 
         Execution exec(settings);
         if (exec.parse()) {
-            exec.checkSortedness();
+            stack->keepSourceMap(exec.getSourceMap());
+
+            // Cache the logic only if all of its theories were loaded as layers
+            if (exec.checkSortedness() && cacheable && stack->isEmpty()) {
+                std::vector<SymbolTablePtr> layers = stack->getLayers();
+
+                SymbolLayerCache::Entry entry;
+                entry.bases = bases;
+                entry.layers.assign(layers.begin() + bases.size(), layers.end());
+                entry.theories = ctx->getCurrentTheories();
+
+                // Along with those of its theories
+                const std::vector<SourceMapPtr>& sourceMaps = stack->getSourceMaps();
+                entry.sourceMaps.assign(sourceMaps.begin() + keptSourceMaps, sourceMaps.end());
+                SymbolLayerCache::add(path, time, entry);
+            }
         } else {
             addError(ErrorMessages::buildLogicUnloadable(logic), node, err);
         }
@@ -442,20 +503,20 @@ void SortednessChecker::loadLogic(const string& logic, const NodePtr& node, Node
 SortednessChecker::NodeErrorPtr SortednessChecker::checkSort(const SortPtr& sort,
                                                              const NodePtr& source,
                                                              SortednessChecker::NodeErrorPtr& err) {
-    string name = sort->identifier->toString();
-    SortEntryPtr entry = ctx->getStack()->getSortEntry(name);
+    SortEntryPtr entry = ctx->getStack()->getSortEntry(sort->identifier->getNameId());
     if (!entry) {
-        err = addError(ErrorMessages::buildSortUnknown(name, sort->rowLeft, sort->colLeft,
-                                                       sort->rowRight, sort->colRight), source, err);
+        string name = sort->identifier->toString();
+        err = addError(ErrorMessages::buildSortUnknown(name, sort->getRowLeft(), sort->getColLeft(),
+                                                       sort->getRowRight(), sort->getColRight()), source, err);
 
         for (const auto& arg : sort->arguments) {
             checkSort(arg, source, err);
         }
     } else {
         if (sort->arguments.size() != entry->arity) {
-            err = addError(ErrorMessages::buildSortArity(name, entry->arity, sort->arguments.size(),
-                                                         sort->rowLeft, sort->colLeft,
-                                                         sort->rowRight, sort->colRight),
+            err = addError(ErrorMessages::buildSortArity(entry->name, entry->arity, sort->arguments.size(),
+                                                         sort->getRowLeft(), sort->getColLeft(),
+                                                         sort->getRowRight(), sort->getColRight()),
                            source, entry, err);
         } else {
             for (const auto& arg : sort->arguments) {
@@ -470,18 +531,19 @@ SortednessChecker::NodeErrorPtr SortednessChecker::checkSort(const std::vector<S
                                                              const SortPtr& sort,
                                                              const NodePtr& source,
                                                              SortednessChecker::NodeErrorPtr& err) {
-    string name = sort->identifier->toString();
+    SymbolId nameId = sort->identifier->getNameId();
     bool isParam = false;
     for (const auto& param : params) {
-        if (name == param->toString())
+        if (nameId == param->id)
             isParam = true;
     }
 
     if (!isParam) {
-        SortEntryPtr entry = ctx->getStack()->getSortEntry(name);
+        SortEntryPtr entry = ctx->getStack()->getSortEntry(nameId);
         if (!entry) {
-            err = addError(ErrorMessages::buildSortUnknown(name, sort->rowLeft, sort->colLeft,
-                                                           sort->rowRight, sort->colRight), source, err);
+            string name = sort->identifier->toString();
+            err = addError(ErrorMessages::buildSortUnknown(name, sort->getRowLeft(), sort->getColLeft(),
+                                                           sort->getRowRight(), sort->getColRight()), source, err);
             for (const auto& arg : sort->arguments) {
                 checkSort(params, arg, source, err);
             }
@@ -490,9 +552,9 @@ SortednessChecker::NodeErrorPtr SortednessChecker::checkSort(const std::vector<S
                 return err;
 
             if (sort->arguments.size() != entry->arity) {
-                err = addError(ErrorMessages::buildSortArity(name, entry->arity, sort->arguments.size(),
-                                                             sort->rowLeft, sort->colLeft,
-                                                             sort->rowRight, sort->colRight),
+                err = addError(ErrorMessages::buildSortArity(entry->name, entry->arity, sort->arguments.size(),
+                                                             sort->getRowLeft(), sort->getColLeft(),
+                                                             sort->getRowRight(), sort->getColRight()),
                                source, entry, err);
             } else {
                 for (const auto& arg : sort->arguments) {
@@ -505,7 +567,15 @@ SortednessChecker::NodeErrorPtr SortednessChecker::checkSort(const std::vector<S
     return err;
 }
 
-void SortednessChecker::visit(const AssertCommandPtr& node) {
+bool SortednessChecker::deferBody(const CommandPtr& cmd) {
+    if (!bodyHandler || ctx->getStack()->getDepth() > 0)
+        return false;
+
+    bodyHandler(cmd);
+    return true;
+}
+
+void SortednessChecker::checkAssertion(AssertCommand* node) {
     TermSorter sorter(shared_from_this());
     SortPtr result = sorter.run(node->term);
     if (result) {
@@ -513,50 +583,94 @@ void SortednessChecker::visit(const AssertCommandPtr& node) {
         if (resstr != SORT_BOOL) {
             TermPtr term = node->term;
             addError(ErrorMessages::buildAssertTermNotBool(term->toString(), resstr,
-                                                           term->rowLeft, term->colLeft,
-                                                           term->rowRight, term->colRight), node);
+                                                           term->getRowLeft(), term->getColLeft(),
+                                                           term->getRowRight(), term->getColRight()),
+                     node->shared_from_this());
         }
     } else {
         TermPtr term = node->term;
         addError(ErrorMessages::buildAssertTermNotWellSorted(term->toString(),
-                                                             term->rowLeft, term->colLeft,
-                                                             term->rowRight, term->colRight), node);
+                                                             term->getRowLeft(), term->getColLeft(),
+                                                             term->getRowRight(), term->getColRight()),
+                 node->shared_from_this());
+    }
+}
+
+void SortednessChecker::checkDefinition(const NodePtr& node, const FunctionDefinitionPtr& definition,
+                                        const FunEntryPtr& entry, bool recursive) {
+    ctx->getStack()->push();
+
+    if (recursive)
+        ctx->getStack()->tryAdd(entry);
+
+    for (const auto& bind : definition->signature->parameters) {
+        ctx->getStack()->tryAdd(make_shared<VarEntry>(bind->symbol->toString(),
+                                                     ctx->getStack()->expand(bind->sort),
+                                                      node));
+    }
+
+    TermSorter sorter(shared_from_this());
+    SortPtr result = sorter.run(definition->body);
+
+    if (result) {
+        string retstr = entry->signature[entry->signature.size() - 1]->toString();
+        string resstr = result->toString();
+        if (resstr != retstr) {
+            TermPtr body = definition->body;
+            addError(ErrorMessages::buildFunBodyWrongSort(body->toString(), resstr, retstr,
+                                                          body->getRowLeft(), body->getColLeft(),
+                                                          body->getRowRight(), body->getColRight()),
+                     node);
+        }
+    } else {
+        TermPtr body = definition->body;
+        addError(ErrorMessages::buildFunBodyNotWellSorted(body->toString(),
+                                                          body->getRowLeft(), body->getColLeft(),
+                                                          body->getRowRight(), body->getColRight()),
+                 node);
     }
+
+    ctx->getStack()->pop();
+}
+
+void SortednessChecker::visit(AssertCommand* node) {
+    if (!deferBody(node->shared_from_this()))
+        checkAssertion(node);
 }
 
-void SortednessChecker::visit(const DeclareConstCommandPtr& node) {
+void SortednessChecker::visit(DeclareConstCommand* node) {
     NodeErrorPtr err;
-    err = checkSort(node->sort, node, err);
+    err = checkSort(node->sort, node->shared_from_this(), err);
 
     FunEntryPtr nodeEntry = getEntry(node);
     FunEntryPtr dupEntry = ctx->getStack()->tryAdd(nodeEntry);
 
     if (dupEntry) {
-        addError(ErrorMessages::buildConstAlreadyExists(nodeEntry->name), node, dupEntry, err);
+        addError(ErrorMessages::buildConstAlreadyExists(nodeEntry->name), node->shared_from_this(), dupEntry, err);
     }
 }
 
-void SortednessChecker::visit(const DeclareFunCommandPtr& node) {
+void SortednessChecker::visit(DeclareFunCommand* node) {
     NodeErrorPtr err;
     for (const auto& param : node->parameters) {
-        err = checkSort(param, node, err);
+        err = checkSort(param, node->shared_from_this(), err);
     }
 
-    err = checkSort(node->sort, node, err);
+    err = checkSort(node->sort, node->shared_from_this(), err);
 
     FunEntryPtr nodeEntry = getEntry(node);
     FunEntryPtr dupEntry = ctx->getStack()->tryAdd(nodeEntry);
 
     if (dupEntry) {
-        addError(ErrorMessages::buildFunAlreadyExists(nodeEntry->name), node, dupEntry, err);
+        addError(ErrorMessages::buildFunAlreadyExists(nodeEntry->name), node->shared_from_this(), dupEntry, err);
     }
 }
 
-void SortednessChecker::visit(const DeclareDatatypeCommandPtr& node) {
+void SortednessChecker::visit(DeclareDatatypeCommand* node) {
     NodeErrorPtr err;
 
     ParametricDatatypeDeclarationPtr pdecl =
-            dynamic_pointer_cast<ParametricDatatypeDeclaration>(node->declaration);
+            nodeCast<ParametricDatatypeDeclaration>(node->declaration);
 
     std::vector<SymbolEntryPtr> entries = getEntry(node);
     for (const auto& entry : entries) {
@@ -565,7 +679,8 @@ void SortednessChecker::visit(const DeclareDatatypeCommandPtr& node) {
             SortEntryPtr dupEntry = ctx->getStack()->tryAdd(sortEntry);
 
             if (dupEntry) {
-                err = addError(ErrorMessages::buildSortAlreadyExists(sortEntry->name), node, dupEntry, err);
+                err = addError(ErrorMessages::buildSortAlreadyExists(sortEntry->name),
+                               node->shared_from_this(), dupEntry, err);
             }
         }
     }
@@ -573,16 +688,16 @@ void SortednessChecker::visit(const DeclareDatatypeCommandPtr& node) {
     if (pdecl) {
         for (const auto& cons : pdecl->constructors) {
             for (const auto& sel : cons->selectors) {
-                err = checkSort(pdecl->parameters, sel->sort, node, err);
+                err = checkSort(pdecl->parameters, sel->sort, node->shared_from_this(), err);
             }
         }
     } else {
         SimpleDatatypeDeclarationPtr sdecl =
-                dynamic_pointer_cast<SimpleDatatypeDeclaration>(node->declaration);
+                nodeCast<SimpleDatatypeDeclaration>(node->declaration);
 
         for (const auto& cons : sdecl->constructors) {
             for (const auto& sel : cons->selectors) {
-                err = checkSort(sel->sort, node, err);
+                err = checkSort(sel->sort, node->shared_from_this(), err);
             }
         }
     }
@@ -594,14 +709,15 @@ void SortednessChecker::visit(const DeclareDatatypeCommandPtr& node) {
             FunEntryPtr dupEntry = ctx->getStack()->tryAdd(funEntry);
 
             if (dupEntry) {
-                err = addError(ErrorMessages::buildFunAlreadyExists(funEntry->name), node, dupEntry, err);
+                err = addError(ErrorMessages::buildFunAlreadyExists(funEntry->name),
+                               node->shared_from_this(), dupEntry, err);
             }
 
         }
     }
 }
 
-void SortednessChecker::visit(const DeclareDatatypesCommandPtr& node) {
+void SortednessChecker::visit(DeclareDatatypesCommand* node) {
     NodeErrorPtr err;
 
     std::vector<SymbolEntryPtr> entries = getEntry(node);
@@ -610,7 +726,8 @@ void SortednessChecker::visit(const DeclareDatatypesCommandPtr& node) {
         if (sortEntry) {
             SortEntryPtr dupEntry = ctx->getStack()->tryAdd(sortEntry);
             if (dupEntry) {
-                err = addError(ErrorMessages::buildSortAlreadyExists(sortEntry->name), node, dupEntry, err);
+                err = addError(ErrorMessages::buildSortAlreadyExists(sortEntry->name),
+                               node->shared_from_this(), dupEntry, err);
             }
         }
     }
@@ -619,7 +736,7 @@ void SortednessChecker::visit(const DeclareDatatypesCommandPtr& node) {
         NodeErrorPtr declerr;
 
         ParametricDatatypeDeclarationPtr pdecl =
-                dynamic_pointer_cast<ParametricDatatypeDeclaration>(node->declarations[i]);
+                nodeCast<ParametricDatatypeDeclaration>(node->declarations[i]);
 
         if (pdecl) {
             for (const auto& cons : pdecl->constructors) {
@@ -629,7 +746,7 @@ void SortednessChecker::visit(const DeclareDatatypesCommandPtr& node) {
             }
         } else {
             SimpleDatatypeDeclarationPtr sdecl =
-                    dynamic_pointer_cast<SimpleDatatypeDeclaration>(node->declarations[i]);
+                    nodeCast<SimpleDatatypeDeclaration>(node->declarations[i]);
 
             for (const auto& cons : sdecl->constructors) {
                 for (const auto& sel : cons->selectors) {
@@ -646,130 +763,82 @@ void SortednessChecker::visit(const DeclareDatatypesCommandPtr& node) {
         if (funEntry) {
             FunEntryPtr dupEntry = ctx->getStack()->tryAdd(funEntry);
             if (dupEntry) {
-                err = addError(ErrorMessages::buildFunAlreadyExists(funEntry->name), node, dupEntry, err);
+                err = addError(ErrorMessages::buildFunAlreadyExists(funEntry->name),
+                               node->shared_from_this(), dupEntry, err);
             }
         }
     }
 }
 
-void SortednessChecker::visit(const DeclareSortCommandPtr& node) {
+void SortednessChecker::visit(DeclareSortCommand* node) {
     SortEntryPtr nodeEntry = getEntry(node);
     SortEntryPtr dupEntry = ctx->getStack()->tryAdd(nodeEntry);
 
     if (dupEntry) {
-        addError(ErrorMessages::buildSortAlreadyExists(nodeEntry->name), node, dupEntry);
+        addError(ErrorMessages::buildSortAlreadyExists(nodeEntry->name), node->shared_from_this(), dupEntry);
     }
 }
 
-void SortednessChecker::visit(const DeclareHeapCommandPtr& node) {
+void SortednessChecker::visit(DeclareHeapCommand* node) {
     NodeErrorPtr err;
 
     for(const auto& pair : node->locDataPairs) {
-        err = checkSort(pair.first, node, err);
-        err = checkSort(pair.second, node, err);
+        err = checkSort(pair.first, node->shared_from_this(), err);
+        err = checkSort(pair.second, node->shared_from_this(), err);
     }
 }
 
-void SortednessChecker::visit(const DefineFunCommandPtr& node) {
+void SortednessChecker::visit(DefineFunCommand* node) {
     NodeErrorPtr err;
 
     for (const auto& sort : node->definition->signature->parameters) {
-        err = checkSort(sort->sort, node, err);
+        err = checkSort(sort->sort, node->shared_from_this(), err);
     }
-    err = checkSort(node->definition->signature->sort, node, err);
+    err = checkSort(node->definition->signature->sort, node->shared_from_this(), err);
 
     FunEntryPtr nodeEntry = getEntry(node);
     FunEntryPtr dupEntry = ctx->getStack()->findDuplicate(nodeEntry);
 
     if (dupEntry) {
-        addError(ErrorMessages::buildFunAlreadyExists(nodeEntry->name), node, dupEntry, err);
+        addError(ErrorMessages::buildFunAlreadyExists(nodeEntry->name), node->shared_from_this(), dupEntry, err);
     } else {
-        ctx->getStack()->push();
+        if (!deferBody(node->shared_from_this()))
+            checkDefinition(node->shared_from_this(), node->definition, nodeEntry, false);
 
-        for (const auto& bind : node->definition->signature->parameters) {
-            ctx->getStack()->tryAdd(make_shared<VarEntry>(bind->symbol->toString(),
-                                                         ctx->getStack()->expand(bind->sort), node));
-        }
-
-        TermSorter sorter(shared_from_this());
-        SortPtr result = sorter.run(node->definition->body);
-
-        if (result) {
-            string retstr = nodeEntry->signature[nodeEntry->signature.size() - 1]->toString();
-            string resstr = result->toString();
-            if (resstr != retstr) {
-                TermPtr body = node->definition->body;
-                addError(ErrorMessages::buildFunBodyWrongSort(body->toString(), resstr, retstr,
-                                                              body->rowLeft, body->colLeft,
-                                                              body->rowRight, body->colRight), node);
-            }
-        } else {
-            TermPtr body = node->definition->body;
-            addError(ErrorMessages::buildFunBodyNotWellSorted(body->toString(),
-                                                              body->rowLeft, body->colLeft,
-                                                              body->rowRight, body->colRight), node);
-        }
-
-        ctx->getStack()->pop();
         ctx->getStack()->tryAdd(nodeEntry);
     }
 }
 
-void SortednessChecker::visit(const DefineFunRecCommandPtr& node) {
+void SortednessChecker::visit(DefineFunRecCommand* node) {
     NodeErrorPtr err;
 
     for (const auto& sort : node->definition->signature->parameters) {
-        err = checkSort(sort->sort, node, err);
+        err = checkSort(sort->sort, node->shared_from_this(), err);
     }
-    err = checkSort(node->definition->signature->sort, node, err);
+    err = checkSort(node->definition->signature->sort, node->shared_from_this(), err);
 
     FunEntryPtr nodeEntry = getEntry(node);
     FunEntryPtr dupEntry = ctx->getStack()->findDuplicate(nodeEntry);
 
     if (dupEntry) {
-        addError(ErrorMessages::buildFunAlreadyExists(nodeEntry->name), node, dupEntry, err);
+        addError(ErrorMessages::buildFunAlreadyExists(nodeEntry->name), node->shared_from_this(), dupEntry, err);
     } else {
-        ctx->getStack()->push();
-        ctx->getStack()->tryAdd(nodeEntry);
-
-        for (const auto& bind : node->definition->signature->parameters) {
-            ctx->getStack()->tryAdd(make_shared<VarEntry>(bind->symbol->toString(),
-                                                         ctx->getStack()->expand(bind->sort), node));
-        }
-
-        TermSorter sorter(shared_from_this());
-        SortPtr result = sorter.run(node->definition->body);
-
-        if (result) {
-            string retstr = nodeEntry->signature[nodeEntry->signature.size() - 1]->toString();
-            string resstr = result->toString();
-            if (resstr != retstr) {
-                TermPtr body = node->definition->body;
-                addError(ErrorMessages::buildFunBodyWrongSort(body->toString(), resstr, retstr,
-                                                              body->rowLeft, body->colLeft,
-                                                              body->rowRight, body->colRight), node);
-            }
-        } else {
-            TermPtr body = node->definition->body;
-            addError(ErrorMessages::buildFunBodyNotWellSorted(body->toString(),
-                                                              body->rowLeft, body->colLeft,
-                                                              body->rowRight, body->colRight), node);
-        }
+        if (!deferBody(node->shared_from_this()))
+            checkDefinition(node->shared_from_this(), node->definition, nodeEntry, true);
 
-        ctx->getStack()->pop();
         ctx->getStack()->tryAdd(nodeEntry);
     }
 }
 
-void SortednessChecker::visit(const DefineFunsRecCommandPtr& node) {
+void SortednessChecker::visit(DefineFunsRecCommand* node) {
     NodeErrorPtr err;
 
     for (const auto& decl : node->declarations) {
         std::vector<SortedVariablePtr>& sig = decl->parameters;
         for (const auto& itt : sig) {
-            err = checkSort(itt->sort, node, err);
+            err = checkSort(itt->sort, node->shared_from_this(), err);
         }
-        err = checkSort(decl->sort, node, err);
+        err = checkSort(decl->sort, node->shared_from_this(), err);
     }
 
     std::vector<FunEntryPtr> entries = getEntry(node);
@@ -779,7 +848,7 @@ void SortednessChecker::visit(const DefineFunsRecCommandPtr& node) {
         FunEntryPtr dupEntry = ctx->getStack()->findDuplicate(entry);
         if (dupEntry) {
             dup = true;
-            err = addError(ErrorMessages::buildFunAlreadyExists(entry->name), node, entry, err);
+            err = addError(ErrorMessages::buildFunAlreadyExists(entry->name), node->shared_from_this(), entry, err);
         }
     }
 
@@ -795,7 +864,8 @@ void SortednessChecker::visit(const DefineFunsRecCommandPtr& node) {
             std::vector<SortedVariablePtr>& bindings = node->declarations[i]->parameters;
             for (const auto& bind : bindings) {
                 ctx->getStack()->tryAdd(make_shared<VarEntry>(bind->symbol->toString(),
-                                                             ctx->getStack()->expand(bind->sort), node));
+                                                             ctx->getStack()->expand(bind->sort),
+                                                              node->shared_from_this()));
             }
 
             TermSorter sorter(shared_from_this());
@@ -806,17 +876,19 @@ void SortednessChecker::visit(const DefineFunsRecCommandPtr& node) {
                 string resstr = result->toString();
                 if (resstr != retstr) {
                     err = addError(ErrorMessages::buildFunBodyWrongSort(entries[i]->name, entries[i]->body->toString(),
-                                                                        resstr, retstr, entries[i]->body->rowLeft,
-                                                                        entries[i]->body->colLeft,
-                                                                        entries[i]->body->rowRight,
-                                                                        entries[i]->body->colRight), node, err);
+                                                                        resstr, retstr, entries[i]->body->getRowLeft(),
+                                                                        entries[i]->body->getColLeft(),
+                                                                        entries[i]->body->getRowRight(),
+                                                                        entries[i]->body->getColRight()),
+                                   node->shared_from_this(), err);
                 }
             } else {
                 err = addError(ErrorMessages::buildFunBodyNotWellSorted(entries[i]->name, entries[i]->body->toString(),
-                                                                        entries[i]->body->rowLeft,
-                                                                        entries[i]->body->colLeft,
-                                                                        entries[i]->body->rowRight,
-                                                                        entries[i]->body->colRight), node, err);
+                                                                        entries[i]->body->getRowLeft(),
+                                                                        entries[i]->body->getColLeft(),
+                                                                        entries[i]->body->getRowRight(),
+                                                                        entries[i]->body->getColRight()),
+                               node->shared_from_this(), err);
             }
             ctx->getStack()->pop();
         }
@@ -828,19 +900,19 @@ void SortednessChecker::visit(const DefineFunsRecCommandPtr& node) {
     }
 }
 
-void SortednessChecker::visit(const DefineSortCommandPtr& node) {
+void SortednessChecker::visit(DefineSortCommand* node) {
     NodeErrorPtr err;
-    err = checkSort(node->parameters, node->sort, node, err);
+    err = checkSort(node->parameters, node->sort, node->shared_from_this(), err);
 
     SortEntryPtr nodeEntry = getEntry(node);
     SortEntryPtr dupEntry = ctx->getStack()->tryAdd(nodeEntry);
 
     if (dupEntry) {
-        addError(ErrorMessages::buildSortAlreadyExists(nodeEntry->name), node, dupEntry, err);
+        addError(ErrorMessages::buildSortAlreadyExists(nodeEntry->name), node->shared_from_this(), dupEntry, err);
     }
 }
 
-void SortednessChecker::visit(const GetValueCommandPtr& node) {
+void SortednessChecker::visit(GetValueCommand* node) {
     NodeErrorPtr err;
 
     for (const auto& term : node->terms) {
@@ -848,48 +920,48 @@ void SortednessChecker::visit(const GetValueCommandPtr& node) {
         SortPtr result = sorter.run(term);
         if (!result) {
             err = addError(ErrorMessages::buildTermNotWellSorted(
-                    term->toString(), term->rowLeft,
-                    term->colLeft, term->rowRight,
-                    term->colRight), node, err);
+                    term->toString(), term->getRowLeft(),
+                    term->getColLeft(), term->getRowRight(),
+                    term->getColRight()), node->shared_from_this(), err);
         }
     }
 }
 
-void SortednessChecker::visit(const PopCommandPtr& node) {
+void SortednessChecker::visit(PopCommand* node) {
     size_t levels = (size_t) node->numeral->value;
     if (!ctx->getStack()->pop(levels)) {
-        addError(ErrorMessages::buildStackUnpoppable(levels), node);
+        addError(ErrorMessages::buildStackUnpoppable(levels), node->shared_from_this());
     }
 }
 
-void SortednessChecker::visit(const PushCommandPtr& node) {
+void SortednessChecker::visit(PushCommand* node) {
     ctx->getStack()->push((size_t) node->numeral->value);
 }
 
-void SortednessChecker::visit(const ResetCommandPtr& node) {
+void SortednessChecker::visit(ResetCommand* node) {
     ctx->getStack()->reset();
     ctx->setCurrentLogic("");
     ctx->getCurrentTheories().clear();
 }
 
-void SortednessChecker::visit(const SetLogicCommandPtr& node) {
+void SortednessChecker::visit(SetLogicCommand* node) {
     NodeErrorPtr err;
     if (!ctx->getCurrentLogic().empty()) {
-        addError(ErrorMessages::buildLogicAlreadySet(ctx->getCurrentLogic()), node);
+        addError(ErrorMessages::buildLogicAlreadySet(ctx->getCurrentLogic()), node->shared_from_this());
     } else {
         string logic = node->logic->toString();
         ctx->setCurrentLogic(logic);
-        loadLogic(logic, node, err);
+        loadLogic(logic, node->shared_from_this(), err);
     }
 }
 
-void SortednessChecker::visit(const LogicPtr& node) {
+void SortednessChecker::visit(Logic* node) {
     for (const auto& attr : node->attributes) {
         if (attr->keyword->value == KW_THEORIES) {
             NodeErrorPtr err;
 
             CompAttributeValuePtr attrValue =
-                    dynamic_pointer_cast<CompAttributeValue>(attr->value);
+                    nodeCast<CompAttributeValue>(attr->value);
 
             for (const auto& compValue : attrValue->values) {
                 string theory = compValue->toString();
@@ -908,73 +980,74 @@ void SortednessChecker::visit(const LogicPtr& node) {
     }
 }
 
-void SortednessChecker::visit(const TheoryPtr& node) {
+void SortednessChecker::visit(Theory* node) {
     for (const auto& attr : node->attributes) {
         if (attr->keyword->value == KW_SORTS || attr->keyword->value == KW_FUNS) {
-            CompAttributeValuePtr val = dynamic_pointer_cast<CompAttributeValue>(attr->value);
+            CompAttributeValuePtr val = nodeCast<CompAttributeValue>(attr->value);
             visit0(val->values);
         }
     }
 }
 
-void SortednessChecker::visit(const ScriptPtr& node) {
+void SortednessChecker::visit(Script* node) {
     visit0(node->commands);
 }
 
-void SortednessChecker::visit(const SortSymbolDeclarationPtr& node) {
+void SortednessChecker::visit(SortSymbolDeclaration* node) {
     SortEntryPtr nodeEntry = getEntry(node);
     SortEntryPtr dupEntry = ctx->getStack()->tryAdd(nodeEntry);
 
     if (dupEntry) {
-        addError(ErrorMessages::buildSortAlreadyExists(nodeEntry->name), node, dupEntry);
+        addError(ErrorMessages::buildSortAlreadyExists(nodeEntry->name), node->shared_from_this(), dupEntry);
     }
 }
 
-void SortednessChecker::visit(const SpecConstFunDeclarationPtr& node) {
+void SortednessChecker::visit(SpecConstFunDeclaration* node) {
     NodeErrorPtr err;
-    err = checkSort(node->sort, node, err);
+    err = checkSort(node->sort, node->shared_from_this(), err);
 
     FunEntryPtr nodeEntry = getEntry(node);
     FunEntryPtr dupEntry = ctx->getStack()->tryAdd(nodeEntry);
 
     if (dupEntry) {
-        addError(ErrorMessages::buildSpecConstAlreadyExists(nodeEntry->name), node, dupEntry, err);
+        addError(ErrorMessages::buildSpecConstAlreadyExists(nodeEntry->name), node->shared_from_this(), dupEntry, err);
     }
 }
 
-void SortednessChecker::visit(const MetaSpecConstFunDeclarationPtr& node) {
+void SortednessChecker::visit(MetaSpecConstFunDeclaration* node) {
     NodeErrorPtr err;
-    err = checkSort(node->sort, node, err);
+    err = checkSort(node->sort, node->shared_from_this(), err);
 
     FunEntryPtr nodeEntry = getEntry(node);
     std::vector<FunEntryPtr> dupEntry = ctx->getStack()->getFunEntry(nodeEntry->name);
 
     if (!dupEntry.empty()) {
-        err = addError(ErrorMessages::buildMetaSpecConstAlreadyExists(nodeEntry->name), node, dupEntry[0], err);
+        err = addError(ErrorMessages::buildMetaSpecConstAlreadyExists(nodeEntry->name),
+                       node->shared_from_this(), dupEntry[0], err);
     } else {
         ctx->getStack()->tryAdd(nodeEntry);
     }
 }
 
-void SortednessChecker::visit(const SimpleFunDeclarationPtr& node) {
+void SortednessChecker::visit(SimpleFunDeclaration* node) {
     NodeErrorPtr err;
 
     for (const auto& sort : node->signature) {
-        err = checkSort(sort, node, err);
+        err = checkSort(sort, node->shared_from_this(), err);
     }
 
     FunEntryPtr nodeEntry = getEntry(node);
 
     if (nodeEntry->assocL) {
         if (node->signature.size() != 3) {
-            err = addError(ErrorMessages::buildLeftAssocParamCount(nodeEntry->name), node, err);
+            err = addError(ErrorMessages::buildLeftAssocParamCount(nodeEntry->name), node->shared_from_this(), err);
             nodeEntry->assocL = false;
         } else {
             SortPtr firstSort = node->signature[0];
             SortPtr returnSort = node->signature[2];
 
-            if (firstSort->toString() != returnSort->toString()) {
-                err = addError(ErrorMessages::buildLeftAssocRetSort(nodeEntry->name), node, err);
+            if (firstSort->getCanonical() != returnSort->getCanonical()) {
+                err = addError(ErrorMessages::buildLeftAssocRetSort(nodeEntry->name), node->shared_from_this(), err);
                 nodeEntry->assocL = false;
             }
         }
@@ -982,58 +1055,58 @@ void SortednessChecker::visit(const SimpleFunDeclarationPtr& node) {
 
     if (nodeEntry->assocR) {
         if (node->signature.size() != 3) {
-            err = addError(ErrorMessages::buildRightAssocParamCount(nodeEntry->name), node, err);
+            err = addError(ErrorMessages::buildRightAssocParamCount(nodeEntry->name), node->shared_from_this(), err);
             nodeEntry->assocR = false;
         } else {
             SortPtr secondSort = node->signature[1];
             SortPtr returnSort = node->signature[2];
 
-            if (secondSort->toString() != returnSort->toString()) {
-                err = addError(ErrorMessages::buildRightAssocRetSort(nodeEntry->name), node, err);
+            if (secondSort->getCanonical() != returnSort->getCanonical()) {
+                err = addError(ErrorMessages::buildRightAssocRetSort(nodeEntry->name), node->shared_from_this(), err);
                 nodeEntry->assocR = false;
             }
         }
     }
 
     if (nodeEntry->chainable && nodeEntry->pairwise) {
-        err = addError(ErrorMessages::buildChainableAndPairwise(nodeEntry->name), node, err);
+        err = addError(ErrorMessages::buildChainableAndPairwise(nodeEntry->name), node->shared_from_this(), err);
         nodeEntry->chainable = false;
         nodeEntry->pairwise = false;
     } else if (nodeEntry->chainable) {
         if (node->signature.size() != 3) {
-            err = addError(ErrorMessages::buildChainableParamCount(nodeEntry->name), node, err);
+            err = addError(ErrorMessages::buildChainableParamCount(nodeEntry->name), node->shared_from_this(), err);
             nodeEntry->chainable = false;
         } else {
             SortPtr firstSort = node->signature[0];
             SortPtr secondSort = node->signature[1];
             SortPtr returnSort = node->signature[2];
 
-            if (firstSort->toString() != secondSort->toString()) {
-                err = addError(ErrorMessages::buildChainableParamSort(nodeEntry->name), node, err);
+            if (firstSort->getCanonical() != secondSort->getCanonical()) {
+                err = addError(ErrorMessages::buildChainableParamSort(nodeEntry->name), node->shared_from_this(), err);
                 nodeEntry->chainable = false;
             }
 
             if (returnSort->toString() != SORT_BOOL) {
-                err = addError(ErrorMessages::buildChainableRetSort(nodeEntry->name), node, err);
+                err = addError(ErrorMessages::buildChainableRetSort(nodeEntry->name), node->shared_from_this(), err);
                 nodeEntry->chainable = false;
             }
         }
     } else if (nodeEntry->pairwise) {
         if (node->signature.size() != 3) {
-            err = addError(ErrorMessages::buildPairwiseParamCount(nodeEntry->name), node, err);
+            err = addError(ErrorMessages::buildPairwiseParamCount(nodeEntry->name), node->shared_from_this(), err);
             nodeEntry->pairwise = false;
         } else {
             SortPtr firstSort = node->signature[0];
             SortPtr secondSort = node->signature[1];
             SortPtr returnSort = node->signature[2];
 
-            if (firstSort->toString() != secondSort->toString()) {
-                err = addError(ErrorMessages::buildPairwiseParamSort(nodeEntry->name), node, err);
+            if (firstSort->getCanonical() != secondSort->getCanonical()) {
+                err = addError(ErrorMessages::buildPairwiseParamSort(nodeEntry->name), node->shared_from_this(), err);
                 nodeEntry->pairwise = false;
             }
 
             if (returnSort->toString() != SORT_BOOL) {
-                err = addError(ErrorMessages::buildPairwiseRetSort(nodeEntry->name), node, err);
+                err = addError(ErrorMessages::buildPairwiseRetSort(nodeEntry->name), node->shared_from_this(), err);
                 nodeEntry->pairwise = false;
             }
         }
@@ -1042,29 +1115,29 @@ void SortednessChecker::visit(const SimpleFunDeclarationPtr& node) {
     FunEntryPtr dupEntry = ctx->getStack()->tryAdd(nodeEntry);
 
     if (dupEntry) {
-        addError(ErrorMessages::buildFunAlreadyExists(nodeEntry->name), node, dupEntry, err);
+        addError(ErrorMessages::buildFunAlreadyExists(nodeEntry->name), node->shared_from_this(), dupEntry, err);
     }
 }
 
-void SortednessChecker::visit(const ParametricFunDeclarationPtr& node) {
+void SortednessChecker::visit(ParametricFunDeclaration* node) {
     NodeErrorPtr err;
 
     for (const auto& sort : node->signature) {
-        err = checkSort(node->parameters, sort, node, err);
+        err = checkSort(node->parameters, sort, node->shared_from_this(), err);
     }
 
     FunEntryPtr nodeEntry = getEntry(node);
 
     if (nodeEntry->assocL) {
         if (node->signature.size() != 3) {
-            err = addError(ErrorMessages::buildLeftAssocParamCount(nodeEntry->name), node, err);
+            err = addError(ErrorMessages::buildLeftAssocParamCount(nodeEntry->name), node->shared_from_this(), err);
             nodeEntry->assocL = false;
         } else {
             SortPtr firstSort = node->signature[0];
             SortPtr returnSort = node->signature[2];
 
-            if (firstSort->toString() != returnSort->toString()) {
-                err = addError(ErrorMessages::buildLeftAssocRetSort(nodeEntry->name), node, err);
+            if (firstSort->getCanonical() != returnSort->getCanonical()) {
+                err = addError(ErrorMessages::buildLeftAssocRetSort(nodeEntry->name), node->shared_from_this(), err);
                 nodeEntry->assocL = false;
             }
         }
@@ -1072,58 +1145,58 @@ void SortednessChecker::visit(const ParametricFunDeclarationPtr& node) {
 
     if (nodeEntry->assocR) {
         if (node->signature.size() != 3) {
-            err = addError(ErrorMessages::buildRightAssocParamCount(nodeEntry->name), node, err);
+            err = addError(ErrorMessages::buildRightAssocParamCount(nodeEntry->name), node->shared_from_this(), err);
             nodeEntry->assocR = false;
         } else {
             SortPtr secondSort = node->signature[1];
             SortPtr returnSort = node->signature[2];
 
-            if (secondSort->toString() != returnSort->toString()) {
-                err = addError(ErrorMessages::buildRightAssocRetSort(nodeEntry->name), node, err);
+            if (secondSort->getCanonical() != returnSort->getCanonical()) {
+                err = addError(ErrorMessages::buildRightAssocRetSort(nodeEntry->name), node->shared_from_this(), err);
                 nodeEntry->assocR = false;
             }
         }
     }
 
     if (nodeEntry->chainable && nodeEntry->pairwise) {
-        err = addError(ErrorMessages::buildChainableAndPairwise(nodeEntry->name), node, err);
+        err = addError(ErrorMessages::buildChainableAndPairwise(nodeEntry->name), node->shared_from_this(), err);
         nodeEntry->chainable = false;
         nodeEntry->pairwise = false;
     } else if (nodeEntry->chainable) {
         if (node->signature.size() != 3) {
-            err = addError(ErrorMessages::buildChainableParamCount(nodeEntry->name), node, err);
+            err = addError(ErrorMessages::buildChainableParamCount(nodeEntry->name), node->shared_from_this(), err);
             nodeEntry->chainable = false;
         } else {
             SortPtr firstSort = node->signature[0];
             SortPtr secondSort = node->signature[1];
             SortPtr returnSort = node->signature[2];
 
-            if (firstSort->toString() != secondSort->toString()) {
-                err = addError(ErrorMessages::buildChainableParamSort(nodeEntry->name), node, err);
+            if (firstSort->getCanonical() != secondSort->getCanonical()) {
+                err = addError(ErrorMessages::buildChainableParamSort(nodeEntry->name), node->shared_from_this(), err);
                 nodeEntry->chainable = false;
             }
 
             if (returnSort->toString() != SORT_BOOL) {
-                err = addError(ErrorMessages::buildChainableRetSort(nodeEntry->name), node, err);
+                err = addError(ErrorMessages::buildChainableRetSort(nodeEntry->name), node->shared_from_this(), err);
                 nodeEntry->chainable = false;
             }
         }
     } else if (nodeEntry->pairwise) {
         if (node->signature.size() != 3) {
-            err = addError(ErrorMessages::buildPairwiseParamCount(nodeEntry->name), node, err);
+            err = addError(ErrorMessages::buildPairwiseParamCount(nodeEntry->name), node->shared_from_this(), err);
             nodeEntry->pairwise = false;
         } else {
             SortPtr firstSort = node->signature[0];
             SortPtr secondSort = node->signature[1];
             SortPtr returnSort = node->signature[2];
 
-            if (firstSort->toString() != secondSort->toString()) {
-                err = addError(ErrorMessages::buildPairwiseParamSort(nodeEntry->name), node, err);
+            if (firstSort->getCanonical() != secondSort->getCanonical()) {
+                err = addError(ErrorMessages::buildPairwiseParamSort(nodeEntry->name), node->shared_from_this(), err);
                 nodeEntry->pairwise = false;
             }
 
             if (returnSort->toString() != SORT_BOOL) {
-                err = addError(ErrorMessages::buildPairwiseRetSort(nodeEntry->name), node, err);
+                err = addError(ErrorMessages::buildPairwiseRetSort(nodeEntry->name), node->shared_from_this(), err);
                 nodeEntry->pairwise = false;
             }
         }
@@ -1132,7 +1205,7 @@ void SortednessChecker::visit(const ParametricFunDeclarationPtr& node) {
     FunEntryPtr dupEntry = ctx->getStack()->tryAdd(nodeEntry);
 
     if (dupEntry) {
-        addError(ErrorMessages::buildFunAlreadyExists(nodeEntry->name), node, dupEntry, err);
+        addError(ErrorMessages::buildFunAlreadyExists(nodeEntry->name), node->shared_from_this(), dupEntry, err);
     }
 }
 
@@ -1146,6 +1219,26 @@ bool SortednessChecker::check(NodePtr& node) {
     return errors.empty();
 }
 
+void SortednessChecker::checkBody(const CommandPtr& cmd) {
+    switch (cmd->getKind()) {
+        case NodeKind::ASSERT_COMMAND:
+            checkAssertion(nodeCast<AssertCommand>(cmd).get());
+            break;
+        case NodeKind::DEFINE_FUN_COMMAND: {
+            DefineFunCommandPtr def = nodeCast<DefineFunCommand>(cmd);
+            checkDefinition(def, def->definition, getEntry(def.get()), false);
+            break;
+        }
+        case NodeKind::DEFINE_FUN_REC_COMMAND: {
+            DefineFunRecCommandPtr def = nodeCast<DefineFunRecCommand>(cmd);
+            checkDefinition(def, def->definition, getEntry(def.get()), true);
+            break;
+        }
+        default:
+            visit0(cmd);
+    }
+}
+
 string SortednessChecker::getErrors() {
     stringstream ss;
 
@@ -1164,8 +1257,8 @@ string SortednessChecker::getErrors() {
 
         for (const auto& err : error.second) {
             if (err->node) {
-                ss << err->node->rowLeft << ":" << err->node->colLeft
-                   << " - " << err->node->rowRight << ":" << err->node->colRight << "   ";
+                ss << err->node->getRowLeft() << ":" << err->node->getColLeft()
+                   << " - " << err->node->getRowRight() << ":" << err->node->getColRight() << "   ";
 
                 string nodestr = err->node->toString();
                 if (nodestr.length() > 100)
@@ -1189,9 +1282,9 @@ string SortednessChecker::getErrors() {
                 ss << "\t" << err->errs[i]->message << "." << endl;
 
                 if (source) {
-                    ss << "\t\tPreviously, in file '" << source->filename->c_str() << "'\n\t\t"
-                       << source->rowLeft << ":" << source->colLeft << " - "
-                       << source->rowRight << ":" << source->colRight << "   ";
+                    ss << "\t\tPreviously, in file '" << (source->getFilename() ? source->getFilename()->c_str() : "") << "'\n\t\t"
+                       << source->getRowLeft() << ":" << source->getColLeft() << " - "
+                       << source->getRowRight() << ":" << source->getColRight() << "   ";
 
                     string sourcestr = source->toString();
                     if (sourcestr.length() > 100)
@@ -1226,3 +1319,20 @@ SortednessCheckerPtr SortednessChecker::getChecker() {
 ConfigurationPtr SortednessChecker::getConfiguration() {
     return ctx->getConfiguration();
 }
+
+void SortednessChecker::clearErrors() {
+    errors.clear();
+}
+
+SortednessChecker::ErrorMap SortednessChecker::takeErrors() {
+    ErrorMap result;
+    result.swap(errors);
+    return result;
+}
+
+void SortednessChecker::addErrors(const ErrorMap& errs) {
+    for (const auto& fileErrors : errs) {
+        std::vector<NodeErrorPtr>& list = errors[fileErrors.first];
+        list.insert(list.end(), fileErrors.second.begin(), fileErrors.second.end());
+    }
+}
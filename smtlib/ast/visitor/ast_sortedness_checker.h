@@ -10,6 +10,7 @@
 #include "util/logger.h"
 #include "util/configuration.h"
 
+#include <functional>
 #include <map>
 
 namespace smtlib {
@@ -56,7 +57,7 @@ namespace smtlib {
         typedef std::shared_ptr<SortednessCheckerContext> SortCheckContextPtr;
 
         /* ================================ SortednessChecker ================================= */
-        class SortednessChecker : public DummyVisitor0,
+        class SortednessChecker : public DummyRawVisitor0,
                                   public ITermSorterContext,
                                   public std::enable_shared_from_this<SortednessChecker> {
         public:
@@ -92,26 +93,46 @@ namespace smtlib {
 
             typedef std::shared_ptr<NodeError> NodeErrorPtr;
 
-        private:
-            ISortCheckContextPtr ctx;
-            std::map<std::string, std::vector<NodeErrorPtr>> errors;
-
-            SortEntryPtr getEntry(const SortSymbolDeclarationPtr& node);
-            SortEntryPtr getEntry(const DeclareSortCommandPtr& node);
-            SortEntryPtr getEntry(const DefineSortCommandPtr& node);
+            /** Errors found by a checker, grouped by file, in the order they were found */
+            typedef std::map<std::string, std::vector<NodeErrorPtr>> ErrorMap;
 
-            FunEntryPtr getEntry(const SpecConstFunDeclarationPtr& node);
-            FunEntryPtr getEntry(const MetaSpecConstFunDeclarationPtr& node);
-            FunEntryPtr getEntry(const SimpleFunDeclarationPtr& node);
-            FunEntryPtr getEntry(const ParametricFunDeclarationPtr& node);
-            FunEntryPtr getEntry(const DeclareConstCommandPtr& node);
-            FunEntryPtr getEntry(const DeclareFunCommandPtr& node);
-            FunEntryPtr getEntry(const DefineFunCommandPtr& node);
-            FunEntryPtr getEntry(const DefineFunRecCommandPtr& node);
+            /** Handler for the bodies of commands checked separately (see setBodyHandler()) */
+            typedef std::function<void(const CommandPtr& cmd)> BodyHandler;
 
-            std::vector<FunEntryPtr> getEntry(const DefineFunsRecCommandPtr& node);
-            std::vector<SymbolEntryPtr> getEntry(const DeclareDatatypeCommandPtr& node);
-            std::vector<SymbolEntryPtr> getEntry(const DeclareDatatypesCommandPtr& node);
+        private:
+            ISortCheckContextPtr ctx;
+            ErrorMap errors;
+            BodyHandler bodyHandler;
+
+            /** Pass the body of a command to the body handler, if there is one and the stack has no pushed levels */
+            bool deferBody(const CommandPtr& cmd);
+
+            /** Check the body of an assertion */
+            void checkAssertion(AssertCommand* node);
+
+            /**
+             * Check the body of a function definition, on a new level holding its parameters
+             * (and the function itself, if the definition is recursive)
+             */
+            void checkDefinition(const NodePtr& node, const FunctionDefinitionPtr& definition,
+                                 const FunEntryPtr& entry, bool recursive);
+
+            SortEntryPtr getEntry(SortSymbolDeclaration* node);
+            SortEntryPtr getEntry(DeclareSortCommand* node);
+            SortEntryPtr getEntry(DefineSortCommand* node);
+
+            FunEntryPtr getEntry(SpecConstFunDeclaration* node);
+            FunEntryPtr getEntry(MetaSpecConstFunDeclaration* node);
+            FunEntryPtr getEntry(SimpleFunDeclaration* node);
+            FunEntryPtr getEntry(ParametricFunDeclaration* node);
+            FunEntryPtr getEntry(DeclareConstCommand* node);
+            FunEntryPtr getEntry(DeclareFunCommand* node);
+            FunEntryPtr getEntry(DefineFunCommand* node);
+            FunEntryPtr getEntry(DefineFunRecCommand* node);
+
+            std::vector<FunEntryPtr> getEntry(DefineFunsRecCommand* node);
+            std::vector<SymbolEntryPtr> getEntry(DeclareDatatypeCommand* node);
+            std::vector<SymbolEntryPtr> getEntry(DeclareDatatypesCommand* node);
 
             void loadTheory(const std::string& theory,
                             const NodePtr& node,
@@ -155,35 +176,60 @@ namespace smtlib {
                                    const NodePtr& source,
                                    NodeErrorPtr& err);
 
-            void visit(const AssertCommandPtr& node) override;
-            void visit(const DeclareConstCommandPtr& node) override;
-            void visit(const DeclareFunCommandPtr& node) override;
-            void visit(const DeclareDatatypeCommandPtr& node) override;
-            void visit(const DeclareDatatypesCommandPtr& node) override;
-            void visit(const DeclareSortCommandPtr& node) override;
-            void visit(const DeclareHeapCommandPtr& node) override;
-            void visit(const DefineFunCommandPtr& node) override;
-            void visit(const DefineFunRecCommandPtr& node) override;
-            void visit(const DefineFunsRecCommandPtr& node) override;
-            void visit(const DefineSortCommandPtr& node) override;
-            void visit(const GetValueCommandPtr& node) override;
-            void visit(const PopCommandPtr& node) override;
-            void visit(const PushCommandPtr& node) override;
-            void visit(const ResetCommandPtr& node) override;
-            void visit(const SetLogicCommandPtr& node) override;
-            void visit(const LogicPtr& node) override;
-            void visit(const TheoryPtr& node) override;
-            void visit(const ScriptPtr& node) override;
-            void visit(const SortSymbolDeclarationPtr& node) override;
-            void visit(const SpecConstFunDeclarationPtr& node) override;
-            void visit(const MetaSpecConstFunDeclarationPtr& node) override;
-            void visit(const SimpleFunDeclarationPtr& node) override;
-            void visit(const ParametricFunDeclarationPtr& node) override;
+            void visit(AssertCommand* node) override;
+            void visit(DeclareConstCommand* node) override;
+            void visit(DeclareFunCommand* node) override;
+            void visit(DeclareDatatypeCommand* node) override;
+            void visit(DeclareDatatypesCommand* node) override;
+            void visit(DeclareSortCommand* node) override;
+            void visit(DeclareHeapCommand* node) override;
+            void visit(DefineFunCommand* node) override;
+            void visit(DefineFunRecCommand* node) override;
+            void visit(DefineFunsRecCommand* node) override;
+            void visit(DefineSortCommand* node) override;
+            void visit(GetValueCommand* node) override;
+            void visit(PopCommand* node) override;
+            void visit(PushCommand* node) override;
+            void visit(ResetCommand* node) override;
+            void visit(SetLogicCommand* node) override;
+            void visit(Logic* node) override;
+            void visit(Theory* node) override;
+            void visit(Script* node) override;
+            void visit(SortSymbolDeclaration* node) override;
+            void visit(SpecConstFunDeclaration* node) override;
+            void visit(MetaSpecConstFunDeclaration* node) override;
+            void visit(SimpleFunDeclaration* node) override;
+            void visit(ParametricFunDeclaration* node) override;
 
             bool check(NodePtr& node);
 
+            /**
+             * Set a handler to which the bodies of assertions and function definitions are passed,
+             * instead of being checked (e.g. to check them in parallel, see checkBody()).
+             * A body is passed once the stack holds all the entries it may refer to,
+             * and only while the stack has no pushed levels, so that it can be checked
+             * on a snapshot of the stack (see SymbolStack::snapshot()).
+             * Bodies are checked as usual if the handler is empty.
+             */
+            inline void setBodyHandler(BodyHandler handler) { bodyHandler = std::move(handler); }
+
+            /**
+             * Check the body of an assertion or a function definition passed to a body handler,
+             * on a stack restored from the snapshot taken when it was passed.
+             */
+            void checkBody(const CommandPtr& cmd);
+
             std::string getErrors();
 
+            /** Discard the errors found so far */
+            void clearErrors();
+
+            /** Remove the errors found so far and return them */
+            ErrorMap takeErrors();
+
+            /** Add errors (e.g. taken from another checker) after the errors found so far */
+            void addErrors(const ErrorMap& errs);
+
             // ITermSorterContext implementation
             SymbolStackPtr getStack() override;
             SortednessCheckerPtr getChecker() override;
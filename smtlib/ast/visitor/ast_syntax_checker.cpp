@@ -11,12 +11,93 @@
 #include "util/error_messages.h"
 #include "util/global_values.h"
 
+#include <cstring>
 #include <iostream>
 
 using namespace std;
 using namespace smtlib;
 using namespace smtlib::ast;
 
+namespace {
+    /** Classes of the characters that may appear in symbols */
+    enum CharClass {
+        /** First character of a simple symbol */
+        SIMPLE_BEGIN = 1,
+        /** Other characters of a simple symbol */
+        SIMPLE_CONTINUE = 2,
+        /** Characters between the bars of a quoted symbol */
+        QUOTED = 4
+    };
+
+    struct CharClassTable {
+        unsigned char classes[256];
+
+        CharClassTable() {
+            for (int c = 0; c < 256; c++) {
+                bool letter = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+                bool special = c != 0 && strchr("+-/*=%?!.$_~&^<>@", c) != nullptr;
+                bool digit = c >= '0' && c <= '9';
+                bool quoted = (c >= 0x20 && c <= 0x7E && c != '\\' && c != '|')
+                              || c >= 0xA0 || c == '\t' || c == '\r' || c == '\n';
+
+                classes[c] = (unsigned char) ((letter || special ? SIMPLE_BEGIN : 0)
+                                              | (letter || special || digit ? SIMPLE_CONTINUE : 0)
+                                              | (quoted ? QUOTED : 0));
+            }
+        }
+
+        inline bool is(char c, CharClass cls) const {
+            return (classes[(unsigned char) c] & cls) != 0;
+        }
+    };
+
+    const CharClassTable CHAR_CLASSES;
+
+    /** Whether the characters in [begin, end) form a simple symbol or a quoted symbol */
+    bool isSymbol(const char* begin, const char* end) {
+        if (begin == end)
+            return false;
+
+        if (*begin == '|') {
+            if (end - begin < 2 || end[-1] != '|')
+                return false;
+
+            for (const char* p = begin + 1; p < end - 1; p++) {
+                if (!CHAR_CLASSES.is(*p, QUOTED))
+                    return false;
+            }
+
+            return true;
+        }
+
+        if (!CHAR_CLASSES.is(*begin, SIMPLE_BEGIN))
+            return false;
+
+        for (const char* p = begin + 1; p < end; p++) {
+            if (!CHAR_CLASSES.is(*p, SIMPLE_CONTINUE))
+                return false;
+        }
+
+        return true;
+    }
+
+    bool isSymbol(const string& value) {
+        return isSymbol(value.data(), value.data() + value.size());
+    }
+
+    /** Whether a string is a keyword, which is a colon followed by a simple symbol (or a quoted symbol) */
+    bool isKeyword(const string& value) {
+        const char* begin = value.data();
+        const char* end = begin + value.size();
+
+        if (begin != end && *begin == ':' && begin + 1 != end && begin[1] != '|')
+            return isSymbol(begin + 1, end);
+
+        // Quoted symbols have always been accepted as keywords
+        return begin != end && *begin == '|' && isSymbol(begin, end);
+    }
+}
+
 SyntaxChecker::ErrorPtr SyntaxChecker::addError(const string& message, const NodePtr& node,
                                                 SyntaxChecker::ErrorPtr& err) {
     if (!err) {
@@ -95,7 +176,8 @@ void SyntaxChecker::visit(const SymbolPtr& node) {
         return;
     }
 
-    if (!regex_match(node->value, regexSymbol)) {
+    // Symbols matched by the lexer as simple symbols are already known to be well-formed
+    if (!node->wellFormed && !isSymbol(node->value)) {
         err = addError(ErrorMessages::ERR_SYMBOL_MALFORMED, node, err);
     }
 }
@@ -108,7 +190,7 @@ void SyntaxChecker::visit(const KeywordPtr& node) {
         return;
     }
 
-    if (!regex_match(node->value, regexKeyword)) {
+    if (!node->wellFormed && !isKeyword(node->value)) {
         err = addError(ErrorMessages::ERR_KEYWORD_MALFORMED, node, err);
     }
 }
@@ -258,10 +340,10 @@ void SyntaxChecker::visit(const DeclareDatatypesCommandPtr& node) {
 
     size_t minCount = sortCount < declCount ? sortCount : declCount;
     for (size_t i = 0; i < minCount; i++) {
-        long arity = node->sorts[i]->arity->value;
+        size_t arity = (size_t) node->sorts[i]->arity->value;
         size_t paramCount = 0;
         ParametricDatatypeDeclarationPtr decl =
-                dynamic_pointer_cast<ParametricDatatypeDeclaration>(node->declarations[i]);
+                nodeCast<ParametricDatatypeDeclaration>(node->declarations[i]);
         if (decl) {
             paramCount = decl->parameters.size();
         }
@@ -655,12 +737,12 @@ void SyntaxChecker::visit(const SetOptionCommandPtr& node) {
         AttributePtr option = node->option;
         if ((option->keyword->value == KW_DIAG_OUTPUT_CHANNEL
              || option->keyword->value == KW_REGULAR_OUTPUT_CHANNEL)
-            && !dynamic_pointer_cast<StringLiteral>(option->value)) {
+            && !nodeCast<StringLiteral>(option->value)) {
             err = addError(ErrorMessages::ERR_OPT_VALUE_STRING, option, err);
         } else if ((option->keyword->value == KW_RANDOM_SEED
                     || option->keyword->value == KW_VERBOSITY
                     || option->keyword->value == KW_REPROD_RESOURCE_LIMIT)
-                   && !dynamic_pointer_cast<NumeralLiteral>(option->value)) {
+                   && !nodeCast<NumeralLiteral>(option->value)) {
             err = addError(ErrorMessages::ERR_OPT_VALUE_NUMERAL, option, err);
         } else if ((option->keyword->value == KW_EXPAND_DEFS
                     || option->keyword->value == KW_GLOBAL_DECLS
@@ -823,14 +905,14 @@ void SyntaxChecker::visit(const LogicPtr& node) {
             || attr->keyword->value == KW_EXTENSIONS
             || attr->keyword->value == KW_VALUES
             || attr->keyword->value == KW_NOTES) {
-            if (!dynamic_pointer_cast<StringLiteral>(attr->value)) {
+            if (!nodeCast<StringLiteral>(attr->value)) {
                 attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_STRING, attr, attrerr);
             }
         } else if (attr->keyword->value == KW_THEORIES) {
-            if (!dynamic_pointer_cast<CompAttributeValue>(attr->value)) {
+            if (!nodeCast<CompAttributeValue>(attr->value)) {
                 err = addError(ErrorMessages::ERR_ATTR_VALUE_THEORIES, attr, err);
             } else {
-                auto val = dynamic_pointer_cast<CompAttributeValue>(attr->value);
+                auto val = nodeCast<CompAttributeValue>(attr->value);
                 std::vector<AttributeValuePtr>& values = val->values;
 
                 // Note: standard prohibits empty theory list, but there are logics that only use Core
@@ -839,7 +921,7 @@ void SyntaxChecker::visit(const LogicPtr& node) {
                 }*/
 
                 for (const auto& value : values) {
-                    if (value && !dynamic_pointer_cast<Symbol>(value)) {
+                    if (value && !nodeCast<Symbol>(value)) {
                         attrerr = addError(ErrorMessages::buildAttrValueSymbol(value->toString()), attr, attrerr);
                     }
                 }
@@ -879,14 +961,14 @@ void SyntaxChecker::visit(const TheoryPtr& node) {
             || attr->keyword->value == KW_DEFINITION
             || attr->keyword->value == KW_VALUES
             || attr->keyword->value == KW_NOTES) {
-            if (!dynamic_pointer_cast<StringLiteral>(attr->value)) {
+            if (!nodeCast<StringLiteral>(attr->value)) {
                 attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_STRING, attr, attrerr);
             }
         } else if (attr->keyword->value == KW_SORTS) {
-            if (!dynamic_pointer_cast<CompAttributeValue>(attr->value)) {
+            if (!nodeCast<CompAttributeValue>(attr->value)) {
                 attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_SORTS, attr, attrerr);
             } else {
-                auto val = dynamic_pointer_cast<CompAttributeValue>(attr->value);
+                auto val = nodeCast<CompAttributeValue>(attr->value);
                 std::vector<AttributeValuePtr>& values = val->values;
 
                 if (values.empty()) {
@@ -894,17 +976,17 @@ void SyntaxChecker::visit(const TheoryPtr& node) {
                 }
 
                 for (const auto& value : values) {
-                    if (value && !dynamic_pointer_cast<SortSymbolDeclaration>(value)) {
+                    if (value && !nodeCast<SortSymbolDeclaration>(value)) {
                         attrerr = addError(
                                 ErrorMessages::buildAttrValueSortDecl(value->toString()), attr, attrerr);
                     }
                 }
             }
         } else if (attr->keyword->value == KW_FUNS) {
-            if (!dynamic_pointer_cast<CompAttributeValue>(attr->value)) {
+            if (!nodeCast<CompAttributeValue>(attr->value)) {
                 attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_FUNS, attr, attrerr);
             } else {
-                auto val = dynamic_pointer_cast<CompAttributeValue>(attr->value);
+                auto val = nodeCast<CompAttributeValue>(attr->value);
                 std::vector<AttributeValuePtr>& values = val->values;
 
                 if (values.empty()) {
@@ -912,7 +994,7 @@ void SyntaxChecker::visit(const TheoryPtr& node) {
                 }
 
                 for (const auto& value : values) {
-                    if (value && !dynamic_pointer_cast<FunSymbolDeclaration>(value)) {
+                    if (value && !nodeCast<FunSymbolDeclaration>(value)) {
                         attrerr = addError(ErrorMessages::buildAttrValueFunDecl(value->toString()), attr, attrerr);
                     }
                 }
@@ -1484,8 +1566,8 @@ string SyntaxChecker::getErrors() {
     stringstream ss;
     for (const auto& err : errors) {
         if (err->node) {
-            ss << err->node->rowLeft << ":" << err->node->colLeft
-            << " - " << err->node->rowRight << ":" << err->node->colRight << "   ";
+            ss << err->node->getRowLeft() << ":" << err->node->getColLeft()
+            << " - " << err->node->getRowRight() << ":" << err->node->getColRight() << "   ";
 
             string nodestr = err->node->toString();
             if (nodestr.length() > 100)
@@ -1506,3 +1588,7 @@ string SyntaxChecker::getErrors() {
 
     return ss.str();
 }
+
+void SyntaxChecker::clearErrors() {
+    errors.clear();
+}
@@ -3,7 +3,6 @@
 
 #include "ast_visitor.h"
 
-#include <regex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -32,15 +31,6 @@ namespace smtlib {
 
             std::vector<ErrorPtr> errors;
 
-            const std::regex regexSymbol = std::regex(
-                    "^([a-zA-Z+\\-/*=%?!.$_~&^<>@][a-zA-Z0-9+\\-/*=%?!.$_~&^<>@]*)"
-                            "|(\\|[\\x20-\\x5B\\x5D-\\x7B\\x7D\\x7E\\xA0-\\xFF\\x09\\r\\n \\xA0]*\\|)$"
-            );
-            const std::regex regexKeyword = std::regex(
-                    "^:([a-zA-Z+\\-/*=%?!.$_~&^<>@][a-zA-Z0-9+\\-/*=%?!.$_~&^<>@]*)"
-                            "|(\\|[\\x20-\\x5B\\x5D-\\x7B\\x7D\\x7E\\xA0-\\xFF\\x09\\r\\n \\xA0]*\\|)$"
-            );
-
             ErrorPtr addError(const std::string& message, const NodePtr& node, ErrorPtr& err);
 
             ErrorPtr checkParamUsage(const std::vector<SymbolPtr>& params,
@@ -136,6 +126,9 @@ namespace smtlib {
             bool check(const NodePtr& node);
 
             std::string getErrors();
+
+            /** Discard the errors found so far */
+            void clearErrors();
         };
 
         typedef std::shared_ptr<SyntaxChecker> SyntaxCheckerPtr;
@@ -8,10 +8,31 @@
 #include "util/error_messages.h"
 #include "util/global_values.h"
 
+#include <cassert>
+
 using namespace std;
 using namespace smtlib;
 using namespace smtlib::ast;
 
+SortPtr TermSorter::visitTerm(Term* term) {
+    SortPtr sort = wrappedVisit(term);
+    term->inferredSort = sort;
+    return sort;
+}
+
+SortPtr TermSorter::run(Node* node) {
+    size_t depth = ctx->getStack()->getDepth();
+
+    Term* term = dynamic_cast<Term*>(node);
+    SortPtr sort = term ? visitTerm(term) : wrappedVisit(node);
+
+    // Binders pop the levels they push, whether their terms have a sort or not
+    assert(ctx->getStack()->getDepth() == depth);
+    (void) depth;
+
+    return sort;
+}
+
 template<class T>
 vector<string> toStringArray(vector<shared_ptr<T>>& array) {
     vector<string> strArray;
@@ -22,38 +43,36 @@ vector<string> toStringArray(vector<shared_ptr<T>>& array) {
     return strArray;
 }
 
-void TermSorter::visit(const SimpleIdentifierPtr& node) {
+void TermSorter::visit(SimpleIdentifier* node) {
     // Check if it is a variable
-    VarEntryPtr varEntry = ctx->getStack()->getVarEntry(node->toString());
+    VarEntryPtr varEntry = ctx->getStack()->getVarEntry(node->getNameId());
     if (varEntry) {
         ret = varEntry->sort;
         return;
     }
 
     // Check if it is a function
-    vector<FunEntryPtr> entries = ctx->getStack()->getFunEntry(node->symbol->toString());
+    vector<FunEntryPtr> entries = ctx->getStack()->getFunEntry(node->symbol->id);
     vector<SortPtr> retSorts = extractReturnSorts(entries, 0, false);
 
     if (retSorts.size() == 1) {
         ret = retSorts[0];
     } else if (retSorts.empty()) {
         auto error = ErrorMessages::buildConstNoSorts(node->toString());
-        ctx->getChecker()->addError(error, node);
+        ctx->getChecker()->addError(error, node->shared_from_this());
     } else {
         auto error = ErrorMessages::buildConstMultipleSorts(node->toString(), retSorts);
-        ctx->getChecker()->addError(error, node);
+        ctx->getChecker()->addError(error, node->shared_from_this());
     }
 }
 
-void TermSorter::visit(const QualifiedIdentifierPtr& node) {
+void TermSorter::visit(QualifiedIdentifier* node) {
     SortednessChecker::NodeErrorPtr errorAccum;
-    errorAccum = ctx->getChecker()->checkSort(node->sort, node, errorAccum);
+    errorAccum = ctx->getChecker()->checkSort(node->sort, node->shared_from_this(), errorAccum);
 
     SortPtr sortExpanded = ctx->getStack()->expand(node->sort);
-    string sortStr = sortExpanded->toString();
 
-    string name = node->identifier->toString();
-    vector<FunEntryPtr> entries = ctx->getStack()->getFunEntry(name);
+    vector<FunEntryPtr> entries = ctx->getStack()->getFunEntry(node->identifier->getNameId());
 
     // Possible non-parametric return sorts
     vector<SortPtr> retSorts = extractReturnSorts(entries, 0, false);
@@ -63,20 +82,20 @@ void TermSorter::visit(const QualifiedIdentifierPtr& node) {
 
     // Check if indicated sort is possible
     auto pos = find_if(retSorts.begin(), retSorts.end(),
-                       [&](const SortPtr& s) { return s->toString() == sortExpanded->toString(); });
+                       [&](const SortPtr& s) { return s->getCanonical() == sortExpanded->getCanonical(); });
 
     if (pos != retSorts.end()) {
         ret = *pos;
     } else if (retSorts.empty()) {
-        auto error = ErrorMessages::buildConstUnknown(name);
-        errorAccum = ctx->getChecker()->addError(error, node, errorAccum);
+        auto error = ErrorMessages::buildConstUnknown(node->identifier->toString());
+        errorAccum = ctx->getChecker()->addError(error, node->shared_from_this(), errorAccum);
     } else {
-        auto error = ErrorMessages::buildConstWrongSort(name, sortExpanded->toString(), retSorts);
-        ctx->getChecker()->addError(error, node, errorAccum);
+        auto error = ErrorMessages::buildConstWrongSort(node->identifier->toString(), sortExpanded->toString(), retSorts);
+        ctx->getChecker()->addError(error, node->shared_from_this(), errorAccum);
     }
 }
 
-void TermSorter::visit(const DecimalLiteralPtr& node) {
+void TermSorter::visit(DecimalLiteral* node) {
     // Get sort for this type of constant
     vector<FunEntryPtr> entries = ctx->getStack()->getFunEntry(MSCONST_DECIMAL);
     if (entries.size() == 1) {
@@ -87,16 +106,16 @@ void TermSorter::visit(const DecimalLiteralPtr& node) {
         // If no entries or multiple entries are found, add error
         if (entries.empty()) {
             auto error = ErrorMessages::buildLiteralUnknownSort(MSCONST_DECIMAL_REF);
-            ctx->getChecker()->addError(error, node);
+            ctx->getChecker()->addError(error, node->shared_from_this());
         } else {
             vector<SortPtr> possibleSorts = extractReturnSorts(entries, 0, false);
             auto error = ErrorMessages::buildLiteralMultipleSorts(MSCONST_DECIMAL_REF, possibleSorts);
-            ctx->getChecker()->addError(error, node);
+            ctx->getChecker()->addError(error, node->shared_from_this());
         }
     }
 }
 
-void TermSorter::visit(const NumeralLiteralPtr& node) {
+void TermSorter::visit(NumeralLiteral* node) {
     // Get sort for this type of constant
     vector<FunEntryPtr> entries = ctx->getStack()->getFunEntry(MSCONST_NUMERAL);
     if (entries.size() == 1) {
@@ -107,16 +126,16 @@ void TermSorter::visit(const NumeralLiteralPtr& node) {
         // If no entries or multiple entries are found, add error
         if (entries.empty()) {
             auto error = ErrorMessages::buildLiteralUnknownSort(MSCONST_NUMERAL_REF);
-            ctx->getChecker()->addError(error, node);
+            ctx->getChecker()->addError(error, node->shared_from_this());
         } else {
             vector<SortPtr> possibleSorts = extractReturnSorts(entries, 0, false);
             auto error = ErrorMessages::buildLiteralMultipleSorts(MSCONST_NUMERAL_REF, possibleSorts);
-            ctx->getChecker()->addError(error, node);
+            ctx->getChecker()->addError(error, node->shared_from_this());
         }
     }
 }
 
-void TermSorter::visit(const StringLiteralPtr& node) {
+void TermSorter::visit(StringLiteral* node) {
     // Get sort for this type of constant
     vector<FunEntryPtr> entries = ctx->getStack()->getFunEntry(MSCONST_STRING);
     if (entries.size() == 1) {
@@ -127,159 +146,149 @@ void TermSorter::visit(const StringLiteralPtr& node) {
         // If no entries or multiple entries are found, add error
         if (entries.empty()) {
             auto error = ErrorMessages::buildLiteralUnknownSort(MSCONST_STRING_REF);
-            ctx->getChecker()->addError(error, node);
+            ctx->getChecker()->addError(error, node->shared_from_this());
         } else {
             vector<SortPtr> possibleSorts = extractReturnSorts(entries, 0, false);
             auto error = ErrorMessages::buildLiteralMultipleSorts(MSCONST_STRING_REF, possibleSorts);
-            ctx->getChecker()->addError(error, node);
+            ctx->getChecker()->addError(error, node->shared_from_this());
         }
     }
 }
 
-void TermSorter::visit(const QualifiedTermPtr& node) {
+void TermSorter::visit(QualifiedTerm* node) {
     SortednessChecker::NodeErrorPtr errAccum;
 
     // Get sorts for arguments
     vector<SortPtr> argSorts;
     vector<TermPtr>& terms = node->terms;
+    argSorts.reserve(terms.size());
     for (const auto& arg : terms) {
-        SortPtr argSort = wrappedVisit(arg);
+        SortPtr argSort = visitTerm(arg.get());
         if (!argSort) { return; }
         argSorts.push_back(argSort);
     }
 
-    SimpleIdentifierPtr id = dynamic_pointer_cast<SimpleIdentifier>(node->identifier);
-    QualifiedIdentifierPtr qid = dynamic_pointer_cast<QualifiedIdentifier>(node->identifier);
+    SimpleIdentifierPtr id = nodeCast<SimpleIdentifier>(node->identifier);
+    QualifiedIdentifierPtr qid = nodeCast<QualifiedIdentifier>(node->identifier);
 
     SortPtr retExpanded;
-    string name;
+    SimpleIdentifierPtr funId;
 
     if (id) {
-        name = id->toString();
+        funId = id;
     } else {
-        errAccum = ctx->getChecker()->checkSort(qid->sort, node, errAccum);
-        name = qid->identifier->toString();
+        errAccum = ctx->getChecker()->checkSort(qid->sort, node->shared_from_this(), errAccum);
+        funId = qid->identifier;
         retExpanded = ctx->getStack()->expand(qid->sort);
     }
 
-    vector<FunEntryPtr> entries = ctx->getStack()->getFunEntry(name);
+    vector<FunEntryPtr> entries = ctx->getStack()->getFunEntry(funId->getNameId());
     vector<SortPtr> retSorts;
+    size_t argCount = argSorts.size();
 
     for (const auto& entry : entries) {
-        // Get function signature, while accounting for all possible attributes (e.g. associativity)
-        vector<SortPtr> funSig;
-        if (argSorts.size() >= 2) {
-            if (entry->assocL) {
-                funSig.push_back(entry->signature[0]);
-                for (size_t i = 0; i < argSorts.size() - 1; i++) {
-                    funSig.push_back(entry->signature[1]);
-                }
-                funSig.push_back(entry->signature[2]);
-            } else if (entry->assocR) {
-                for (size_t i = 0; i < argSorts.size() - 1; i++) {
-                    funSig.push_back(entry->signature[0]);
-                }
-                funSig.push_back(entry->signature[1]);
-                funSig.push_back(entry->signature[2]);
-            } else if (entry->chainable || entry->pairwise) {
-                for (size_t i = 0; i < argSorts.size(); i++) {
-                    funSig.push_back(entry->signature[0]);
-                }
-                funSig.push_back(entry->signature[2]);
-            } else {
-                funSig.insert(funSig.begin(), entry->signature.begin(), entry->signature.end());
-            }
-        } else {
-            funSig.insert(funSig.begin(), entry->signature.begin(), entry->signature.end());
-        }
+        // Match the arguments against the signature, while accounting for all possible attributes
+        // (e.g. associativity), so that it does not need to be expanded to one sort per argument
+        if (!entry->acceptsArity(argCount)) { continue; }
 
-        // Check that the arguments respect the signature
-        if (argSorts.size() != funSig.size() - 1) { continue; }
-        bool fits = true;
         if (entry->params.empty()) { // Function is not parametric
-            for (size_t i = 0; i < funSig.size() - 1; i++) {
-                if (funSig[i]->toString() != argSorts[i]->toString())
-                    fits = false;
+            // Stop at the first argument that does not fit, which rules out most overloads right away
+            bool fits = true;
+            for (size_t i = 0; i < argCount && fits; i++) {
+                fits = entry->getArgumentSort(i, argCount)->getCanonical() == argSorts[i]->getCanonical();
             }
 
-            if(!fits) { continue; }
+            if (!fits) { continue; }
 
+            const SortPtr& retSort = entry->getResultSort(argCount);
             if (id) {
-                retSorts.push_back(funSig[funSig.size() - 1]);
-            } else {
-                SortPtr retSort = funSig[funSig.size() - 1];
-                if (retSort->toString() == retExpanded->toString()) {
-                    ret = retSort;
-                    return;
-                }
+                retSorts.push_back(retSort);
+            } else if (retSort->getCanonical() == retExpanded->getCanonical()) {
+                ret = retSort;
+                return;
             }
         } else { // Function is parametric
-            vector<string> pnames = toStringArray(entry->params);
-            unordered_map<string, SortPtr> mapping;
+            // Instances only depend on the argument sorts, so they are computed once for each
+            bool known;
+            SortPtr& instance = ctx->getStack()->getInstance(entry, argSorts, known);
+            if (!known) {
+                vector<string> pnames = toStringArray(entry->params);
+                unordered_map<string, SortPtr> mapping;
+
+                // Unify each argument sort with its corresponding signature sort
+                bool fits = true;
+                for (size_t i = 0; i < argCount && fits; i++) {
+                    fits = unify(entry->getArgumentSort(i, argCount), argSorts[i], pnames, mapping);
+                }
 
-            // Unify each argument sort with its corresponding signature sort
-            for (size_t i = 0; i < funSig.size() - 1; i++) {
-                fits = fits && unify(funSig[i], argSorts[i], pnames, mapping);
+                if (fits && mapping.size() == entry->params.size())
+                    instance = ctx->getStack()->replace(entry->getResultSort(argCount), mapping);
             }
 
-            if (!fits || mapping.size() != entry->params.size()) { continue; }
+            SortPtr retSort = instance;
+            if (!retSort) { continue; }
 
-            SortPtr retSort = funSig[funSig.size() - 1];
-            retSort = ctx->getStack()->replace(retSort, mapping);
             if (id) {
                 retSorts.push_back(retSort);
-            } else if (retSort->toString() == retExpanded->toString()) {
+            } else if (retSort->getCanonical() == retExpanded->getCanonical()) {
                 ret = retSort;
                 return;
             }
         }
     }
 
+    if (id && retSorts.size() == 1) {
+        ret = retSorts[0];
+        return;
+    }
+
+    // Resolution failed, so build the diagnostic
     vector<string> argSortsStr = toStringArray(argSorts);
-    vector<string> retSortsStr = toStringArray(retSorts);
+    string name = funId->toString();
 
-    if (id) {
-        if (retSorts.size() == 1) {
-            ret = retSorts[0];
-        } else if (retSorts.empty()) {
-            auto error = ErrorMessages::buildFunUnknownDecl(name, argSortsStr);
-            errAccum = ctx->getChecker()->addError(error, node, errAccum);
-        } else {
-            auto error = ErrorMessages::buildFunMultipleDecls(name, argSortsStr, retSortsStr);
-            errAccum = ctx->getChecker()->addError(error, node, errAccum);
-        }
-    } else {
+    if (!id) {
         auto error = ErrorMessages::buildFunUnknownDecl(name, argSortsStr, retExpanded->toString());
-        errAccum = ctx->getChecker()->addError(error, node, errAccum);
+        errAccum = ctx->getChecker()->addError(error, node->shared_from_this(), errAccum);
+    } else if (retSorts.empty()) {
+        auto error = ErrorMessages::buildFunUnknownDecl(name, argSortsStr);
+        errAccum = ctx->getChecker()->addError(error, node->shared_from_this(), errAccum);
+    } else {
+        auto error = ErrorMessages::buildFunMultipleDecls(name, argSortsStr, toStringArray(retSorts));
+        errAccum = ctx->getChecker()->addError(error, node->shared_from_this(), errAccum);
     }
 }
 
-void TermSorter::visit(const LetTermPtr& node) {
+void TermSorter::visit(LetTerm* node) {
     // New stack level for bindings
     ctx->getStack()->push();
 
-    // Push bindings
+    // Push bindings, stopping at the first one without a sort
+    bool bound = true;
     vector<VariableBindingPtr>& bindings = node->bindings;
     for (const auto& bind : bindings) {
-        SortPtr bindSort = wrappedVisit(bind->term);
-        if (bindSort) {
-            ctx->getStack()->tryAdd(make_shared<VarEntry>(std::move(bind->symbol->toString()), bindSort, node));
-        } else {
-            return;
+        SortPtr bindSort = visitTerm(bind->term.get());
+        if (!bindSort) {
+            bound = false;
+            break;
         }
+
+        ctx->getStack()->tryAdd(make_shared<VarEntry>(std::move(bind->symbol->toString()), bindSort,
+                                                      node->shared_from_this()));
     }
 
     // Determine sort of the inner term
-    SortPtr termSort = wrappedVisit(node->term);
-    if (termSort) {
-        ret = termSort;
+    if (bound) {
+        SortPtr termSort = visitTerm(node->term.get());
+        if (termSort) {
+            ret = termSort;
+        }
     }
 
     // Pop the previously added level
     ctx->getStack()->pop();
 }
 
-void TermSorter::visit(const ForallTermPtr& node) {
+void TermSorter::visit(ForallTerm* node) {
     // New stack level for bindings
     ctx->getStack()->push();
 
@@ -288,11 +297,11 @@ void TermSorter::visit(const ForallTermPtr& node) {
     for (const auto& bind : bindings) {
         auto bindSortExpanded = ctx->getStack()->expand(bind->sort);
         ctx->getStack()->tryAdd(make_shared<VarEntry>(std::move(bind->symbol->toString()),
-                                                     bindSortExpanded, node));
+                                                     bindSortExpanded, node->shared_from_this()));
     }
 
     // Determine sort of the inner term
-    SortPtr termSort = wrappedVisit(node->term);
+    SortPtr termSort = visitTerm(node->term.get());
     if (termSort) {
         string termSortStr = termSort->toString();
         // Inner term should be boolean
@@ -301,9 +310,9 @@ void TermSorter::visit(const ForallTermPtr& node) {
         } else {
             // Otherwise, add error
             auto error = ErrorMessages::buildQuantTermWrongSort(node->term->toString(), termSortStr, SORT_BOOL,
-                                                                node->term->rowLeft, node->term->colLeft,
-                                                                node->term->rowRight, node->term->colRight);
-            ctx->getChecker()->addError(error, node);
+                                                                node->term->getRowLeft(), node->term->getColLeft(),
+                                                                node->term->getRowRight(), node->term->getColRight());
+            ctx->getChecker()->addError(error, node->shared_from_this());
         }
     }
 
@@ -311,7 +320,7 @@ void TermSorter::visit(const ForallTermPtr& node) {
     ctx->getStack()->pop();
 }
 
-void TermSorter::visit(const ExistsTermPtr& node) {
+void TermSorter::visit(ExistsTerm* node) {
     // New stack level for bindings
     ctx->getStack()->push();
 
@@ -320,11 +329,11 @@ void TermSorter::visit(const ExistsTermPtr& node) {
     for (const auto& bind : bindings) {
         auto bindSortExpanded = ctx->getStack()->expand(bind->sort);
         ctx->getStack()->tryAdd(make_shared<VarEntry>(std::move(bind->symbol->toString()),
-                                                     bindSortExpanded, node));
+                                                     bindSortExpanded, node->shared_from_this()));
     }
 
     // Determine sort of the inner term
-    SortPtr termSort = wrappedVisit(node->term);
+    SortPtr termSort = visitTerm(node->term.get());
 
     if (termSort) {
         string termSortStr = termSort->toString();
@@ -334,9 +343,9 @@ void TermSorter::visit(const ExistsTermPtr& node) {
         } else {
             // Otherwise, add error
             auto error = ErrorMessages::buildQuantTermWrongSort(node->term->toString(), termSortStr, SORT_BOOL,
-                                                                node->term->rowLeft, node->term->colLeft,
-                                                                node->term->rowRight, node->term->colRight);
-            ctx->getChecker()->addError(error, node);
+                                                                node->term->getRowLeft(), node->term->getColLeft(),
+                                                                node->term->getRowRight(), node->term->getColRight());
+            ctx->getChecker()->addError(error, node->shared_from_this());
         }
     }
 
@@ -344,9 +353,9 @@ void TermSorter::visit(const ExistsTermPtr& node) {
     ctx->getStack()->pop();
 }
 
-void TermSorter::visit(const MatchTermPtr& node) {
+void TermSorter::visit(MatchTerm* node) {
     // Determine sort of the term to be matched
-    SortPtr termSort = wrappedVisit(node->term);
+    SortPtr termSort = visitTerm(node->term.get());
 
     // Return if sort could not be determined
     if (!termSort) {
@@ -364,11 +373,11 @@ void TermSorter::visit(const MatchTermPtr& node) {
         PatternPtr pattern = cases[i]->pattern;
 
         // Symbol (constructor or variable)
-        SymbolPtr spattern = dynamic_pointer_cast<Symbol>(pattern);
+        SymbolPtr spattern = nodeCast<Symbol>(pattern);
         // Qualified constructor
-        QualifiedConstructorPtr cpattern = dynamic_pointer_cast<QualifiedConstructor>(pattern);
+        QualifiedConstructorPtr cpattern = nodeCast<QualifiedConstructor>(pattern);
         // Qualified pattern
-        QualifiedPatternPtr qpattern = dynamic_pointer_cast<QualifiedPattern>(pattern);
+        QualifiedPatternPtr qpattern = nodeCast<QualifiedPattern>(pattern);
 
         SymbolPtr scons; // Simple constructor for qualified pattern
         QualifiedConstructorPtr qcons; // Qualified constructor for qualified pattern
@@ -381,8 +390,8 @@ void TermSorter::visit(const MatchTermPtr& node) {
             caseId = cpattern->symbol->toString();
         } else if (qpattern) {
             ConstructorPtr cons = qpattern->constructor;
-            scons = dynamic_pointer_cast<Symbol>(cons);
-            qcons = dynamic_pointer_cast<QualifiedConstructor>(cons);
+            scons = nodeCast<Symbol>(cons);
+            qcons = nodeCast<QualifiedConstructor>(cons);
 
             if (scons)
                 caseId = scons->toString();
@@ -398,7 +407,6 @@ void TermSorter::visit(const MatchTermPtr& node) {
         // Select the function entries that fit
         for (const auto& entry : funEntries) {
             SortPtr retSort = entry->signature[entry->signature.size() - 1];
-            string retSortStr = retSort->toString();
 
             // If entry is about a parametric function, map sort parameters to real sorts
             vector<string> pnames = toStringArray(entry->params);
@@ -408,9 +416,9 @@ void TermSorter::visit(const MatchTermPtr& node) {
             // Check if current function entry fits
             if (spattern || cpattern) {
                 // Return sort mismatch in case of qualified constructor
-                if (cpattern && cpattern->sort->toString() != termSortStr) {
+                if (cpattern && cpattern->sort->getCanonical() != termSort->getCanonical()) {
                     auto error = ErrorMessages::buildPatternMismatch(termSortStr, pattern->toString());
-                    errAccum = ctx->getChecker()->addError(error, node, errAccum);
+                    errAccum = ctx->getChecker()->addError(error, node->shared_from_this(), errAccum);
                     continue;
                 }
 
@@ -421,9 +429,9 @@ void TermSorter::visit(const MatchTermPtr& node) {
                 }
             } else if (qpattern) {
                 // Return sort mismatch in case of qualified constructor
-                if (qcons && qcons->sort->toString() != termSortStr) {
+                if (qcons && qcons->sort->getCanonical() != termSort->getCanonical()) {
                     auto error = ErrorMessages::buildPatternMismatch(termSortStr, pattern->toString());
-                    errAccum = ctx->getChecker()->addError(error, node, errAccum);
+                    errAccum = ctx->getChecker()->addError(error, node->shared_from_this(), errAccum);
                     continue;
                 }
 
@@ -442,22 +450,22 @@ void TermSorter::visit(const MatchTermPtr& node) {
                 // If it's not a function, try to interpret it as a variable
                 ctx->getStack()->push();
                 ctx->getStack()->tryAdd(make_shared<VarEntry>(caseId, termSort, cases[i]));
-                SortPtr caseSort = wrappedVisit(cases[i]->term);
+                SortPtr caseSort = visitTerm(cases[i]->term.get());
                 if (caseSort) {
                     caseSorts.push_back(caseSort);
                 }
                 ctx->getStack()->pop();
             } else if (spattern || cpattern) {
                 auto error = ErrorMessages::buildFunUnknownDecl(caseId, termSort->toString());
-                errAccum = ctx->getChecker()->addError(error, node, errAccum);
+                errAccum = ctx->getChecker()->addError(error, node->shared_from_this(), errAccum);
             } else if (qpattern) {
                 auto error = ErrorMessages::buildFunUnknownDecl(caseId, qpattern->symbols.size(), termSort->toString());
-                errAccum = ctx->getChecker()->addError(error, node, errAccum);
+                errAccum = ctx->getChecker()->addError(error, node->shared_from_this(), errAccum);
             }
         } else if (matchingEntries.size() > 1) {
             if (qpattern) {
                 auto error = ErrorMessages::buildFunMultipleDecls(caseId, qpattern->symbols.size(), termSort->toString());
-                errAccum = ctx->getChecker()->addError(error, node, errAccum);
+                errAccum = ctx->getChecker()->addError(error, node->shared_from_this(), errAccum);
             }
         } else {
             FunEntryPtr match = matchingEntries[0];
@@ -470,7 +478,7 @@ void TermSorter::visit(const MatchTermPtr& node) {
                 }
             }
 
-            SortPtr caseSort = wrappedVisit(cases[i]->term);
+            SortPtr caseSort = visitTerm(cases[i]->term.get());
             if (caseSort) {
                 caseSorts.push_back(caseSort);
             }
@@ -483,21 +491,22 @@ void TermSorter::visit(const MatchTermPtr& node) {
 
     // Check that all cases have the same sort
     if (caseSorts.size() == node->cases.size()) {
-        string case1 = caseSorts[0]->toString();
+        const CanonicalSort* case1 = caseSorts[0]->getCanonical();
         auto pos = find_if(caseSorts.begin() + 1, caseSorts.end(),
-                           [&](const SortPtr& s) { return s->toString() != case1; });
+                           [&](const SortPtr& s) { return s->getCanonical() != case1; });
 
         bool equalCases = pos == caseSorts.end();
         if (equalCases) {
             ret = caseSorts[0];
         } else {
-            errAccum = ctx->getChecker()->addError(ErrorMessages::buildCasesMismatch(caseSorts), node, errAccum);
+            errAccum = ctx->getChecker()->addError(ErrorMessages::buildCasesMismatch(caseSorts),
+                                                   node->shared_from_this(), errAccum);
         }
     }
 
 }
 
-void TermSorter::visit(const AnnotatedTermPtr& node) {
+void TermSorter::visit(AnnotatedTerm* node) {
     visit0(node->term);
 }
 
@@ -571,7 +580,7 @@ bool TermSorter::unify(const SortPtr& sort1, const SortPtr& sort2,
 
     if (isParam) {
         if (mapping[sort1Name]) {
-            return mapping[sort1Name]->toString() == sort2->toString();
+            return mapping[sort1Name]->getCanonical() == sort2->getCanonical();
         } else {
             mapping[sort1Name] = sort2;
             return true;
@@ -31,7 +31,7 @@ namespace smtlib {
 
         /* ==================================== TermSorter ==================================== */
         /** Determines the sort of a term */
-        class TermSorter : public DummyVisitor1<SortPtr> {
+        class TermSorter : public DummyRawVisitor1<SortPtr> {
         private:
             ITermSorterContextPtr ctx;
 
@@ -64,26 +64,30 @@ namespace smtlib {
                               const std::vector<std::string>& params,
                               std::unordered_map<std::string, SortPtr>& mapping);
 
+            /** Determine the sort of a term, and annotate the term with it */
+            SortPtr visitTerm(Term* term);
+
         public:
             inline explicit TermSorter(ITermSorterContextPtr ctx)
                     : ctx(std::move(ctx)) {}
 
-            void visit(const SimpleIdentifierPtr& node) override;
-            void visit(const QualifiedIdentifierPtr& node) override;
-            void visit(const DecimalLiteralPtr& node) override;
-            void visit(const NumeralLiteralPtr& node) override;
-            void visit(const StringLiteralPtr& node) override;
-
-            void visit(const QualifiedTermPtr& node) override;
-            void visit(const LetTermPtr& node) override;
-            void visit(const ForallTermPtr& node) override;
-            void visit(const ExistsTermPtr& node) override;
-            void visit(const MatchTermPtr& node) override;
-            void visit(const AnnotatedTermPtr& node) override;
-
-            SortPtr run(const NodePtr& node) override {
-                return wrappedVisit(node);
-            }
+            using DummyRawVisitor1<SortPtr>::run;
+
+            /** Determine the sort of a node, annotating it and its subterms if it is a term */
+            SortPtr run(Node* node) override;
+
+            void visit(SimpleIdentifier* node) override;
+            void visit(QualifiedIdentifier* node) override;
+            void visit(DecimalLiteral* node) override;
+            void visit(NumeralLiteral* node) override;
+            void visit(StringLiteral* node) override;
+
+            void visit(QualifiedTerm* node) override;
+            void visit(LetTerm* node) override;
+            void visit(ForallTerm* node) override;
+            void visit(ExistsTerm* node) override;
+            void visit(MatchTerm* node) override;
+            void visit(AnnotatedTerm* node) override;
         };
 
         typedef std::shared_ptr<TermSorter> TermSorterPtr;
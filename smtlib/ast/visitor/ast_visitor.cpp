@@ -8,6 +8,7 @@
 #include "ast/ast_symbol_decl.h"
 #include "ast/ast_term.h"
 #include "ast/ast_theory.h"
+#include "util/stack_guard.h"
 
 using namespace smtlib::ast;
 
@@ -15,6 +16,13 @@ void Visitor0::visit0(const NodePtr& node) {
     if (node == nullptr) {
         return;
     }
+
+    // Continue deeply nested traversals on a new stack segment
+    if (StackGuard::isLow()) {
+        StackGuard::runOnNewSegment([&] { node->accept(this); });
+        return;
+    }
+
     node->accept(this);
 }
 
@@ -306,3 +314,306 @@ void DummyVisitor0::visit(const VariableBindingPtr& node) {
     visit0(node->symbol);
     visit0(node->term);
 }
+
+void RawVisitor0::visit0(Node* node) {
+    if (node == nullptr) {
+        return;
+    }
+
+    // Continue deeply nested traversals on a new stack segment
+    if (StackGuard::isLow()) {
+        StackGuard::runOnNewSegment([&] { node->accept(this); });
+        return;
+    }
+
+    node->accept(this);
+}
+
+void DummyRawVisitor0::visit(Attribute* node) {
+    visit0(node->keyword);
+    visit0(node->value);
+}
+
+void DummyRawVisitor0::visit(CompAttributeValue* node) {
+    visit0(node->values);
+}
+
+void DummyRawVisitor0::visit(Symbol* node) {}
+
+void DummyRawVisitor0::visit(Keyword* node) {}
+
+void DummyRawVisitor0::visit(MetaSpecConstant* node) {}
+
+void DummyRawVisitor0::visit(BooleanValue* node) {}
+
+void DummyRawVisitor0::visit(PropLiteral* node) {}
+
+void DummyRawVisitor0::visit(AssertCommand* node) {
+    visit0(node->term);
+}
+
+void DummyRawVisitor0::visit(CheckSatCommand* node) {}
+
+void DummyRawVisitor0::visit(CheckUnsatCommand* node) {}
+
+void DummyRawVisitor0::visit(CheckSatAssumCommand* node) {
+    visit0(node->assumptions);
+}
+
+void DummyRawVisitor0::visit(DeclareConstCommand* node) {
+    visit0(node->symbol);
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(DeclareDatatypeCommand* node) {
+    visit0(node->symbol);
+    visit0(node->declaration);
+}
+
+void DummyRawVisitor0::visit(DeclareDatatypesCommand* node) {
+    visit0(node->declarations);
+}
+
+void DummyRawVisitor0::visit(DeclareFunCommand* node) {
+    visit0(node->symbol);
+    visit0(node->parameters);
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(DeclareSortCommand* node) {
+    visit0(node->symbol);
+}
+
+void DummyRawVisitor0::visit(DeclareHeapCommand* node) {
+    visit0(node->locDataPairs);
+}
+
+void DummyRawVisitor0::visit(DefineFunCommand* node) {
+    visit0(node->definition);
+}
+
+void DummyRawVisitor0::visit(DefineFunRecCommand* node) {
+    visit0(node->definition);
+}
+
+void DummyRawVisitor0::visit(DefineFunsRecCommand* node) {
+    visit0(node->declarations);
+    visit0(node->bodies);
+}
+
+void DummyRawVisitor0::visit(DefineSortCommand* node) {
+    visit0(node->symbol);
+    visit0(node->parameters);
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(EchoCommand* node) {}
+
+void DummyRawVisitor0::visit(ExitCommand* node) {}
+
+void DummyRawVisitor0::visit(GetAssertsCommand* node) {}
+
+void DummyRawVisitor0::visit(GetAssignsCommand* node) {}
+
+void DummyRawVisitor0::visit(GetInfoCommand* node) {
+    visit0(node->flag);
+}
+
+void DummyRawVisitor0::visit(GetModelCommand* node) {}
+
+void DummyRawVisitor0::visit(GetOptionCommand* node) {
+    visit0(node->option);
+}
+
+void DummyRawVisitor0::visit(GetProofCommand* node) {}
+
+void DummyRawVisitor0::visit(GetUnsatAssumsCommand* node) {}
+
+void DummyRawVisitor0::visit(GetUnsatCoreCommand* node) {}
+
+void DummyRawVisitor0::visit(GetValueCommand* node) {
+    visit0(node->terms);
+}
+
+void DummyRawVisitor0::visit(PopCommand* node) {
+    visit0(node->numeral);
+}
+
+void DummyRawVisitor0::visit(PushCommand* node) {
+    visit0(node->numeral);
+}
+
+void DummyRawVisitor0::visit(ResetCommand* node) {}
+
+void DummyRawVisitor0::visit(ResetAssertsCommand* node) {}
+
+void DummyRawVisitor0::visit(SetInfoCommand* node) {
+    visit0(node->info);
+}
+
+void DummyRawVisitor0::visit(SetLogicCommand* node) {
+    visit0(node->logic);
+}
+
+void DummyRawVisitor0::visit(SetOptionCommand* node) {
+    visit0(node->option);
+}
+
+void DummyRawVisitor0::visit(FunctionDeclaration* node) {
+    visit0(node->symbol);
+    visit0(node->parameters);
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(FunctionDefinition* node) {
+    visit0(node->signature);
+    visit0(node->body);
+}
+
+void DummyRawVisitor0::visit(SimpleIdentifier* node) {
+    visit0(node->symbol);
+}
+
+void DummyRawVisitor0::visit(QualifiedIdentifier* node) {
+    visit0(node->identifier);
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(DecimalLiteral* node) {}
+
+void DummyRawVisitor0::visit(NumeralLiteral* node) {}
+
+void DummyRawVisitor0::visit(StringLiteral* node) {}
+
+void DummyRawVisitor0::visit(Logic* node) {
+    visit0(node->name);
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(Theory* node) {
+    visit0(node->name);
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(Script* node) {
+    visit0(node->commands);
+}
+
+void DummyRawVisitor0::visit(Sort* node) {
+    visit0(node->identifier);
+    visit0(node->arguments);
+}
+
+void DummyRawVisitor0::visit(CompSExpression* node) {
+    visit0(node->expressions);
+}
+
+void DummyRawVisitor0::visit(SortSymbolDeclaration* node) {
+    visit0(node->identifier);
+    visit0(node->arity);
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(SortDeclaration* node) {
+    visit0(node->symbol);
+    visit0(node->arity);
+}
+
+void DummyRawVisitor0::visit(SelectorDeclaration* node) {
+    visit0(node->symbol);
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(ConstructorDeclaration* node) {
+    visit0(node->symbol);
+    visit0(node->selectors);
+}
+
+void DummyRawVisitor0::visit(SimpleDatatypeDeclaration* node) {
+    visit0(node->constructors);
+}
+
+void DummyRawVisitor0::visit(ParametricDatatypeDeclaration* node) {
+    visit0(node->constructors);
+    visit0(node->parameters);
+}
+
+void DummyRawVisitor0::visit(QualifiedConstructor* node) {
+    visit0(node->symbol);
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(QualifiedPattern* node) {
+    visit0(node->constructor);
+    visit0(node->symbols);
+}
+
+void DummyRawVisitor0::visit(MatchCase* node) {
+    visit0(node->pattern);
+    visit0(node->term);
+}
+
+void DummyRawVisitor0::visit(SpecConstFunDeclaration* node) {
+    visit0(node->constant);
+    visit0(node->sort);
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(MetaSpecConstFunDeclaration* node) {
+    visit0(node->constant);
+    visit0(node->sort);
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(SimpleFunDeclaration* node) {
+    visit0(node->identifier);
+    visit0(node->signature);
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(ParametricFunDeclaration* node) {
+    visit0(node->parameters);
+    visit0(node->identifier);
+    visit0(node->signature);
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(QualifiedTerm* node) {
+    visit0(node->identifier);
+    visit0(node->terms);
+}
+
+void DummyRawVisitor0::visit(LetTerm* node) {
+    visit0(node->bindings);
+    visit0(node->term);
+}
+
+void DummyRawVisitor0::visit(ForallTerm* node) {
+    visit0(node->bindings);
+    visit0(node->term);
+}
+
+void DummyRawVisitor0::visit(ExistsTerm* node) {
+    visit0(node->bindings);
+    visit0(node->term);
+}
+
+void DummyRawVisitor0::visit(MatchTerm* node) {
+    visit0(node->term);
+    visit0(node->cases);
+}
+
+void DummyRawVisitor0::visit(AnnotatedTerm* node) {
+    visit0(node->term);
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(SortedVariable* node) {
+    visit0(node->symbol);
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(VariableBinding* node) {
+    visit0(node->symbol);
+    visit0(node->term);
+}
@@ -94,6 +94,115 @@ namespace smtlib {
         class DummyVisitor2 : public Visitor2<RetT, ArgT>,
                               public DummyVisitor0 {
         };
+
+        /* =================================== RawVisitor1 ==================================== */
+        /**
+         * An extended visitor for the smtlib::ast hierarchy, where each visit returns a result,
+         * that does not share ownership of the nodes it visits (see RawVisitor0).
+         * Results are moved rather than copied, and a visit that does not set a result returns an empty one
+         */
+        template<class RetT>
+        class RawVisitor1 : public virtual RawVisitor0 {
+        protected:
+            RetT ret;
+
+            RetT wrappedVisit(Node* node) {
+                RetT oldRet = std::move(ret);
+                ret = RetT();
+                visit0(node);
+                RetT newRet = std::move(ret);
+                ret = std::move(oldRet);
+                return newRet;
+            }
+
+            template<class T>
+            RetT wrappedVisit(const std::shared_ptr<T>& node) {
+                return wrappedVisit(static_cast<Node*>(node.get()));
+            }
+
+            template<class T>
+            std::vector<RetT> wrappedVisit(const std::vector<std::shared_ptr<T>>& nodes) {
+                std::vector<RetT> result(nodes.size());
+                for (size_t i = 0, n = nodes.size(); i < n; ++i) {
+                    result[i] = wrappedVisit(nodes[i]);
+                }
+                return result;
+            }
+
+        public:
+            virtual RetT run(Node* node) {
+                return wrappedVisit(node);
+            }
+
+            template<class T>
+            RetT run(const std::shared_ptr<T>& node) {
+                return run(static_cast<Node*>(node.get()));
+            }
+        };
+
+        /* =================================== RawVisitor2 ==================================== */
+        /**
+         * An extended visitor for the smtlib::ast hierarchy, where each visit returns a result
+         * and takes an additional argument, that does not share ownership of the nodes it visits
+         * (see RawVisitor0). Results and arguments are moved rather than copied,
+         * and a visit that does not set a result returns an empty one
+         */
+        template<class RetT, class ArgT>
+        class RawVisitor2 : public virtual RawVisitor0 {
+        protected:
+            ArgT arg;
+            RetT ret;
+
+            RetT wrappedVisit(ArgT arg, Node* node) {
+                RetT oldRet = std::move(ret);
+                ArgT oldArg = std::move(this->arg);
+                ret = RetT();
+                this->arg = std::move(arg);
+                visit0(node);
+                RetT newRet = std::move(ret);
+                ret = std::move(oldRet);
+                this->arg = std::move(oldArg);
+                return newRet;
+            }
+
+            template<class T>
+            RetT wrappedVisit(ArgT arg, const std::shared_ptr<T>& node) {
+                return wrappedVisit(std::move(arg), static_cast<Node*>(node.get()));
+            }
+
+            template<class T>
+            std::vector<RetT> wrappedVisit(const ArgT& arg, const std::vector<std::shared_ptr<T>>& nodes) {
+                std::vector<RetT> result(nodes.size());
+                for (size_t i = 0, n = nodes.size(); i < n; ++i) {
+                    result[i] = wrappedVisit(arg, nodes[i]);
+                }
+                return result;
+            }
+
+        public:
+            virtual RetT run(ArgT arg, Node* node) {
+                return wrappedVisit(std::move(arg), node);
+            }
+
+            template<class T>
+            RetT run(ArgT arg, const std::shared_ptr<T>& node) {
+                return run(std::move(arg), static_cast<Node*>(node.get()));
+            }
+        };
+
+        /* ================================= DummyRawVisitor1 ================================= */
+        /** A dummy (empty) implementation of RawVisitor1 */
+        template<class RetT>
+        class DummyRawVisitor1 : public RawVisitor1<RetT>,
+                                 public DummyRawVisitor0 {
+        };
+
+        /* ================================= DummyRawVisitor2 ================================= */
+        /** A dummy (empty) implementation of RawVisitor2 */
+        template<class RetT, class ArgT>
+        class DummyRawVisitor2 : public RawVisitor2<RetT, ArgT>,
+                                 public DummyRawVisitor0 {
+        };
     }
 }
 
@@ -2,19 +2,26 @@
 #include <stdio.h>
 #include "smtlib-glue.h"
 
-int yylex();
-void yyerror(SmtPrsr parser, const char *);
-
-#define YYMAXDEPTH 300000
-#define YYINITDEPTH 300000
+/* Nesting depth up to which the parser stacks can grow (set by PARSER_MAX_DEPTH in CMake) */
+#ifndef YYMAXDEPTH
+#define YYMAXDEPTH 10000000
+#endif
 %}
 
 %locations
-%error-verbose
+%define parse.error verbose
 
 %define api.prefix {smt_yy}
+%define api.pure full
+%define api.header.include {"smtlib-bison-parser.y.h"}
+
+%lex-param {SmtScanner scanner}
+%parse-param {SmtPrsr parser} {SmtScanner scanner}
 
-%parse-param {SmtPrsr parser}
+%code {
+int yylex(YYSTYPE* lvalp, YYLTYPE* llocp, SmtScanner scanner);
+void yyerror(YYLTYPE* llocp, SmtPrsr parser, SmtScanner scanner, const char* msg);
+}
 
 %union
 {
@@ -23,6 +30,9 @@ void yyerror(SmtPrsr parser, const char *);
 	AstPairList pairList;
 };
 
+%destructor { ast_listDelete($$); } <list>
+%destructor { ast_pairListDelete($$); } <pairList>
+
 %token KW_AS KW_LET KW_FORALL KW_EXISTS KW_MATCH KW_PAR NOT
 
 %token <ptr> NUMERAL DECIMAL HEXADECIMAL BINARY
@@ -68,7 +78,7 @@ smt_file:
 script:
 	command_plus	
 		{ 
-			$$ = ast_newScript($1);
+			$$ = ast_newScript(parser, $1);
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -83,7 +93,7 @@ command_plus:
 	command 				
 		{ 	
 			$$ = ast_listCreate(); 
-			ast_listAdd($$, $1); 
+			ast_addCommand(parser, $$, $1); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -93,7 +103,7 @@ command_plus:
 |
 	command_plus command 	
 		{ 
-			ast_listAdd($1, $2); 
+			ast_addCommand(parser, $1, $2); 
 			$$ = $1; 
 
 			@$.first_line = @1.first_line;
@@ -106,7 +116,7 @@ command_plus:
 command:
 	'(' KW_ASSERT term ')'		
 		{ 
-			$$ = ast_newAssertCommand($3); 
+			$$ = ast_newAssertCommand(parser, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -118,7 +128,7 @@ command:
 |
 	'(' KW_CHK_SAT ')'			
 		{ 
-			$$ = ast_newCheckSatCommand(); 
+			$$ = ast_newCheckSatCommand(parser); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -130,7 +140,7 @@ command:
 |
 	'(' KW_CHK_UNSAT ')'
 		{
-			$$ = ast_newCheckUnsatCommand();
+			$$ = ast_newCheckUnsatCommand(parser);
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -142,7 +152,7 @@ command:
 |
 	'(' KW_CHK_SAT_ASSUM '(' prop_literal_star ')' ')'		
 		{ 
-			$$ = ast_newCheckSatAssumCommand($4); 
+			$$ = ast_newCheckSatAssumCommand(parser, $4); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -154,7 +164,7 @@ command:
 |
 	'(' KW_DECL_CONST symbol sort ')'						
 		{ 
-			$$ = ast_newDeclareConstCommand($3, $4); 
+			$$ = ast_newDeclareConstCommand(parser, $3, $4); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -166,7 +176,7 @@ command:
 |
 	'(' KW_DECL_DATATYPE symbol datatype_decl ')'
 		{
-			$$ = ast_newDeclareDatatypeCommand($3, $4);
+			$$ = ast_newDeclareDatatypeCommand(parser, $3, $4);
 
 			@$.first_line = @1.first_line;
 			@$.first_column = @1.first_column;
@@ -178,7 +188,7 @@ command:
 |
 	'(' KW_DECL_DATATYPES '(' sort_decl_plus ')' '(' datatype_decl_plus ')' ')'
 		{
-			$$ = ast_newDeclareDatatypesCommand($4, $7);
+			$$ = ast_newDeclareDatatypesCommand(parser, $4, $7);
 
 			@$.first_line = @1.first_line;
 			@$.first_column = @1.first_column;
@@ -190,7 +200,7 @@ command:
 |
 	'(' KW_DECL_FUN symbol '(' sort_star ')' sort ')'
 		{ 
-			$$ = ast_newDeclareFunCommand($3, $5, $7); 
+			$$ = ast_newDeclareFunCommand(parser, $3, $5, $7); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -202,7 +212,7 @@ command:
 |
 	'(' KW_DECL_SORT symbol NUMERAL ')'
 		{ 
-			$$ = ast_newDeclareSortCommand($3, $4); 
+			$$ = ast_newDeclareSortCommand(parser, $3, $4); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -214,7 +224,7 @@ command:
 |
 	'(' KW_DECL_HEAP sort_pair_plus ')'
 		{
-			$$ = ast_newDeclareHeapCommand($3);
+			$$ = ast_newDeclareHeapCommand(parser, $3);
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -226,7 +236,7 @@ command:
 |
 	'(' KW_DEF_FUNS_REC '(' fun_decl_plus ')'  '(' term_plus ')' ')'
 		{ 
-			$$ = ast_newDefineFunsRecCommand($4, $7); 
+			$$ = ast_newDefineFunsRecCommand(parser, $4, $7); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -238,7 +248,7 @@ command:
 |	
 	'(' KW_DEF_FUN_REC fun_def ')'
 		{ 
-			$$ = ast_newDefineFunRecCommand($3); 
+			$$ = ast_newDefineFunRecCommand(parser, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -250,7 +260,7 @@ command:
 |
 	'(' KW_DEF_FUN fun_def ')'
 		{ 
-			$$ = ast_newDefineFunCommand($3); 
+			$$ = ast_newDefineFunCommand(parser, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -262,7 +272,7 @@ command:
 |
 	'(' KW_DEF_SORT symbol '(' symbol_star ')' sort ')'
 		{ 
-			$$ = ast_newDefineSortCommand($3, $5, $7); 
+			$$ = ast_newDefineSortCommand(parser, $3, $5, $7); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -274,7 +284,7 @@ command:
 |
 	'(' KW_ECHO STRING ')'
 		{ 
-			$$ = ast_newEchoCommand($3); 
+			$$ = ast_newEchoCommand(parser, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -286,7 +296,7 @@ command:
 |
 	'(' KW_EXIT ')'
 		{ 
-			$$ = ast_newExitCommand(); 
+			$$ = ast_newExitCommand(parser); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -298,7 +308,7 @@ command:
 |
 	'(' KW_GET_ASSERTS ')'
 		{ 
-			$$ = ast_newGetAssertsCommand(); 
+			$$ = ast_newGetAssertsCommand(parser); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -310,7 +320,7 @@ command:
 |
 	'(' KW_GET_ASSIGNS ')'
 		{ 
-			$$ = ast_newGetAssignsCommand(); 
+			$$ = ast_newGetAssignsCommand(parser); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -322,7 +332,7 @@ command:
 |
 	'(' KW_GET_INFO info_flag ')' 
 		{ 
-			$$ = ast_newGetInfoCommand($3); 
+			$$ = ast_newGetInfoCommand(parser, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -334,7 +344,7 @@ command:
 |
 	'(' KW_GET_MODEL ')'
 		{ 
-			$$ = ast_newGetModelCommand(); 
+			$$ = ast_newGetModelCommand(parser); 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
 			@$.last_line = @1.last_line;
@@ -345,7 +355,7 @@ command:
 |
 	'(' KW_GET_OPT KEYWORD ')'
 		{ 
-			$$ = ast_newGetOptionCommand($3); 
+			$$ = ast_newGetOptionCommand(parser, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -357,7 +367,7 @@ command:
 |
 	'(' KW_GET_PROOF ')'
 		{ 
-			$$ = ast_newGetProofCommand(); 
+			$$ = ast_newGetProofCommand(parser); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -369,7 +379,7 @@ command:
 |
 	'(' KW_GET_UNSAT_ASSUMS ')'
 		{ 
-			$$ = ast_newGetModelCommand(); 
+			$$ = ast_newGetModelCommand(parser); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -381,7 +391,7 @@ command:
 |
 	'(' KW_GET_UNSAT_CORE ')'
 		{ 
-			$$ = ast_newGetUnsatCoreCommand(); 
+			$$ = ast_newGetUnsatCoreCommand(parser); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -393,7 +403,7 @@ command:
 |
 	'(' KW_GET_VALUE term_plus ')'
 		{ 
-			$$ = ast_newGetValueCommand($3); 
+			$$ = ast_newGetValueCommand(parser, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -405,7 +415,7 @@ command:
 |
 	'(' KW_POP NUMERAL ')'
 		{ 
-			$$ = ast_newPopCommand($3); 
+			$$ = ast_newPopCommand(parser, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -417,7 +427,7 @@ command:
 |
 	'(' KW_PUSH NUMERAL ')'
 		{ 
-			$$ = ast_newPushCommand($3); 
+			$$ = ast_newPushCommand(parser, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -429,7 +439,7 @@ command:
 |
 	'(' KW_RESET_ASSERTS ')'
 		{ 
-			$$ = ast_newResetAssertsCommand(); 
+			$$ = ast_newResetAssertsCommand(parser); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -441,7 +451,7 @@ command:
 |
 	'(' KW_RESET ')'
 		{ 
-			$$ = ast_newResetCommand(); 
+			$$ = ast_newResetCommand(parser); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -453,7 +463,7 @@ command:
 |
 	'(' KW_SET_INFO attribute ')'
 		{ 
-			$$ = ast_newSetInfoCommand($3); 
+			$$ = ast_newSetInfoCommand(parser, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -465,7 +475,7 @@ command:
 |
 	'(' KW_SET_LOGIC symbol ')'
 		{ 
-			$$ = ast_newSetLogicCommand($3); 
+			$$ = ast_newSetLogicCommand(parser, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -477,7 +487,7 @@ command:
 |
 	'(' KW_SET_OPT option ')'
 		{ 
-			$$ = ast_newSetOptionCommand($3); 
+			$$ = ast_newSetOptionCommand(parser, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -515,7 +525,7 @@ datatype_decl_plus:
 datatype_decl:
 	'(' constructor_decl_plus ')'
 		{
-			$$ = ast_newSimpleDatatypeDeclaration($2);
+			$$ = ast_newSimpleDatatypeDeclaration(parser, $2);
 
 			@$.first_line = @1.first_line;
 			@$.first_column = @1.first_column;
@@ -527,7 +537,7 @@ datatype_decl:
 |
 	'(' KW_PAR '(' symbol_plus ')' '(' constructor_decl_plus ')' ')'
 		{
-			$$ = ast_newParametricDatatypeDeclaration($4, $7);
+			$$ = ast_newParametricDatatypeDeclaration(parser, $4, $7);
 
 			@$.first_line = @1.first_line;
 			@$.first_column = @1.first_column;
@@ -565,7 +575,7 @@ constructor_decl_plus:
 constructor_decl:
 	'(' symbol selector_decl_star ')'
 		{
-			$$ = ast_newConstructorDeclaration($2, $3);
+			$$ = ast_newConstructorDeclaration(parser, $2, $3);
 
 			@$.first_line = @1.first_line;
 			@$.first_column = @1.first_column;
@@ -604,7 +614,7 @@ selector_decl_star:
 selector_decl:
 	'(' symbol sort ')'
 		{
-			$$ = ast_newSelectorDeclaration($2, $3);
+			$$ = ast_newSelectorDeclaration(parser, $2, $3);
 
 			@$.first_line = @1.first_line;
 			@$.first_column = @1.first_column;
@@ -642,7 +652,7 @@ sort_decl_plus:
 sort_decl:
 	'(' symbol NUMERAL ')'
 		{
-			$$ = ast_newSortDeclaration($2, $3);
+			$$ = ast_newSortDeclaration(parser, $2, $3);
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -676,7 +686,7 @@ term:
 |
 	'(' qual_identifier term_plus ')' 
 		{ 
-			$$ = ast_newQualifiedTerm($2, $3); 
+			$$ = ast_newQualifiedTerm(parser, $2, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -688,7 +698,7 @@ term:
 |
 	'(' KW_LET '(' var_binding_plus ')' term ')'
 		{ 
-			$$ = ast_newLetTerm($4, $6); 
+			$$ = ast_newLetTerm(parser, $4, $6); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -700,7 +710,7 @@ term:
 |
 	'(' KW_FORALL '(' sorted_var_plus ')' term ')'
 		{ 
-			$$ = ast_newForallTerm($4, $6); 
+			$$ = ast_newForallTerm(parser, $4, $6); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -712,7 +722,7 @@ term:
 |
 	'(' KW_EXISTS '(' sorted_var_plus ')' term ')'
 		{ 
-			$$ = ast_newExistsTerm($4, $6); 
+			$$ = ast_newExistsTerm(parser, $4, $6); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -724,7 +734,7 @@ term:
 |
 	'(' KW_MATCH term '(' match_case_plus ')' ')'
 		{
-			$$ = ast_newMatchTerm($3, $5);
+			$$ = ast_newMatchTerm(parser, $3, $5);
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -736,7 +746,7 @@ term:
 |
 	'(' '!' term attribute_plus ')'
 		{ 
-			$$ = ast_newAnnotatedTerm($3, $4); 
+			$$ = ast_newAnnotatedTerm(parser, $3, $4); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -810,7 +820,7 @@ match_case_plus:
 match_case:
 	'(' pattern term ')'
 		{
-			$$ = ast_newMatchCase($2, $3);
+			$$ = ast_newMatchCase(parser, $2, $3);
 
 			@$.first_line = @1.first_line;
 			@$.first_column = @1.first_column;
@@ -834,7 +844,7 @@ pattern:
 |
 	'(' qual_constructor symbol_plus ')'
 		{
-			$$ = ast_newQualifiedPattern($2, $3);
+			$$ = ast_newQualifiedPattern(parser, $2, $3);
 
 			@$.first_line = @1.first_line;
 			@$.first_column = @1.first_column;
@@ -858,7 +868,7 @@ qual_constructor:
 |
 	'(' KW_AS symbol sort ')'
 		{
-			$$ = ast_newQualifiedConstructor($3, $4);
+			$$ = ast_newQualifiedConstructor(parser, $3, $4);
 
 			@$.first_line = @1.first_line;
 			@$.first_column = @1.first_column;
@@ -946,7 +956,7 @@ symbol:
 |
 	KW_RESET
 		{
-			$$ = ast_newSymbol("reset");
+			$$ = ast_newSymbol(parser, "reset");
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -958,7 +968,7 @@ symbol:
 |
 	NOT
 		{
-			$$ = ast_newSymbol("not");
+			$$ = ast_newSymbol(parser, "not");
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -970,7 +980,7 @@ symbol:
 |
 	'_'
 		{
-			$$ = ast_newSymbol("_");
+			$$ = ast_newSymbol(parser, "_");
 
 			@$.first_line = @1.first_line;
 			@$.first_column = @1.first_column;
@@ -994,7 +1004,7 @@ qual_identifier:
 |
 	'(' KW_AS identifier sort ')'
 		{ 
-			$$ = ast_newQualifiedIdentifier($3, $4); 
+			$$ = ast_newQualifiedIdentifier(parser, $3, $4); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1008,7 +1018,7 @@ qual_identifier:
 identifier:
 	symbol 			
 		{ 
-			$$ = ast_newSimpleIdentifier1($1);
+			$$ = ast_newSimpleIdentifier1(parser, $1);
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1020,7 +1030,7 @@ identifier:
 |
 	'(' '_' symbol index_plus ')'
 		{ 
-			$$ = ast_newSimpleIdentifier2($3, $4);
+			$$ = ast_newSimpleIdentifier2(parser, $3, $4);
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1084,7 +1094,7 @@ index_plus:
 sort:
 	identifier 	
 		{ 
-			$$ = ast_newSort1($1); 
+			$$ = ast_newSort1(parser, $1); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1096,7 +1106,7 @@ sort:
 |
 	'(' identifier sort_plus ')'
 		{ 
-			$$ = ast_newSort2($2, $3); 
+			$$ = ast_newSort2(parser, $2, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1183,7 +1193,7 @@ sort_pair_plus:
 var_binding:
 	'(' symbol term ')'
 		{ 
-			$$ = ast_newVariableBinding($2, $3);
+			$$ = ast_newVariableBinding(parser, $2, $3);
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1221,7 +1231,7 @@ var_binding_plus:
 sorted_var:
 	'(' symbol sort ')'
 		{ 
-			$$ = ast_newSortedVariable($2, $3); 
+			$$ = ast_newSortedVariable(parser, $2, $3); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1282,7 +1292,7 @@ sorted_var_star:
 attribute:
 	KEYWORD
 		{ 
-			$$ = ast_newAttribute1($1); 
+			$$ = ast_newAttribute1(parser, $1); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1294,7 +1304,7 @@ attribute:
 |
 	KEYWORD attr_value
 		{ 
-			$$ = ast_newAttribute2($1, $2); 
+			$$ = ast_newAttribute2(parser, $1, $2); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1375,7 +1385,7 @@ attr_value:
 |
 	'(' s_exp_plus ')'
 		{ 
-			$$ = ast_newCompSExpression($2); 
+			$$ = ast_newCompSExpression(parser, $2); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1419,7 +1429,7 @@ s_exp:
 |
 	'(' s_exp_plus ')'
 		{ 
-			$$ = ast_newCompSExpression($2); 
+			$$ = ast_newCompSExpression(parser, $2); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1457,7 +1467,7 @@ s_exp_plus :
 prop_literal:
 	symbol
 		{ 
-			$$ = ast_newPropLiteral($1, 0); 
+			$$ = ast_newPropLiteral(parser, $1, 0); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1469,7 +1479,7 @@ prop_literal:
 |
 	'(' NOT symbol ')'
 		{ 
-			$$ = ast_newPropLiteral($3, 1); 
+			$$ = ast_newPropLiteral(parser, $3, 1); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1507,7 +1517,7 @@ prop_literal_star:
 fun_decl:
 	'(' symbol '(' sorted_var_star ')' sort ')'
 		{ 
-			$$ = ast_newFunctionDeclaration($2, $4, $6); 
+			$$ = ast_newFunctionDeclaration(parser, $2, $4, $6); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1545,8 +1555,8 @@ fun_decl_plus:
 fun_def:
 	symbol '(' sorted_var_star ')' sort term
 		{ 
-			$$ = ast_newFunctionDefinition(
-				ast_newFunctionDeclaration($1, $3, $5), $6); 
+			$$ = ast_newFunctionDefinition(parser, 
+				ast_newFunctionDeclaration(parser, $1, $3, $5), $6); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1633,7 +1643,7 @@ option:
 theory_decl:
 	'(' THEORY symbol theory_attr_plus ')'
 		{ 
-			$$ = ast_newTheory($3, $4); 
+			$$ = ast_newTheory(parser, $3, $4); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1647,8 +1657,8 @@ theory_decl:
 theory_attr:
 	KW_ATTR_SORTS '(' sort_symbol_decl_plus ')'
 		{ 
-			$$ = ast_newAttribute2($1, 
-				ast_newCompAttributeValue($3));
+			$$ = ast_newAttribute2(parser, $1, 
+				ast_newCompAttributeValue(parser, $3));
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1660,8 +1670,8 @@ theory_attr:
 |
 	KW_ATTR_FUNS '(' par_fun_symbol_decl_plus ')'
 		{ 
-			$$ = ast_newAttribute2($1, 
-				ast_newCompAttributeValue($3));
+			$$ = ast_newAttribute2(parser, $1, 
+				ast_newCompAttributeValue(parser, $3));
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1709,7 +1719,7 @@ theory_attr_plus:
 sort_symbol_decl:
 	'(' identifier NUMERAL attribute_star ')'
 		{ 
-			$$ = ast_newSortSymbolDeclaration($2, $3, $4); 
+			$$ = ast_newSortSymbolDeclaration(parser, $2, $3, $4); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1749,7 +1759,7 @@ par_fun_symbol_decl:
 |
 	'(' KW_PAR '(' symbol_plus ')' '(' identifier sort_plus attribute_star ')' ')'
 		{ 
-			$$ = ast_newParametricFunDeclaration($4, $7, $8, $9);
+			$$ = ast_newParametricFunDeclaration(parser, $4, $7, $8, $9);
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1787,7 +1797,7 @@ par_fun_symbol_decl_plus:
 fun_symbol_decl:
 	'(' spec_const sort attribute_star ')'
 		{ 
-			$$ = ast_newSpecConstFunDeclaration($2, $3, $4); 
+			$$ = ast_newSpecConstFunDeclaration(parser, $2, $3, $4); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1799,7 +1809,7 @@ fun_symbol_decl:
 |
 	'(' meta_spec_const sort attribute_star ')'
 		{ 
-			$$ = ast_newMetaSpecConstFunDeclaration($2, $3, $4); 
+			$$ = ast_newMetaSpecConstFunDeclaration(parser, $2, $3, $4); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1811,7 +1821,7 @@ fun_symbol_decl:
 |
 	'(' identifier sort_plus attribute_star ')'
 		{ 
-			$$ = ast_newSimpleFunDeclaration($2, $3, $4);
+			$$ = ast_newSimpleFunDeclaration(parser, $2, $3, $4);
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1863,7 +1873,7 @@ meta_spec_const:
 logic:
 	'(' LOGIC symbol logic_attr_plus ')'
 		{ 
-			$$ = ast_newLogic($3, $4); 
+			$$ = ast_newLogic(parser, $3, $4); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1877,7 +1887,7 @@ logic:
 logic_attr:
 	KW_ATTR_THEORIES '(' symbol_star ')'
 		{ 
-			$$ = ast_newAttribute2($1, ast_newCompAttributeValue($3));
+			$$ = ast_newAttribute2(parser, $1, ast_newCompAttributeValue(parser, $3));
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -1924,7 +1934,7 @@ logic_attr_plus:
 
 %%
 
-void yyerror(SmtPrsr parser, const char* s) {
-	ast_reportError(parser, yylloc.first_line, yylloc.first_column,
-					yylloc.last_line, yylloc.last_column, s);
+void yyerror(YYLTYPE* llocp, SmtPrsr parser, SmtScanner scanner, const char* s) {
+	ast_reportError(parser, llocp->first_line, llocp->first_column,
+					llocp->last_line, llocp->last_column, s);
 }
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,17 +45,17 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
 
 /* Pure parsers.  */
-#define YYPURE 0
+#define YYPURE 2
 
 /* Push parsers.  */
 #define YYPUSH 0
@@ -68,192 +73,265 @@
 #define yydebug         smt_yydebug
 #define yynerrs         smt_yynerrs
 
-#define yylval          smt_yylval
-#define yychar          smt_yychar
-#define yylloc          smt_yylloc
-
-/* Copy the first part of user declarations.  */
-#line 1 "smtlib-bison-parser.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 1 "smtlib-bison-parser.y"
 
 #include <stdio.h>
 #include "smtlib-glue.h"
 
-int yylex();
-void yyerror(SmtPrsr parser, const char *);
-
-#define YYMAXDEPTH 300000
-#define YYINITDEPTH 300000
+/* Nesting depth up to which the parser stacks can grow (set by PARSER_MAX_DEPTH in CMake) */
+#ifndef YYMAXDEPTH
+#define YYMAXDEPTH 10000000
+#endif
 
-#line 88 "smtlib-bison-parser.tab.c" /* yacc.c:339  */
+#line 88 "smtlib-bison-parser.tab.c"
 
-# ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
 #  else
-#   define YY_NULLPTR 0
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
 #  endif
 # endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 1
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "smtlib-bison-parser.tab.h".  */
-#ifndef YY_SMT_YY_SMTLIB_BISON_PARSER_TAB_H_INCLUDED
-# define YY_SMT_YY_SMTLIB_BISON_PARSER_TAB_H_INCLUDED
-/* Debug traces.  */
-#ifndef SMT_YYDEBUG
-# if defined YYDEBUG
-#if YYDEBUG
-#   define SMT_YYDEBUG 1
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define SMT_YYDEBUG 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
-# else /* ! defined YYDEBUG */
-#  define SMT_YYDEBUG 0
-# endif /* ! defined YYDEBUG */
-#endif  /* ! defined SMT_YYDEBUG */
-#if SMT_YYDEBUG
-extern int smt_yydebug;
-#endif
-
-/* Token type.  */
-#ifndef SMT_YYTOKENTYPE
-# define SMT_YYTOKENTYPE
-  enum smt_yytokentype
-  {
-    KW_AS = 258,
-    KW_LET = 259,
-    KW_FORALL = 260,
-    KW_EXISTS = 261,
-    KW_MATCH = 262,
-    KW_PAR = 263,
-    NOT = 264,
-    NUMERAL = 265,
-    DECIMAL = 266,
-    HEXADECIMAL = 267,
-    BINARY = 268,
-    KW_ASSERT = 269,
-    KW_CHK_SAT = 270,
-    KW_CHK_UNSAT = 271,
-    KW_CHK_SAT_ASSUM = 272,
-    KW_DECL_CONST = 273,
-    KW_DECL_FUN = 274,
-    KW_DECL_SORT = 275,
-    KW_DECL_HEAP = 276,
-    KW_DEF_FUN = 277,
-    KW_DEF_FUN_REC = 278,
-    KW_DEF_FUNS_REC = 279,
-    KW_DEF_SORT = 280,
-    KW_ECHO = 281,
-    KW_EXIT = 282,
-    KW_GET_ASSERTS = 283,
-    KW_GET_ASSIGNS = 284,
-    KW_GET_INFO = 285,
-    KW_GET_MODEL = 286,
-    KW_GET_OPT = 287,
-    KW_GET_PROOF = 288,
-    KW_GET_UNSAT_ASSUMS = 289,
-    KW_GET_UNSAT_CORE = 290,
-    KW_GET_VALUE = 291,
-    KW_POP = 292,
-    KW_PUSH = 293,
-    KW_RESET = 294,
-    KW_RESET_ASSERTS = 295,
-    KW_SET_INFO = 296,
-    KW_SET_LOGIC = 297,
-    KW_SET_OPT = 298,
-    KW_DECL_DATATYPE = 299,
-    KW_DECL_DATATYPES = 300,
-    META_SPEC_DECIMAL = 301,
-    META_SPEC_NUMERAL = 302,
-    META_SPEC_STRING = 303,
-    KEYWORD = 304,
-    STRING = 305,
-    SYMBOL = 306,
-    THEORY = 307,
-    LOGIC = 308,
-    KW_ATTR_SORTS = 309,
-    KW_ATTR_FUNS = 310,
-    KW_ATTR_THEORIES = 311
-  };
-#endif
-
-/* Value type.  */
-#if ! defined SMT_YYSTYPE && ! defined SMT_YYSTYPE_IS_DECLARED
-
-union SMT_YYSTYPE
-{
-#line 20 "smtlib-bison-parser.y" /* yacc.c:355  */
-
-	AstPtr ptr;
-	AstList list;
-	AstPairList pairList;
-
-#line 199 "smtlib-bison-parser.tab.c" /* yacc.c:355  */
-};
-
-typedef union SMT_YYSTYPE SMT_YYSTYPE;
-# define SMT_YYSTYPE_IS_TRIVIAL 1
-# define SMT_YYSTYPE_IS_DECLARED 1
-#endif
+# endif
 
-/* Location type.  */
-#if ! defined SMT_YYLTYPE && ! defined SMT_YYLTYPE_IS_DECLARED
-typedef struct SMT_YYLTYPE SMT_YYLTYPE;
-struct SMT_YYLTYPE
+#include "smtlib-bison-parser.y.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-  int first_line;
-  int first_column;
-  int last_line;
-  int last_column;
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_KW_AS = 3,                      /* KW_AS  */
+  YYSYMBOL_KW_LET = 4,                     /* KW_LET  */
+  YYSYMBOL_KW_FORALL = 5,                  /* KW_FORALL  */
+  YYSYMBOL_KW_EXISTS = 6,                  /* KW_EXISTS  */
+  YYSYMBOL_KW_MATCH = 7,                   /* KW_MATCH  */
+  YYSYMBOL_KW_PAR = 8,                     /* KW_PAR  */
+  YYSYMBOL_NOT = 9,                        /* NOT  */
+  YYSYMBOL_NUMERAL = 10,                   /* NUMERAL  */
+  YYSYMBOL_DECIMAL = 11,                   /* DECIMAL  */
+  YYSYMBOL_HEXADECIMAL = 12,               /* HEXADECIMAL  */
+  YYSYMBOL_BINARY = 13,                    /* BINARY  */
+  YYSYMBOL_KW_ASSERT = 14,                 /* KW_ASSERT  */
+  YYSYMBOL_KW_CHK_SAT = 15,                /* KW_CHK_SAT  */
+  YYSYMBOL_KW_CHK_UNSAT = 16,              /* KW_CHK_UNSAT  */
+  YYSYMBOL_KW_CHK_SAT_ASSUM = 17,          /* KW_CHK_SAT_ASSUM  */
+  YYSYMBOL_KW_DECL_CONST = 18,             /* KW_DECL_CONST  */
+  YYSYMBOL_KW_DECL_FUN = 19,               /* KW_DECL_FUN  */
+  YYSYMBOL_KW_DECL_SORT = 20,              /* KW_DECL_SORT  */
+  YYSYMBOL_KW_DECL_HEAP = 21,              /* KW_DECL_HEAP  */
+  YYSYMBOL_KW_DEF_FUN = 22,                /* KW_DEF_FUN  */
+  YYSYMBOL_KW_DEF_FUN_REC = 23,            /* KW_DEF_FUN_REC  */
+  YYSYMBOL_KW_DEF_FUNS_REC = 24,           /* KW_DEF_FUNS_REC  */
+  YYSYMBOL_KW_DEF_SORT = 25,               /* KW_DEF_SORT  */
+  YYSYMBOL_KW_ECHO = 26,                   /* KW_ECHO  */
+  YYSYMBOL_KW_EXIT = 27,                   /* KW_EXIT  */
+  YYSYMBOL_KW_GET_ASSERTS = 28,            /* KW_GET_ASSERTS  */
+  YYSYMBOL_KW_GET_ASSIGNS = 29,            /* KW_GET_ASSIGNS  */
+  YYSYMBOL_KW_GET_INFO = 30,               /* KW_GET_INFO  */
+  YYSYMBOL_KW_GET_MODEL = 31,              /* KW_GET_MODEL  */
+  YYSYMBOL_KW_GET_OPT = 32,                /* KW_GET_OPT  */
+  YYSYMBOL_KW_GET_PROOF = 33,              /* KW_GET_PROOF  */
+  YYSYMBOL_KW_GET_UNSAT_ASSUMS = 34,       /* KW_GET_UNSAT_ASSUMS  */
+  YYSYMBOL_KW_GET_UNSAT_CORE = 35,         /* KW_GET_UNSAT_CORE  */
+  YYSYMBOL_KW_GET_VALUE = 36,              /* KW_GET_VALUE  */
+  YYSYMBOL_KW_POP = 37,                    /* KW_POP  */
+  YYSYMBOL_KW_PUSH = 38,                   /* KW_PUSH  */
+  YYSYMBOL_KW_RESET = 39,                  /* KW_RESET  */
+  YYSYMBOL_KW_RESET_ASSERTS = 40,          /* KW_RESET_ASSERTS  */
+  YYSYMBOL_KW_SET_INFO = 41,               /* KW_SET_INFO  */
+  YYSYMBOL_KW_SET_LOGIC = 42,              /* KW_SET_LOGIC  */
+  YYSYMBOL_KW_SET_OPT = 43,                /* KW_SET_OPT  */
+  YYSYMBOL_KW_DECL_DATATYPE = 44,          /* KW_DECL_DATATYPE  */
+  YYSYMBOL_KW_DECL_DATATYPES = 45,         /* KW_DECL_DATATYPES  */
+  YYSYMBOL_META_SPEC_DECIMAL = 46,         /* META_SPEC_DECIMAL  */
+  YYSYMBOL_META_SPEC_NUMERAL = 47,         /* META_SPEC_NUMERAL  */
+  YYSYMBOL_META_SPEC_STRING = 48,          /* META_SPEC_STRING  */
+  YYSYMBOL_KEYWORD = 49,                   /* KEYWORD  */
+  YYSYMBOL_STRING = 50,                    /* STRING  */
+  YYSYMBOL_SYMBOL = 51,                    /* SYMBOL  */
+  YYSYMBOL_THEORY = 52,                    /* THEORY  */
+  YYSYMBOL_LOGIC = 53,                     /* LOGIC  */
+  YYSYMBOL_KW_ATTR_SORTS = 54,             /* KW_ATTR_SORTS  */
+  YYSYMBOL_KW_ATTR_FUNS = 55,              /* KW_ATTR_FUNS  */
+  YYSYMBOL_KW_ATTR_THEORIES = 56,          /* KW_ATTR_THEORIES  */
+  YYSYMBOL_57_ = 57,                       /* '('  */
+  YYSYMBOL_58_ = 58,                       /* ')'  */
+  YYSYMBOL_59_ = 59,                       /* '!'  */
+  YYSYMBOL_60___ = 60,                     /* '_'  */
+  YYSYMBOL_YYACCEPT = 61,                  /* $accept  */
+  YYSYMBOL_smt_file = 62,                  /* smt_file  */
+  YYSYMBOL_script = 63,                    /* script  */
+  YYSYMBOL_command_plus = 64,              /* command_plus  */
+  YYSYMBOL_command = 65,                   /* command  */
+  YYSYMBOL_datatype_decl_plus = 66,        /* datatype_decl_plus  */
+  YYSYMBOL_datatype_decl = 67,             /* datatype_decl  */
+  YYSYMBOL_constructor_decl_plus = 68,     /* constructor_decl_plus  */
+  YYSYMBOL_constructor_decl = 69,          /* constructor_decl  */
+  YYSYMBOL_selector_decl_star = 70,        /* selector_decl_star  */
+  YYSYMBOL_selector_decl = 71,             /* selector_decl  */
+  YYSYMBOL_sort_decl_plus = 72,            /* sort_decl_plus  */
+  YYSYMBOL_sort_decl = 73,                 /* sort_decl  */
+  YYSYMBOL_term = 74,                      /* term  */
+  YYSYMBOL_term_plus = 75,                 /* term_plus  */
+  YYSYMBOL_match_case_plus = 76,           /* match_case_plus  */
+  YYSYMBOL_match_case = 77,                /* match_case  */
+  YYSYMBOL_pattern = 78,                   /* pattern  */
+  YYSYMBOL_qual_constructor = 79,          /* qual_constructor  */
+  YYSYMBOL_spec_const = 80,                /* spec_const  */
+  YYSYMBOL_symbol = 81,                    /* symbol  */
+  YYSYMBOL_qual_identifier = 82,           /* qual_identifier  */
+  YYSYMBOL_identifier = 83,                /* identifier  */
+  YYSYMBOL_index = 84,                     /* index  */
+  YYSYMBOL_index_plus = 85,                /* index_plus  */
+  YYSYMBOL_sort = 86,                      /* sort  */
+  YYSYMBOL_sort_plus = 87,                 /* sort_plus  */
+  YYSYMBOL_sort_star = 88,                 /* sort_star  */
+  YYSYMBOL_sort_pair_plus = 89,            /* sort_pair_plus  */
+  YYSYMBOL_var_binding = 90,               /* var_binding  */
+  YYSYMBOL_var_binding_plus = 91,          /* var_binding_plus  */
+  YYSYMBOL_sorted_var = 92,                /* sorted_var  */
+  YYSYMBOL_sorted_var_plus = 93,           /* sorted_var_plus  */
+  YYSYMBOL_sorted_var_star = 94,           /* sorted_var_star  */
+  YYSYMBOL_attribute = 95,                 /* attribute  */
+  YYSYMBOL_attribute_star = 96,            /* attribute_star  */
+  YYSYMBOL_attribute_plus = 97,            /* attribute_plus  */
+  YYSYMBOL_attr_value = 98,                /* attr_value  */
+  YYSYMBOL_s_exp = 99,                     /* s_exp  */
+  YYSYMBOL_s_exp_plus = 100,               /* s_exp_plus  */
+  YYSYMBOL_prop_literal = 101,             /* prop_literal  */
+  YYSYMBOL_prop_literal_star = 102,        /* prop_literal_star  */
+  YYSYMBOL_fun_decl = 103,                 /* fun_decl  */
+  YYSYMBOL_fun_decl_plus = 104,            /* fun_decl_plus  */
+  YYSYMBOL_fun_def = 105,                  /* fun_def  */
+  YYSYMBOL_symbol_star = 106,              /* symbol_star  */
+  YYSYMBOL_symbol_plus = 107,              /* symbol_plus  */
+  YYSYMBOL_info_flag = 108,                /* info_flag  */
+  YYSYMBOL_option = 109,                   /* option  */
+  YYSYMBOL_theory_decl = 110,              /* theory_decl  */
+  YYSYMBOL_theory_attr = 111,              /* theory_attr  */
+  YYSYMBOL_theory_attr_plus = 112,         /* theory_attr_plus  */
+  YYSYMBOL_sort_symbol_decl = 113,         /* sort_symbol_decl  */
+  YYSYMBOL_sort_symbol_decl_plus = 114,    /* sort_symbol_decl_plus  */
+  YYSYMBOL_par_fun_symbol_decl = 115,      /* par_fun_symbol_decl  */
+  YYSYMBOL_par_fun_symbol_decl_plus = 116, /* par_fun_symbol_decl_plus  */
+  YYSYMBOL_fun_symbol_decl = 117,          /* fun_symbol_decl  */
+  YYSYMBOL_meta_spec_const = 118,          /* meta_spec_const  */
+  YYSYMBOL_logic = 119,                    /* logic  */
+  YYSYMBOL_logic_attr = 120,               /* logic_attr  */
+  YYSYMBOL_logic_attr_plus = 121           /* logic_attr_plus  */
 };
-# define SMT_YYLTYPE_IS_DECLARED 1
-# define SMT_YYLTYPE_IS_TRIVIAL 1
-#endif
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
 
-extern SMT_YYSTYPE smt_yylval;
-extern SMT_YYLTYPE smt_yylloc;
-int smt_yyparse (SmtPrsr parser);
 
-#endif /* !YY_SMT_YY_SMTLIB_BISON_PARSER_TAB_H_INCLUDED  */
+/* Unqualified %code blocks.  */
+#line 21 "smtlib-bison-parser.y"
 
-/* Copy the second part of user declarations.  */
+int yylex(YYSTYPE* lvalp, YYLTYPE* llocp, SmtScanner scanner);
+void yyerror(YYLTYPE* llocp, SmtPrsr parser, SmtScanner scanner, const char* msg);
 
-#line 230 "smtlib-bison-parser.tab.c" /* yacc.c:358  */
+#line 249 "smtlib-bison-parser.tab.c"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
 #else
 typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -261,15 +339,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -283,47 +374,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -336,8 +423,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -402,8 +503,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* 1 */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -413,18 +513,19 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
   YYLTYPE yyls_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE) + sizeof (YYLTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
       + 2 * YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -437,11 +538,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -453,12 +554,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -481,17 +582,20 @@ union yyalloc
 /* YYNSTATES -- Number of states.  */
 #define YYNSTATES  364
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   311
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
-static const yytype_uint8 yytranslate[] =
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -528,91 +632,89 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if SMT_YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,    61,    61,    63,    65,    69,    83,    94,   107,   119,
-     131,   143,   155,   167,   179,   191,   203,   215,   227,   239,
-     251,   263,   275,   287,   299,   311,   323,   335,   346,   358,
-     370,   382,   394,   406,   418,   430,   442,   454,   466,   478,
-     492,   503,   516,   528,   542,   553,   566,   581,   585,   605,
-     619,   630,   643,   657,   667,   677,   689,   701,   713,   725,
-     737,   749,   763,   774,   787,   798,   811,   825,   835,   849,
-     859,   873,   885,   897,   909,   921,   935,   947,   959,   971,
-     985,   995,  1009,  1021,  1035,  1047,  1061,  1072,  1085,  1097,
-    1111,  1122,  1136,  1140,  1160,  1171,  1184,  1198,  1209,  1222,
-    1236,  1247,  1261,  1263,  1283,  1295,  1310,  1312,  1332,  1343,
-    1356,  1366,  1376,  1390,  1400,  1410,  1420,  1434,  1445,  1458,
-    1470,  1485,  1488,  1508,  1522,  1533,  1546,  1562,  1564,  1584,
-    1595,  1608,  1622,  1634,  1648,  1661,  1674,  1686,  1697,  1710,
-    1724,  1735,  1748,  1750,  1764,  1775,  1788,  1800,  1812,  1826,
-    1838,  1850,  1864,  1878,  1890,  1902,  1913
+       0,    71,    71,    73,    75,    79,    93,   104,   117,   129,
+     141,   153,   165,   177,   189,   201,   213,   225,   237,   249,
+     261,   273,   285,   297,   309,   321,   333,   345,   356,   368,
+     380,   392,   404,   416,   428,   440,   452,   464,   476,   488,
+     502,   513,   526,   538,   552,   563,   576,   591,   595,   615,
+     629,   640,   653,   667,   677,   687,   699,   711,   723,   735,
+     747,   759,   773,   784,   797,   808,   821,   835,   845,   859,
+     869,   883,   895,   907,   919,   931,   945,   957,   969,   981,
+     995,  1005,  1019,  1031,  1045,  1057,  1071,  1082,  1095,  1107,
+    1121,  1132,  1146,  1150,  1170,  1181,  1194,  1208,  1219,  1232,
+    1246,  1257,  1271,  1273,  1293,  1305,  1320,  1322,  1342,  1353,
+    1366,  1376,  1386,  1400,  1410,  1420,  1430,  1444,  1455,  1468,
+    1480,  1495,  1498,  1518,  1532,  1543,  1556,  1572,  1574,  1594,
+    1605,  1618,  1632,  1644,  1658,  1671,  1684,  1696,  1707,  1720,
+    1734,  1745,  1758,  1760,  1774,  1785,  1798,  1810,  1822,  1836,
+    1848,  1860,  1874,  1888,  1900,  1912,  1923
 };
 #endif
 
-#if SMT_YYDEBUG || YYERROR_VERBOSE || 1
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "KW_AS", "KW_LET", "KW_FORALL",
-  "KW_EXISTS", "KW_MATCH", "KW_PAR", "NOT", "NUMERAL", "DECIMAL",
-  "HEXADECIMAL", "BINARY", "KW_ASSERT", "KW_CHK_SAT", "KW_CHK_UNSAT",
-  "KW_CHK_SAT_ASSUM", "KW_DECL_CONST", "KW_DECL_FUN", "KW_DECL_SORT",
-  "KW_DECL_HEAP", "KW_DEF_FUN", "KW_DEF_FUN_REC", "KW_DEF_FUNS_REC",
-  "KW_DEF_SORT", "KW_ECHO", "KW_EXIT", "KW_GET_ASSERTS", "KW_GET_ASSIGNS",
-  "KW_GET_INFO", "KW_GET_MODEL", "KW_GET_OPT", "KW_GET_PROOF",
-  "KW_GET_UNSAT_ASSUMS", "KW_GET_UNSAT_CORE", "KW_GET_VALUE", "KW_POP",
-  "KW_PUSH", "KW_RESET", "KW_RESET_ASSERTS", "KW_SET_INFO", "KW_SET_LOGIC",
-  "KW_SET_OPT", "KW_DECL_DATATYPE", "KW_DECL_DATATYPES",
-  "META_SPEC_DECIMAL", "META_SPEC_NUMERAL", "META_SPEC_STRING", "KEYWORD",
-  "STRING", "SYMBOL", "THEORY", "LOGIC", "KW_ATTR_SORTS", "KW_ATTR_FUNS",
-  "KW_ATTR_THEORIES", "'('", "')'", "'!'", "'_'", "$accept", "smt_file",
-  "script", "command_plus", "command", "datatype_decl_plus",
-  "datatype_decl", "constructor_decl_plus", "constructor_decl",
-  "selector_decl_star", "selector_decl", "sort_decl_plus", "sort_decl",
-  "term", "term_plus", "match_case_plus", "match_case", "pattern",
-  "qual_constructor", "spec_const", "symbol", "qual_identifier",
-  "identifier", "index", "index_plus", "sort", "sort_plus", "sort_star",
-  "sort_pair_plus", "var_binding", "var_binding_plus", "sorted_var",
-  "sorted_var_plus", "sorted_var_star", "attribute", "attribute_star",
-  "attribute_plus", "attr_value", "s_exp", "s_exp_plus", "prop_literal",
-  "prop_literal_star", "fun_decl", "fun_decl_plus", "fun_def",
-  "symbol_star", "symbol_plus", "info_flag", "option", "theory_decl",
-  "theory_attr", "theory_attr_plus", "sort_symbol_decl",
-  "sort_symbol_decl_plus", "par_fun_symbol_decl",
+  "\"end of file\"", "error", "\"invalid token\"", "KW_AS", "KW_LET",
+  "KW_FORALL", "KW_EXISTS", "KW_MATCH", "KW_PAR", "NOT", "NUMERAL",
+  "DECIMAL", "HEXADECIMAL", "BINARY", "KW_ASSERT", "KW_CHK_SAT",
+  "KW_CHK_UNSAT", "KW_CHK_SAT_ASSUM", "KW_DECL_CONST", "KW_DECL_FUN",
+  "KW_DECL_SORT", "KW_DECL_HEAP", "KW_DEF_FUN", "KW_DEF_FUN_REC",
+  "KW_DEF_FUNS_REC", "KW_DEF_SORT", "KW_ECHO", "KW_EXIT", "KW_GET_ASSERTS",
+  "KW_GET_ASSIGNS", "KW_GET_INFO", "KW_GET_MODEL", "KW_GET_OPT",
+  "KW_GET_PROOF", "KW_GET_UNSAT_ASSUMS", "KW_GET_UNSAT_CORE",
+  "KW_GET_VALUE", "KW_POP", "KW_PUSH", "KW_RESET", "KW_RESET_ASSERTS",
+  "KW_SET_INFO", "KW_SET_LOGIC", "KW_SET_OPT", "KW_DECL_DATATYPE",
+  "KW_DECL_DATATYPES", "META_SPEC_DECIMAL", "META_SPEC_NUMERAL",
+  "META_SPEC_STRING", "KEYWORD", "STRING", "SYMBOL", "THEORY", "LOGIC",
+  "KW_ATTR_SORTS", "KW_ATTR_FUNS", "KW_ATTR_THEORIES", "'('", "')'", "'!'",
+  "'_'", "$accept", "smt_file", "script", "command_plus", "command",
+  "datatype_decl_plus", "datatype_decl", "constructor_decl_plus",
+  "constructor_decl", "selector_decl_star", "selector_decl",
+  "sort_decl_plus", "sort_decl", "term", "term_plus", "match_case_plus",
+  "match_case", "pattern", "qual_constructor", "spec_const", "symbol",
+  "qual_identifier", "identifier", "index", "index_plus", "sort",
+  "sort_plus", "sort_star", "sort_pair_plus", "var_binding",
+  "var_binding_plus", "sorted_var", "sorted_var_plus", "sorted_var_star",
+  "attribute", "attribute_star", "attribute_plus", "attr_value", "s_exp",
+  "s_exp_plus", "prop_literal", "prop_literal_star", "fun_decl",
+  "fun_decl_plus", "fun_def", "symbol_star", "symbol_plus", "info_flag",
+  "option", "theory_decl", "theory_attr", "theory_attr_plus",
+  "sort_symbol_decl", "sort_symbol_decl_plus", "par_fun_symbol_decl",
   "par_fun_symbol_decl_plus", "fun_symbol_decl", "meta_spec_const",
   "logic", "logic_attr", "logic_attr_plus", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,    40,    41,    33,
-      95
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -302
+#define YYPACT_NINF (-302)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-302)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -1
+#define YYTABLE_NINF (-1)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
      -34,   486,    31,  -302,     5,  -302,  -302,  -302,   419,    27,
@@ -654,9 +756,9 @@ static const yytype_int16 yypact[] =
       79,    92,   397,  -302
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
        0,     0,     0,     2,     5,     6,     3,     4,     0,     0,
@@ -698,7 +800,7 @@ static const yytype_uint8 yydefact[] =
      106,     0,     0,   143
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
     -302,  -302,  -302,  -302,   446,  -302,  -227,   124,  -184,  -302,
@@ -710,10 +812,10 @@ static const yytype_int16 yypgoto[] =
     -302
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     2,     3,     4,     5,   276,   140,   186,   187,   274,
+       0,     2,     3,     4,     5,   276,   140,   186,   187,   274,
      312,   142,   143,    84,    85,   256,   257,   297,   298,    56,
       57,    58,   111,   213,   214,   218,   219,   169,    67,   202,
      203,   205,   206,   173,   347,   335,   210,   135,   182,   183,
@@ -722,10 +824,10 @@ static const yytype_int16 yydefgoto[] =
      152
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
-static const yytype_uint16 yytable[] =
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
 {
       59,   112,   236,    91,   115,    93,   162,   318,    63,    64,
       65,   277,    68,    68,   225,    72,   337,   338,   339,   133,
@@ -849,9 +951,9 @@ static const yytype_int16 yycheck[] =
       44,    45
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
        0,    57,    62,    63,    64,    65,   110,   119,    14,    15,
       16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
@@ -892,8 +994,8 @@ static const yytype_uint8 yystos[] =
       87,    96,    58,    58
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
 {
        0,    61,    62,    62,    62,    63,    64,    64,    65,    65,
       65,    65,    65,    65,    65,    65,    65,    65,    65,    65,
@@ -913,8 +1015,8 @@ static const yytype_uint8 yyr1[] =
      118,   118,   119,   120,   120,   121,   121
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     1,     1,     1,     1,     1,     2,     4,     3,
        3,     6,     5,     5,     9,     8,     5,     4,     9,     4,
@@ -935,39 +1037,39 @@ static const yytype_uint8 yyr2[] =
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
-#define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
+#define yyclearin       (yychar = SMT_YYEMPTY)
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (parser, YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == SMT_YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (&yylloc, parser, scanner, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use SMT_YYerror or SMT_YYUNDEF. */
+#define YYERRCODE SMT_YYUNDEF
 
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -1011,20 +1113,27 @@ do {                                            \
 } while (0)
 
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
+/* YYLOCATION_PRINT -- Print the location on the stream.
    This macro was not mandated originally: define only if we know
    we won't break user code: when these are the locations we know.  */
 
-#ifndef YY_LOCATION_PRINT
-# if defined SMT_YYLTYPE_IS_TRIVIAL && SMT_YYLTYPE_IS_TRIVIAL
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined SMT_YYLTYPE_IS_TRIVIAL && SMT_YYLTYPE_IS_TRIVIAL
 
 /* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
 
 YY_ATTRIBUTE_UNUSED
-static unsigned
+static int
 yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
 {
-  unsigned res = 0;
+  int res = 0;
   int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
   if (0 <= yylocp->first_line)
     {
@@ -1044,64 +1153,73 @@ yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
         res += YYFPRINTF (yyo, "-%d", end_col);
     }
   return res;
- }
+}
 
-#  define YY_LOCATION_PRINT(File, Loc)          \
-  yy_location_print_ (File, &(Loc))
+#   define YYLOCATION_PRINT  yy_location_print_
 
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
 
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, Location, parser); \
+                  Kind, Value, Location, parser, scanner); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, SmtPrsr parser)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, SmtPrsr parser, SmtScanner scanner)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
-  YYUSE (yylocationp);
-  YYUSE (parser);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (parser);
+  YY_USE (scanner);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, SmtPrsr parser)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, SmtPrsr parser, SmtScanner scanner)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  YY_LOCATION_PRINT (yyoutput, *yylocationp);
-  YYFPRINTF (yyoutput, ": ");
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp, parser);
-  YYFPRINTF (yyoutput, ")");
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, parser, scanner);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1110,7 +1228,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYL
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1133,21 +1251,22 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule, SmtPrsr parser)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, SmtPrsr parser, SmtScanner scanner)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                       , &(yylsp[(yyi + 1) - (yynrhs)])                       , parser);
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), parser, scanner);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1155,15 +1274,15 @@ yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule
 # define YY_REDUCE_PRINT(Rule)          \
 do {                                    \
   if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, parser); \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, parser, scanner); \
 } while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !SMT_YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !SMT_YYDEBUG */
@@ -1186,28 +1305,77 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+  YYLTYPE *yylloc;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
 /* Return the length of YYSTR.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yystrlen (const char *yystr)
 {
-  YYSIZE_T yylen;
+  YYPTRDIFF_T yylen;
   for (yylen = 0; yystr[yylen]; yylen++)
     continue;
   return yylen;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
 /* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
    YYDEST.  */
 static char *
@@ -1221,10 +1389,10 @@ yystpcpy (char *yydest, const char *yysrc)
 
   return yyd - 1;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yytnamerr
+#ifndef yytnamerr
 /* Copy to YYRES the contents of YYSTR after stripping away unnecessary
    quotes and backslashes, so that it's suitable for yyerror.  The
    heuristic is that double-quoting is unnecessary unless the string
@@ -1232,14 +1400,13 @@ yystpcpy (char *yydest, const char *yysrc)
    backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
    null, do not copy; instead, return the length of what the result
    would have been.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yytnamerr (char *yyres, const char *yystr)
 {
   if (*yystr == '"')
     {
-      YYSIZE_T yyn = 0;
+      YYPTRDIFF_T yyn = 0;
       char const *yyp = yystr;
-
       for (;;)
         switch (*++yyp)
           {
@@ -1250,7 +1417,10 @@ yytnamerr (char *yyres, const char *yystr)
           case '\\':
             if (*++yyp != '\\')
               goto do_not_strip_quotes;
-            /* Fall through.  */
+            else
+              goto append;
+
+          append:
           default:
             if (yyres)
               yyres[yyn] = *yyp;
@@ -1265,36 +1435,20 @@ yytnamerr (char *yyres, const char *yystr)
     do_not_strip_quotes: ;
     }
 
-  if (! yyres)
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
     return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
 }
-# endif
+#endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
 static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
 {
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
+  /* Actual size of YYARG. */
   int yycount = 0;
-
   /* There are many possibilities here to consider:
      - If this state is a consistent state with a default action, then
        the only way this function was invoked is if the default action
@@ -1318,63 +1472,78 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
        one exception: it will still contain any token that will not be
        accepted due to an error action in a later state.
   */
-  if (yytoken != YYEMPTY)
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
     {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
     }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
 
   switch (yycount)
     {
-# define YYCASE_(N, S)                      \
+#define YYCASE_(N, S)                       \
       case N:                               \
         yyformat = S;                       \
-      break
+        break
+    default: /* Avoid compiler warnings. */
       YYCASE_(0, YY_("syntax error"));
       YYCASE_(1, YY_("syntax error, unexpected %s"));
       YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
       YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
       YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
       YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
+#undef YYCASE_
     }
 
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
   {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
   }
 
   if (*yymsg_alloc < yysize)
@@ -1383,7 +1552,7 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
       if (! (yysize <= *yymsg_alloc
              && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
         *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
+      return -1;
     }
 
   /* Avoid sprintf, as that infringes on the user's name space.
@@ -1395,110 +1564,269 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
     while ((*yyp = *yyformat) != '\0')
       if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
         {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
           yyformat += 2;
         }
       else
         {
-          yyp++;
-          yyformat++;
+          ++yyp;
+          ++yyformat;
         }
   }
   return 0;
 }
-#endif /* YYERROR_VERBOSE */
+
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, SmtPrsr parser)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, SmtPrsr parser, SmtScanner scanner)
 {
-  YYUSE (yyvaluep);
-  YYUSE (yylocationp);
-  YYUSE (parser);
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (parser);
+  YY_USE (scanner);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  switch (yykind)
+    {
+    case YYSYMBOL_command_plus: /* command_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1603 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_datatype_decl_plus: /* datatype_decl_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1609 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_constructor_decl_plus: /* constructor_decl_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1615 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_selector_decl_star: /* selector_decl_star  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1621 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_sort_decl_plus: /* sort_decl_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1627 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_term_plus: /* term_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1633 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_match_case_plus: /* match_case_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1639 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_index_plus: /* index_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1645 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_sort_plus: /* sort_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1651 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_sort_star: /* sort_star  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1657 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_sort_pair_plus: /* sort_pair_plus  */
+#line 34 "smtlib-bison-parser.y"
+            { ast_pairListDelete(((*yyvaluep).pairList)); }
+#line 1663 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_var_binding_plus: /* var_binding_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1669 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_sorted_var_plus: /* sorted_var_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1675 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_sorted_var_star: /* sorted_var_star  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1681 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_attribute_star: /* attribute_star  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1687 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_attribute_plus: /* attribute_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1693 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_s_exp_plus: /* s_exp_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1699 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_prop_literal_star: /* prop_literal_star  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1705 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_fun_decl_plus: /* fun_decl_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1711 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_symbol_star: /* symbol_star  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1717 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_symbol_plus: /* symbol_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1723 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_theory_attr_plus: /* theory_attr_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1729 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_sort_symbol_decl_plus: /* sort_symbol_decl_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1735 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_par_fun_symbol_decl_plus: /* par_fun_symbol_decl_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1741 "smtlib-bison-parser.tab.c"
+        break;
+
+    case YYSYMBOL_logic_attr_plus: /* logic_attr_plus  */
+#line 33 "smtlib-bison-parser.y"
+            { ast_listDelete(((*yyvaluep).list)); }
+#line 1747 "smtlib-bison-parser.tab.c"
+        break;
+
+      default:
+        break;
+    }
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
 
 
-/* The lookahead symbol.  */
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (SmtPrsr parser, SmtScanner scanner)
+{
+/* Lookahead token kind.  */
 int yychar;
 
+
 /* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
 /* Location data for the lookahead symbol.  */
-YYLTYPE yylloc
+static YYLTYPE yyloc_default
 # if defined SMT_YYLTYPE_IS_TRIVIAL && SMT_YYLTYPE_IS_TRIVIAL
   = { 1, 1, 1, 1 }
 # endif
 ;
-/* Number of syntax errors so far.  */
-int yynerrs;
-
+YYLTYPE yylloc = yyloc_default;
 
-/*----------.
-| yyparse.  |
-`----------*/
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
 
-int
-yyparse (SmtPrsr parser)
-{
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+    int yyerrstatus = 0;
 
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-       'yyls': related to locations.
-
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    /* The semantic value stack.  */
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-    /* The location stack.  */
+    /* The location stack: array, bottom, top.  */
     YYLTYPE yylsa[YYINITDEPTH];
-    YYLTYPE *yyls;
-    YYLTYPE *yylsp;
-
-    /* The locations where the error started and ended.  */
-    YYLTYPE yyerror_range[3];
-
-    YYSIZE_T yystacksize;
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
   YYLTYPE yyloc;
 
-#if YYERROR_VERBOSE
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
   /* Buffer for error messages, and its allocated size.  */
   char yymsgbuf[128];
   char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
 
@@ -1506,43 +1834,49 @@ yyparse (SmtPrsr parser)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yylsp = yyls = yylsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY; /* Cause a token to be read.  */
+  yychar = SMT_YYEMPTY; /* Cause a token to be read.  */
+
   yylsp[0] = yylloc;
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
         YYLTYPE *yyls1 = yyls;
 
         /* Each stack pointer address is followed by the size of the
@@ -1550,32 +1884,29 @@ yyparse (SmtPrsr parser)
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
-                    &yyls1, yysize * sizeof (*yylsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
                     &yystacksize);
-
-        yyls = yyls1;
         yyss = yyss1;
         yyvs = yyvs1;
+        yyls = yyls1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
         YYSTACK_RELOCATE (yyls_alloc, yyls);
@@ -1584,31 +1915,32 @@ yyparse (SmtPrsr parser)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
       yylsp = yyls + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -1619,18 +1951,30 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
-  if (yychar == YYEMPTY)
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == SMT_YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = yylex ();
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, &yylloc, scanner);
     }
 
-  if (yychar <= YYEOF)
+  if (yychar <= SMT_YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = SMT_YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == SMT_YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = SMT_YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1658,15 +2002,14 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
   *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = SMT_YYEMPTY;
   goto yynewstate;
 
 
@@ -1681,7 +2024,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -1697,33 +2040,34 @@ yyreduce:
      GCC warning that YYVAL may be used uninitialized.  */
   yyval = yyvsp[1-yylen];
 
-  /* Default location.  */
+  /* Default location. */
   YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 61 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { (yyval.ptr) = (yyvsp[0].ptr); ast_setAst(parser, (yyvsp[0].ptr)); }
-#line 1709 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+  case 2: /* smt_file: script  */
+#line 71 "smtlib-bison-parser.y"
+                                { (yyval.ptr) = (yyvsp[0].ptr); ast_setAst(parser, (yyvsp[0].ptr)); }
+#line 2053 "smtlib-bison-parser.tab.c"
     break;
 
-  case 3:
-#line 63 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { (yyval.ptr) = (yyvsp[0].ptr); ast_setAst(parser, (yyvsp[0].ptr)); }
-#line 1715 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+  case 3: /* smt_file: theory_decl  */
+#line 73 "smtlib-bison-parser.y"
+                                { (yyval.ptr) = (yyvsp[0].ptr); ast_setAst(parser, (yyvsp[0].ptr)); }
+#line 2059 "smtlib-bison-parser.tab.c"
     break;
 
-  case 4:
-#line 65 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { (yyval.ptr) = (yyvsp[0].ptr); ast_setAst(parser, (yyvsp[0].ptr)); }
-#line 1721 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+  case 4: /* smt_file: logic  */
+#line 75 "smtlib-bison-parser.y"
+                                { (yyval.ptr) = (yyvsp[0].ptr); ast_setAst(parser, (yyvsp[0].ptr)); }
+#line 2065 "smtlib-bison-parser.tab.c"
     break;
 
-  case 5:
-#line 70 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newScript((yyvsp[0].list));
+  case 5: /* script: command_plus  */
+#line 80 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newScript(parser, (yyvsp[0].list));
 
 			(yyloc).first_line = (yylsp[0]).first_line;
             (yyloc).first_column = (yylsp[0]).first_column;
@@ -1732,27 +2076,27 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1736 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2080 "smtlib-bison-parser.tab.c"
     break;
 
-  case 6:
-#line 84 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 	
+  case 6: /* command_plus: command  */
+#line 94 "smtlib-bison-parser.y"
+                { 	
 			(yyval.list) = ast_listCreate(); 
-			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
+			ast_addCommand(parser, (yyval.list), (yyvsp[0].ptr)); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
             (yyloc).first_column = (yylsp[0]).first_column;
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 1750 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2094 "smtlib-bison-parser.tab.c"
     break;
 
-  case 7:
-#line 95 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
+  case 7: /* command_plus: command_plus command  */
+#line 105 "smtlib-bison-parser.y"
+                { 
+			ast_addCommand(parser, (yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
 			(yyloc).first_line = (yylsp[-1]).first_line;
@@ -1760,13 +2104,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 1764 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2108 "smtlib-bison-parser.tab.c"
     break;
 
-  case 8:
-#line 108 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newAssertCommand((yyvsp[-1].ptr)); 
+  case 8: /* command: '(' KW_ASSERT term ')'  */
+#line 118 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newAssertCommand(parser, (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -1775,13 +2119,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1779 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2123 "smtlib-bison-parser.tab.c"
     break;
 
-  case 9:
-#line 120 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newCheckSatCommand(); 
+  case 9: /* command: '(' KW_CHK_SAT ')'  */
+#line 130 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newCheckSatCommand(parser); 
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
             (yyloc).first_column = (yylsp[-2]).first_column;
@@ -1790,13 +2134,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1794 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2138 "smtlib-bison-parser.tab.c"
     break;
 
-  case 10:
-#line 132 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newCheckUnsatCommand();
+  case 10: /* command: '(' KW_CHK_UNSAT ')'  */
+#line 142 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newCheckUnsatCommand(parser);
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
             (yyloc).first_column = (yylsp[-2]).first_column;
@@ -1805,13 +2149,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1809 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2153 "smtlib-bison-parser.tab.c"
     break;
 
-  case 11:
-#line 144 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newCheckSatAssumCommand((yyvsp[-2].list)); 
+  case 11: /* command: '(' KW_CHK_SAT_ASSUM '(' prop_literal_star ')' ')'  */
+#line 154 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newCheckSatAssumCommand(parser, (yyvsp[-2].list)); 
 
 			(yyloc).first_line = (yylsp[-5]).first_line;
             (yyloc).first_column = (yylsp[-5]).first_column;
@@ -1820,13 +2164,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1824 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2168 "smtlib-bison-parser.tab.c"
     break;
 
-  case 12:
-#line 156 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newDeclareConstCommand((yyvsp[-2].ptr), (yyvsp[-1].ptr)); 
+  case 12: /* command: '(' KW_DECL_CONST symbol sort ')'  */
+#line 166 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newDeclareConstCommand(parser, (yyvsp[-2].ptr), (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-4]).first_line;
             (yyloc).first_column = (yylsp[-4]).first_column;
@@ -1835,13 +2179,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1839 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2183 "smtlib-bison-parser.tab.c"
     break;
 
-  case 13:
-#line 168 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newDeclareDatatypeCommand((yyvsp[-2].ptr), (yyvsp[-1].ptr));
+  case 13: /* command: '(' KW_DECL_DATATYPE symbol datatype_decl ')'  */
+#line 178 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newDeclareDatatypeCommand(parser, (yyvsp[-2].ptr), (yyvsp[-1].ptr));
 
 			(yyloc).first_line = (yylsp[-4]).first_line;
 			(yyloc).first_column = (yylsp[-4]).first_column;
@@ -1850,13 +2194,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1854 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2198 "smtlib-bison-parser.tab.c"
     break;
 
-  case 14:
-#line 180 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newDeclareDatatypesCommand((yyvsp[-5].list), (yyvsp[-2].list));
+  case 14: /* command: '(' KW_DECL_DATATYPES '(' sort_decl_plus ')' '(' datatype_decl_plus ')' ')'  */
+#line 190 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newDeclareDatatypesCommand(parser, (yyvsp[-5].list), (yyvsp[-2].list));
 
 			(yyloc).first_line = (yylsp[-8]).first_line;
 			(yyloc).first_column = (yylsp[-8]).first_column;
@@ -1865,13 +2209,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1869 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2213 "smtlib-bison-parser.tab.c"
     break;
 
-  case 15:
-#line 192 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newDeclareFunCommand((yyvsp[-5].ptr), (yyvsp[-3].list), (yyvsp[-1].ptr)); 
+  case 15: /* command: '(' KW_DECL_FUN symbol '(' sort_star ')' sort ')'  */
+#line 202 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newDeclareFunCommand(parser, (yyvsp[-5].ptr), (yyvsp[-3].list), (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-7]).first_line;
             (yyloc).first_column = (yylsp[-7]).first_column;
@@ -1880,13 +2224,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1884 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2228 "smtlib-bison-parser.tab.c"
     break;
 
-  case 16:
-#line 204 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newDeclareSortCommand((yyvsp[-2].ptr), (yyvsp[-1].ptr)); 
+  case 16: /* command: '(' KW_DECL_SORT symbol NUMERAL ')'  */
+#line 214 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newDeclareSortCommand(parser, (yyvsp[-2].ptr), (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-4]).first_line;
             (yyloc).first_column = (yylsp[-4]).first_column;
@@ -1895,13 +2239,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1899 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2243 "smtlib-bison-parser.tab.c"
     break;
 
-  case 17:
-#line 216 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newDeclareHeapCommand((yyvsp[-1].pairList));
+  case 17: /* command: '(' KW_DECL_HEAP sort_pair_plus ')'  */
+#line 226 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newDeclareHeapCommand(parser, (yyvsp[-1].pairList));
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -1910,13 +2254,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1914 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2258 "smtlib-bison-parser.tab.c"
     break;
 
-  case 18:
-#line 228 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newDefineFunsRecCommand((yyvsp[-5].list), (yyvsp[-2].list)); 
+  case 18: /* command: '(' KW_DEF_FUNS_REC '(' fun_decl_plus ')' '(' term_plus ')' ')'  */
+#line 238 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newDefineFunsRecCommand(parser, (yyvsp[-5].list), (yyvsp[-2].list)); 
 
 			(yyloc).first_line = (yylsp[-8]).first_line;
             (yyloc).first_column = (yylsp[-8]).first_column;
@@ -1925,13 +2269,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1929 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2273 "smtlib-bison-parser.tab.c"
     break;
 
-  case 19:
-#line 240 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newDefineFunRecCommand((yyvsp[-1].ptr)); 
+  case 19: /* command: '(' KW_DEF_FUN_REC fun_def ')'  */
+#line 250 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newDefineFunRecCommand(parser, (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -1940,13 +2284,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1944 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2288 "smtlib-bison-parser.tab.c"
     break;
 
-  case 20:
-#line 252 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newDefineFunCommand((yyvsp[-1].ptr)); 
+  case 20: /* command: '(' KW_DEF_FUN fun_def ')'  */
+#line 262 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newDefineFunCommand(parser, (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -1955,13 +2299,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1959 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2303 "smtlib-bison-parser.tab.c"
     break;
 
-  case 21:
-#line 264 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newDefineSortCommand((yyvsp[-5].ptr), (yyvsp[-3].list), (yyvsp[-1].ptr)); 
+  case 21: /* command: '(' KW_DEF_SORT symbol '(' symbol_star ')' sort ')'  */
+#line 274 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newDefineSortCommand(parser, (yyvsp[-5].ptr), (yyvsp[-3].list), (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-7]).first_line;
             (yyloc).first_column = (yylsp[-7]).first_column;
@@ -1970,13 +2314,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1974 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2318 "smtlib-bison-parser.tab.c"
     break;
 
-  case 22:
-#line 276 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newEchoCommand((yyvsp[-1].ptr)); 
+  case 22: /* command: '(' KW_ECHO STRING ')'  */
+#line 286 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newEchoCommand(parser, (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -1985,13 +2329,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 1989 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2333 "smtlib-bison-parser.tab.c"
     break;
 
-  case 23:
-#line 288 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newExitCommand(); 
+  case 23: /* command: '(' KW_EXIT ')'  */
+#line 298 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newExitCommand(parser); 
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
             (yyloc).first_column = (yylsp[-2]).first_column;
@@ -2000,13 +2344,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2004 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2348 "smtlib-bison-parser.tab.c"
     break;
 
-  case 24:
-#line 300 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newGetAssertsCommand(); 
+  case 24: /* command: '(' KW_GET_ASSERTS ')'  */
+#line 310 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newGetAssertsCommand(parser); 
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
             (yyloc).first_column = (yylsp[-2]).first_column;
@@ -2015,13 +2359,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2019 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2363 "smtlib-bison-parser.tab.c"
     break;
 
-  case 25:
-#line 312 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newGetAssignsCommand(); 
+  case 25: /* command: '(' KW_GET_ASSIGNS ')'  */
+#line 322 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newGetAssignsCommand(parser); 
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
             (yyloc).first_column = (yylsp[-2]).first_column;
@@ -2030,13 +2374,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2034 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2378 "smtlib-bison-parser.tab.c"
     break;
 
-  case 26:
-#line 324 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newGetInfoCommand((yyvsp[-1].ptr)); 
+  case 26: /* command: '(' KW_GET_INFO info_flag ')'  */
+#line 334 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newGetInfoCommand(parser, (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -2045,13 +2389,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2049 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2393 "smtlib-bison-parser.tab.c"
     break;
 
-  case 27:
-#line 336 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newGetModelCommand(); 
+  case 27: /* command: '(' KW_GET_MODEL ')'  */
+#line 346 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newGetModelCommand(parser); 
 			(yyloc).first_line = (yylsp[-2]).first_line;
             (yyloc).first_column = (yylsp[-2]).first_column;
 			(yyloc).last_line = (yylsp[-2]).last_line;
@@ -2059,13 +2403,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2063 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2407 "smtlib-bison-parser.tab.c"
     break;
 
-  case 28:
-#line 347 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newGetOptionCommand((yyvsp[-1].ptr)); 
+  case 28: /* command: '(' KW_GET_OPT KEYWORD ')'  */
+#line 357 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newGetOptionCommand(parser, (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -2074,13 +2418,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2078 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2422 "smtlib-bison-parser.tab.c"
     break;
 
-  case 29:
-#line 359 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newGetProofCommand(); 
+  case 29: /* command: '(' KW_GET_PROOF ')'  */
+#line 369 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newGetProofCommand(parser); 
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
             (yyloc).first_column = (yylsp[-2]).first_column;
@@ -2089,13 +2433,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2093 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2437 "smtlib-bison-parser.tab.c"
     break;
 
-  case 30:
-#line 371 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newGetModelCommand(); 
+  case 30: /* command: '(' KW_GET_UNSAT_ASSUMS ')'  */
+#line 381 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newGetModelCommand(parser); 
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
             (yyloc).first_column = (yylsp[-2]).first_column;
@@ -2104,13 +2448,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2108 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2452 "smtlib-bison-parser.tab.c"
     break;
 
-  case 31:
-#line 383 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newGetUnsatCoreCommand(); 
+  case 31: /* command: '(' KW_GET_UNSAT_CORE ')'  */
+#line 393 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newGetUnsatCoreCommand(parser); 
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
             (yyloc).first_column = (yylsp[-2]).first_column;
@@ -2119,13 +2463,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2123 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2467 "smtlib-bison-parser.tab.c"
     break;
 
-  case 32:
-#line 395 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newGetValueCommand((yyvsp[-1].list)); 
+  case 32: /* command: '(' KW_GET_VALUE term_plus ')'  */
+#line 405 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newGetValueCommand(parser, (yyvsp[-1].list)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -2134,13 +2478,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2138 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2482 "smtlib-bison-parser.tab.c"
     break;
 
-  case 33:
-#line 407 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newPopCommand((yyvsp[-1].ptr)); 
+  case 33: /* command: '(' KW_POP NUMERAL ')'  */
+#line 417 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newPopCommand(parser, (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -2149,13 +2493,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2153 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2497 "smtlib-bison-parser.tab.c"
     break;
 
-  case 34:
-#line 419 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newPushCommand((yyvsp[-1].ptr)); 
+  case 34: /* command: '(' KW_PUSH NUMERAL ')'  */
+#line 429 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newPushCommand(parser, (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -2164,13 +2508,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2168 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2512 "smtlib-bison-parser.tab.c"
     break;
 
-  case 35:
-#line 431 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newResetAssertsCommand(); 
+  case 35: /* command: '(' KW_RESET_ASSERTS ')'  */
+#line 441 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newResetAssertsCommand(parser); 
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
             (yyloc).first_column = (yylsp[-2]).first_column;
@@ -2179,13 +2523,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2183 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2527 "smtlib-bison-parser.tab.c"
     break;
 
-  case 36:
-#line 443 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newResetCommand(); 
+  case 36: /* command: '(' KW_RESET ')'  */
+#line 453 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newResetCommand(parser); 
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
             (yyloc).first_column = (yylsp[-2]).first_column;
@@ -2194,13 +2538,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2198 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2542 "smtlib-bison-parser.tab.c"
     break;
 
-  case 37:
-#line 455 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newSetInfoCommand((yyvsp[-1].ptr)); 
+  case 37: /* command: '(' KW_SET_INFO attribute ')'  */
+#line 465 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newSetInfoCommand(parser, (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -2209,13 +2553,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2213 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2557 "smtlib-bison-parser.tab.c"
     break;
 
-  case 38:
-#line 467 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newSetLogicCommand((yyvsp[-1].ptr)); 
+  case 38: /* command: '(' KW_SET_LOGIC symbol ')'  */
+#line 477 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newSetLogicCommand(parser, (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -2224,13 +2568,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2228 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2572 "smtlib-bison-parser.tab.c"
     break;
 
-  case 39:
-#line 479 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newSetOptionCommand((yyvsp[-1].ptr)); 
+  case 39: /* command: '(' KW_SET_OPT option ')'  */
+#line 489 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newSetOptionCommand(parser, (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -2239,12 +2583,12 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2243 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2587 "smtlib-bison-parser.tab.c"
     break;
 
-  case 40:
-#line 493 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 40: /* datatype_decl_plus: datatype_decl  */
+#line 503 "smtlib-bison-parser.y"
+                {
 			(yyval.list) = ast_listCreate();
 			ast_listAdd((yyval.list), (yyvsp[0].ptr));
 
@@ -2253,12 +2597,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2257 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2601 "smtlib-bison-parser.tab.c"
     break;
 
-  case 41:
-#line 504 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 41: /* datatype_decl_plus: datatype_decl_plus datatype_decl  */
+#line 514 "smtlib-bison-parser.y"
+                {
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr));
 			(yyval.list) = (yyvsp[-1].list);
 
@@ -2267,13 +2611,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2271 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2615 "smtlib-bison-parser.tab.c"
     break;
 
-  case 42:
-#line 517 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newSimpleDatatypeDeclaration((yyvsp[-1].list));
+  case 42: /* datatype_decl: '(' constructor_decl_plus ')'  */
+#line 527 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newSimpleDatatypeDeclaration(parser, (yyvsp[-1].list));
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
 			(yyloc).first_column = (yylsp[-2]).first_column;
@@ -2282,13 +2626,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2286 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2630 "smtlib-bison-parser.tab.c"
     break;
 
-  case 43:
-#line 529 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newParametricDatatypeDeclaration((yyvsp[-5].list), (yyvsp[-2].list));
+  case 43: /* datatype_decl: '(' KW_PAR '(' symbol_plus ')' '(' constructor_decl_plus ')' ')'  */
+#line 539 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newParametricDatatypeDeclaration(parser, (yyvsp[-5].list), (yyvsp[-2].list));
 
 			(yyloc).first_line = (yylsp[-8]).first_line;
 			(yyloc).first_column = (yylsp[-8]).first_column;
@@ -2297,12 +2641,12 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2301 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2645 "smtlib-bison-parser.tab.c"
     break;
 
-  case 44:
-#line 543 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 44: /* constructor_decl_plus: constructor_decl  */
+#line 553 "smtlib-bison-parser.y"
+                {
 			(yyval.list) = ast_listCreate();
 			ast_listAdd((yyval.list), (yyvsp[0].ptr));
 
@@ -2311,12 +2655,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2315 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2659 "smtlib-bison-parser.tab.c"
     break;
 
-  case 45:
-#line 554 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 45: /* constructor_decl_plus: constructor_decl_plus constructor_decl  */
+#line 564 "smtlib-bison-parser.y"
+                {
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr));
 			(yyval.list) = (yyvsp[-1].list);
 
@@ -2325,13 +2669,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2329 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2673 "smtlib-bison-parser.tab.c"
     break;
 
-  case 46:
-#line 567 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newConstructorDeclaration((yyvsp[-2].ptr), (yyvsp[-1].list));
+  case 46: /* constructor_decl: '(' symbol selector_decl_star ')'  */
+#line 577 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newConstructorDeclaration(parser, (yyvsp[-2].ptr), (yyvsp[-1].list));
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
 			(yyloc).first_column = (yylsp[-3]).first_column;
@@ -2340,20 +2684,20 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2344 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2688 "smtlib-bison-parser.tab.c"
     break;
 
-  case 47:
-#line 581 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 47: /* selector_decl_star: %empty  */
+#line 591 "smtlib-bison-parser.y"
+                {
 			(yyval.list) = ast_listCreate();
 		}
-#line 2352 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2696 "smtlib-bison-parser.tab.c"
     break;
 
-  case 48:
-#line 586 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 48: /* selector_decl_star: selector_decl_star selector_decl  */
+#line 596 "smtlib-bison-parser.y"
+                {
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr));
 			(yyval.list) = (yyvsp[-1].list);
 
@@ -2369,13 +2713,13 @@ yyreduce:
             	(yyloc).last_column = (yylsp[0]).last_column;
 			}
 		}
-#line 2373 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2717 "smtlib-bison-parser.tab.c"
     break;
 
-  case 49:
-#line 606 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newSelectorDeclaration((yyvsp[-2].ptr), (yyvsp[-1].ptr));
+  case 49: /* selector_decl: '(' symbol sort ')'  */
+#line 616 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newSelectorDeclaration(parser, (yyvsp[-2].ptr), (yyvsp[-1].ptr));
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
 			(yyloc).first_column = (yylsp[-3]).first_column;
@@ -2384,12 +2728,12 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2388 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2732 "smtlib-bison-parser.tab.c"
     break;
 
-  case 50:
-#line 620 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 50: /* sort_decl_plus: sort_decl  */
+#line 630 "smtlib-bison-parser.y"
+                {
 			(yyval.list) = ast_listCreate();
 			ast_listAdd((yyval.list), (yyvsp[0].ptr));
 
@@ -2398,12 +2742,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2402 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2746 "smtlib-bison-parser.tab.c"
     break;
 
-  case 51:
-#line 631 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 51: /* sort_decl_plus: sort_decl_plus sort_decl  */
+#line 641 "smtlib-bison-parser.y"
+                {
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr));
 			(yyval.list) = (yyvsp[-1].list);
 
@@ -2412,13 +2756,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2416 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2760 "smtlib-bison-parser.tab.c"
     break;
 
-  case 52:
-#line 644 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newSortDeclaration((yyvsp[-2].ptr), (yyvsp[-1].ptr));
+  case 52: /* sort_decl: '(' symbol NUMERAL ')'  */
+#line 654 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newSortDeclaration(parser, (yyvsp[-2].ptr), (yyvsp[-1].ptr));
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -2427,12 +2771,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2431 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2775 "smtlib-bison-parser.tab.c"
     break;
 
-  case 53:
-#line 658 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 53: /* term: spec_const  */
+#line 668 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -2440,12 +2784,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2444 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2788 "smtlib-bison-parser.tab.c"
     break;
 
-  case 54:
-#line 668 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 54: /* term: qual_identifier  */
+#line 678 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -2453,13 +2797,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2457 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2801 "smtlib-bison-parser.tab.c"
     break;
 
-  case 55:
-#line 678 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newQualifiedTerm((yyvsp[-2].ptr), (yyvsp[-1].list)); 
+  case 55: /* term: '(' qual_identifier term_plus ')'  */
+#line 688 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newQualifiedTerm(parser, (yyvsp[-2].ptr), (yyvsp[-1].list)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -2468,13 +2812,13 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2472 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2816 "smtlib-bison-parser.tab.c"
     break;
 
-  case 56:
-#line 690 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newLetTerm((yyvsp[-3].list), (yyvsp[-1].ptr)); 
+  case 56: /* term: '(' KW_LET '(' var_binding_plus ')' term ')'  */
+#line 700 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newLetTerm(parser, (yyvsp[-3].list), (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-6]).first_line;
             (yyloc).first_column = (yylsp[-6]).first_column;
@@ -2483,13 +2827,13 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2487 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2831 "smtlib-bison-parser.tab.c"
     break;
 
-  case 57:
-#line 702 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newForallTerm((yyvsp[-3].list), (yyvsp[-1].ptr)); 
+  case 57: /* term: '(' KW_FORALL '(' sorted_var_plus ')' term ')'  */
+#line 712 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newForallTerm(parser, (yyvsp[-3].list), (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-6]).first_line;
             (yyloc).first_column = (yylsp[-6]).first_column;
@@ -2498,13 +2842,13 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2502 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2846 "smtlib-bison-parser.tab.c"
     break;
 
-  case 58:
-#line 714 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newExistsTerm((yyvsp[-3].list), (yyvsp[-1].ptr)); 
+  case 58: /* term: '(' KW_EXISTS '(' sorted_var_plus ')' term ')'  */
+#line 724 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newExistsTerm(parser, (yyvsp[-3].list), (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-6]).first_line;
             (yyloc).first_column = (yylsp[-6]).first_column;
@@ -2513,13 +2857,13 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2517 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2861 "smtlib-bison-parser.tab.c"
     break;
 
-  case 59:
-#line 726 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newMatchTerm((yyvsp[-4].ptr), (yyvsp[-2].list));
+  case 59: /* term: '(' KW_MATCH term '(' match_case_plus ')' ')'  */
+#line 736 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newMatchTerm(parser, (yyvsp[-4].ptr), (yyvsp[-2].list));
 
 			(yyloc).first_line = (yylsp[-6]).first_line;
             (yyloc).first_column = (yylsp[-6]).first_column;
@@ -2528,13 +2872,13 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2532 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2876 "smtlib-bison-parser.tab.c"
     break;
 
-  case 60:
-#line 738 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newAnnotatedTerm((yyvsp[-2].ptr), (yyvsp[-1].list)); 
+  case 60: /* term: '(' '!' term attribute_plus ')'  */
+#line 748 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newAnnotatedTerm(parser, (yyvsp[-2].ptr), (yyvsp[-1].list)); 
 
 			(yyloc).first_line = (yylsp[-4]).first_line;
             (yyloc).first_column = (yylsp[-4]).first_column;
@@ -2543,12 +2887,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2547 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2891 "smtlib-bison-parser.tab.c"
     break;
 
-  case 61:
-#line 750 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 61: /* term: '(' term ')'  */
+#line 760 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[-1].ptr); 
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
@@ -2558,12 +2902,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2562 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2906 "smtlib-bison-parser.tab.c"
     break;
 
-  case 62:
-#line 764 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 62: /* term_plus: term  */
+#line 774 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate(); 
 			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
 
@@ -2572,12 +2916,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2576 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2920 "smtlib-bison-parser.tab.c"
     break;
 
-  case 63:
-#line 775 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 63: /* term_plus: term_plus term  */
+#line 785 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -2586,12 +2930,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2590 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2934 "smtlib-bison-parser.tab.c"
     break;
 
-  case 64:
-#line 788 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 64: /* match_case_plus: match_case  */
+#line 798 "smtlib-bison-parser.y"
+                {
 			(yyval.list) = ast_listCreate();
 			ast_listAdd((yyval.list), (yyvsp[0].ptr));
 
@@ -2600,12 +2944,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2604 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2948 "smtlib-bison-parser.tab.c"
     break;
 
-  case 65:
-#line 799 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 65: /* match_case_plus: match_case_plus match_case  */
+#line 809 "smtlib-bison-parser.y"
+                {
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr));
 			(yyval.list) = (yyvsp[-1].list);
 
@@ -2614,13 +2958,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2618 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2962 "smtlib-bison-parser.tab.c"
     break;
 
-  case 66:
-#line 812 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newMatchCase((yyvsp[-2].ptr), (yyvsp[-1].ptr));
+  case 66: /* match_case: '(' pattern term ')'  */
+#line 822 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newMatchCase(parser, (yyvsp[-2].ptr), (yyvsp[-1].ptr));
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
 			(yyloc).first_column = (yylsp[-3]).first_column;
@@ -2629,12 +2973,12 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2633 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2977 "smtlib-bison-parser.tab.c"
     break;
 
-  case 67:
-#line 826 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 67: /* pattern: qual_constructor  */
+#line 836 "smtlib-bison-parser.y"
+                {
 			(yyval.ptr) = (yyvsp[0].ptr);
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -2642,13 +2986,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
 			(yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2646 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 2990 "smtlib-bison-parser.tab.c"
     break;
 
-  case 68:
-#line 836 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newQualifiedPattern((yyvsp[-2].ptr), (yyvsp[-1].list));
+  case 68: /* pattern: '(' qual_constructor symbol_plus ')'  */
+#line 846 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newQualifiedPattern(parser, (yyvsp[-2].ptr), (yyvsp[-1].list));
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
 			(yyloc).first_column = (yylsp[-3]).first_column;
@@ -2657,12 +3001,12 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2661 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3005 "smtlib-bison-parser.tab.c"
     break;
 
-  case 69:
-#line 850 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 69: /* qual_constructor: symbol  */
+#line 860 "smtlib-bison-parser.y"
+                {
 			(yyval.ptr) = (yyvsp[0].ptr);
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -2670,13 +3014,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
 			(yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2674 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3018 "smtlib-bison-parser.tab.c"
     break;
 
-  case 70:
-#line 860 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newQualifiedConstructor((yyvsp[-2].ptr), (yyvsp[-1].ptr));
+  case 70: /* qual_constructor: '(' KW_AS symbol sort ')'  */
+#line 870 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newQualifiedConstructor(parser, (yyvsp[-2].ptr), (yyvsp[-1].ptr));
 
 			(yyloc).first_line = (yylsp[-4]).first_line;
 			(yyloc).first_column = (yylsp[-4]).first_column;
@@ -2685,12 +3029,12 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2689 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3033 "smtlib-bison-parser.tab.c"
     break;
 
-  case 71:
-#line 874 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 71: /* spec_const: NUMERAL  */
+#line 884 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -2700,12 +3044,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2704 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3048 "smtlib-bison-parser.tab.c"
     break;
 
-  case 72:
-#line 886 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 72: /* spec_const: DECIMAL  */
+#line 896 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -2715,12 +3059,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2719 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3063 "smtlib-bison-parser.tab.c"
     break;
 
-  case 73:
-#line 898 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 73: /* spec_const: HEXADECIMAL  */
+#line 908 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -2730,12 +3074,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2734 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3078 "smtlib-bison-parser.tab.c"
     break;
 
-  case 74:
-#line 910 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 74: /* spec_const: BINARY  */
+#line 920 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -2745,12 +3089,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2749 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3093 "smtlib-bison-parser.tab.c"
     break;
 
-  case 75:
-#line 922 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 75: /* spec_const: STRING  */
+#line 932 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -2760,12 +3104,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2764 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3108 "smtlib-bison-parser.tab.c"
     break;
 
-  case 76:
-#line 936 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 76: /* symbol: SYMBOL  */
+#line 946 "smtlib-bison-parser.y"
+                {
 			(yyval.ptr) = (yyvsp[0].ptr);
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -2775,13 +3119,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2779 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3123 "smtlib-bison-parser.tab.c"
     break;
 
-  case 77:
-#line 948 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newSymbol("reset");
+  case 77: /* symbol: KW_RESET  */
+#line 958 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newSymbol(parser, "reset");
 
 			(yyloc).first_line = (yylsp[0]).first_line;
             (yyloc).first_column = (yylsp[0]).first_column;
@@ -2790,13 +3134,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2794 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3138 "smtlib-bison-parser.tab.c"
     break;
 
-  case 78:
-#line 960 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newSymbol("not");
+  case 78: /* symbol: NOT  */
+#line 970 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newSymbol(parser, "not");
 
 			(yyloc).first_line = (yylsp[0]).first_line;
             (yyloc).first_column = (yylsp[0]).first_column;
@@ -2805,13 +3149,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2809 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3153 "smtlib-bison-parser.tab.c"
     break;
 
-  case 79:
-#line 972 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
-			(yyval.ptr) = ast_newSymbol("_");
+  case 79: /* symbol: '_'  */
+#line 982 "smtlib-bison-parser.y"
+                {
+			(yyval.ptr) = ast_newSymbol(parser, "_");
 
 			(yyloc).first_line = (yylsp[0]).first_line;
 			(yyloc).first_column = (yylsp[0]).first_column;
@@ -2820,12 +3164,12 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2824 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3168 "smtlib-bison-parser.tab.c"
     break;
 
-  case 80:
-#line 986 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 80: /* qual_identifier: identifier  */
+#line 996 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -2833,13 +3177,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2837 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3181 "smtlib-bison-parser.tab.c"
     break;
 
-  case 81:
-#line 996 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newQualifiedIdentifier((yyvsp[-2].ptr), (yyvsp[-1].ptr)); 
+  case 81: /* qual_identifier: '(' KW_AS identifier sort ')'  */
+#line 1006 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newQualifiedIdentifier(parser, (yyvsp[-2].ptr), (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-4]).first_line;
             (yyloc).first_column = (yylsp[-4]).first_column;
@@ -2848,13 +3192,13 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2852 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3196 "smtlib-bison-parser.tab.c"
     break;
 
-  case 82:
-#line 1010 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newSimpleIdentifier1((yyvsp[0].ptr));
+  case 82: /* identifier: symbol  */
+#line 1020 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newSimpleIdentifier1(parser, (yyvsp[0].ptr));
 
 			(yyloc).first_line = (yylsp[0]).first_line;
             (yyloc).first_column = (yylsp[0]).first_column;
@@ -2863,13 +3207,13 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2867 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3211 "smtlib-bison-parser.tab.c"
     break;
 
-  case 83:
-#line 1022 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newSimpleIdentifier2((yyvsp[-2].ptr), (yyvsp[-1].list));
+  case 83: /* identifier: '(' '_' symbol index_plus ')'  */
+#line 1032 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newSimpleIdentifier2(parser, (yyvsp[-2].ptr), (yyvsp[-1].list));
 
 			(yyloc).first_line = (yylsp[-4]).first_line;
             (yyloc).first_column = (yylsp[-4]).first_column;
@@ -2878,12 +3222,12 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2882 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3226 "smtlib-bison-parser.tab.c"
     break;
 
-  case 84:
-#line 1036 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 84: /* index: NUMERAL  */
+#line 1046 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -2893,12 +3237,12 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2897 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3241 "smtlib-bison-parser.tab.c"
     break;
 
-  case 85:
-#line 1048 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 85: /* index: symbol  */
+#line 1058 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -2908,12 +3252,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2912 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3256 "smtlib-bison-parser.tab.c"
     break;
 
-  case 86:
-#line 1062 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 86: /* index_plus: index  */
+#line 1072 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate(); 
 			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
 
@@ -2922,12 +3266,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2926 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3270 "smtlib-bison-parser.tab.c"
     break;
 
-  case 87:
-#line 1073 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 87: /* index_plus: index_plus index  */
+#line 1083 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -2936,13 +3280,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2940 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3284 "smtlib-bison-parser.tab.c"
     break;
 
-  case 88:
-#line 1086 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newSort1((yyvsp[0].ptr)); 
+  case 88: /* sort: identifier  */
+#line 1096 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newSort1(parser, (yyvsp[0].ptr)); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
             (yyloc).first_column = (yylsp[0]).first_column;
@@ -2951,13 +3295,13 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2955 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3299 "smtlib-bison-parser.tab.c"
     break;
 
-  case 89:
-#line 1098 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newSort2((yyvsp[-2].ptr), (yyvsp[-1].list)); 
+  case 89: /* sort: '(' identifier sort_plus ')'  */
+#line 1108 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newSort2(parser, (yyvsp[-2].ptr), (yyvsp[-1].list)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -2966,12 +3310,12 @@ yyreduce:
 
 			ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 2970 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3314 "smtlib-bison-parser.tab.c"
     break;
 
-  case 90:
-#line 1112 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 90: /* sort_plus: sort  */
+#line 1122 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate(); 
 			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
 
@@ -2980,12 +3324,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2984 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3328 "smtlib-bison-parser.tab.c"
     break;
 
-  case 91:
-#line 1123 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 91: /* sort_plus: sort_plus sort  */
+#line 1133 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -2994,20 +3338,20 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 2998 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3342 "smtlib-bison-parser.tab.c"
     break;
 
-  case 92:
-#line 1136 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 92: /* sort_star: %empty  */
+#line 1146 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate();
 		}
-#line 3006 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3350 "smtlib-bison-parser.tab.c"
     break;
 
-  case 93:
-#line 1141 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 93: /* sort_star: sort_star sort  */
+#line 1151 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3023,12 +3367,12 @@ yyreduce:
             	(yyloc).last_column = (yylsp[0]).last_column;
 			}
 		}
-#line 3027 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3371 "smtlib-bison-parser.tab.c"
     break;
 
-  case 94:
-#line 1161 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 94: /* sort_pair_plus: '(' sort sort ')'  */
+#line 1171 "smtlib-bison-parser.y"
+                {
 			(yyval.pairList) = ast_pairListCreate();
 			ast_pairListAdd((yyval.pairList), (yyvsp[-2].ptr), (yyvsp[-1].ptr));
 
@@ -3037,12 +3381,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[-1]).last_line;
             (yyloc).last_column = (yylsp[-1]).last_column;
 		}
-#line 3041 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3385 "smtlib-bison-parser.tab.c"
     break;
 
-  case 95:
-#line 1172 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    {
+  case 95: /* sort_pair_plus: sort_pair_plus '(' sort sort ')'  */
+#line 1182 "smtlib-bison-parser.y"
+                {
 			ast_pairListAdd((yyvsp[-4].pairList), (yyvsp[-2].ptr), (yyvsp[-1].ptr));
 			(yyval.pairList) = (yyvsp[-4].pairList);
 
@@ -3051,13 +3395,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3055 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3399 "smtlib-bison-parser.tab.c"
     break;
 
-  case 96:
-#line 1185 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newVariableBinding((yyvsp[-2].ptr), (yyvsp[-1].ptr));
+  case 96: /* var_binding: '(' symbol term ')'  */
+#line 1195 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newVariableBinding(parser, (yyvsp[-2].ptr), (yyvsp[-1].ptr));
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -3066,12 +3410,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3070 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3414 "smtlib-bison-parser.tab.c"
     break;
 
-  case 97:
-#line 1199 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 97: /* var_binding_plus: var_binding  */
+#line 1209 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate(); 
 			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
 
@@ -3080,12 +3424,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3084 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3428 "smtlib-bison-parser.tab.c"
     break;
 
-  case 98:
-#line 1210 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 98: /* var_binding_plus: var_binding_plus var_binding  */
+#line 1220 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3094,13 +3438,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3098 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3442 "smtlib-bison-parser.tab.c"
     break;
 
-  case 99:
-#line 1223 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newSortedVariable((yyvsp[-2].ptr), (yyvsp[-1].ptr)); 
+  case 99: /* sorted_var: '(' symbol sort ')'  */
+#line 1233 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newSortedVariable(parser, (yyvsp[-2].ptr), (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -3109,12 +3453,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3113 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3457 "smtlib-bison-parser.tab.c"
     break;
 
-  case 100:
-#line 1237 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 100: /* sorted_var_plus: sorted_var  */
+#line 1247 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate(); 
 			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
 
@@ -3123,12 +3467,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3127 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3471 "smtlib-bison-parser.tab.c"
     break;
 
-  case 101:
-#line 1248 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 101: /* sorted_var_plus: sorted_var_plus sorted_var  */
+#line 1258 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3137,18 +3481,18 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3141 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3485 "smtlib-bison-parser.tab.c"
     break;
 
-  case 102:
-#line 1261 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { (yyval.list) = ast_listCreate(); }
-#line 3147 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+  case 102: /* sorted_var_star: %empty  */
+#line 1271 "smtlib-bison-parser.y"
+                { (yyval.list) = ast_listCreate(); }
+#line 3491 "smtlib-bison-parser.tab.c"
     break;
 
-  case 103:
-#line 1264 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 103: /* sorted_var_star: sorted_var_star sorted_var  */
+#line 1274 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3164,13 +3508,13 @@ yyreduce:
             	(yyloc).last_column = (yylsp[0]).last_column;
         	}
 		}
-#line 3168 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3512 "smtlib-bison-parser.tab.c"
     break;
 
-  case 104:
-#line 1284 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newAttribute1((yyvsp[0].ptr)); 
+  case 104: /* attribute: KEYWORD  */
+#line 1294 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newAttribute1(parser, (yyvsp[0].ptr)); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
             (yyloc).first_column = (yylsp[0]).first_column;
@@ -3179,13 +3523,13 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3183 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3527 "smtlib-bison-parser.tab.c"
     break;
 
-  case 105:
-#line 1296 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newAttribute2((yyvsp[-1].ptr), (yyvsp[0].ptr)); 
+  case 105: /* attribute: KEYWORD attr_value  */
+#line 1306 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newAttribute2(parser, (yyvsp[-1].ptr), (yyvsp[0].ptr)); 
 
 			(yyloc).first_line = (yylsp[-1]).first_line;
             (yyloc).first_column = (yylsp[-1]).first_column;
@@ -3194,18 +3538,18 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3198 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3542 "smtlib-bison-parser.tab.c"
     break;
 
-  case 106:
-#line 1310 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { (yyval.list) = ast_listCreate(); }
-#line 3204 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+  case 106: /* attribute_star: %empty  */
+#line 1320 "smtlib-bison-parser.y"
+                { (yyval.list) = ast_listCreate(); }
+#line 3548 "smtlib-bison-parser.tab.c"
     break;
 
-  case 107:
-#line 1313 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 107: /* attribute_star: attribute_star attribute  */
+#line 1323 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3221,12 +3565,12 @@ yyreduce:
             	(yyloc).last_column = (yylsp[0]).last_column;
         	}
 		}
-#line 3225 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3569 "smtlib-bison-parser.tab.c"
     break;
 
-  case 108:
-#line 1333 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 108: /* attribute_plus: attribute  */
+#line 1343 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate(); 
 			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
 
@@ -3235,12 +3579,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3239 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3583 "smtlib-bison-parser.tab.c"
     break;
 
-  case 109:
-#line 1344 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 109: /* attribute_plus: attribute_plus attribute  */
+#line 1354 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3249,12 +3593,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
         	(yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3253 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3597 "smtlib-bison-parser.tab.c"
     break;
 
-  case 110:
-#line 1357 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 110: /* attr_value: spec_const  */
+#line 1367 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -3262,12 +3606,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3266 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3610 "smtlib-bison-parser.tab.c"
     break;
 
-  case 111:
-#line 1367 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 111: /* attr_value: symbol  */
+#line 1377 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -3275,13 +3619,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3279 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3623 "smtlib-bison-parser.tab.c"
     break;
 
-  case 112:
-#line 1377 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newCompSExpression((yyvsp[-1].list)); 
+  case 112: /* attr_value: '(' s_exp_plus ')'  */
+#line 1387 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newCompSExpression(parser, (yyvsp[-1].list)); 
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
             (yyloc).first_column = (yylsp[-2]).first_column;
@@ -3290,12 +3634,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3294 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3638 "smtlib-bison-parser.tab.c"
     break;
 
-  case 113:
-#line 1391 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 113: /* s_exp: spec_const  */
+#line 1401 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -3303,12 +3647,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3307 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3651 "smtlib-bison-parser.tab.c"
     break;
 
-  case 114:
-#line 1401 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 114: /* s_exp: symbol  */
+#line 1411 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -3316,12 +3660,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3320 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3664 "smtlib-bison-parser.tab.c"
     break;
 
-  case 115:
-#line 1411 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 115: /* s_exp: KEYWORD  */
+#line 1421 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -3329,13 +3673,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3333 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3677 "smtlib-bison-parser.tab.c"
     break;
 
-  case 116:
-#line 1421 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newCompSExpression((yyvsp[-1].list)); 
+  case 116: /* s_exp: '(' s_exp_plus ')'  */
+#line 1431 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newCompSExpression(parser, (yyvsp[-1].list)); 
 
 			(yyloc).first_line = (yylsp[-2]).first_line;
             (yyloc).first_column = (yylsp[-2]).first_column;
@@ -3344,12 +3688,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3348 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3692 "smtlib-bison-parser.tab.c"
     break;
 
-  case 117:
-#line 1435 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 117: /* s_exp_plus: s_exp  */
+#line 1445 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate(); 
 			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
 
@@ -3358,12 +3702,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3362 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3706 "smtlib-bison-parser.tab.c"
     break;
 
-  case 118:
-#line 1446 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 118: /* s_exp_plus: s_exp_plus s_exp  */
+#line 1456 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3372,13 +3716,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3376 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3720 "smtlib-bison-parser.tab.c"
     break;
 
-  case 119:
-#line 1459 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newPropLiteral((yyvsp[0].ptr), 0); 
+  case 119: /* prop_literal: symbol  */
+#line 1469 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newPropLiteral(parser, (yyvsp[0].ptr), 0); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
             (yyloc).first_column = (yylsp[0]).first_column;
@@ -3387,13 +3731,13 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3391 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3735 "smtlib-bison-parser.tab.c"
     break;
 
-  case 120:
-#line 1471 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newPropLiteral((yyvsp[-1].ptr), 1); 
+  case 120: /* prop_literal: '(' NOT symbol ')'  */
+#line 1481 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newPropLiteral(parser, (yyvsp[-1].ptr), 1); 
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -3402,18 +3746,18 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3406 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3750 "smtlib-bison-parser.tab.c"
     break;
 
-  case 121:
-#line 1485 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { (yyval.list) = ast_listCreate(); }
-#line 3412 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+  case 121: /* prop_literal_star: %empty  */
+#line 1495 "smtlib-bison-parser.y"
+                { (yyval.list) = ast_listCreate(); }
+#line 3756 "smtlib-bison-parser.tab.c"
     break;
 
-  case 122:
-#line 1489 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 122: /* prop_literal_star: prop_literal_star prop_literal  */
+#line 1499 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3429,13 +3773,13 @@ yyreduce:
             	(yyloc).last_column = (yylsp[0]).last_column;
         	}
 		}
-#line 3433 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3777 "smtlib-bison-parser.tab.c"
     break;
 
-  case 123:
-#line 1509 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newFunctionDeclaration((yyvsp[-5].ptr), (yyvsp[-3].list), (yyvsp[-1].ptr)); 
+  case 123: /* fun_decl: '(' symbol '(' sorted_var_star ')' sort ')'  */
+#line 1519 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newFunctionDeclaration(parser, (yyvsp[-5].ptr), (yyvsp[-3].list), (yyvsp[-1].ptr)); 
 
 			(yyloc).first_line = (yylsp[-6]).first_line;
             (yyloc).first_column = (yylsp[-6]).first_column;
@@ -3444,12 +3788,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3448 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3792 "smtlib-bison-parser.tab.c"
     break;
 
-  case 124:
-#line 1523 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 124: /* fun_decl_plus: fun_decl  */
+#line 1533 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate(); 
 			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
 
@@ -3458,12 +3802,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3462 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3806 "smtlib-bison-parser.tab.c"
     break;
 
-  case 125:
-#line 1534 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 125: /* fun_decl_plus: fun_decl_plus fun_decl  */
+#line 1544 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3472,14 +3816,14 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3476 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3820 "smtlib-bison-parser.tab.c"
     break;
 
-  case 126:
-#line 1547 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newFunctionDefinition(
-				ast_newFunctionDeclaration((yyvsp[-5].ptr), (yyvsp[-3].list), (yyvsp[-1].ptr)), (yyvsp[0].ptr)); 
+  case 126: /* fun_def: symbol '(' sorted_var_star ')' sort term  */
+#line 1557 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newFunctionDefinition(parser, 
+				ast_newFunctionDeclaration(parser, (yyvsp[-5].ptr), (yyvsp[-3].list), (yyvsp[-1].ptr)), (yyvsp[0].ptr)); 
 
 			(yyloc).first_line = (yylsp[-5]).first_line;
             (yyloc).first_column = (yylsp[-5]).first_column;
@@ -3488,18 +3832,18 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3492 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3836 "smtlib-bison-parser.tab.c"
     break;
 
-  case 127:
-#line 1562 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { (yyval.list) = ast_listCreate(); }
-#line 3498 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+  case 127: /* symbol_star: %empty  */
+#line 1572 "smtlib-bison-parser.y"
+                { (yyval.list) = ast_listCreate(); }
+#line 3842 "smtlib-bison-parser.tab.c"
     break;
 
-  case 128:
-#line 1565 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 128: /* symbol_star: symbol_star symbol  */
+#line 1575 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3515,12 +3859,12 @@ yyreduce:
             	(yyloc).last_column = (yylsp[0]).last_column;
         	}
 		}
-#line 3519 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3863 "smtlib-bison-parser.tab.c"
     break;
 
-  case 129:
-#line 1585 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 129: /* symbol_plus: symbol  */
+#line 1595 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate(); 
 			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
 
@@ -3529,12 +3873,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3533 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3877 "smtlib-bison-parser.tab.c"
     break;
 
-  case 130:
-#line 1596 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 130: /* symbol_plus: symbol_plus symbol  */
+#line 1606 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3543,12 +3887,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3547 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3891 "smtlib-bison-parser.tab.c"
     break;
 
-  case 131:
-#line 1609 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 131: /* info_flag: KEYWORD  */
+#line 1619 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -3558,12 +3902,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3562 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3906 "smtlib-bison-parser.tab.c"
     break;
 
-  case 132:
-#line 1623 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 132: /* option: attribute  */
+#line 1633 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -3571,13 +3915,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3575 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3919 "smtlib-bison-parser.tab.c"
     break;
 
-  case 133:
-#line 1635 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newTheory((yyvsp[-2].ptr), (yyvsp[-1].list)); 
+  case 133: /* theory_decl: '(' THEORY symbol theory_attr_plus ')'  */
+#line 1645 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newTheory(parser, (yyvsp[-2].ptr), (yyvsp[-1].list)); 
 
 			(yyloc).first_line = (yylsp[-4]).first_line;
             (yyloc).first_column = (yylsp[-4]).first_column;
@@ -3586,14 +3930,14 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3590 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3934 "smtlib-bison-parser.tab.c"
     break;
 
-  case 134:
-#line 1649 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newAttribute2((yyvsp[-3].ptr), 
-				ast_newCompAttributeValue((yyvsp[-1].list)));
+  case 134: /* theory_attr: KW_ATTR_SORTS '(' sort_symbol_decl_plus ')'  */
+#line 1659 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newAttribute2(parser, (yyvsp[-3].ptr), 
+				ast_newCompAttributeValue(parser, (yyvsp[-1].list)));
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -3602,14 +3946,14 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3606 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3950 "smtlib-bison-parser.tab.c"
     break;
 
-  case 135:
-#line 1662 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newAttribute2((yyvsp[-3].ptr), 
-				ast_newCompAttributeValue((yyvsp[-1].list)));
+  case 135: /* theory_attr: KW_ATTR_FUNS '(' par_fun_symbol_decl_plus ')'  */
+#line 1672 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newAttribute2(parser, (yyvsp[-3].ptr), 
+				ast_newCompAttributeValue(parser, (yyvsp[-1].list)));
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -3618,12 +3962,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3622 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3966 "smtlib-bison-parser.tab.c"
     break;
 
-  case 136:
-#line 1675 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 136: /* theory_attr: attribute  */
+#line 1685 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -3631,12 +3975,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3635 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3979 "smtlib-bison-parser.tab.c"
     break;
 
-  case 137:
-#line 1687 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 137: /* theory_attr_plus: theory_attr  */
+#line 1697 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate(); 
 			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
 
@@ -3645,12 +3989,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3649 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 3993 "smtlib-bison-parser.tab.c"
     break;
 
-  case 138:
-#line 1698 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 138: /* theory_attr_plus: theory_attr_plus theory_attr  */
+#line 1708 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3659,13 +4003,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3663 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4007 "smtlib-bison-parser.tab.c"
     break;
 
-  case 139:
-#line 1711 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newSortSymbolDeclaration((yyvsp[-3].ptr), (yyvsp[-2].ptr), (yyvsp[-1].list)); 
+  case 139: /* sort_symbol_decl: '(' identifier NUMERAL attribute_star ')'  */
+#line 1721 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newSortSymbolDeclaration(parser, (yyvsp[-3].ptr), (yyvsp[-2].ptr), (yyvsp[-1].list)); 
 
 			(yyloc).first_line = (yylsp[-4]).first_line;
             (yyloc).first_column = (yylsp[-4]).first_column;
@@ -3674,12 +4018,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3678 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4022 "smtlib-bison-parser.tab.c"
     break;
 
-  case 140:
-#line 1725 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 140: /* sort_symbol_decl_plus: sort_symbol_decl  */
+#line 1735 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate(); 
 			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
 
@@ -3688,12 +4032,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3692 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4036 "smtlib-bison-parser.tab.c"
     break;
 
-  case 141:
-#line 1736 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 141: /* sort_symbol_decl_plus: sort_symbol_decl_plus sort_symbol_decl  */
+#line 1746 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3702,13 +4046,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3706 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4050 "smtlib-bison-parser.tab.c"
     break;
 
-  case 143:
-#line 1751 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newParametricFunDeclaration((yyvsp[-7].list), (yyvsp[-4].ptr), (yyvsp[-3].list), (yyvsp[-2].list));
+  case 143: /* par_fun_symbol_decl: '(' KW_PAR '(' symbol_plus ')' '(' identifier sort_plus attribute_star ')' ')'  */
+#line 1761 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newParametricFunDeclaration(parser, (yyvsp[-7].list), (yyvsp[-4].ptr), (yyvsp[-3].list), (yyvsp[-2].list));
 
 			(yyloc).first_line = (yylsp[-10]).first_line;
             (yyloc).first_column = (yylsp[-10]).first_column;
@@ -3717,12 +4061,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3721 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4065 "smtlib-bison-parser.tab.c"
     break;
 
-  case 144:
-#line 1765 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 144: /* par_fun_symbol_decl_plus: par_fun_symbol_decl  */
+#line 1775 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate(); 
 			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
 
@@ -3731,12 +4075,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3735 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4079 "smtlib-bison-parser.tab.c"
     break;
 
-  case 145:
-#line 1776 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 145: /* par_fun_symbol_decl_plus: par_fun_symbol_decl_plus par_fun_symbol_decl  */
+#line 1786 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list);
 
@@ -3745,13 +4089,13 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column; 
 		}
-#line 3749 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4093 "smtlib-bison-parser.tab.c"
     break;
 
-  case 146:
-#line 1789 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newSpecConstFunDeclaration((yyvsp[-3].ptr), (yyvsp[-2].ptr), (yyvsp[-1].list)); 
+  case 146: /* fun_symbol_decl: '(' spec_const sort attribute_star ')'  */
+#line 1799 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newSpecConstFunDeclaration(parser, (yyvsp[-3].ptr), (yyvsp[-2].ptr), (yyvsp[-1].list)); 
 
 			(yyloc).first_line = (yylsp[-4]).first_line;
             (yyloc).first_column = (yylsp[-4]).first_column;
@@ -3760,13 +4104,13 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3764 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4108 "smtlib-bison-parser.tab.c"
     break;
 
-  case 147:
-#line 1801 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newMetaSpecConstFunDeclaration((yyvsp[-3].ptr), (yyvsp[-2].ptr), (yyvsp[-1].list)); 
+  case 147: /* fun_symbol_decl: '(' meta_spec_const sort attribute_star ')'  */
+#line 1811 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newMetaSpecConstFunDeclaration(parser, (yyvsp[-3].ptr), (yyvsp[-2].ptr), (yyvsp[-1].list)); 
 
 			(yyloc).first_line = (yylsp[-4]).first_line;
             (yyloc).first_column = (yylsp[-4]).first_column;
@@ -3775,13 +4119,13 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3779 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4123 "smtlib-bison-parser.tab.c"
     break;
 
-  case 148:
-#line 1813 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newSimpleFunDeclaration((yyvsp[-3].ptr), (yyvsp[-2].list), (yyvsp[-1].list));
+  case 148: /* fun_symbol_decl: '(' identifier sort_plus attribute_star ')'  */
+#line 1823 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newSimpleFunDeclaration(parser, (yyvsp[-3].ptr), (yyvsp[-2].list), (yyvsp[-1].list));
 
 			(yyloc).first_line = (yylsp[-4]).first_line;
             (yyloc).first_column = (yylsp[-4]).first_column;
@@ -3790,12 +4134,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3794 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4138 "smtlib-bison-parser.tab.c"
     break;
 
-  case 149:
-#line 1827 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 149: /* meta_spec_const: META_SPEC_NUMERAL  */
+#line 1837 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -3805,12 +4149,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3809 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4153 "smtlib-bison-parser.tab.c"
     break;
 
-  case 150:
-#line 1839 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 150: /* meta_spec_const: META_SPEC_DECIMAL  */
+#line 1849 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -3820,12 +4164,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3824 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4168 "smtlib-bison-parser.tab.c"
     break;
 
-  case 151:
-#line 1851 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 151: /* meta_spec_const: META_SPEC_STRING  */
+#line 1861 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -3835,13 +4179,13 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3839 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4183 "smtlib-bison-parser.tab.c"
     break;
 
-  case 152:
-#line 1865 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newLogic((yyvsp[-2].ptr), (yyvsp[-1].list)); 
+  case 152: /* logic: '(' LOGIC symbol logic_attr_plus ')'  */
+#line 1875 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newLogic(parser, (yyvsp[-2].ptr), (yyvsp[-1].list)); 
 
 			(yyloc).first_line = (yylsp[-4]).first_line;
             (yyloc).first_column = (yylsp[-4]).first_column;
@@ -3850,13 +4194,13 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3854 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4198 "smtlib-bison-parser.tab.c"
     break;
 
-  case 153:
-#line 1879 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
-			(yyval.ptr) = ast_newAttribute2((yyvsp[-3].ptr), ast_newCompAttributeValue((yyvsp[-1].list)));
+  case 153: /* logic_attr: KW_ATTR_THEORIES '(' symbol_star ')'  */
+#line 1889 "smtlib-bison-parser.y"
+                { 
+			(yyval.ptr) = ast_newAttribute2(parser, (yyvsp[-3].ptr), ast_newCompAttributeValue(parser, (yyvsp[-1].list)));
 
 			(yyloc).first_line = (yylsp[-3]).first_line;
             (yyloc).first_column = (yylsp[-3]).first_column;
@@ -3865,12 +4209,12 @@ yyreduce:
 
             ast_setLocation(parser, (yyval.ptr), (yyloc).first_line, (yyloc).first_column, (yyloc).last_line, (yyloc).last_column);
 		}
-#line 3869 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4213 "smtlib-bison-parser.tab.c"
     break;
 
-  case 154:
-#line 1891 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 154: /* logic_attr: attribute  */
+#line 1901 "smtlib-bison-parser.y"
+                { 
 			(yyval.ptr) = (yyvsp[0].ptr); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
@@ -3878,12 +4222,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3882 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4226 "smtlib-bison-parser.tab.c"
     break;
 
-  case 155:
-#line 1903 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 155: /* logic_attr_plus: logic_attr  */
+#line 1913 "smtlib-bison-parser.y"
+                { 
 			(yyval.list) = ast_listCreate(); 
 			ast_listAdd((yyval.list), (yyvsp[0].ptr)); 
 
@@ -3892,12 +4236,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3896 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4240 "smtlib-bison-parser.tab.c"
     break;
 
-  case 156:
-#line 1914 "smtlib-bison-parser.y" /* yacc.c:1661  */
-    { 
+  case 156: /* logic_attr_plus: logic_attr_plus logic_attr  */
+#line 1924 "smtlib-bison-parser.y"
+                { 
 			ast_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
@@ -3906,11 +4250,12 @@ yyreduce:
 			(yyloc).last_line = (yylsp[0]).last_line;
             (yyloc).last_column = (yylsp[0]).last_column;
 		}
-#line 3910 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4254 "smtlib-bison-parser.tab.c"
     break;
 
 
-#line 3914 "smtlib-bison-parser.tab.c" /* yacc.c:1661  */
+#line 4258 "smtlib-bison-parser.tab.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -3924,11 +4269,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
   *++yylsp = yyloc;
@@ -3936,14 +4280,13 @@ yyreduce:
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -3954,66 +4297,61 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == SMT_YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (parser, YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
       {
+        yypcontext_t yyctx
+          = {yyssp, yytoken, &yylloc};
         char const *yymsgp = YY_("syntax error");
         int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
         if (yysyntax_error_status == 0)
           yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
+        else if (yysyntax_error_status == -1)
           {
             if (yymsg != yymsgbuf)
               YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
               {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
               }
             else
               {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
               }
           }
-        yyerror (parser, yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
+        yyerror (&yylloc, parser, scanner, yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
       }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
   yyerror_range[1] = yylloc;
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
          error, discard it.  */
 
-      if (yychar <= YYEOF)
+      if (yychar <= SMT_YYEOF)
         {
           /* Return failure if at end of input.  */
-          if (yychar == YYEOF)
+          if (yychar == SMT_YYEOF)
             YYABORT;
         }
       else
         {
           yydestruct ("Error: discarding",
-                      yytoken, &yylval, &yylloc, parser);
-          yychar = YYEMPTY;
+                      yytoken, &yylval, &yylloc, parser, scanner);
+          yychar = SMT_YYEMPTY;
         }
     }
 
@@ -4026,14 +4364,12 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  yyerror_range[1] = yylsp[1-yylen];
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
@@ -4049,13 +4385,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -4069,7 +4406,7 @@ yyerrlab1:
 
       yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, yylsp, parser);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, parser, scanner);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -4080,13 +4417,11 @@ yyerrlab1:
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
   yyerror_range[2] = yylloc;
-  /* Using YYLLOC is tempting, but would change the location of
-     the lookahead.  YYLOC is available though.  */
-  YYLLOC_DEFAULT (yyloc, yyerror_range, 2);
-  *++yylsp = yyloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -4097,33 +4432,37 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (parser, YY_("memory exhausted"));
+  yyerror (&yylloc, parser, scanner, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
-  if (yychar != YYEMPTY)
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != SMT_YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval, &yylloc, parser);
+                  yytoken, &yylval, &yylloc, parser, scanner);
     }
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
@@ -4132,23 +4471,22 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp, yylsp, parser);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, parser, scanner);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
   if (yymsg != yymsgbuf)
     YYSTACK_FREE (yymsg);
-#endif
   return yyresult;
 }
-#line 1925 "smtlib-bison-parser.y" /* yacc.c:1906  */
+
+#line 1935 "smtlib-bison-parser.y"
 
 
-void yyerror(SmtPrsr parser, const char* s) {
-	ast_reportError(parser, yylloc.first_line, yylloc.first_column,
-					yylloc.last_line, yylloc.last_column, s);
+void yyerror(YYLTYPE* llocp, SmtPrsr parser, SmtScanner scanner, const char* s) {
+	ast_reportError(parser, llocp->first_line, llocp->first_column,
+					llocp->last_line, llocp->last_column, s);
 }
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -30,6 +31,10 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_SMT_YY_SMTLIB_BISON_PARSER_TAB_H_INCLUDED
 # define YY_SMT_YY_SMTLIB_BISON_PARSER_TAB_H_INCLUDED
 /* Debug traces.  */
@@ -48,82 +53,86 @@
 extern int smt_yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef SMT_YYTOKENTYPE
 # define SMT_YYTOKENTYPE
   enum smt_yytokentype
   {
-    KW_AS = 258,
-    KW_LET = 259,
-    KW_FORALL = 260,
-    KW_EXISTS = 261,
-    KW_MATCH = 262,
-    KW_PAR = 263,
-    NOT = 264,
-    NUMERAL = 265,
-    DECIMAL = 266,
-    HEXADECIMAL = 267,
-    BINARY = 268,
-    KW_ASSERT = 269,
-    KW_CHK_SAT = 270,
-    KW_CHK_UNSAT = 271,
-    KW_CHK_SAT_ASSUM = 272,
-    KW_DECL_CONST = 273,
-    KW_DECL_FUN = 274,
-    KW_DECL_SORT = 275,
-    KW_DECL_HEAP = 276,
-    KW_DEF_FUN = 277,
-    KW_DEF_FUN_REC = 278,
-    KW_DEF_FUNS_REC = 279,
-    KW_DEF_SORT = 280,
-    KW_ECHO = 281,
-    KW_EXIT = 282,
-    KW_GET_ASSERTS = 283,
-    KW_GET_ASSIGNS = 284,
-    KW_GET_INFO = 285,
-    KW_GET_MODEL = 286,
-    KW_GET_OPT = 287,
-    KW_GET_PROOF = 288,
-    KW_GET_UNSAT_ASSUMS = 289,
-    KW_GET_UNSAT_CORE = 290,
-    KW_GET_VALUE = 291,
-    KW_POP = 292,
-    KW_PUSH = 293,
-    KW_RESET = 294,
-    KW_RESET_ASSERTS = 295,
-    KW_SET_INFO = 296,
-    KW_SET_LOGIC = 297,
-    KW_SET_OPT = 298,
-    KW_DECL_DATATYPE = 299,
-    KW_DECL_DATATYPES = 300,
-    META_SPEC_DECIMAL = 301,
-    META_SPEC_NUMERAL = 302,
-    META_SPEC_STRING = 303,
-    KEYWORD = 304,
-    STRING = 305,
-    SYMBOL = 306,
-    THEORY = 307,
-    LOGIC = 308,
-    KW_ATTR_SORTS = 309,
-    KW_ATTR_FUNS = 310,
-    KW_ATTR_THEORIES = 311
+    SMT_YYEMPTY = -2,
+    SMT_YYEOF = 0,                 /* "end of file"  */
+    SMT_YYerror = 256,             /* error  */
+    SMT_YYUNDEF = 257,             /* "invalid token"  */
+    KW_AS = 258,                   /* KW_AS  */
+    KW_LET = 259,                  /* KW_LET  */
+    KW_FORALL = 260,               /* KW_FORALL  */
+    KW_EXISTS = 261,               /* KW_EXISTS  */
+    KW_MATCH = 262,                /* KW_MATCH  */
+    KW_PAR = 263,                  /* KW_PAR  */
+    NOT = 264,                     /* NOT  */
+    NUMERAL = 265,                 /* NUMERAL  */
+    DECIMAL = 266,                 /* DECIMAL  */
+    HEXADECIMAL = 267,             /* HEXADECIMAL  */
+    BINARY = 268,                  /* BINARY  */
+    KW_ASSERT = 269,               /* KW_ASSERT  */
+    KW_CHK_SAT = 270,              /* KW_CHK_SAT  */
+    KW_CHK_UNSAT = 271,            /* KW_CHK_UNSAT  */
+    KW_CHK_SAT_ASSUM = 272,        /* KW_CHK_SAT_ASSUM  */
+    KW_DECL_CONST = 273,           /* KW_DECL_CONST  */
+    KW_DECL_FUN = 274,             /* KW_DECL_FUN  */
+    KW_DECL_SORT = 275,            /* KW_DECL_SORT  */
+    KW_DECL_HEAP = 276,            /* KW_DECL_HEAP  */
+    KW_DEF_FUN = 277,              /* KW_DEF_FUN  */
+    KW_DEF_FUN_REC = 278,          /* KW_DEF_FUN_REC  */
+    KW_DEF_FUNS_REC = 279,         /* KW_DEF_FUNS_REC  */
+    KW_DEF_SORT = 280,             /* KW_DEF_SORT  */
+    KW_ECHO = 281,                 /* KW_ECHO  */
+    KW_EXIT = 282,                 /* KW_EXIT  */
+    KW_GET_ASSERTS = 283,          /* KW_GET_ASSERTS  */
+    KW_GET_ASSIGNS = 284,          /* KW_GET_ASSIGNS  */
+    KW_GET_INFO = 285,             /* KW_GET_INFO  */
+    KW_GET_MODEL = 286,            /* KW_GET_MODEL  */
+    KW_GET_OPT = 287,              /* KW_GET_OPT  */
+    KW_GET_PROOF = 288,            /* KW_GET_PROOF  */
+    KW_GET_UNSAT_ASSUMS = 289,     /* KW_GET_UNSAT_ASSUMS  */
+    KW_GET_UNSAT_CORE = 290,       /* KW_GET_UNSAT_CORE  */
+    KW_GET_VALUE = 291,            /* KW_GET_VALUE  */
+    KW_POP = 292,                  /* KW_POP  */
+    KW_PUSH = 293,                 /* KW_PUSH  */
+    KW_RESET = 294,                /* KW_RESET  */
+    KW_RESET_ASSERTS = 295,        /* KW_RESET_ASSERTS  */
+    KW_SET_INFO = 296,             /* KW_SET_INFO  */
+    KW_SET_LOGIC = 297,            /* KW_SET_LOGIC  */
+    KW_SET_OPT = 298,              /* KW_SET_OPT  */
+    KW_DECL_DATATYPE = 299,        /* KW_DECL_DATATYPE  */
+    KW_DECL_DATATYPES = 300,       /* KW_DECL_DATATYPES  */
+    META_SPEC_DECIMAL = 301,       /* META_SPEC_DECIMAL  */
+    META_SPEC_NUMERAL = 302,       /* META_SPEC_NUMERAL  */
+    META_SPEC_STRING = 303,        /* META_SPEC_STRING  */
+    KEYWORD = 304,                 /* KEYWORD  */
+    STRING = 305,                  /* STRING  */
+    SYMBOL = 306,                  /* SYMBOL  */
+    THEORY = 307,                  /* THEORY  */
+    LOGIC = 308,                   /* LOGIC  */
+    KW_ATTR_SORTS = 309,           /* KW_ATTR_SORTS  */
+    KW_ATTR_FUNS = 310,            /* KW_ATTR_FUNS  */
+    KW_ATTR_THEORIES = 311         /* KW_ATTR_THEORIES  */
   };
+  typedef enum smt_yytokentype smt_yytoken_kind_t;
 #endif
 
 /* Value type.  */
 #if ! defined SMT_YYSTYPE && ! defined SMT_YYSTYPE_IS_DECLARED
-
 union SMT_YYSTYPE
 {
-#line 20 "smtlib-bison-parser.y" /* yacc.c:1915  */
+#line 27 "smtlib-bison-parser.y"
 
 	AstPtr ptr;
 	AstList list;
 	AstPairList pairList;
 
-#line 125 "smtlib-bison-parser.tab.h" /* yacc.c:1915  */
-};
+#line 134 "smtlib-bison-parser.tab.h"
 
+};
 typedef union SMT_YYSTYPE SMT_YYSTYPE;
 # define SMT_YYSTYPE_IS_TRIVIAL 1
 # define SMT_YYSTYPE_IS_DECLARED 1
@@ -144,8 +153,9 @@ struct SMT_YYLTYPE
 #endif
 
 
-extern SMT_YYSTYPE smt_yylval;
-extern SMT_YYLTYPE smt_yylloc;
-int smt_yyparse (SmtPrsr parser);
+
+
+int smt_yyparse (SmtPrsr parser, SmtScanner scanner);
+
 
 #endif /* !YY_SMT_YY_SMTLIB_BISON_PARSER_TAB_H_INCLUDED  */
@@ -7,19 +7,40 @@
 
 #define yy_create_buffer smt_yy_create_buffer
 #define yy_delete_buffer smt_yy_delete_buffer
-#define yy_flex_debug smt_yy_flex_debug
+#define yy_scan_buffer smt_yy_scan_buffer
+#define yy_scan_string smt_yy_scan_string
+#define yy_scan_bytes smt_yy_scan_bytes
 #define yy_init_buffer smt_yy_init_buffer
 #define yy_flush_buffer smt_yy_flush_buffer
 #define yy_load_buffer_state smt_yy_load_buffer_state
 #define yy_switch_to_buffer smt_yy_switch_to_buffer
-#define yyin smt_yyin
-#define yyleng smt_yyleng
+#define yypush_buffer_state smt_yypush_buffer_state
+#define yypop_buffer_state smt_yypop_buffer_state
+#define yyensure_buffer_stack smt_yyensure_buffer_stack
 #define yylex smt_yylex
-#define yylineno smt_yylineno
-#define yyout smt_yyout
 #define yyrestart smt_yyrestart
-#define yytext smt_yytext
+#define yylex_init smt_yylex_init
+#define yylex_init_extra smt_yylex_init_extra
+#define yylex_destroy smt_yylex_destroy
+#define yyget_debug smt_yyget_debug
+#define yyset_debug smt_yyset_debug
+#define yyget_extra smt_yyget_extra
+#define yyset_extra smt_yyset_extra
+#define yyget_in smt_yyget_in
+#define yyset_in smt_yyset_in
+#define yyget_out smt_yyget_out
+#define yyset_out smt_yyset_out
+#define yyget_leng smt_yyget_leng
+#define yyget_text smt_yyget_text
+#define yyget_lineno smt_yyget_lineno
+#define yyset_lineno smt_yyset_lineno
+#define yyget_column smt_yyget_column
+#define yyset_column smt_yyset_column
 #define yywrap smt_yywrap
+#define yyget_lval smt_yyget_lval
+#define yyset_lval smt_yyset_lval
+#define yyget_lloc smt_yyget_lloc
+#define yyset_lloc smt_yyset_lloc
 #define yyalloc smt_yyalloc
 #define yyrealloc smt_yyrealloc
 #define yyfree smt_yyfree
@@ -137,24 +158,41 @@ typedef unsigned int flex_uint32_t;
  */
 #define YY_SC_TO_UI(c) ((unsigned int) (unsigned char) c)
 
+/* An opaque pointer. */
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void* yyscan_t;
+#endif
+
+/* For convenience, these vars (plus the bison vars far below)
+   are macros in the reentrant scanner. */
+#define yyin yyg->yyin_r
+#define yyout yyg->yyout_r
+#define yyextra yyg->yyextra_r
+#define yyleng yyg->yyleng_r
+#define yytext yyg->yytext_r
+#define yylineno (YY_CURRENT_BUFFER_LVALUE->yy_bs_lineno)
+#define yycolumn (YY_CURRENT_BUFFER_LVALUE->yy_bs_column)
+#define yy_flex_debug yyg->yy_flex_debug_r
+
 /* Enter a start condition.  This macro really ought to take a parameter,
  * but we do it the disgusting crufty way forced on us by the ()-less
  * definition of BEGIN.
  */
-#define BEGIN (yy_start) = 1 + 2 *
+#define BEGIN yyg->yy_start = 1 + 2 *
 
 /* Translate the current start state into a value that can be later handed
  * to BEGIN to return to the state.  The YYSTATE alias is for lex
  * compatibility.
  */
-#define YY_START (((yy_start) - 1) / 2)
+#define YY_START ((yyg->yy_start - 1) / 2)
 #define YYSTATE YY_START
 
 /* Action number for EOF rule of a given start state. */
 #define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
 
 /* Special action meaning "start processing a new file". */
-#define YY_NEW_FILE smt_yyrestart(smt_yyin  )
+#define YY_NEW_FILE smt_yyrestart(yyin ,yyscanner )
 
 #define YY_END_OF_BUFFER_CHAR 0
 
@@ -177,10 +215,6 @@ typedef struct yy_buffer_state *YY_BUFFER_STATE;
 typedef size_t yy_size_t;
 #endif
 
-extern yy_size_t smt_yyleng;
-
-extern FILE *smt_yyin, *smt_yyout;
-
 #define EOB_ACT_CONTINUE_SCAN 0
 #define EOB_ACT_END_OF_FILE 1
 #define EOB_ACT_LAST_MATCH 2
@@ -189,32 +223,32 @@ extern FILE *smt_yyin, *smt_yyout;
      *       access to the local variable yy_act. Since yyless() is a macro, it would break
      *       existing scanners that call yyless() from OUTSIDE smt_yylex. 
      *       One obvious solution it to make yy_act a global. I tried that, and saw
-     *       a 5% performance hit in a non-smt_yylineno scanner, because yy_act is
+     *       a 5% performance hit in a non-yylineno scanner, because yy_act is
      *       normally declared as a register variable-- so it is not worth it.
      */
     #define  YY_LESS_LINENO(n) \
             do { \
                 yy_size_t yyl;\
-                for ( yyl = n; yyl < smt_yyleng; ++yyl )\
-                    if ( smt_yytext[yyl] == '\n' )\
-                        --smt_yylineno;\
+                for ( yyl = n; yyl < yyleng; ++yyl )\
+                    if ( yytext[yyl] == '\n' )\
+                        --yylineno;\
             }while(0)
     
 /* Return all but the first "n" matched characters back to the input stream. */
 #define yyless(n) \
 	do \
 		{ \
-		/* Undo effects of setting up smt_yytext. */ \
+		/* Undo effects of setting up yytext. */ \
         int yyless_macro_arg = (n); \
         YY_LESS_LINENO(yyless_macro_arg);\
-		*yy_cp = (yy_hold_char); \
+		*yy_cp = yyg->yy_hold_char; \
 		YY_RESTORE_YY_MORE_OFFSET \
-		(yy_c_buf_p) = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
-		YY_DO_BEFORE_ACTION; /* set up smt_yytext again */ \
+		yyg->yy_c_buf_p = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
+		YY_DO_BEFORE_ACTION; /* set up yytext again */ \
 		} \
 	while ( 0 )
 
-#define unput(c) yyunput( c, (yytext_ptr)  )
+#define unput(c) yyunput( c, yyg->yytext_ptr  ,yyscanner)
 
 #ifndef YY_STRUCT_YY_BUFFER_STATE
 #define YY_STRUCT_YY_BUFFER_STATE
@@ -274,78 +308,58 @@ struct yy_buffer_state
 	 *
 	 * When we actually see the EOF, we change the status to "new"
 	 * (via smt_yyrestart()), so that the user can continue scanning by
-	 * just pointing smt_yyin at a new input file.
+	 * just pointing yyin at a new input file.
 	 */
 #define YY_BUFFER_EOF_PENDING 2
 
 	};
 #endif /* !YY_STRUCT_YY_BUFFER_STATE */
 
-/* Stack of input buffers. */
-static size_t yy_buffer_stack_top = 0; /**< index of top of stack. */
-static size_t yy_buffer_stack_max = 0; /**< capacity of stack. */
-static YY_BUFFER_STATE * yy_buffer_stack = 0; /**< Stack as an array. */
-
 /* We provide macros for accessing buffer states in case in the
  * future we want to put the buffer states in a more general
  * "scanner state".
  *
  * Returns the top of the stack, or NULL.
  */
-#define YY_CURRENT_BUFFER ( (yy_buffer_stack) \
-                          ? (yy_buffer_stack)[(yy_buffer_stack_top)] \
+#define YY_CURRENT_BUFFER ( yyg->yy_buffer_stack \
+                          ? yyg->yy_buffer_stack[yyg->yy_buffer_stack_top] \
                           : NULL)
 
 /* Same as previous macro, but useful when we know that the buffer stack is not
  * NULL or when we need an lvalue. For internal use only.
  */
-#define YY_CURRENT_BUFFER_LVALUE (yy_buffer_stack)[(yy_buffer_stack_top)]
-
-/* yy_hold_char holds the character lost when smt_yytext is formed. */
-static char yy_hold_char;
-static yy_size_t yy_n_chars;		/* number of characters read into yy_ch_buf */
-yy_size_t smt_yyleng;
-
-/* Points to current character in buffer. */
-static char *yy_c_buf_p = (char *) 0;
-static int yy_init = 0;		/* whether we need to initialize */
-static int yy_start = 0;	/* start state number */
-
-/* Flag which is used to allow smt_yywrap()'s to do buffer switches
- * instead of setting up a fresh smt_yyin.  A bit of a hack ...
- */
-static int yy_did_buffer_switch_on_eof;
+#define YY_CURRENT_BUFFER_LVALUE yyg->yy_buffer_stack[yyg->yy_buffer_stack_top]
 
-void smt_yyrestart (FILE *input_file  );
-void smt_yy_switch_to_buffer (YY_BUFFER_STATE new_buffer  );
-YY_BUFFER_STATE smt_yy_create_buffer (FILE *file,int size  );
-void smt_yy_delete_buffer (YY_BUFFER_STATE b  );
-void smt_yy_flush_buffer (YY_BUFFER_STATE b  );
-void smt_yypush_buffer_state (YY_BUFFER_STATE new_buffer  );
-void smt_yypop_buffer_state (void );
+void smt_yyrestart (FILE *input_file  , yyscan_t yyscanner);
+void smt_yy_switch_to_buffer (YY_BUFFER_STATE new_buffer  , yyscan_t yyscanner);
+YY_BUFFER_STATE smt_yy_create_buffer (FILE *file,int size  , yyscan_t yyscanner);
+void smt_yy_delete_buffer (YY_BUFFER_STATE b  , yyscan_t yyscanner);
+void smt_yy_flush_buffer (YY_BUFFER_STATE b  , yyscan_t yyscanner);
+void smt_yypush_buffer_state (YY_BUFFER_STATE new_buffer  , yyscan_t yyscanner);
+void smt_yypop_buffer_state (yyscan_t yyscanner);
 
-static void smt_yyensure_buffer_stack (void );
-static void smt_yy_load_buffer_state (void );
-static void smt_yy_init_buffer (YY_BUFFER_STATE b,FILE *file  );
+static void smt_yyensure_buffer_stack (yyscan_t yyscanner);
+static void smt_yy_load_buffer_state (yyscan_t yyscanner);
+static void smt_yy_init_buffer (YY_BUFFER_STATE b,FILE *file  , yyscan_t yyscanner);
 
-#define YY_FLUSH_BUFFER smt_yy_flush_buffer(YY_CURRENT_BUFFER )
+#define YY_FLUSH_BUFFER smt_yy_flush_buffer(YY_CURRENT_BUFFER ,yyscanner)
 
-YY_BUFFER_STATE smt_yy_scan_buffer (char *base,yy_size_t size  );
-YY_BUFFER_STATE smt_yy_scan_string (yyconst char *yy_str  );
-YY_BUFFER_STATE smt_yy_scan_bytes (yyconst char *bytes,yy_size_t len  );
+YY_BUFFER_STATE smt_yy_scan_buffer (char *base,yy_size_t size  , yyscan_t yyscanner);
+YY_BUFFER_STATE smt_yy_scan_string (yyconst char *yy_str  , yyscan_t yyscanner);
+YY_BUFFER_STATE smt_yy_scan_bytes (yyconst char *bytes,yy_size_t len  , yyscan_t yyscanner);
 
-void *smt_yyalloc (yy_size_t  );
-void *smt_yyrealloc (void *,yy_size_t  );
-void smt_yyfree (void *  );
+void *smt_yyalloc (yy_size_t  , yyscan_t yyscanner);
+void *smt_yyrealloc (void *,yy_size_t  , yyscan_t yyscanner);
+void smt_yyfree (void *  , yyscan_t yyscanner);
 
 #define yy_new_buffer smt_yy_create_buffer
 
 #define yy_set_interactive(is_interactive) \
 	{ \
 	if ( ! YY_CURRENT_BUFFER ){ \
-        smt_yyensure_buffer_stack (); \
+        smt_yyensure_buffer_stack (yyscanner); \
 		YY_CURRENT_BUFFER_LVALUE =    \
-            smt_yy_create_buffer(smt_yyin,YY_BUF_SIZE ); \
+            smt_yy_create_buffer(yyin,YY_BUF_SIZE ,yyscanner); \
 	} \
 	YY_CURRENT_BUFFER_LVALUE->yy_is_interactive = is_interactive; \
 	}
@@ -353,9 +367,9 @@ void smt_yyfree (void *  );
 #define yy_set_bol(at_bol) \
 	{ \
 	if ( ! YY_CURRENT_BUFFER ){\
-        smt_yyensure_buffer_stack (); \
+        smt_yyensure_buffer_stack (yyscanner); \
 		YY_CURRENT_BUFFER_LVALUE =    \
-            smt_yy_create_buffer(smt_yyin,YY_BUF_SIZE ); \
+            smt_yy_create_buffer(yyin,YY_BUF_SIZE ,yyscanner); \
 	} \
 	YY_CURRENT_BUFFER_LVALUE->yy_at_bol = at_bol; \
 	}
@@ -367,32 +381,25 @@ void smt_yyfree (void *  );
 
 typedef unsigned char YY_CHAR;
 
-FILE *smt_yyin = (FILE *) 0, *smt_yyout = (FILE *) 0;
-
 typedef int yy_state_type;
 
-extern int smt_yylineno;
-
-int smt_yylineno = 1;
-
-extern char *smt_yytext;
-#define yytext_ptr smt_yytext
+#define yytext_ptr yytext_r
 
-static yy_state_type yy_get_previous_state (void );
-static yy_state_type yy_try_NUL_trans (yy_state_type current_state  );
-static int yy_get_next_buffer (void );
-static void yy_fatal_error (yyconst char msg[]  );
+static yy_state_type yy_get_previous_state (yyscan_t yyscanner);
+static yy_state_type yy_try_NUL_trans (yy_state_type current_state  , yyscan_t yyscanner);
+static int yy_get_next_buffer (yyscan_t yyscanner);
+static void yy_fatal_error (yyconst char msg[]  , yyscan_t yyscanner);
 
 /* Done after the current pattern has been matched and before the
- * corresponding action - sets up smt_yytext.
+ * corresponding action - sets up yytext.
  */
 #define YY_DO_BEFORE_ACTION \
-	(yytext_ptr) = yy_bp; \
-	(yytext_ptr) -= (yy_more_len); \
-	smt_yyleng = (yy_size_t) (yy_cp - (yytext_ptr)); \
-	(yy_hold_char) = *yy_cp; \
+	yyg->yytext_ptr = yy_bp; \
+	yyg->yytext_ptr -= yyg->yy_more_len; \
+	yyleng = (yy_size_t) (yy_cp - yyg->yytext_ptr); \
+	yyg->yy_hold_char = *yy_cp; \
 	*yy_cp = '\0'; \
-	(yy_c_buf_p) = yy_cp;
+	yyg->yy_c_buf_p = yy_cp;
 
 #define YY_NUM_RULES 71
 #define YY_END_OF_BUFFER 72
@@ -680,22 +687,13 @@ static yyconst flex_int32_t yy_rule_can_match_eol[72] =
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0,     };
 
-static yy_state_type yy_last_accepting_state;
-static char *yy_last_accepting_cpos;
-
-extern int smt_yy_flex_debug;
-int smt_yy_flex_debug = 0;
-
 /* The intent behind this definition is that it'll catch
  * any uses of REJECT which flex missed.
  */
 #define REJECT reject_used_but_not_detected
-static int yy_more_flag = 0;
-static int yy_more_len = 0;
-#define yymore() ((yy_more_flag) = 1)
-#define YY_MORE_ADJ (yy_more_len)
+#define yymore() (yyg->yy_more_flag = 1)
+#define YY_MORE_ADJ yyg->yy_more_len
 #define YY_RESTORE_YY_MORE_OFFSET
-char *smt_yytext;
 #line 1 "smtlib-flex-lexer.l"
 #line 2 "smtlib-flex-lexer.l"
 #include <stdlib.h>
@@ -704,25 +702,194 @@ char *smt_yytext;
 #include "smtlib-glue.h" 
 #include "smtlib-bison-parser.y.h"
 
-int smt_yycolumn = 1;
-#define UPDATE_COLUMN(n) smt_yycolumn += n;
+#define YYSTYPE SMT_YYSTYPE
+#define YYLTYPE SMT_YYLTYPE
+
+/* Characters not matched by any rule are printed through the logger, like the rest of the output */
+#define ECHO ast_echo(yytext, yyleng)
+
+/* yycolumn is kept per scanner, counting from 0 */
+#define UPDATE_COLUMN(n) yycolumn += n;
+
+#define RESET_COLUMN yycolumn = 0;
+
+#define SET_LOCATION yylloc->first_line = yylloc->last_line = yylineno; \
+yylloc->first_column = yycolumn + 1; yylloc->last_column = yycolumn + yyleng; \
+UPDATE_COLUMN(yyleng);
+
+#define SET_LEFT yylloc->first_line = yylineno; \
+yylloc->first_column = yycolumn + 1; \
+UPDATE_COLUMN(yyleng);
+
+#define SET_RIGHT yylloc->last_line = yylineno; \
+yylloc->last_column = yycolumn + yyleng; \
+UPDATE_COLUMN(yyleng);
+
+/*
+ * The fast paths below scan the current buffer directly, past the text matched by a rule.
+ * They only consume tokens which end before the last character loaded into the buffer,
+ * and otherwise leave the input to the rules, so reading the input in chunks still works.
+ */
+
+/* End of the characters loaded into the current buffer */
+#define BUFFER_END (YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + yyg->yy_n_chars)
+
+/* Put back the character after the matched text, which flex replaces with a NUL */
+#define RESTORE_INPUT *yyg->yy_c_buf_p = yyg->yy_hold_char;
+
+/* Continue scanning at p, a position in the current buffer */
+#define RESUME_AT(p) yyg->yy_hold_char = *(p); *(p) = '\0'; yyg->yy_c_buf_p = (p);
+
+#define SKIP_BLANK { \
+char* next; \
+RESTORE_INPUT; \
+next = skipBlank(yyg->yy_c_buf_p, BUFFER_END, &yylineno, &yycolumn, yylloc); \
+RESUME_AT(next); }
+
+#define IS_WHITESPACE(c) ((c) == ' ' || (c) == '\t' || (unsigned char) (c) == 0xA0)
+#define IS_NEWLINE(c) ((c) == '\n' || (c) == '\r')
+
+/* Count the line feeds in [p, end) */
+static int countLines(const char* p, const char* end) {
+	int lines = 0;
+	while ((p = (const char*) memchr(p, '\n', end - p))) {
+		lines++;
+		p++;
+	}
+	return lines;
+}
+
+/*
+ * Skip the whitespace, line breaks and comments starting at p.
+ * Lines, columns and the location of the last token skipped
+ * are updated exactly as the rules for these tokens would.
+ * Returns the position of the first character that was not skipped.
+ */
+static char* skipBlank(char* p, char* end, int* line, int* column, YYLTYPE* loc) {
+	while (p < end) {
+		char* next;
+
+		if (IS_WHITESPACE(*p)) {
+			/* Every whitespace character is a token of its own */
+			next = p + 1;
+			while (next < end && IS_WHITESPACE(*next))
+				next++;
+
+			*column += next - p;
+			loc->first_line = loc->last_line = *line;
+			loc->first_column = loc->last_column = *column;
+			p = next;
+			continue;
+		}
+
+		if (IS_NEWLINE(*p)) {
+			next = p + 1;
+		} else if (*p == ';') {
+			next = (char*) memchr(p, '\n', end - p);
+			if (!next)
+				break;
+		} else {
+			break;
+		}
+
+		while (next < end && IS_NEWLINE(*next))
+			next++;
 
-#define RESET_COLUMN smt_yycolumn = 1;
+		/* The token might go on in the next chunk of input */
+		if (next == end)
+			break;
 
-#define SET_LOCATION smt_yylloc.first_line = smt_yylloc.last_line = smt_yylineno; \
-smt_yylloc.first_column = smt_yycolumn; smt_yylloc.last_column = smt_yycolumn + smt_yyleng - 1; \
-UPDATE_COLUMN(smt_yyleng);
+		*line += countLines(p, next);
+		loc->first_line = loc->last_line = *line;
+		loc->first_column = *column + 1;
+		loc->last_column = *column + (int) (next - p);
+		*column = 0;
+		p = next;
+	}
 
-#define SET_LEFT smt_yylloc.first_line = smt_yylineno; \
-smt_yylloc.first_column = smt_yycolumn; \
-UPDATE_COLUMN(smt_yyleng);
+	return p;
+}
 
-#define SET_RIGHT smt_yylloc.last_line = smt_yylineno; \
-smt_yylloc.last_column = smt_yycolumn + smt_yyleng - 1; \
-UPDATE_COLUMN(smt_yyleng);
+/*
+ * Scan the rest of a string literal, starting after its opening quote,
+ * following the <string> rules for lines and columns.
+ * Returns the position after the closing quote,
+ * or NULL if the literal does not end in the current buffer.
+ */
+static char* scanString(char* p, char* end, int* line, int* column) {
+	int lines = *line, columns = *column;
+
+	while (1) {
+		size_t span = strcspn(p, "\"\n\r");
+		p += span;
+		columns += (int) span;
+
+		if (p >= end) {
+			return NULL;
+		} else if (*p == '"') {
+			if (p + 1 == end)
+				return NULL;
+			if (p[1] != '"')
+				break;
+			/* Escaped quote */
+			p += 2;
+			columns += 2;
+		} else if (*p == '\0') {
+			return NULL;
+		} else {
+			char* next = p + 1;
+			while (next < end && IS_NEWLINE(*next))
+				next++;
+			lines += countLines(p, next);
+			columns = 0;
+			p = next;
+		}
+	}
 
+	*line = lines;
+	*column = columns;
+	return p + 1;
+}
 
-#line 726 "lex.smt_yy.c"
+/*
+ * Scan the rest of a quoted symbol, starting after its opening bar,
+ * following the <quoted> rules for lines, columns and the text of the symbol.
+ * Returns the position after the closing bar,
+ * or NULL if the symbol does not end in the current buffer.
+ */
+static char* scanQuoted(char* p, char* end, char** text, int* line, int* column) {
+	char* start = *text;
+	int lines = *line, columns = *column;
+
+	while (1) {
+		size_t span = strcspn(p, "|\\\n\r");
+		p += span;
+		columns += (int) span;
+
+		if (p >= end || *p == '\0') {
+			return NULL;
+		} else if (*p == '|') {
+			break;
+		} else if (*p == '\\') {
+			/* The text of the symbol restarts after a backslash */
+			p++;
+			start = p;
+		} else {
+			char* next = p + 1;
+			while (next < end && IS_NEWLINE(*next))
+				next++;
+			lines += countLines(p, next);
+			columns = 0;
+			p = next;
+		}
+	}
+
+	*text = start;
+	*line = lines;
+	*column = columns;
+	return p + 1;
+}
+#line 893 "lex.smt_yy.c"
 
 #define INITIAL 0
 #define string 1
@@ -736,40 +903,98 @@ UPDATE_COLUMN(smt_yyleng);
 #include <unistd.h>
 #endif
 
-#ifndef YY_EXTRA_TYPE
-#define YY_EXTRA_TYPE void *
-#endif
+#define YY_EXTRA_TYPE SmtPrsr
+
+/* Holds the entire state of the reentrant scanner. */
+struct yyguts_t
+    {
+
+    /* User-defined. Not touched by flex. */
+    YY_EXTRA_TYPE yyextra_r;
 
-static int yy_init_globals (void );
+    /* The rest are the same as the globals declared in the non-reentrant scanner. */
+    FILE *yyin_r, *yyout_r;
+    size_t yy_buffer_stack_top; /**< index of top of stack. */
+    size_t yy_buffer_stack_max; /**< capacity of stack. */
+    YY_BUFFER_STATE * yy_buffer_stack; /**< Stack as an array. */
+    char yy_hold_char;
+    yy_size_t yy_n_chars;
+    yy_size_t yyleng_r;
+    char *yy_c_buf_p;
+    int yy_init;
+    int yy_start;
+    int yy_did_buffer_switch_on_eof;
+    int yy_start_stack_ptr;
+    int yy_start_stack_depth;
+    int *yy_start_stack;
+    yy_state_type yy_last_accepting_state;
+    char* yy_last_accepting_cpos;
+
+    int yylineno_r;
+    int yy_flex_debug_r;
+
+    char *yytext_r;
+    int yy_more_flag;
+    int yy_more_len;
+
+    YYSTYPE * yylval_r;
+
+    YYLTYPE * yylloc_r;
+
+    }; /* end struct yyguts_t */
+
+static int yy_init_globals (yyscan_t yyscanner );
+
+    /* This must go here because YYSTYPE and YYLTYPE are included
+     * from bison output in section 1.*/
+    #    define yylval yyg->yylval_r
+    
+    #    define yylloc yyg->yylloc_r
+    
+int smt_yylex_init (yyscan_t* scanner);
+
+int smt_yylex_init_extra (YY_EXTRA_TYPE user_defined,yyscan_t* scanner);
 
 /* Accessor methods to globals.
    These are made visible to non-reentrant scanners for convenience. */
 
-int smt_yylex_destroy (void );
+int smt_yylex_destroy (yyscan_t yyscanner);
 
-int smt_yyget_debug (void );
+int smt_yyget_debug (yyscan_t yyscanner);
 
-void smt_yyset_debug (int debug_flag  );
+void smt_yyset_debug (int debug_flag  , yyscan_t yyscanner);
 
-YY_EXTRA_TYPE smt_yyget_extra (void );
+YY_EXTRA_TYPE smt_yyget_extra (yyscan_t yyscanner);
 
-void smt_yyset_extra (YY_EXTRA_TYPE user_defined  );
+void smt_yyset_extra (YY_EXTRA_TYPE user_defined  , yyscan_t yyscanner);
 
-FILE *smt_yyget_in (void );
+FILE *smt_yyget_in (yyscan_t yyscanner);
 
-void smt_yyset_in  (FILE * in_str  );
+void smt_yyset_in  (FILE * in_str  , yyscan_t yyscanner);
 
-FILE *smt_yyget_out (void );
+FILE *smt_yyget_out (yyscan_t yyscanner);
 
-void smt_yyset_out  (FILE * out_str  );
+void smt_yyset_out  (FILE * out_str  , yyscan_t yyscanner);
 
-yy_size_t smt_yyget_leng (void );
+yy_size_t smt_yyget_leng (yyscan_t yyscanner);
 
-char *smt_yyget_text (void );
+char *smt_yyget_text (yyscan_t yyscanner);
 
-int smt_yyget_lineno (void );
+int smt_yyget_lineno (yyscan_t yyscanner);
 
-void smt_yyset_lineno (int line_number  );
+void smt_yyset_lineno (int line_number  , yyscan_t yyscanner);
+
+int smt_yyget_column  (yyscan_t yyscanner);
+
+void smt_yyset_column (int column_no , yyscan_t yyscanner);
+
+YYSTYPE * smt_yyget_lval (yyscan_t yyscanner);
+
+void smt_yyset_lval (YYSTYPE * yylval_param , yyscan_t yyscanner);
+
+       YYLTYPE *smt_yyget_lloc (yyscan_t yyscanner);
+    
+        void smt_yyset_lloc (YYLTYPE * yylloc_param , yyscan_t yyscanner);
 
 /* Macros after this point can all be overridden by user definitions in
  * section 1.
@@ -777,13 +1002,13 @@ void smt_yyset_lineno (int line_number  );
 
 #ifndef YY_SKIP_YYWRAP
 #ifdef __cplusplus
-extern "C" int smt_yywrap (void );
+extern "C" int smt_yywrap (yyscan_t yyscanner);
 #else
-extern int smt_yywrap (void );
+extern int smt_yywrap (yyscan_t yyscanner);
 #endif
 #endif
 
-    static void yyunput (int c,char *buf_ptr  );
+    static void yyunput (int c,char *buf_ptr  , yyscan_t yyscanner);
     
 #ifndef yytext_ptr
 static void yy_flex_strncpy (char *,yyconst char *,int );
@@ -796,9 +1021,9 @@ static int yy_flex_strlen (yyconst char * );
 #ifndef YY_NO_INPUT
 
 #ifdef __cplusplus
-static int yyinput (void );
+static int yyinput (yyscan_t yyscanner);
 #else
-static int input (void );
+static int input (yyscan_t yyscanner);
 #endif
 
 #endif
@@ -813,7 +1038,7 @@ static int input (void );
 /* This used to be an fputs(), but since the string might contain NUL's,
  * we now use fwrite().
  */
-#define ECHO fwrite( smt_yytext, smt_yyleng, 1, smt_yyout )
+#define ECHO fwrite( yytext, yyleng, 1, yyout )
 #endif
 
 /* Gets input and stuffs it into "buf".  number of characters read, or YY_NULL,
@@ -826,18 +1051,18 @@ static int input (void );
 		int c = '*'; \
 		yy_size_t n; \
 		for ( n = 0; n < max_size && \
-			     (c = getc( smt_yyin )) != EOF && c != '\n'; ++n ) \
+			     (c = getc( yyin )) != EOF && c != '\n'; ++n ) \
 			buf[n] = (char) c; \
 		if ( c == '\n' ) \
 			buf[n++] = (char) c; \
-		if ( c == EOF && ferror( smt_yyin ) ) \
+		if ( c == EOF && ferror( yyin ) ) \
 			YY_FATAL_ERROR( "input in flex scanner failed" ); \
 		result = n; \
 		} \
 	else \
 		{ \
 		errno=0; \
-		while ( (result = fread(buf, 1, max_size, smt_yyin))==0 && ferror(smt_yyin)) \
+		while ( (result = fread(buf, 1, max_size, yyin))==0 && ferror(yyin)) \
 			{ \
 			if( errno != EINTR) \
 				{ \
@@ -845,7 +1070,7 @@ static int input (void );
 				break; \
 				} \
 			errno=0; \
-			clearerr(smt_yyin); \
+			clearerr(yyin); \
 			} \
 		}\
 \
@@ -867,7 +1092,7 @@ static int input (void );
 
 /* Report a fatal error. */
 #ifndef YY_FATAL_ERROR
-#define YY_FATAL_ERROR(msg) yy_fatal_error( msg )
+#define YY_FATAL_ERROR(msg) yy_fatal_error( msg ,yyscanner)
 #endif
 
 /* end tables serialization structures and prototypes */
@@ -878,12 +1103,14 @@ static int input (void );
 #ifndef YY_DECL
 #define YY_DECL_IS_OURS 1
 
-extern int smt_yylex (void);
+extern int smt_yylex \
+               (YYSTYPE * yylval_param,YYLTYPE * yylloc_param ,yyscan_t yyscanner);
 
-#define YY_DECL int smt_yylex (void)
+#define YY_DECL int smt_yylex \
+               (YYSTYPE * yylval_param, YYLTYPE * yylloc_param , yyscan_t yyscanner)
 #endif /* !YY_DECL */
 
-/* Code executed at the beginning of each rule, after smt_yytext and smt_yyleng
+/* Code executed at the beginning of each rule, after yytext and yyleng
  * have been set up.
  */
 #ifndef YY_USER_ACTION
@@ -905,65 +1132,70 @@ YY_DECL
 	register yy_state_type yy_current_state;
 	register char *yy_cp, *yy_bp;
 	register int yy_act;
-    
-#line 49 "smtlib-flex-lexer.l"
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+#line 225 "smtlib-flex-lexer.l"
+
 
+#line 1141 "lex.smt_yy.c"
 
-#line 913 "lex.smt_yy.c"
+    yylval = yylval_param;
 
-	if ( !(yy_init) )
+    yylloc = yylloc_param;
+
+	if ( !yyg->yy_init )
 		{
-		(yy_init) = 1;
+		yyg->yy_init = 1;
 
 #ifdef YY_USER_INIT
 		YY_USER_INIT;
 #endif
 
-		if ( ! (yy_start) )
-			(yy_start) = 1;	/* first start state */
+		if ( ! yyg->yy_start )
+			yyg->yy_start = 1;	/* first start state */
 
-		if ( ! smt_yyin )
-			smt_yyin = stdin;
+		if ( ! yyin )
+			yyin = stdin;
 
-		if ( ! smt_yyout )
-			smt_yyout = stdout;
+		if ( ! yyout )
+			yyout = stdout;
 
 		if ( ! YY_CURRENT_BUFFER ) {
-			smt_yyensure_buffer_stack ();
+			smt_yyensure_buffer_stack (yyscanner);
 			YY_CURRENT_BUFFER_LVALUE =
-				smt_yy_create_buffer(smt_yyin,YY_BUF_SIZE );
+				smt_yy_create_buffer(yyin,YY_BUF_SIZE ,yyscanner);
 		}
 
-		smt_yy_load_buffer_state( );
+		smt_yy_load_buffer_state( yyscanner);
 		}
 
 	while ( 1 )		/* loops until end-of-file is reached */
 		{
-		(yy_more_len) = 0;
-		if ( (yy_more_flag) )
+		yyg->yy_more_len = 0;
+		if ( yyg->yy_more_flag )
 			{
-			(yy_more_len) = (yy_c_buf_p) - (yytext_ptr);
-			(yy_more_flag) = 0;
+			yyg->yy_more_len = yyg->yy_c_buf_p - yyg->yytext_ptr;
+			yyg->yy_more_flag = 0;
 			}
-		yy_cp = (yy_c_buf_p);
+		yy_cp = yyg->yy_c_buf_p;
 
-		/* Support of smt_yytext. */
-		*yy_cp = (yy_hold_char);
+		/* Support of yytext. */
+		*yy_cp = yyg->yy_hold_char;
 
 		/* yy_bp points to the position in yy_ch_buf of the start of
 		 * the current run.
 		 */
 		yy_bp = yy_cp;
 
-		yy_current_state = (yy_start);
+		yy_current_state = yyg->yy_start;
 yy_match:
 		do
 			{
 			register YY_CHAR yy_c = yy_ec[YY_SC_TO_UI(*yy_cp)];
 			if ( yy_accept[yy_current_state] )
 				{
-				(yy_last_accepting_state) = yy_current_state;
-				(yy_last_accepting_cpos) = yy_cp;
+				yyg->yy_last_accepting_state = yy_current_state;
+				yyg->yy_last_accepting_cpos = yy_cp;
 				}
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
@@ -980,8 +1212,8 @@ yy_find_action:
 		yy_act = yy_accept[yy_current_state];
 		if ( yy_act == 0 )
 			{ /* have to back up */
-			yy_cp = (yy_last_accepting_cpos);
-			yy_current_state = (yy_last_accepting_state);
+			yy_cp = yyg->yy_last_accepting_cpos;
+			yy_current_state = yyg->yy_last_accepting_state;
 			yy_act = yy_accept[yy_current_state];
 			}
 
@@ -990,10 +1222,10 @@ yy_find_action:
 		if ( yy_act != YY_END_OF_BUFFER && yy_rule_can_match_eol[yy_act] )
 			{
 			yy_size_t yyl;
-			for ( yyl = (yy_more_len); yyl < smt_yyleng; ++yyl )
-				if ( smt_yytext[yyl] == '\n' )
+			for ( yyl = yyg->yy_more_len; yyl < yyleng; ++yyl )
+				if ( yytext[yyl] == '\n' )
 					   
-    smt_yylineno++;
+    yylineno++;
 ;
 			}
 
@@ -1003,441 +1235,467 @@ do_action:	/* This label is used only to access EOF actions. */
 	{ /* beginning of action switch */
 			case 0: /* must back up */
 			/* undo the effects of YY_DO_BEFORE_ACTION */
-			*yy_cp = (yy_hold_char);
-			yy_cp = (yy_last_accepting_cpos);
-			yy_current_state = (yy_last_accepting_state);
+			*yy_cp = yyg->yy_hold_char;
+			yy_cp = yyg->yy_last_accepting_cpos;
+			yy_current_state = yyg->yy_last_accepting_state;
 			goto yy_find_action;
 
 case 1:
 YY_RULE_SETUP
-#line 51 "smtlib-flex-lexer.l"
+#line 226 "smtlib-flex-lexer.l"
 { SET_LOCATION; return '_'; }
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
-#line 52 "smtlib-flex-lexer.l"
+#line 227 "smtlib-flex-lexer.l"
 { SET_LOCATION; return '!'; }
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 53 "smtlib-flex-lexer.l"
+#line 228 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_AS; }
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 54 "smtlib-flex-lexer.l"
+#line 229 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_LET; }
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 55 "smtlib-flex-lexer.l"
+#line 230 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_EXISTS; }
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 56 "smtlib-flex-lexer.l"
+#line 231 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_FORALL; }
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 57 "smtlib-flex-lexer.l"
+#line 232 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_MATCH; }
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 58 "smtlib-flex-lexer.l"
+#line 233 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_PAR; }
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 60 "smtlib-flex-lexer.l"
+#line 235 "smtlib-flex-lexer.l"
 { SET_LOCATION; return '('; }
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 61 "smtlib-flex-lexer.l"
+#line 236 "smtlib-flex-lexer.l"
 { SET_LOCATION; return ')'; }
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 63 "smtlib-flex-lexer.l"
+#line 238 "smtlib-flex-lexer.l"
 { 
 						SET_LOCATION;
-						smt_yylval.ptr = ast_newNumeralLiteral(
-							strtol(smt_yytext, NULL, 10), 10); 
+						yylval->ptr = ast_newNumeralLiteral(yyextra, 
+							strtol(yytext, NULL, 10), 10); 
 						return NUMERAL; 
 					}
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 70 "smtlib-flex-lexer.l"
+#line 245 "smtlib-flex-lexer.l"
 {
 						SET_LOCATION;
-						smt_yylval.ptr = ast_newDecimalLiteral(
-							strtod(smt_yytext, NULL));  
+						yylval->ptr = ast_newDecimalLiteral(yyextra, 
+							strtod(yytext, NULL));  
 						return DECIMAL; 
 					}
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 76 "smtlib-flex-lexer.l"
+#line 251 "smtlib-flex-lexer.l"
 { 
 						SET_LOCATION;
-						smt_yylval.ptr = ast_newNumeralLiteral(
-							strtol(smt_yytext+2, NULL, 16), 16); 
+						yylval->ptr = ast_newNumeralLiteral(yyextra, 
+							strtol(yytext+2, NULL, 16), 16); 
 						return HEXADECIMAL; 
 					}
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 82 "smtlib-flex-lexer.l"
+#line 257 "smtlib-flex-lexer.l"
 {
 						SET_LOCATION;
-						smt_yylval.ptr = ast_newNumeralLiteral(
-							strtol(smt_yytext+2, NULL, 2), 2); 
+						yylval->ptr = ast_newNumeralLiteral(yyextra, 
+							strtol(yytext+2, NULL, 2), 2); 
 						return BINARY; 
 					}
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 88 "smtlib-flex-lexer.l"
+#line 263 "smtlib-flex-lexer.l"
 { SET_LOCATION; return NOT; }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 90 "smtlib-flex-lexer.l"
+#line 265 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_ASSERT; }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 91 "smtlib-flex-lexer.l"
+#line 266 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_CHK_SAT_ASSUM; }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 92 "smtlib-flex-lexer.l"
+#line 267 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_CHK_SAT; }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 93 "smtlib-flex-lexer.l"
+#line 268 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_CHK_UNSAT; }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 94 "smtlib-flex-lexer.l"
+#line 269 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_DECL_CONST; }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 95 "smtlib-flex-lexer.l"
+#line 270 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_DECL_DATATYPE; }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 96 "smtlib-flex-lexer.l"
+#line 271 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_DECL_DATATYPES; }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 97 "smtlib-flex-lexer.l"
+#line 272 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_DECL_FUN; }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 98 "smtlib-flex-lexer.l"
+#line 273 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_DECL_SORT; }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-#line 99 "smtlib-flex-lexer.l"
+#line 274 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_DECL_HEAP; }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-#line 100 "smtlib-flex-lexer.l"
+#line 275 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_DEF_FUNS_REC; }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-#line 101 "smtlib-flex-lexer.l"
+#line 276 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_DEF_FUN_REC; }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-#line 102 "smtlib-flex-lexer.l"
+#line 277 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_DEF_FUN; }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-#line 103 "smtlib-flex-lexer.l"
+#line 278 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_DEF_SORT; }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-#line 104 "smtlib-flex-lexer.l"
+#line 279 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_ECHO; }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 105 "smtlib-flex-lexer.l"
+#line 280 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_EXIT; }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 106 "smtlib-flex-lexer.l"
+#line 281 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_GET_ASSERTS; }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-#line 107 "smtlib-flex-lexer.l"
+#line 282 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_GET_ASSIGNS; }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-#line 108 "smtlib-flex-lexer.l"
+#line 283 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_GET_INFO; }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-#line 109 "smtlib-flex-lexer.l"
+#line 284 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_GET_MODEL; }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-#line 110 "smtlib-flex-lexer.l"
+#line 285 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_GET_OPT; }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
-#line 111 "smtlib-flex-lexer.l"
+#line 286 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_GET_PROOF; }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
-#line 112 "smtlib-flex-lexer.l"
+#line 287 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_GET_UNSAT_ASSUMS; }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-#line 113 "smtlib-flex-lexer.l"
+#line 288 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_GET_UNSAT_CORE; }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
-#line 114 "smtlib-flex-lexer.l"
+#line 289 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_GET_VALUE; }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-#line 115 "smtlib-flex-lexer.l"
+#line 290 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_POP; }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 116 "smtlib-flex-lexer.l"
+#line 291 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_PUSH; }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
-#line 117 "smtlib-flex-lexer.l"
+#line 292 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_RESET_ASSERTS; }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-#line 118 "smtlib-flex-lexer.l"
+#line 293 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_RESET; }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-#line 119 "smtlib-flex-lexer.l"
+#line 294 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_SET_INFO; }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 120 "smtlib-flex-lexer.l"
+#line 295 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_SET_LOGIC; }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
-#line 121 "smtlib-flex-lexer.l"
+#line 296 "smtlib-flex-lexer.l"
 { SET_LOCATION; return KW_SET_OPT; }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 123 "smtlib-flex-lexer.l"
+#line 298 "smtlib-flex-lexer.l"
 { 
 				SET_LOCATION;
-				smt_yylval.ptr = ast_newMetaSpecConstant(1);
+				yylval->ptr = ast_newMetaSpecConstant(yyextra, 1);
 				return META_SPEC_DECIMAL; 
 			}
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 128 "smtlib-flex-lexer.l"
+#line 303 "smtlib-flex-lexer.l"
 { 
 				SET_LOCATION;
-				smt_yylval.ptr = ast_newMetaSpecConstant(0);
+				yylval->ptr = ast_newMetaSpecConstant(yyextra, 0);
 				return META_SPEC_NUMERAL; 
 			}
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
-#line 133 "smtlib-flex-lexer.l"
+#line 308 "smtlib-flex-lexer.l"
 { 
 				SET_LOCATION;
-				smt_yylval.ptr = ast_newMetaSpecConstant(2);
+				yylval->ptr = ast_newMetaSpecConstant(yyextra, 2);
 				return META_SPEC_STRING; 
 			}
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
-#line 139 "smtlib-flex-lexer.l"
+#line 314 "smtlib-flex-lexer.l"
 { 
 				SET_LOCATION;
-				smt_yylval.ptr = ast_newSymbol(smt_yytext); 
+				yylval->ptr = ast_newSimpleSymbol(yyextra, yytext); 
 				return THEORY; 
 			}
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
-#line 144 "smtlib-flex-lexer.l"
+#line 319 "smtlib-flex-lexer.l"
 { 
 				SET_LOCATION;
-				smt_yylval.ptr = ast_newSymbol(smt_yytext); 
+				yylval->ptr = ast_newSimpleSymbol(yyextra, yytext); 
 				return LOGIC; 
 			}
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
-#line 150 "smtlib-flex-lexer.l"
+#line 325 "smtlib-flex-lexer.l"
 { 
 							SET_LOCATION;
-							smt_yylval.ptr = ast_newKeyword(smt_yytext);
+							yylval->ptr = ast_newSimpleKeyword(yyextra, yytext);
 							return KW_ATTR_SORTS; 
 						}
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
-#line 155 "smtlib-flex-lexer.l"
+#line 330 "smtlib-flex-lexer.l"
 { 
 							SET_LOCATION;
-							smt_yylval.ptr = ast_newKeyword(smt_yytext);
+							yylval->ptr = ast_newSimpleKeyword(yyextra, yytext);
 							return KW_ATTR_FUNS; 
 						}
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
-#line 160 "smtlib-flex-lexer.l"
+#line 335 "smtlib-flex-lexer.l"
 {
 							SET_LOCATION;
-							smt_yylval.ptr = ast_newKeyword(smt_yytext); 
+							yylval->ptr = ast_newSimpleKeyword(yyextra, yytext); 
 							return KW_ATTR_THEORIES; 
 						}
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
-#line 166 "smtlib-flex-lexer.l"
+#line 341 "smtlib-flex-lexer.l"
 {
 						SET_LOCATION;
-						smt_yylval.ptr = ast_newSymbol(smt_yytext); 
+						yylval->ptr = ast_newSimpleSymbol(yyextra, yytext); 
 						return SYMBOL; 
 					}
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
-#line 171 "smtlib-flex-lexer.l"
+#line 346 "smtlib-flex-lexer.l"
 { 
 						SET_LOCATION;
-						smt_yylval.ptr = ast_newKeyword(smt_yytext); 
+						yylval->ptr = ast_newSimpleKeyword(yyextra, yytext); 
 						return KEYWORD; 
 					}
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
-#line 177 "smtlib-flex-lexer.l"
-{ SET_LEFT; BEGIN string; yymore(); }
+#line 352 "smtlib-flex-lexer.l"
+{
+						char* next;
+						SET_LEFT;
+						RESTORE_INPUT;
+						next = scanString(yyg->yy_c_buf_p, BUFFER_END, &yylineno, &yycolumn);
+						RESUME_AT(next ? next : yyg->yy_c_buf_p);
+						if (next) {
+							yyleng = next - yytext;
+							SET_RIGHT;
+							yylval->ptr = ast_newStringLiteral(yyextra, yytext);
+							return STRING;
+						}
+						BEGIN string; yymore();
+					}
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
-#line 178 "smtlib-flex-lexer.l"
+#line 366 "smtlib-flex-lexer.l"
 { UPDATE_COLUMN(2);; yymore(); }
 	YY_BREAK
 case 60:
 /* rule 60 can match eol */
 YY_RULE_SETUP
-#line 179 "smtlib-flex-lexer.l"
+#line 367 "smtlib-flex-lexer.l"
 { RESET_COLUMN; yymore(); }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
-#line 180 "smtlib-flex-lexer.l"
+#line 368 "smtlib-flex-lexer.l"
 { 	
 						SET_RIGHT;
 						BEGIN 0; 
-						smt_yylval.ptr = ast_newStringLiteral(smt_yytext);
+						yylval->ptr = ast_newStringLiteral(yyextra, yytext);
 						return STRING; 
 					}
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
-#line 186 "smtlib-flex-lexer.l"
+#line 374 "smtlib-flex-lexer.l"
 { UPDATE_COLUMN(1); yymore(); }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
-#line 188 "smtlib-flex-lexer.l"
-{ SET_LEFT; BEGIN quoted; yymore(); }
+#line 376 "smtlib-flex-lexer.l"
+{
+						char* next;
+						SET_LEFT;
+						RESTORE_INPUT;
+						next = scanQuoted(yyg->yy_c_buf_p, BUFFER_END, &yytext, &yylineno, &yycolumn);
+						RESUME_AT(next ? next : yyg->yy_c_buf_p);
+						if (next) {
+							yyleng = next - yytext;
+							SET_RIGHT;
+							yylval->ptr = ast_newSymbol(yyextra, yytext);
+							return SYMBOL;
+						}
+						BEGIN quoted; yymore();
+					}
 	YY_BREAK
 case 64:
 /* rule 64 can match eol */
 YY_RULE_SETUP
-#line 189 "smtlib-flex-lexer.l"
+#line 390 "smtlib-flex-lexer.l"
 { RESET_COLUMN; yymore(); }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
-#line 190 "smtlib-flex-lexer.l"
+#line 391 "smtlib-flex-lexer.l"
 { 
 						SET_RIGHT;
 						BEGIN 0; 
-						smt_yylval.ptr = ast_newSymbol(smt_yytext);
+						yylval->ptr = ast_newSymbol(yyextra, yytext);
 						return SYMBOL; 
 					}
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
-#line 196 "smtlib-flex-lexer.l"
+#line 397 "smtlib-flex-lexer.l"
 { }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
-#line 197 "smtlib-flex-lexer.l"
+#line 398 "smtlib-flex-lexer.l"
 { UPDATE_COLUMN(1); yymore(); }
 	YY_BREAK
 case 68:
 /* rule 68 can match eol */
 YY_RULE_SETUP
-#line 199 "smtlib-flex-lexer.l"
-{ SET_LOCATION; smt_yycolumn = 1; }
+#line 400 "smtlib-flex-lexer.l"
+{ SET_LOCATION; RESET_COLUMN; SKIP_BLANK; }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
-#line 200 "smtlib-flex-lexer.l"
-{ SET_LOCATION; /*ignore*/ }
+#line 401 "smtlib-flex-lexer.l"
+{ SET_LOCATION; SKIP_BLANK; /*ignore*/ }
 	YY_BREAK
 case 70:
 /* rule 70 can match eol */
 YY_RULE_SETUP
-#line 201 "smtlib-flex-lexer.l"
-{ SET_LOCATION; smt_yycolumn = 1; /*ignore*/ }
+#line 402 "smtlib-flex-lexer.l"
+{ SET_LOCATION; RESET_COLUMN; SKIP_BLANK; /*ignore*/ }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
-#line 202 "smtlib-flex-lexer.l"
+#line 403 "smtlib-flex-lexer.l"
 ECHO;
 	YY_BREAK
-#line 1441 "lex.smt_yy.c"
+#line 1699 "lex.smt_yy.c"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(string):
 case YY_STATE_EOF(quoted):
@@ -1446,25 +1704,25 @@ case YY_STATE_EOF(quoted):
 	case YY_END_OF_BUFFER:
 		{
 		/* Amount of text matched not including the EOB char. */
-		int yy_amount_of_matched_text = (int) (yy_cp - (yytext_ptr)) - 1;
+		int yy_amount_of_matched_text = (int) (yy_cp - yyg->yytext_ptr) - 1;
 
 		/* Undo the effects of YY_DO_BEFORE_ACTION. */
-		*yy_cp = (yy_hold_char);
+		*yy_cp = yyg->yy_hold_char;
 		YY_RESTORE_YY_MORE_OFFSET
 
 		if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_NEW )
 			{
 			/* We're scanning a new file or input source.  It's
 			 * possible that this happened because the user
-			 * just pointed smt_yyin at a new source and called
+			 * just pointed yyin at a new source and called
 			 * smt_yylex().  If so, then we have to assure
 			 * consistency between YY_CURRENT_BUFFER and our
 			 * globals.  Here is the right place to do so, because
 			 * this is the first action (other than possibly a
 			 * back-up) that will match for the new input source.
 			 */
-			(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
-			YY_CURRENT_BUFFER_LVALUE->yy_input_file = smt_yyin;
+			yyg->yy_n_chars = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+			YY_CURRENT_BUFFER_LVALUE->yy_input_file = yyin;
 			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status = YY_BUFFER_NORMAL;
 			}
 
@@ -1475,13 +1733,13 @@ case YY_STATE_EOF(quoted):
 		 * end-of-buffer state).  Contrast this with the test
 		 * in input().
 		 */
-		if ( (yy_c_buf_p) <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
+		if ( yyg->yy_c_buf_p <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] )
 			{ /* This was really a NUL. */
 			yy_state_type yy_next_state;
 
-			(yy_c_buf_p) = (yytext_ptr) + yy_amount_of_matched_text;
+			yyg->yy_c_buf_p = yyg->yytext_ptr + yy_amount_of_matched_text;
 
-			yy_current_state = yy_get_previous_state(  );
+			yy_current_state = yy_get_previous_state(  yyscanner);
 
 			/* Okay, we're now positioned to make the NUL
 			 * transition.  We couldn't have
@@ -1492,43 +1750,43 @@ case YY_STATE_EOF(quoted):
 			 * will run more slowly).
 			 */
 
-			yy_next_state = yy_try_NUL_trans( yy_current_state );
+			yy_next_state = yy_try_NUL_trans( yy_current_state ,yyscanner);
 
-			yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+			yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
 
 			if ( yy_next_state )
 				{
 				/* Consume the NUL. */
-				yy_cp = ++(yy_c_buf_p);
+				yy_cp = ++yyg->yy_c_buf_p;
 				yy_current_state = yy_next_state;
 				goto yy_match;
 				}
 
 			else
 				{
-				yy_cp = (yy_c_buf_p);
+				yy_cp = yyg->yy_c_buf_p;
 				goto yy_find_action;
 				}
 			}
 
-		else switch ( yy_get_next_buffer(  ) )
+		else switch ( yy_get_next_buffer(  yyscanner) )
 			{
 			case EOB_ACT_END_OF_FILE:
 				{
-				(yy_did_buffer_switch_on_eof) = 0;
+				yyg->yy_did_buffer_switch_on_eof = 0;
 
-				if ( smt_yywrap( ) )
+				if ( smt_yywrap( yyscanner) )
 					{
 					/* Note: because we've taken care in
 					 * yy_get_next_buffer() to have set up
-					 * smt_yytext, we can now set up
+					 * yytext, we can now set up
 					 * yy_c_buf_p so that if some total
 					 * hoser (like flex itself) wants to
 					 * call the scanner after we return the
 					 * YY_NULL, it'll still work - another
 					 * YY_NULL will get returned.
 					 */
-					(yy_c_buf_p) = (yytext_ptr) + YY_MORE_ADJ;
+					yyg->yy_c_buf_p = yyg->yytext_ptr + YY_MORE_ADJ;
 
 					yy_act = YY_STATE_EOF(YY_START);
 					goto do_action;
@@ -1536,30 +1794,30 @@ case YY_STATE_EOF(quoted):
 
 				else
 					{
-					if ( ! (yy_did_buffer_switch_on_eof) )
+					if ( ! yyg->yy_did_buffer_switch_on_eof )
 						YY_NEW_FILE;
 					}
 				break;
 				}
 
 			case EOB_ACT_CONTINUE_SCAN:
-				(yy_c_buf_p) =
-					(yytext_ptr) + yy_amount_of_matched_text;
+				yyg->yy_c_buf_p =
+					yyg->yytext_ptr + yy_amount_of_matched_text;
 
-				yy_current_state = yy_get_previous_state(  );
+				yy_current_state = yy_get_previous_state(  yyscanner);
 
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+				yy_cp = yyg->yy_c_buf_p;
+				yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
 				goto yy_match;
 
 			case EOB_ACT_LAST_MATCH:
-				(yy_c_buf_p) =
-				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)];
+				yyg->yy_c_buf_p =
+				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars];
 
-				yy_current_state = yy_get_previous_state(  );
+				yy_current_state = yy_get_previous_state(  yyscanner);
 
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+				yy_cp = yyg->yy_c_buf_p;
+				yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
 				goto yy_find_action;
 			}
 		break;
@@ -1579,20 +1837,21 @@ case YY_STATE_EOF(quoted):
  *	EOB_ACT_CONTINUE_SCAN - continue scanning from current position
  *	EOB_ACT_END_OF_FILE - end of file
  */
-static int yy_get_next_buffer (void)
+static int yy_get_next_buffer (yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
     	register char *dest = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf;
-	register char *source = (yytext_ptr);
+	register char *source = yyg->yytext_ptr;
 	register int number_to_move, i;
 	int ret_val;
 
-	if ( (yy_c_buf_p) > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] )
+	if ( yyg->yy_c_buf_p > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars + 1] )
 		YY_FATAL_ERROR(
 		"fatal flex scanner internal error--end of buffer missed" );
 
 	if ( YY_CURRENT_BUFFER_LVALUE->yy_fill_buffer == 0 )
 		{ /* Don't try to fill the buffer, so this is an EOF. */
-		if ( (yy_c_buf_p) - (yytext_ptr) - YY_MORE_ADJ == 1 )
+		if ( yyg->yy_c_buf_p - yyg->yytext_ptr - YY_MORE_ADJ == 1 )
 			{
 			/* We matched a single character, the EOB, so
 			 * treat this as a final EOF.
@@ -1612,7 +1871,7 @@ static int yy_get_next_buffer (void)
 	/* Try to read more data. */
 
 	/* First move last chars to start of buffer. */
-	number_to_move = (int) ((yy_c_buf_p) - (yytext_ptr)) - 1;
+	number_to_move = (int) (yyg->yy_c_buf_p - yyg->yytext_ptr) - 1;
 
 	for ( i = 0; i < number_to_move; ++i )
 		*(dest++) = *(source++);
@@ -1621,7 +1880,7 @@ static int yy_get_next_buffer (void)
 		/* don't do the read, it's not guaranteed to return an EOF,
 		 * just force an EOF
 		 */
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars) = 0;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars = 0;
 
 	else
 		{
@@ -1635,7 +1894,7 @@ static int yy_get_next_buffer (void)
 			YY_BUFFER_STATE b = YY_CURRENT_BUFFER;
 
 			int yy_c_buf_p_offset =
-				(int) ((yy_c_buf_p) - b->yy_ch_buf);
+				(int) (yyg->yy_c_buf_p - b->yy_ch_buf);
 
 			if ( b->yy_is_our_buffer )
 				{
@@ -1648,7 +1907,7 @@ static int yy_get_next_buffer (void)
 
 				b->yy_ch_buf = (char *)
 					/* Include room in for 2 EOB chars. */
-					smt_yyrealloc((void *) b->yy_ch_buf,b->yy_buf_size + 2  );
+					smt_yyrealloc((void *) b->yy_ch_buf,b->yy_buf_size + 2  ,yyscanner);
 				}
 			else
 				/* Can't grow it, we don't own it. */
@@ -1658,7 +1917,7 @@ static int yy_get_next_buffer (void)
 				YY_FATAL_ERROR(
 				"fatal error - scanner input buffer overflow" );
 
-			(yy_c_buf_p) = &b->yy_ch_buf[yy_c_buf_p_offset];
+			yyg->yy_c_buf_p = &b->yy_ch_buf[yy_c_buf_p_offset];
 
 			num_to_read = YY_CURRENT_BUFFER_LVALUE->yy_buf_size -
 						number_to_move - 1;
@@ -1670,17 +1929,17 @@ static int yy_get_next_buffer (void)
 
 		/* Read in more data. */
 		YY_INPUT( (&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[number_to_move]),
-			(yy_n_chars), num_to_read );
+			yyg->yy_n_chars, num_to_read );
 
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
 		}
 
-	if ( (yy_n_chars) == 0 )
+	if ( yyg->yy_n_chars == 0 )
 		{
 		if ( number_to_move == YY_MORE_ADJ )
 			{
 			ret_val = EOB_ACT_END_OF_FILE;
-			smt_yyrestart(smt_yyin  );
+			smt_yyrestart(yyin  ,yyscanner);
 			}
 
 		else
@@ -1694,39 +1953,40 @@ static int yy_get_next_buffer (void)
 	else
 		ret_val = EOB_ACT_CONTINUE_SCAN;
 
-	if ((yy_size_t) ((yy_n_chars) + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
+	if ((yy_size_t) (yyg->yy_n_chars + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
 		/* Extend the array by 50%, plus the number we really need. */
-		yy_size_t new_size = (yy_n_chars) + number_to_move + ((yy_n_chars) >> 1);
-		YY_CURRENT_BUFFER_LVALUE->yy_ch_buf = (char *) smt_yyrealloc((void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf,new_size  );
+		yy_size_t new_size = yyg->yy_n_chars + number_to_move + (yyg->yy_n_chars >> 1);
+		YY_CURRENT_BUFFER_LVALUE->yy_ch_buf = (char *) smt_yyrealloc((void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf,new_size  ,yyscanner);
 		if ( ! YY_CURRENT_BUFFER_LVALUE->yy_ch_buf )
-			YY_FATAL_ERROR( "out of dynamic memory in yy_get_next_buffer()" );
+			YY_FATAL_ERROR( "out of dynamic memory in yy_get_next_buffer(yyscanner)" );
 	}
 
-	(yy_n_chars) += number_to_move;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] = YY_END_OF_BUFFER_CHAR;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] = YY_END_OF_BUFFER_CHAR;
+	yyg->yy_n_chars += number_to_move;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] = YY_END_OF_BUFFER_CHAR;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars + 1] = YY_END_OF_BUFFER_CHAR;
 
-	(yytext_ptr) = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
+	yyg->yytext_ptr = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
 
 	return ret_val;
 }
 
 /* yy_get_previous_state - get the state just before the EOB char was reached */
 
-    static yy_state_type yy_get_previous_state (void)
+    static yy_state_type yy_get_previous_state (yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 	register yy_state_type yy_current_state;
 	register char *yy_cp;
     
-	yy_current_state = (yy_start);
+	yy_current_state = yyg->yy_start;
 
-	for ( yy_cp = (yytext_ptr) + YY_MORE_ADJ; yy_cp < (yy_c_buf_p); ++yy_cp )
+	for ( yy_cp = yyg->yytext_ptr + YY_MORE_ADJ; yy_cp < yyg->yy_c_buf_p; ++yy_cp )
 		{
 		register YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 1);
 		if ( yy_accept[yy_current_state] )
 			{
-			(yy_last_accepting_state) = yy_current_state;
-			(yy_last_accepting_cpos) = yy_cp;
+			yyg->yy_last_accepting_state = yy_current_state;
+			yyg->yy_last_accepting_cpos = yy_cp;
 			}
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
@@ -1745,16 +2005,17 @@ static int yy_get_next_buffer (void)
  * synopsis
  *	next_state = yy_try_NUL_trans( current_state );
  */
-    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state )
+    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 	register int yy_is_jam;
-    	register char *yy_cp = (yy_c_buf_p);
+    	register char *yy_cp = yyg->yy_c_buf_p;
 
 	register YY_CHAR yy_c = 1;
 	if ( yy_accept[yy_current_state] )
 		{
-		(yy_last_accepting_state) = yy_current_state;
-		(yy_last_accepting_cpos) = yy_cp;
+		yyg->yy_last_accepting_state = yy_current_state;
+		yyg->yy_last_accepting_cpos = yy_cp;
 		}
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
@@ -1768,19 +2029,20 @@ static int yy_get_next_buffer (void)
 	return yy_is_jam ? 0 : yy_current_state;
 }
 
-    static void yyunput (int c, register char * yy_bp )
+    static void yyunput (int c, register char * yy_bp , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 	register char *yy_cp;
     
-    yy_cp = (yy_c_buf_p);
+    yy_cp = yyg->yy_c_buf_p;
 
-	/* undo effects of setting up smt_yytext */
-	*yy_cp = (yy_hold_char);
+	/* undo effects of setting up yytext */
+	*yy_cp = yyg->yy_hold_char;
 
 	if ( yy_cp < YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + 2 )
 		{ /* need to shift things up to make room */
 		/* +2 for EOB chars. */
-		register yy_size_t number_to_move = (yy_n_chars) + 2;
+		register yy_size_t number_to_move = yyg->yy_n_chars + 2;
 		register char *dest = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[
 					YY_CURRENT_BUFFER_LVALUE->yy_buf_size + 2];
 		register char *source =
@@ -1792,7 +2054,7 @@ static int yy_get_next_buffer (void)
 		yy_cp += (int) (dest - source);
 		yy_bp += (int) (dest - source);
 		YY_CURRENT_BUFFER_LVALUE->yy_n_chars =
-			(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_buf_size;
+			yyg->yy_n_chars = YY_CURRENT_BUFFER_LVALUE->yy_buf_size;
 
 		if ( yy_cp < YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + 2 )
 			YY_FATAL_ERROR( "flex scanner push-back overflow" );
@@ -1801,42 +2063,43 @@ static int yy_get_next_buffer (void)
 	*--yy_cp = (char) c;
 
     if ( c == '\n' ){
-        --smt_yylineno;
+        --yylineno;
     }
 
-	(yytext_ptr) = yy_bp;
-	(yy_hold_char) = *yy_cp;
-	(yy_c_buf_p) = yy_cp;
+	yyg->yytext_ptr = yy_bp;
+	yyg->yy_hold_char = *yy_cp;
+	yyg->yy_c_buf_p = yy_cp;
 }
 
 #ifndef YY_NO_INPUT
 #ifdef __cplusplus
-    static int yyinput (void)
+    static int yyinput (yyscan_t yyscanner)
 #else
-    static int input  (void)
+    static int input  (yyscan_t yyscanner)
 #endif
 
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 	int c;
     
-	*(yy_c_buf_p) = (yy_hold_char);
+	*yyg->yy_c_buf_p = yyg->yy_hold_char;
 
-	if ( *(yy_c_buf_p) == YY_END_OF_BUFFER_CHAR )
+	if ( *yyg->yy_c_buf_p == YY_END_OF_BUFFER_CHAR )
 		{
 		/* yy_c_buf_p now points to the character we want to return.
 		 * If this occurs *before* the EOB characters, then it's a
 		 * valid NUL; if not, then we've hit the end of the buffer.
 		 */
-		if ( (yy_c_buf_p) < &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
+		if ( yyg->yy_c_buf_p < &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] )
 			/* This was really a NUL. */
-			*(yy_c_buf_p) = '\0';
+			*yyg->yy_c_buf_p = '\0';
 
 		else
 			{ /* need more input */
-			yy_size_t offset = (yy_c_buf_p) - (yytext_ptr);
-			++(yy_c_buf_p);
+			yy_size_t offset = yyg->yy_c_buf_p - yyg->yytext_ptr;
+			++yyg->yy_c_buf_p;
 
-			switch ( yy_get_next_buffer(  ) )
+			switch ( yy_get_next_buffer(  yyscanner) )
 				{
 				case EOB_ACT_LAST_MATCH:
 					/* This happens because yy_g_n_b()
@@ -1850,38 +2113,38 @@ static int yy_get_next_buffer (void)
 					 */
 
 					/* Reset buffer status. */
-					smt_yyrestart(smt_yyin );
+					smt_yyrestart(yyin ,yyscanner);
 
 					/*FALLTHROUGH*/
 
 				case EOB_ACT_END_OF_FILE:
 					{
-					if ( smt_yywrap( ) )
+					if ( smt_yywrap( yyscanner) )
 						return 0;
 
-					if ( ! (yy_did_buffer_switch_on_eof) )
+					if ( ! yyg->yy_did_buffer_switch_on_eof )
 						YY_NEW_FILE;
 #ifdef __cplusplus
-					return yyinput();
+					return yyinput(yyscanner);
 #else
-					return input();
+					return input(yyscanner);
 #endif
 					}
 
 				case EOB_ACT_CONTINUE_SCAN:
-					(yy_c_buf_p) = (yytext_ptr) + offset;
+					yyg->yy_c_buf_p = yyg->yytext_ptr + offset;
 					break;
 				}
 			}
 		}
 
-	c = *(unsigned char *) (yy_c_buf_p);	/* cast for 8-bit char's */
-	*(yy_c_buf_p) = '\0';	/* preserve smt_yytext */
-	(yy_hold_char) = *++(yy_c_buf_p);
+	c = *(unsigned char *) yyg->yy_c_buf_p;	/* cast for 8-bit char's */
+	*yyg->yy_c_buf_p = '\0';	/* preserve yytext */
+	yyg->yy_hold_char = *++yyg->yy_c_buf_p;
 
 	if ( c == '\n' )
 		   
-    smt_yylineno++;
+    yylineno++;
 ;
 
 	return c;
@@ -1893,60 +2156,63 @@ static int yy_get_next_buffer (void)
  * 
  * @note This function does not reset the start condition to @c INITIAL .
  */
-    void smt_yyrestart  (FILE * input_file )
+    void smt_yyrestart  (FILE * input_file , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
     
 	if ( ! YY_CURRENT_BUFFER ){
-        smt_yyensure_buffer_stack ();
+        smt_yyensure_buffer_stack (yyscanner);
 		YY_CURRENT_BUFFER_LVALUE =
-            smt_yy_create_buffer(smt_yyin,YY_BUF_SIZE );
+            smt_yy_create_buffer(yyin,YY_BUF_SIZE ,yyscanner);
 	}
 
-	smt_yy_init_buffer(YY_CURRENT_BUFFER,input_file );
-	smt_yy_load_buffer_state( );
+	smt_yy_init_buffer(YY_CURRENT_BUFFER,input_file ,yyscanner);
+	smt_yy_load_buffer_state( yyscanner);
 }
 
 /** Switch to a different input buffer.
  * @param new_buffer The new input buffer.
  * 
  */
-    void smt_yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer )
+    void smt_yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
     
 	/* TODO. We should be able to replace this entire function body
 	 * with
 	 *		smt_yypop_buffer_state();
 	 *		smt_yypush_buffer_state(new_buffer);
      */
-	smt_yyensure_buffer_stack ();
+	smt_yyensure_buffer_stack (yyscanner);
 	if ( YY_CURRENT_BUFFER == new_buffer )
 		return;
 
 	if ( YY_CURRENT_BUFFER )
 		{
 		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = yyg->yy_c_buf_p;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
 		}
 
 	YY_CURRENT_BUFFER_LVALUE = new_buffer;
-	smt_yy_load_buffer_state( );
+	smt_yy_load_buffer_state( yyscanner);
 
 	/* We don't actually know whether we did this switch during
 	 * EOF (smt_yywrap()) processing, but the only time this flag
 	 * is looked at is after smt_yywrap() is called, so it's safe
 	 * to go ahead and always set it.
 	 */
-	(yy_did_buffer_switch_on_eof) = 1;
+	yyg->yy_did_buffer_switch_on_eof = 1;
 }
 
-static void smt_yy_load_buffer_state  (void)
+static void smt_yy_load_buffer_state  (yyscan_t yyscanner)
 {
-    	(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
-	(yytext_ptr) = (yy_c_buf_p) = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
-	smt_yyin = YY_CURRENT_BUFFER_LVALUE->yy_input_file;
-	(yy_hold_char) = *(yy_c_buf_p);
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    	yyg->yy_n_chars = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+	yyg->yytext_ptr = yyg->yy_c_buf_p = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
+	yyin = YY_CURRENT_BUFFER_LVALUE->yy_input_file;
+	yyg->yy_hold_char = *yyg->yy_c_buf_p;
 }
 
 /** Allocate and initialize an input buffer state.
@@ -1955,26 +2221,26 @@ static void smt_yy_load_buffer_state  (void)
  * 
  * @return the allocated buffer state.
  */
-    YY_BUFFER_STATE smt_yy_create_buffer  (FILE * file, int  size )
+    YY_BUFFER_STATE smt_yy_create_buffer  (FILE * file, int  size , yyscan_t yyscanner)
 {
 	YY_BUFFER_STATE b;
     
-	b = (YY_BUFFER_STATE) smt_yyalloc(sizeof( struct yy_buffer_state )  );
+	b = (YY_BUFFER_STATE) smt_yyalloc(sizeof( struct yy_buffer_state )  ,yyscanner);
 	if ( ! b )
-		YY_FATAL_ERROR( "out of dynamic memory in smt_yy_create_buffer()" );
+		YY_FATAL_ERROR( "out of dynamic memory in smt_yy_create_buffer(yyscanner)" );
 
 	b->yy_buf_size = size;
 
 	/* yy_ch_buf has to be 2 characters longer than the size given because
 	 * we need to put in 2 end-of-buffer characters.
 	 */
-	b->yy_ch_buf = (char *) smt_yyalloc(b->yy_buf_size + 2  );
+	b->yy_ch_buf = (char *) smt_yyalloc(b->yy_buf_size + 2  ,yyscanner);
 	if ( ! b->yy_ch_buf )
-		YY_FATAL_ERROR( "out of dynamic memory in smt_yy_create_buffer()" );
+		YY_FATAL_ERROR( "out of dynamic memory in smt_yy_create_buffer(yyscanner)" );
 
 	b->yy_is_our_buffer = 1;
 
-	smt_yy_init_buffer(b,file );
+	smt_yy_init_buffer(b,file ,yyscanner);
 
 	return b;
 }
@@ -1983,8 +2249,9 @@ static void smt_yy_load_buffer_state  (void)
  * @param b a buffer created with smt_yy_create_buffer()
  * 
  */
-    void smt_yy_delete_buffer (YY_BUFFER_STATE  b )
+    void smt_yy_delete_buffer (YY_BUFFER_STATE  b , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
     
 	if ( ! b )
 		return;
@@ -1993,9 +2260,9 @@ static void smt_yy_load_buffer_state  (void)
 		YY_CURRENT_BUFFER_LVALUE = (YY_BUFFER_STATE) 0;
 
 	if ( b->yy_is_our_buffer )
-		smt_yyfree((void *) b->yy_ch_buf  );
+		smt_yyfree((void *) b->yy_ch_buf  ,yyscanner);
 
-	smt_yyfree((void *) b  );
+	smt_yyfree((void *) b  ,yyscanner);
 }
 
 #ifndef __cplusplus
@@ -2006,12 +2273,13 @@ extern int isatty (int );
  * This function is sometimes called more than once on the same buffer,
  * such as during a smt_yyrestart() or at EOF.
  */
-    static void smt_yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file )
+    static void smt_yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file , yyscan_t yyscanner)
 
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 	int oerrno = errno;
     
-	smt_yy_flush_buffer(b );
+	smt_yy_flush_buffer(b ,yyscanner);
 
 	b->yy_input_file = file;
 	b->yy_fill_buffer = 1;
@@ -2034,8 +2302,9 @@ extern int isatty (int );
  * @param b the buffer state to be flushed, usually @c YY_CURRENT_BUFFER.
  * 
  */
-    void smt_yy_flush_buffer (YY_BUFFER_STATE  b )
+    void smt_yy_flush_buffer (YY_BUFFER_STATE  b , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
     	if ( ! b )
 		return;
 
@@ -2054,7 +2323,7 @@ extern int isatty (int );
 	b->yy_buffer_status = YY_BUFFER_NEW;
 
 	if ( b == YY_CURRENT_BUFFER )
-		smt_yy_load_buffer_state( );
+		smt_yy_load_buffer_state( yyscanner);
 }
 
 /** Pushes the new state onto the stack. The new state becomes
@@ -2063,95 +2332,98 @@ extern int isatty (int );
  *  @param new_buffer The new state.
  *  
  */
-void smt_yypush_buffer_state (YY_BUFFER_STATE new_buffer )
+void smt_yypush_buffer_state (YY_BUFFER_STATE new_buffer , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
     	if (new_buffer == NULL)
 		return;
 
-	smt_yyensure_buffer_stack();
+	smt_yyensure_buffer_stack(yyscanner);
 
 	/* This block is copied from smt_yy_switch_to_buffer. */
 	if ( YY_CURRENT_BUFFER )
 		{
 		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = yyg->yy_c_buf_p;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
 		}
 
 	/* Only push if top exists. Otherwise, replace top. */
 	if (YY_CURRENT_BUFFER)
-		(yy_buffer_stack_top)++;
+		yyg->yy_buffer_stack_top++;
 	YY_CURRENT_BUFFER_LVALUE = new_buffer;
 
 	/* copied from smt_yy_switch_to_buffer. */
-	smt_yy_load_buffer_state( );
-	(yy_did_buffer_switch_on_eof) = 1;
+	smt_yy_load_buffer_state( yyscanner);
+	yyg->yy_did_buffer_switch_on_eof = 1;
 }
 
 /** Removes and deletes the top of the stack, if present.
  *  The next element becomes the new top.
  *  
  */
-void smt_yypop_buffer_state (void)
+void smt_yypop_buffer_state (yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
     	if (!YY_CURRENT_BUFFER)
 		return;
 
-	smt_yy_delete_buffer(YY_CURRENT_BUFFER );
+	smt_yy_delete_buffer(YY_CURRENT_BUFFER ,yyscanner);
 	YY_CURRENT_BUFFER_LVALUE = NULL;
-	if ((yy_buffer_stack_top) > 0)
-		--(yy_buffer_stack_top);
+	if (yyg->yy_buffer_stack_top > 0)
+		--yyg->yy_buffer_stack_top;
 
 	if (YY_CURRENT_BUFFER) {
-		smt_yy_load_buffer_state( );
-		(yy_did_buffer_switch_on_eof) = 1;
+		smt_yy_load_buffer_state( yyscanner);
+		yyg->yy_did_buffer_switch_on_eof = 1;
 	}
 }
 
 /* Allocates the stack if it does not exist.
  *  Guarantees space for at least one push.
  */
-static void smt_yyensure_buffer_stack (void)
+static void smt_yyensure_buffer_stack (yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 	yy_size_t num_to_alloc;
     
-	if (!(yy_buffer_stack)) {
+	if (!yyg->yy_buffer_stack) {
 
 		/* First allocation is just for 2 elements, since we don't know if this
 		 * scanner will even need a stack. We use 2 instead of 1 to avoid an
 		 * immediate realloc on the next call.
          */
 		num_to_alloc = 1;
-		(yy_buffer_stack) = (struct yy_buffer_state**)smt_yyalloc
+		yyg->yy_buffer_stack = (struct yy_buffer_state**)smt_yyalloc
 								(num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
-			YY_FATAL_ERROR( "out of dynamic memory in smt_yyensure_buffer_stack()" );
+								,yyscanner);
+		if ( ! yyg->yy_buffer_stack )
+			YY_FATAL_ERROR( "out of dynamic memory in smt_yyensure_buffer_stack(yyscanner)" );
 								  
-		memset((yy_buffer_stack), 0, num_to_alloc * sizeof(struct yy_buffer_state*));
+		memset(yyg->yy_buffer_stack, 0, num_to_alloc * sizeof(struct yy_buffer_state*));
 				
-		(yy_buffer_stack_max) = num_to_alloc;
-		(yy_buffer_stack_top) = 0;
+		yyg->yy_buffer_stack_max = num_to_alloc;
+		yyg->yy_buffer_stack_top = 0;
 		return;
 	}
 
-	if ((yy_buffer_stack_top) >= ((yy_buffer_stack_max)) - 1){
+	if (yyg->yy_buffer_stack_top >= (yyg->yy_buffer_stack_max) - 1){
 
 		/* Increase the buffer to prepare for a possible push. */
 		int grow_size = 8 /* arbitrary grow size */;
 
-		num_to_alloc = (yy_buffer_stack_max) + grow_size;
-		(yy_buffer_stack) = (struct yy_buffer_state**)smt_yyrealloc
-								((yy_buffer_stack),
+		num_to_alloc = yyg->yy_buffer_stack_max + grow_size;
+		yyg->yy_buffer_stack = (struct yy_buffer_state**)smt_yyrealloc
+								(yyg->yy_buffer_stack,
 								num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
-			YY_FATAL_ERROR( "out of dynamic memory in smt_yyensure_buffer_stack()" );
+								,yyscanner);
+		if ( ! yyg->yy_buffer_stack )
+			YY_FATAL_ERROR( "out of dynamic memory in smt_yyensure_buffer_stack(yyscanner)" );
 
 		/* zero only the new slots.*/
-		memset((yy_buffer_stack) + (yy_buffer_stack_max), 0, grow_size * sizeof(struct yy_buffer_state*));
-		(yy_buffer_stack_max) = num_to_alloc;
+		memset(yyg->yy_buffer_stack + yyg->yy_buffer_stack_max, 0, grow_size * sizeof(struct yy_buffer_state*));
+		yyg->yy_buffer_stack_max = num_to_alloc;
 	}
 }
 
@@ -2161,7 +2433,7 @@ static void smt_yyensure_buffer_stack (void)
  * 
  * @return the newly allocated buffer state object. 
  */
-YY_BUFFER_STATE smt_yy_scan_buffer  (char * base, yy_size_t  size )
+YY_BUFFER_STATE smt_yy_scan_buffer  (char * base, yy_size_t  size , yyscan_t yyscanner)
 {
 	YY_BUFFER_STATE b;
     
@@ -2171,9 +2443,9 @@ YY_BUFFER_STATE smt_yy_scan_buffer  (char * base, yy_size_t  size )
 		/* They forgot to leave room for the EOB's. */
 		return 0;
 
-	b = (YY_BUFFER_STATE) smt_yyalloc(sizeof( struct yy_buffer_state )  );
+	b = (YY_BUFFER_STATE) smt_yyalloc(sizeof( struct yy_buffer_state )  ,yyscanner);
 	if ( ! b )
-		YY_FATAL_ERROR( "out of dynamic memory in smt_yy_scan_buffer()" );
+		YY_FATAL_ERROR( "out of dynamic memory in smt_yy_scan_buffer(yyscanner)" );
 
 	b->yy_buf_size = size - 2;	/* "- 2" to take care of EOB's */
 	b->yy_buf_pos = b->yy_ch_buf = base;
@@ -2185,7 +2457,7 @@ YY_BUFFER_STATE smt_yy_scan_buffer  (char * base, yy_size_t  size )
 	b->yy_fill_buffer = 0;
 	b->yy_buffer_status = YY_BUFFER_NEW;
 
-	smt_yy_switch_to_buffer(b  );
+	smt_yy_switch_to_buffer(b  ,yyscanner);
 
 	return b;
 }
@@ -2198,10 +2470,10 @@ YY_BUFFER_STATE smt_yy_scan_buffer  (char * base, yy_size_t  size )
  * @note If you want to scan bytes that may contain NUL values, then use
  *       smt_yy_scan_bytes() instead.
  */
-YY_BUFFER_STATE smt_yy_scan_string (yyconst char * yystr )
+YY_BUFFER_STATE smt_yy_scan_string (yyconst char * yystr , yyscan_t yyscanner)
 {
     
-	return smt_yy_scan_bytes(yystr,strlen(yystr) );
+	return smt_yy_scan_bytes(yystr,strlen(yystr) ,yyscanner);
 }
 
 /** Setup the input buffer state to scan the given bytes. The next call to smt_yylex() will
@@ -2211,7 +2483,7 @@ YY_BUFFER_STATE smt_yy_scan_string (yyconst char * yystr )
  * 
  * @return the newly allocated buffer state object.
  */
-YY_BUFFER_STATE smt_yy_scan_bytes  (yyconst char * yybytes, yy_size_t  _yybytes_len )
+YY_BUFFER_STATE smt_yy_scan_bytes  (yyconst char * yybytes, yy_size_t  _yybytes_len , yyscan_t yyscanner)
 {
 	YY_BUFFER_STATE b;
 	char *buf;
@@ -2219,18 +2491,18 @@ YY_BUFFER_STATE smt_yy_scan_bytes  (yyconst char * yybytes, yy_size_t  _yybytes_
     
 	/* Get memory for full buffer, including space for trailing EOB's. */
 	n = _yybytes_len + 2;
-	buf = (char *) smt_yyalloc(n  );
+	buf = (char *) smt_yyalloc(n  ,yyscanner);
 	if ( ! buf )
-		YY_FATAL_ERROR( "out of dynamic memory in smt_yy_scan_bytes()" );
+		YY_FATAL_ERROR( "out of dynamic memory in smt_yy_scan_bytes(yyscanner)" );
 
 	for ( i = 0; i < _yybytes_len; ++i )
 		buf[i] = yybytes[i];
 
 	buf[_yybytes_len] = buf[_yybytes_len+1] = YY_END_OF_BUFFER_CHAR;
 
-	b = smt_yy_scan_buffer(buf,n );
+	b = smt_yy_scan_buffer(buf,n ,yyscanner);
 	if ( ! b )
-		YY_FATAL_ERROR( "bad buffer in smt_yy_scan_bytes()" );
+		YY_FATAL_ERROR( "bad buffer in smt_yy_scan_bytes(yyscanner)" );
 
 	/* It's okay to grow etc. this buffer, and we should throw it
 	 * away when we're done.
@@ -2244,7 +2516,7 @@ YY_BUFFER_STATE smt_yy_scan_bytes  (yyconst char * yybytes, yy_size_t  _yybytes_
 #define YY_EXIT_FAILURE 2
 #endif
 
-static void yy_fatal_error (yyconst char* msg )
+static void yy_fatal_error (yyconst char* msg , yyscan_t yyscanner)
 {
     	(void) fprintf( stderr, "%s\n", msg );
 	exit( YY_EXIT_FAILURE );
@@ -2256,69 +2528,129 @@ static void yy_fatal_error (yyconst char* msg )
 #define yyless(n) \
 	do \
 		{ \
-		/* Undo effects of setting up smt_yytext. */ \
+		/* Undo effects of setting up yytext. */ \
         int yyless_macro_arg = (n); \
         YY_LESS_LINENO(yyless_macro_arg);\
-		smt_yytext[smt_yyleng] = (yy_hold_char); \
-		(yy_c_buf_p) = smt_yytext + yyless_macro_arg; \
-		(yy_hold_char) = *(yy_c_buf_p); \
-		*(yy_c_buf_p) = '\0'; \
-		smt_yyleng = yyless_macro_arg; \
+		yytext[yyleng] = yyg->yy_hold_char; \
+		yyg->yy_c_buf_p = yytext + yyless_macro_arg; \
+		yyg->yy_hold_char = *yyg->yy_c_buf_p; \
+		*yyg->yy_c_buf_p = '\0'; \
+		yyleng = yyless_macro_arg; \
 		} \
 	while ( 0 )
 
 /* Accessor  methods (get/set functions) to struct members. */
 
+/** Get the user-defined data for this scanner.
+ * @param yyscanner The scanner object.
+ */
+YY_EXTRA_TYPE smt_yyget_extra  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyextra;
+}
+
 /** Get the current line number.
- * 
+ * @param yyscanner The scanner object.
  */
-int smt_yyget_lineno  (void)
+int smt_yyget_lineno  (yyscan_t yyscanner)
 {
-        
-    return smt_yylineno;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    
+        if (! YY_CURRENT_BUFFER)
+            return 0;
+    
+    return yylineno;
+}
+
+/** Get the current column number.
+ * @param yyscanner The scanner object.
+ */
+int smt_yyget_column  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    
+        if (! YY_CURRENT_BUFFER)
+            return 0;
+    
+    return yycolumn;
 }
 
 /** Get the input stream.
  * 
  */
-FILE *smt_yyget_in  (void)
+FILE *smt_yyget_in  (yyscan_t yyscanner)
 {
-        return smt_yyin;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+        return yyin;
 }
 
 /** Get the output stream.
  * 
  */
-FILE *smt_yyget_out  (void)
+FILE *smt_yyget_out  (yyscan_t yyscanner)
 {
-        return smt_yyout;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+        return yyout;
 }
 
 /** Get the length of the current token.
  * 
  */
-yy_size_t smt_yyget_leng  (void)
+yy_size_t smt_yyget_leng  (yyscan_t yyscanner)
 {
-        return smt_yyleng;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+        return yyleng;
 }
 
 /** Get the current token.
  * 
  */
 
-char *smt_yyget_text  (void)
+char *smt_yyget_text  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+        return yytext;
+}
+
+/** Set the user-defined data. This data is never touched by the scanner.
+ * @param user_defined The data to be associated with this scanner.
+ * @param yyscanner The scanner object.
+ */
+void smt_yyset_extra (YY_EXTRA_TYPE  user_defined , yyscan_t yyscanner)
 {
-        return smt_yytext;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyextra = user_defined ;
 }
 
 /** Set the current line number.
  * @param line_number
- * 
+ * @param yyscanner The scanner object.
  */
-void smt_yyset_lineno (int  line_number )
+void smt_yyset_lineno (int  line_number , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        /* lineno is only valid if an input buffer exists. */
+        if (! YY_CURRENT_BUFFER )
+           yy_fatal_error( "smt_yyset_lineno called with no buffer" , yyscanner); 
     
-    smt_yylineno = line_number;
+    yylineno = line_number;
+}
+
+/** Set the current column.
+ * @param line_number
+ * @param yyscanner The scanner object.
+ */
+void smt_yyset_column (int  column_no , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        /* column is only valid if an input buffer exists. */
+        if (! YY_CURRENT_BUFFER )
+           yy_fatal_error( "smt_yyset_column called with no buffer" , yyscanner); 
+    
+    yycolumn = column_no;
 }
 
 /** Set the input stream. This does not discard the current
@@ -2327,49 +2659,145 @@ void smt_yyset_lineno (int  line_number )
  * 
  * @see smt_yy_switch_to_buffer
  */
-void smt_yyset_in (FILE *  in_str )
+void smt_yyset_in (FILE *  in_str , yyscan_t yyscanner)
 {
-        smt_yyin = in_str ;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+        yyin = in_str ;
 }
 
-void smt_yyset_out (FILE *  out_str )
+void smt_yyset_out (FILE *  out_str , yyscan_t yyscanner)
 {
-        smt_yyout = out_str ;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+        yyout = out_str ;
 }
 
-int smt_yyget_debug  (void)
+int smt_yyget_debug  (yyscan_t yyscanner)
 {
-        return smt_yy_flex_debug;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+        return yy_flex_debug;
 }
 
-void smt_yyset_debug (int  bdebug )
+void smt_yyset_debug (int  bdebug , yyscan_t yyscanner)
 {
-        smt_yy_flex_debug = bdebug ;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+        yy_flex_debug = bdebug ;
 }
 
-static int yy_init_globals (void)
+/* Accessor methods for yylval and yylloc */
+
+YYSTYPE * smt_yyget_lval  (yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yylval;
+}
+
+void smt_yyset_lval (YYSTYPE *  yylval_param , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yylval = yylval_param;
+}
+
+YYLTYPE *smt_yyget_lloc  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yylloc;
+}
+    
+void smt_yyset_lloc (YYLTYPE *  yylloc_param , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yylloc = yylloc_param;
+}
+    
+/* User-visible API */
+
+/* smt_yylex_init is special because it creates the scanner itself, so it is
+ * the ONLY reentrant function that doesn't take the scanner as the last argument.
+ * That's why we explicitly handle the declaration, instead of using our macros.
+ */
+
+int smt_yylex_init(yyscan_t* ptr_yy_globals)
+
+{
+    if (ptr_yy_globals == NULL){
+        errno = EINVAL;
+        return 1;
+    }
+
+    *ptr_yy_globals = (yyscan_t) smt_yyalloc ( sizeof( struct yyguts_t ), NULL );
+
+    if (*ptr_yy_globals == NULL){
+        errno = ENOMEM;
+        return 1;
+    }
+
+    /* By setting to 0xAA, we expose bugs in yy_init_globals. Leave at 0x00 for releases. */
+    memset(*ptr_yy_globals,0x00,sizeof(struct yyguts_t));
+
+    return yy_init_globals ( *ptr_yy_globals );
+}
+
+/* smt_yylex_init_extra has the same functionality as smt_yylex_init, but follows the
+ * convention of taking the scanner as the last argument. Note however, that
+ * this is a *pointer* to a scanner, as it will be allocated by this call (and
+ * is the reason, too, why this function also must handle its own declaration).
+ * The user defined value in the first argument will be available to smt_yyalloc in
+ * the yyextra field.
+ */
+
+int smt_yylex_init_extra(YY_EXTRA_TYPE yy_user_defined,yyscan_t* ptr_yy_globals )
+
+{
+    struct yyguts_t dummy_yyguts;
+
+    smt_yyset_extra (yy_user_defined, &dummy_yyguts);
+
+    if (ptr_yy_globals == NULL){
+        errno = EINVAL;
+        return 1;
+    }
+	
+    *ptr_yy_globals = (yyscan_t) smt_yyalloc ( sizeof( struct yyguts_t ), &dummy_yyguts );
+	
+    if (*ptr_yy_globals == NULL){
+        errno = ENOMEM;
+        return 1;
+    }
+    
+    /* By setting to 0xAA, we expose bugs in
+    yy_init_globals. Leave at 0x00 for releases. */
+    memset(*ptr_yy_globals,0x00,sizeof(struct yyguts_t));
+    
+    smt_yyset_extra (yy_user_defined, *ptr_yy_globals);
+    
+    return yy_init_globals ( *ptr_yy_globals );
+}
+
+static int yy_init_globals (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
         /* Initialization is the same as for the non-reentrant scanner.
      * This function is called from smt_yylex_destroy(), so don't allocate here.
      */
 
-    /* We do not touch smt_yylineno unless the option is enabled. */
-    smt_yylineno =  1;
-    
-    (yy_buffer_stack) = 0;
-    (yy_buffer_stack_top) = 0;
-    (yy_buffer_stack_max) = 0;
-    (yy_c_buf_p) = (char *) 0;
-    (yy_init) = 0;
-    (yy_start) = 0;
+    yyg->yy_buffer_stack = 0;
+    yyg->yy_buffer_stack_top = 0;
+    yyg->yy_buffer_stack_max = 0;
+    yyg->yy_c_buf_p = (char *) 0;
+    yyg->yy_init = 0;
+    yyg->yy_start = 0;
+
+    yyg->yy_start_stack_ptr = 0;
+    yyg->yy_start_stack_depth = 0;
+    yyg->yy_start_stack =  NULL;
 
 /* Defined in main.c */
 #ifdef YY_STDINIT
-    smt_yyin = stdin;
-    smt_yyout = stdout;
+    yyin = stdin;
+    yyout = stdout;
 #else
-    smt_yyin = (FILE *) 0;
-    smt_yyout = (FILE *) 0;
+    yyin = (FILE *) 0;
+    yyout = (FILE *) 0;
 #endif
 
     /* For future reference: Set errno on error, since we are called by
@@ -2379,24 +2807,32 @@ static int yy_init_globals (void)
 }
 
 /* smt_yylex_destroy is for both reentrant and non-reentrant scanners. */
-int smt_yylex_destroy  (void)
+int smt_yylex_destroy  (yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
     
     /* Pop the buffer stack, destroying each element. */
 	while(YY_CURRENT_BUFFER){
-		smt_yy_delete_buffer(YY_CURRENT_BUFFER  );
+		smt_yy_delete_buffer(YY_CURRENT_BUFFER  ,yyscanner);
 		YY_CURRENT_BUFFER_LVALUE = NULL;
-		smt_yypop_buffer_state();
+		smt_yypop_buffer_state(yyscanner);
 	}
 
 	/* Destroy the stack itself. */
-	smt_yyfree((yy_buffer_stack) );
-	(yy_buffer_stack) = NULL;
+	smt_yyfree(yyg->yy_buffer_stack ,yyscanner);
+	yyg->yy_buffer_stack = NULL;
+
+    /* Destroy the start condition stack. */
+        smt_yyfree(yyg->yy_start_stack ,yyscanner );
+        yyg->yy_start_stack = NULL;
 
     /* Reset the globals. This is important in a non-reentrant scanner so the next time
      * smt_yylex() is called, initialization will occur. */
-    yy_init_globals( );
+    yy_init_globals( yyscanner);
 
+    /* Destroy the main struct (reentrant only). */
+    smt_yyfree ( yyscanner , yyscanner );
+    yyscanner = NULL;
     return 0;
 }
 
@@ -2424,12 +2860,12 @@ static int yy_flex_strlen (yyconst char * s )
 }
 #endif
 
-void *smt_yyalloc (yy_size_t  size )
+void *smt_yyalloc (yy_size_t  size , yyscan_t yyscanner)
 {
 	return (void *) malloc( size );
 }
 
-void *smt_yyrealloc  (void * ptr, yy_size_t  size )
+void *smt_yyrealloc  (void * ptr, yy_size_t  size , yyscan_t yyscanner)
 {
 	/* The cast to (char *) in the following accommodates both
 	 * implementations that use char* generic pointers, and those
@@ -2441,11 +2877,11 @@ void *smt_yyrealloc  (void * ptr, yy_size_t  size )
 	return (void *) realloc( (char *) ptr, size );
 }
 
-void smt_yyfree (void * ptr )
+void smt_yyfree (void * ptr , yyscan_t yyscanner)
 {
 	free( (char *) ptr );	/* see smt_yyrealloc() for (char *) cast */
 }
 
 #define YYTABLES_NAME "yytables"
 
-#line 202 "smtlib-flex-lexer.l"
+#line 403 "smtlib-flex-lexer.l"
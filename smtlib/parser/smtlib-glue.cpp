@@ -18,419 +18,271 @@
 #include "ast/ast_theory.h"
 #include "ast/ast_variable.h"
 #include "parser/smtlib_parser.h"
+#include "util/logger.h"
 
 #include <iostream>
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 using namespace std;
 using namespace smtlib;
 using namespace smtlib::ast;
 
-unordered_map<smtlib::ast::Node*, smtlib::ast::NodePtr> smtlib_nodemap;
-
 template<class T>
-shared_ptr<T> share(AstPtr nakedPtr) {
-    return dynamic_pointer_cast<T>(smtlib_nodemap[nakedPtr]);
+shared_ptr<T> cast(const NodePtr& node) {
+    return nodeCast<T>(node);
 }
 
 template<>
-SpecConstantPtr share(AstPtr nakedPtr) {
-    NumeralLiteralPtr option1 = dynamic_pointer_cast<NumeralLiteral>(smtlib_nodemap[nakedPtr]);
-    if (option1) {
-        return option1->shared_from_this();
-    }
-
-    DecimalLiteralPtr option2 = dynamic_pointer_cast<DecimalLiteral>(smtlib_nodemap[nakedPtr]);
-    if (option2) {
-        return option2->shared_from_this();
-    }
-
-    StringLiteralPtr option3 = dynamic_pointer_cast<StringLiteral>(smtlib_nodemap[nakedPtr]);
-    if (option3) {
-        return option3->shared_from_this();
+SpecConstantPtr cast(const NodePtr& node) {
+    switch (node->getKind()) {
+        case NodeKind::NUMERAL_LITERAL:
+            return nodeCast<NumeralLiteral>(node);
+        case NodeKind::DECIMAL_LITERAL:
+            return nodeCast<DecimalLiteral>(node);
+        case NodeKind::STRING_LITERAL:
+            return nodeCast<StringLiteral>(node);
+        default:
+            return SpecConstantPtr();
     }
-
-    throw;
 }
 
 template<>
-CommandPtr share(AstPtr nakedPtr) {
-    AssertCommandPtr option1 = dynamic_pointer_cast<AssertCommand>(smtlib_nodemap[nakedPtr]);
-    if (option1) {
-        return option1->shared_from_this();
-    }
-
-    CheckSatCommandPtr option2 = dynamic_pointer_cast<CheckSatCommand>(smtlib_nodemap[nakedPtr]);
-    if (option2) {
-        return option2->shared_from_this();
-    }
-
-    CheckUnsatCommandPtr option2b = dynamic_pointer_cast<CheckUnsatCommand>(smtlib_nodemap[nakedPtr]);
-    if (option2b) {
-        return option2b->shared_from_this();
-    }
-
-    CheckSatAssumCommandPtr option3 = dynamic_pointer_cast<CheckSatAssumCommand>(smtlib_nodemap[nakedPtr]);
-    if (option3) {
-        return option3->shared_from_this();
-    }
-
-    DeclareConstCommandPtr option4 = dynamic_pointer_cast<DeclareConstCommand>(smtlib_nodemap[nakedPtr]);
-    if (option4) {
-        return option4->shared_from_this();
-    }
-
-    DeclareFunCommandPtr option5 = dynamic_pointer_cast<DeclareFunCommand>(smtlib_nodemap[nakedPtr]);
-    if (option5) {
-        return option5->shared_from_this();
-    }
-
-    DeclareSortCommandPtr option6 = dynamic_pointer_cast<DeclareSortCommand>(smtlib_nodemap[nakedPtr]);
-    if (option6) {
-        return option6->shared_from_this();
-    }
-
-    DeclareHeapCommandPtr option6b = dynamic_pointer_cast<DeclareHeapCommand>(smtlib_nodemap[nakedPtr]);
-    if (option6b) {
-        return option6b->shared_from_this();
-    }
-
-    DefineFunCommandPtr option7 = dynamic_pointer_cast<DefineFunCommand>(smtlib_nodemap[nakedPtr]);
-    if (option7) {
-        return option7->shared_from_this();
-    }
-
-    DefineFunRecCommandPtr option8 = dynamic_pointer_cast<DefineFunRecCommand>(smtlib_nodemap[nakedPtr]);
-    if (option8) {
-        return option8->shared_from_this();
-    }
-
-    DefineFunsRecCommandPtr option9 = dynamic_pointer_cast<DefineFunsRecCommand>(smtlib_nodemap[nakedPtr]);
-    if (option9) {
-        return option9->shared_from_this();
-    }
-
-    DefineSortCommandPtr option10 = dynamic_pointer_cast<DefineSortCommand>(smtlib_nodemap[nakedPtr]);
-    if (option10) {
-        return option10->shared_from_this();
-    }
-
-    EchoCommandPtr option11 = dynamic_pointer_cast<EchoCommand>(smtlib_nodemap[nakedPtr]);
-    if (option11) {
-        return option11->shared_from_this();
-    }
-
-    ExitCommandPtr option12 = dynamic_pointer_cast<ExitCommand>(smtlib_nodemap[nakedPtr]);
-    if (option12) {
-        return option12->shared_from_this();
-    }
-
-    SetOptionCommandPtr option13 = dynamic_pointer_cast<SetOptionCommand>(smtlib_nodemap[nakedPtr]);
-    if (option13) {
-        return option13->shared_from_this();
-    }
-
-    GetAssertsCommandPtr option14 = dynamic_pointer_cast<GetAssertsCommand>(smtlib_nodemap[nakedPtr]);
-    if (option14) {
-        return option14->shared_from_this();
-    }
-
-    GetAssignsCommandPtr option15 = dynamic_pointer_cast<GetAssignsCommand>(smtlib_nodemap[nakedPtr]);
-    if (option15) {
-        return option15->shared_from_this();
-    }
-
-    GetInfoCommandPtr option16 = dynamic_pointer_cast<GetInfoCommand>(smtlib_nodemap[nakedPtr]);
-    if (option16) {
-        return option16->shared_from_this();
-    }
-
-    GetModelCommandPtr option17 = dynamic_pointer_cast<GetModelCommand>(smtlib_nodemap[nakedPtr]);
-    if (option17) {
-        return option17->shared_from_this();
-    }
-
-    GetOptionCommandPtr option18 = dynamic_pointer_cast<GetOptionCommand>(smtlib_nodemap[nakedPtr]);
-    if (option18) {
-        return option18->shared_from_this();
-    }
-
-    GetProofCommandPtr option19 = dynamic_pointer_cast<GetProofCommand>(smtlib_nodemap[nakedPtr]);
-    if (option19) {
-        return option19->shared_from_this();
-    }
-
-    GetUnsatAssumsCommandPtr option20 = dynamic_pointer_cast<GetUnsatAssumsCommand>(smtlib_nodemap[nakedPtr]);
-    if (option20) {
-        return option20->shared_from_this();
-    }
-
-    GetUnsatCoreCommandPtr option21 = dynamic_pointer_cast<GetUnsatCoreCommand>(smtlib_nodemap[nakedPtr]);
-    if (option21) {
-        return option21->shared_from_this();
-    }
-
-    GetValueCommandPtr option22 = dynamic_pointer_cast<GetValueCommand>(smtlib_nodemap[nakedPtr]);
-    if (option22) {
-        return option22->shared_from_this();
-    }
-
-    PopCommandPtr option23 = dynamic_pointer_cast<PopCommand>(smtlib_nodemap[nakedPtr]);
-    if (option23) {
-        return option23->shared_from_this();
-    }
-
-    PushCommandPtr option24 = dynamic_pointer_cast<PushCommand>(smtlib_nodemap[nakedPtr]);
-    if (option24) {
-        return option24->shared_from_this();
+CommandPtr cast(const NodePtr& node) {
+    switch (node->getKind()) {
+        case NodeKind::ASSERT_COMMAND:
+            return nodeCast<AssertCommand>(node);
+        case NodeKind::CHECK_SAT_COMMAND:
+            return nodeCast<CheckSatCommand>(node);
+        case NodeKind::CHECK_UNSAT_COMMAND:
+            return nodeCast<CheckUnsatCommand>(node);
+        case NodeKind::CHECK_SAT_ASSUM_COMMAND:
+            return nodeCast<CheckSatAssumCommand>(node);
+        case NodeKind::DECLARE_CONST_COMMAND:
+            return nodeCast<DeclareConstCommand>(node);
+        case NodeKind::DECLARE_FUN_COMMAND:
+            return nodeCast<DeclareFunCommand>(node);
+        case NodeKind::DECLARE_SORT_COMMAND:
+            return nodeCast<DeclareSortCommand>(node);
+        case NodeKind::DECLARE_HEAP_COMMAND:
+            return nodeCast<DeclareHeapCommand>(node);
+        case NodeKind::DEFINE_FUN_COMMAND:
+            return nodeCast<DefineFunCommand>(node);
+        case NodeKind::DEFINE_FUN_REC_COMMAND:
+            return nodeCast<DefineFunRecCommand>(node);
+        case NodeKind::DEFINE_FUNS_REC_COMMAND:
+            return nodeCast<DefineFunsRecCommand>(node);
+        case NodeKind::DEFINE_SORT_COMMAND:
+            return nodeCast<DefineSortCommand>(node);
+        case NodeKind::ECHO_COMMAND:
+            return nodeCast<EchoCommand>(node);
+        case NodeKind::EXIT_COMMAND:
+            return nodeCast<ExitCommand>(node);
+        case NodeKind::SET_OPTION_COMMAND:
+            return nodeCast<SetOptionCommand>(node);
+        case NodeKind::GET_ASSERTS_COMMAND:
+            return nodeCast<GetAssertsCommand>(node);
+        case NodeKind::GET_ASSIGNS_COMMAND:
+            return nodeCast<GetAssignsCommand>(node);
+        case NodeKind::GET_INFO_COMMAND:
+            return nodeCast<GetInfoCommand>(node);
+        case NodeKind::GET_MODEL_COMMAND:
+            return nodeCast<GetModelCommand>(node);
+        case NodeKind::GET_OPTION_COMMAND:
+            return nodeCast<GetOptionCommand>(node);
+        case NodeKind::GET_PROOF_COMMAND:
+            return nodeCast<GetProofCommand>(node);
+        case NodeKind::GET_UNSAT_ASSUMS_COMMAND:
+            return nodeCast<GetUnsatAssumsCommand>(node);
+        case NodeKind::GET_UNSAT_CORE_COMMAND:
+            return nodeCast<GetUnsatCoreCommand>(node);
+        case NodeKind::GET_VALUE_COMMAND:
+            return nodeCast<GetValueCommand>(node);
+        case NodeKind::POP_COMMAND:
+            return nodeCast<PopCommand>(node);
+        case NodeKind::PUSH_COMMAND:
+            return nodeCast<PushCommand>(node);
+        case NodeKind::RESET_COMMAND:
+            return nodeCast<ResetCommand>(node);
+        case NodeKind::RESET_ASSERTS_COMMAND:
+            return nodeCast<ResetAssertsCommand>(node);
+        case NodeKind::SET_INFO_COMMAND:
+            return nodeCast<SetInfoCommand>(node);
+        case NodeKind::SET_LOGIC_COMMAND:
+            return nodeCast<SetLogicCommand>(node);
+        case NodeKind::DECLARE_DATATYPE_COMMAND:
+            return nodeCast<DeclareDatatypeCommand>(node);
+        case NodeKind::DECLARE_DATATYPES_COMMAND:
+            return nodeCast<DeclareDatatypesCommand>(node);
+        default:
+            return CommandPtr();
     }
-
-    ResetCommandPtr option25 = dynamic_pointer_cast<ResetCommand>(smtlib_nodemap[nakedPtr]);
-    if (option25) {
-        return option25->shared_from_this();
-    }
-
-    ResetAssertsCommandPtr option26 = dynamic_pointer_cast<ResetAssertsCommand>(smtlib_nodemap[nakedPtr]);
-    if (option26) {
-        return option26->shared_from_this();
-    }
-
-    SetInfoCommandPtr option27 = dynamic_pointer_cast<SetInfoCommand>(smtlib_nodemap[nakedPtr]);
-    if (option27) {
-        return option27->shared_from_this();
-    }
-
-    SetLogicCommandPtr option28 = dynamic_pointer_cast<SetLogicCommand>(smtlib_nodemap[nakedPtr]);
-    if (option28) {
-        return option28->shared_from_this();
-    }
-
-    DeclareDatatypeCommandPtr option29 = dynamic_pointer_cast<DeclareDatatypeCommand>(smtlib_nodemap[nakedPtr]);
-    if (option29) {
-        return option29->shared_from_this();
-    }
-
-    DeclareDatatypesCommandPtr option30 = dynamic_pointer_cast<DeclareDatatypesCommand>(smtlib_nodemap[nakedPtr]);
-    if (option30) {
-        return option30->shared_from_this();
-    }
-
-    throw;
 }
 
 template<>
-FunSymbolDeclarationPtr share(AstPtr nakedPtr) {
-    SpecConstFunDeclarationPtr option6 = dynamic_pointer_cast<SpecConstFunDeclaration>(smtlib_nodemap[nakedPtr]);
-    if (option6) {
-        return option6->shared_from_this();
-    }
-
-    MetaSpecConstFunDeclarationPtr option7 = dynamic_pointer_cast<MetaSpecConstFunDeclaration>(
-            smtlib_nodemap[nakedPtr]);
-    if (option7) {
-        return option7->shared_from_this();
-    }
-
-    SimpleFunDeclarationPtr option8 = dynamic_pointer_cast<SimpleFunDeclaration>(smtlib_nodemap[nakedPtr]);
-    if (option8) {
-        return option8->shared_from_this();
-    }
-
-    ParametricFunDeclarationPtr option9 = dynamic_pointer_cast<ParametricFunDeclaration>(smtlib_nodemap[nakedPtr]);
-    if (option9) {
-        return option9->shared_from_this();
+FunSymbolDeclarationPtr cast(const NodePtr& node) {
+    switch (node->getKind()) {
+        case NodeKind::SPEC_CONST_FUN_DECLARATION:
+            return nodeCast<SpecConstFunDeclaration>(node);
+        case NodeKind::META_SPEC_CONST_FUN_DECLARATION:
+            return nodeCast<MetaSpecConstFunDeclaration>(node);
+        case NodeKind::SIMPLE_FUN_DECLARATION:
+            return nodeCast<SimpleFunDeclaration>(node);
+        case NodeKind::PARAMETRIC_FUN_DECLARATION:
+            return nodeCast<ParametricFunDeclaration>(node);
+        default:
+            return FunSymbolDeclarationPtr();
     }
-
-    throw;
 }
 
 template<>
-ConstructorPtr share(AstPtr nakedPtr) {
-    SymbolPtr option1 = dynamic_pointer_cast<Symbol>(smtlib_nodemap[nakedPtr]);
-    if (option1) {
-        return option1->shared_from_this();
+ConstructorPtr cast(const NodePtr& node) {
+    switch (node->getKind()) {
+        case NodeKind::SYMBOL:
+            return nodeCast<Symbol>(node);
+        case NodeKind::QUALIFIED_CONSTRUCTOR:
+            return nodeCast<QualifiedConstructor>(node);
+        default:
+            return ConstructorPtr();
     }
-
-    QualifiedConstructorPtr option2 = dynamic_pointer_cast<QualifiedConstructor>(smtlib_nodemap[nakedPtr]);
-    if (option2) {
-        return option2->shared_from_this();
-    }
-
-    throw;
 }
 
 template<>
-PatternPtr share(AstPtr nakedPtr) {
-    if (dynamic_cast<Constructor*>(nakedPtr)) {
-        return share<Constructor>(nakedPtr);
+PatternPtr cast(const NodePtr& node) {
+    switch (node->getKind()) {
+        case NodeKind::SYMBOL:
+            return nodeCast<Symbol>(node);
+        case NodeKind::QUALIFIED_CONSTRUCTOR:
+            return nodeCast<QualifiedConstructor>(node);
+        case NodeKind::QUALIFIED_PATTERN:
+            return nodeCast<QualifiedPattern>(node);
+        default:
+            return PatternPtr();
     }
-
-    SymbolPtr option1 = dynamic_pointer_cast<Symbol>(smtlib_nodemap[nakedPtr]);
-    if (option1) {
-        return option1->shared_from_this();
-    }
-
-    QualifiedPatternPtr option2 = dynamic_pointer_cast<QualifiedPattern>(smtlib_nodemap[nakedPtr]);
-    if (option2) {
-        return option2->shared_from_this();
-    }
-
-    throw;
 }
 
 template<>
-DatatypeDeclarationPtr share(AstPtr nakedPtr) {
-    SimpleDatatypeDeclarationPtr option1 =
-            dynamic_pointer_cast<SimpleDatatypeDeclaration>(smtlib_nodemap[nakedPtr]);
-    if (option1) {
-        return option1->shared_from_this();
+DatatypeDeclarationPtr cast(const NodePtr& node) {
+    switch (node->getKind()) {
+        case NodeKind::SIMPLE_DATATYPE_DECLARATION:
+            return nodeCast<SimpleDatatypeDeclaration>(node);
+        case NodeKind::PARAMETRIC_DATATYPE_DECLARATION:
+            return nodeCast<ParametricDatatypeDeclaration>(node);
+        default:
+            return DatatypeDeclarationPtr();
     }
-
-    ParametricDatatypeDeclarationPtr option2 =
-            dynamic_pointer_cast<ParametricDatatypeDeclaration>(smtlib_nodemap[nakedPtr]);
-    if (option2) {
-        return option2->shared_from_this();
-    }
-
-    throw;
 }
 
 template<>
-AttributeValuePtr share(AstPtr nakedPtr) {
-    BooleanValuePtr option1 = dynamic_pointer_cast<BooleanValue>(smtlib_nodemap[nakedPtr]);
-    if (option1) {
-        return option1->shared_from_this();
-    }
-
-    if (dynamic_cast<SpecConstant*>(nakedPtr)) {
-        return share<SpecConstant>(nakedPtr);
-    }
-
-    SortSymbolDeclarationPtr option5 = dynamic_pointer_cast<SortSymbolDeclaration>(smtlib_nodemap[nakedPtr]);
-    if (option5) {
-        return option5->shared_from_this();
-    }
-
-    if (dynamic_cast<FunSymbolDeclaration*>(nakedPtr)) {
-        return share<FunSymbolDeclaration>(nakedPtr);
+AttributeValuePtr cast(const NodePtr& node) {
+    switch (node->getKind()) {
+        case NodeKind::BOOLEAN_VALUE:
+            return nodeCast<BooleanValue>(node);
+        case NodeKind::NUMERAL_LITERAL:
+            return nodeCast<NumeralLiteral>(node);
+        case NodeKind::DECIMAL_LITERAL:
+            return nodeCast<DecimalLiteral>(node);
+        case NodeKind::STRING_LITERAL:
+            return nodeCast<StringLiteral>(node);
+        case NodeKind::SORT_SYMBOL_DECLARATION:
+            return nodeCast<SortSymbolDeclaration>(node);
+        case NodeKind::SPEC_CONST_FUN_DECLARATION:
+            return nodeCast<SpecConstFunDeclaration>(node);
+        case NodeKind::META_SPEC_CONST_FUN_DECLARATION:
+            return nodeCast<MetaSpecConstFunDeclaration>(node);
+        case NodeKind::SIMPLE_FUN_DECLARATION:
+            return nodeCast<SimpleFunDeclaration>(node);
+        case NodeKind::PARAMETRIC_FUN_DECLARATION:
+            return nodeCast<ParametricFunDeclaration>(node);
+        case NodeKind::SYMBOL:
+            return nodeCast<Symbol>(node);
+        case NodeKind::COMP_SEXPRESSION:
+            return nodeCast<CompSExpression>(node);
+        case NodeKind::COMP_ATTRIBUTE_VALUE:
+            return nodeCast<CompAttributeValue>(node);
+        default:
+            return AttributeValuePtr();
     }
-
-    SymbolPtr option10 = dynamic_pointer_cast<Symbol>(smtlib_nodemap[nakedPtr]);
-    if (option10) {
-        return option10->shared_from_this();
-    }
-
-    CompSExpressionPtr option11 = dynamic_pointer_cast<CompSExpression>(smtlib_nodemap[nakedPtr]);
-    if (option11) {
-        return option11->shared_from_this();
-    }
-
-    CompAttributeValuePtr option12 = dynamic_pointer_cast<CompAttributeValue>(smtlib_nodemap[nakedPtr]);
-    if (option12) {
-        return option12->shared_from_this();
-    }
-
-    throw;
 }
 
 template<>
-SExpressionPtr share(AstPtr nakedPtr) {
-    if (dynamic_cast<SpecConstant*>(nakedPtr)) {
-        return share<SpecConstant>(nakedPtr);
-    }
-
-    SymbolPtr option4 = dynamic_pointer_cast<Symbol>(smtlib_nodemap[nakedPtr]);
-    if (option4) {
-        return option4->shared_from_this();
+SExpressionPtr cast(const NodePtr& node) {
+    switch (node->getKind()) {
+        case NodeKind::NUMERAL_LITERAL:
+            return nodeCast<NumeralLiteral>(node);
+        case NodeKind::DECIMAL_LITERAL:
+            return nodeCast<DecimalLiteral>(node);
+        case NodeKind::STRING_LITERAL:
+            return nodeCast<StringLiteral>(node);
+        case NodeKind::SYMBOL:
+            return nodeCast<Symbol>(node);
+        case NodeKind::KEYWORD:
+            return nodeCast<Keyword>(node);
+        case NodeKind::COMP_SEXPRESSION:
+            return nodeCast<CompSExpression>(node);
+        default:
+            return SExpressionPtr();
     }
-
-    KeywordPtr option5 = dynamic_pointer_cast<Keyword>(smtlib_nodemap[nakedPtr]);
-    if (option5) {
-        return option5->shared_from_this();
-    }
-
-    CompSExpressionPtr option6 = dynamic_pointer_cast<CompSExpression>(smtlib_nodemap[nakedPtr]);
-    if (option6) {
-        return option6->shared_from_this();
-    }
-
-    throw;
 }
 
 template<>
-IdentifierPtr share(AstPtr nakedPtr) {
-    SimpleIdentifierPtr option1 = dynamic_pointer_cast<SimpleIdentifier>(smtlib_nodemap[nakedPtr]);
-    if (option1) {
-        return option1->shared_from_this();
+IdentifierPtr cast(const NodePtr& node) {
+    switch (node->getKind()) {
+        case NodeKind::SIMPLE_IDENTIFIER:
+            return nodeCast<SimpleIdentifier>(node);
+        case NodeKind::QUALIFIED_IDENTIFIER:
+            return nodeCast<QualifiedIdentifier>(node);
+        default:
+            return IdentifierPtr();
     }
-
-    QualifiedIdentifierPtr option2 = dynamic_pointer_cast<QualifiedIdentifier>(smtlib_nodemap[nakedPtr]);
-    if (option2) {
-        return option2->shared_from_this();
-    }
-
-    throw;
 }
 
 template<>
-TermPtr share(AstPtr nakedPtr) {
-    if (dynamic_cast<SpecConstant*>(nakedPtr)) {
-        return share<SpecConstant>(nakedPtr);
-    }
-
-    if (dynamic_cast<Identifier*>(nakedPtr)) {
-        return share<Identifier>(nakedPtr);
-    }
-
-    AnnotatedTermPtr option6 = dynamic_pointer_cast<AnnotatedTerm>(smtlib_nodemap[nakedPtr]);
-    if (option6) {
-        return option6->shared_from_this();
-    }
-
-    ExistsTermPtr option7 = dynamic_pointer_cast<ExistsTerm>(smtlib_nodemap[nakedPtr]);
-    if (option7) {
-        return option7->shared_from_this();
+TermPtr cast(const NodePtr& node) {
+    switch (node->getKind()) {
+        case NodeKind::NUMERAL_LITERAL:
+            return nodeCast<NumeralLiteral>(node);
+        case NodeKind::DECIMAL_LITERAL:
+            return nodeCast<DecimalLiteral>(node);
+        case NodeKind::STRING_LITERAL:
+            return nodeCast<StringLiteral>(node);
+        case NodeKind::SIMPLE_IDENTIFIER:
+            return nodeCast<SimpleIdentifier>(node);
+        case NodeKind::QUALIFIED_IDENTIFIER:
+            return nodeCast<QualifiedIdentifier>(node);
+        case NodeKind::ANNOTATED_TERM:
+            return nodeCast<AnnotatedTerm>(node);
+        case NodeKind::EXISTS_TERM:
+            return nodeCast<ExistsTerm>(node);
+        case NodeKind::FORALL_TERM:
+            return nodeCast<ForallTerm>(node);
+        case NodeKind::LET_TERM:
+            return nodeCast<LetTerm>(node);
+        case NodeKind::QUALIFIED_TERM:
+            return nodeCast<QualifiedTerm>(node);
+        case NodeKind::MATCH_TERM:
+            return nodeCast<MatchTerm>(node);
+        default:
+            return TermPtr();
     }
-
-    ForallTermPtr option8 = dynamic_pointer_cast<ForallTerm>(smtlib_nodemap[nakedPtr]);
-    if (option8) {
-        return option8->shared_from_this();
-    }
-
-    LetTermPtr option9 = dynamic_pointer_cast<LetTerm>(smtlib_nodemap[nakedPtr]);
-    if (option9) {
-        return option9->shared_from_this();
-    }
-
-    QualifiedTermPtr option10 = dynamic_pointer_cast<QualifiedTerm>(smtlib_nodemap[nakedPtr]);
-    if (option10) {
-        return option10->shared_from_this();
-    }
-
-    MatchTermPtr option11 = dynamic_pointer_cast<MatchTerm>(smtlib_nodemap[nakedPtr]);
-    if (option11) {
-        return option11->shared_from_this();
-    }
-
-    throw;
 }
 
 template<>
-IndexPtr share(AstPtr nakedPtr) {
-    NumeralLiteralPtr option1 = dynamic_pointer_cast<NumeralLiteral>(smtlib_nodemap[nakedPtr]);
-    if (option1) {
-        return option1->shared_from_this();
-    }
-
-    SymbolPtr option2 = dynamic_pointer_cast<Symbol>(smtlib_nodemap[nakedPtr]);
-    if (option2) {
-        return option2->shared_from_this();
+IndexPtr cast(const NodePtr& node) {
+    switch (node->getKind()) {
+        case NodeKind::NUMERAL_LITERAL:
+            return nodeCast<NumeralLiteral>(node);
+        case NodeKind::SYMBOL:
+            return nodeCast<Symbol>(node);
+        default:
+            return IndexPtr();
     }
+}
 
-    throw;
+template<class T>
+shared_ptr<T> share(SmtPrsr parser, AstPtr nakedPtr) {
+    return cast<T>(parser->claimNode(nakedPtr));
 }
 
 //namespace smtlib {
@@ -441,11 +293,11 @@ private:
     vector<AstPtr> v;
 public:
     template<class T>
-    vector<shared_ptr<T>> unwrap() {
+    vector<shared_ptr<T>> unwrap(SmtPrsr parser) {
         vector<shared_ptr<T>> result;
+        result.reserve(v.size());
         for (const auto& elem : v) {
-            shared_ptr<T> ptr = share<T>(elem);
-            result.push_back(ptr);
+            result.push_back(share<T>(parser, elem));
         }
         v.clear();
         return result;
@@ -461,11 +313,12 @@ private:
     vector<pair<AstPtr, AstPtr>> v;
 public:
     template<class T1, class T2>
-    vector<pair<shared_ptr<T1>, shared_ptr<T2>>> unwrap() {
+    vector<pair<shared_ptr<T1>, shared_ptr<T2>>> unwrap(SmtPrsr parser) {
         vector<pair<shared_ptr<T1>, shared_ptr<T2>>> result;
+        result.reserve(v.size());
         for (const auto& pair : v) {
-            shared_ptr<T1> ptr1 = share<T1>(pair.first);
-            shared_ptr<T1> ptr2 = share<T2>(pair.second);
+            shared_ptr<T1> ptr1 = share<T1>(parser, pair.first);
+            shared_ptr<T2> ptr2 = share<T2>(parser, pair.second);
             result.push_back(make_pair(ptr1, ptr2));
         }
         v.clear();
@@ -479,6 +332,22 @@ public:
 //}
 //}
 
+/** Unwrap the nodes of a list and release the list */
+template<class T>
+vector<shared_ptr<T>> unwrap(SmtPrsr parser, AstList list) {
+    vector<shared_ptr<T>> result = list->unwrap<T>(parser);
+    delete list;
+    return result;
+}
+
+/** Unwrap the node pairs of a list and release the list */
+template<class T1, class T2>
+vector<pair<shared_ptr<T1>, shared_ptr<T2>>> unwrap(SmtPrsr parser, AstPairList list) {
+    vector<pair<shared_ptr<T1>, shared_ptr<T2>>> result = list->unwrap<T1, T2>(parser);
+    delete list;
+    return result;
+}
+
 AstList ast_listCreate() {
     return new ParserInternalList();
 }
@@ -487,6 +356,14 @@ void ast_listAdd(AstList list, AstPtr item) {
     list->add(item);
 }
 
+void ast_addCommand(SmtPrsr parser, AstList cmds, AstPtr cmd) {
+    if (parser->hasCommandHandler()) {
+        parser->handleCommand(share<Command>(parser, cmd));
+    } else {
+        cmds->add(cmd);
+    }
+}
+
 void ast_listDelete(AstList list) {
     delete list;
 }
@@ -499,18 +376,21 @@ void ast_pairListAdd(AstPairList list, AstPtr item1, AstPtr item2) {
     list->add(item1, item2);
 }
 
-void ast_pairListDelete(AstList list) {
+void ast_pairListDelete(AstPairList list) {
     delete list;
 }
 
 void ast_print(AstPtr ptr) {
-    cout << ptr->toString();
+    cout << (*ptr)->toString();
+}
+
+void ast_echo(const char* text, size_t length) {
+    Logger::echo(text, length);
 }
 
 void ast_setAst(SmtPrsr parser, AstPtr ast) {
     if (parser && ast) {
-        parser->setAst(smtlib_nodemap[ast]);
-        smtlib_nodemap.clear();
+        parser->setAst(parser->claimNode(ast));
     }
 }
 
@@ -526,15 +406,12 @@ void ast_reportError(SmtPrsr parser,
 void ast_setLocation(SmtPrsr parser, AstPtr ptr,
                      int rowLeft, int colLeft,
                      int rowRight, int colRight) {
-    ptr->filename = parser->getFilename();
-    ptr->rowLeft = rowLeft;
-    ptr->colLeft = colLeft;
-    ptr->rowRight = rowRight;
-    ptr->colRight = colRight;
+    const NodePtr& node = *ptr;
+    node->span = parser->addSpan(rowLeft, colLeft, rowRight, colRight);
 }
 
-int ast_bool_value(AstPtr ptr) {
-    BooleanValuePtr val = share<BooleanValue>(ptr);
+int ast_bool_value(SmtPrsr, AstPtr ptr) {
+    BooleanValuePtr val = nodeCast<BooleanValue>(*ptr);
     if (val) {
         return val->value;
     } else {
@@ -543,537 +420,474 @@ int ast_bool_value(AstPtr ptr) {
 }
 
 // ast_attribute.h
-AstPtr ast_newAttribute1(AstPtr keyword) {
-    AttributePtr ptr = make_shared<Attribute>(std::move(share<Keyword>(keyword)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newAttribute1(SmtPrsr parser, AstPtr keyword) {
+    AttributePtr ptr = makeShared<Attribute>(parser->getArena(), share<Keyword>(parser, keyword));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newAttribute2(AstPtr keyword, AstPtr attr_value) {
-    AttributePtr ptr = make_shared<Attribute>(std::move(share<Keyword>(keyword)),
-                                              std::move(share<AttributeValue>(attr_value)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newAttribute2(SmtPrsr parser, AstPtr keyword, AstPtr attr_value) {
+    AttributePtr ptr = makeShared<Attribute>(parser->getArena(), share<Keyword>(parser, keyword),
+                                              share<AttributeValue>(parser, attr_value));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newCompAttributeValue(AstList values) {
+AstPtr ast_newCompAttributeValue(SmtPrsr parser, AstList values) {
     CompAttributeValuePtr ptr =
-            make_shared<CompAttributeValue>(std::move(values->unwrap<AttributeValue>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<CompAttributeValue>(parser->getArena(), unwrap<AttributeValue>(parser, values));
+    return parser->holdNode(ptr);
 }
 
 // ast_basic.h
-AstPtr ast_newSymbol(char const* value) {
-    SymbolPtr ptr = make_shared<Symbol>(value);
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newSymbol(SmtPrsr parser, char const* value) {
+    SymbolPtr ptr = makeShared<Symbol>(parser->getArena(), value);
+    return parser->holdNode(ptr);
+}
+
+AstPtr ast_newKeyword(SmtPrsr parser, char const* value) {
+    KeywordPtr ptr = makeShared<Keyword>(parser->getArena(), value);
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newKeyword(char const* value) {
-    KeywordPtr ptr = make_shared<Keyword>(value);
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newSimpleSymbol(SmtPrsr parser, char const* value) {
+    SymbolPtr ptr = makeShared<Symbol>(parser->getArena(), value);
+    ptr->wellFormed = true;
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newMetaSpecConstant(int value) {
+AstPtr ast_newSimpleKeyword(SmtPrsr parser, char const* value) {
+    KeywordPtr ptr = makeShared<Keyword>(parser->getArena(), value);
+    ptr->wellFormed = true;
+    return parser->holdNode(ptr);
+}
+
+AstPtr ast_newMetaSpecConstant(SmtPrsr parser, int value) {
     MetaSpecConstantPtr ptr =
-            make_shared<MetaSpecConstant>(static_cast<MetaSpecConstant::Type>(value));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<MetaSpecConstant>(parser->getArena(), static_cast<MetaSpecConstant::Type>(value));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newBooleanValue(int value) {
-    BooleanValuePtr ptr = make_shared<BooleanValue>((bool) value);
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newBooleanValue(SmtPrsr parser, int value) {
+    BooleanValuePtr ptr = makeShared<BooleanValue>(parser->getArena(), (bool) value);
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newPropLiteral(AstPtr symbol, int negated) {
+AstPtr ast_newPropLiteral(SmtPrsr parser, AstPtr symbol, int negated) {
     PropLiteralPtr ptr =
-            make_shared<PropLiteral>(std::move(share<Symbol>(symbol)), (bool) negated);
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<PropLiteral>(parser->getArena(), share<Symbol>(parser, symbol), (bool) negated);
+    return parser->holdNode(ptr);
 }
 
 // ast_command.h
-AstPtr ast_newAssertCommand(AstPtr term) {
-    AssertCommandPtr ptr = make_shared<AssertCommand>(share<Term>(term));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newAssertCommand(SmtPrsr parser, AstPtr term) {
+    AssertCommandPtr ptr = makeShared<AssertCommand>(parser->getArena(), share<Term>(parser, term));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newCheckSatCommand() {
-    CheckSatCommandPtr ptr = make_shared<CheckSatCommand>();
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newCheckSatCommand(SmtPrsr parser) {
+    CheckSatCommandPtr ptr = makeShared<CheckSatCommand>(parser->getArena());
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newCheckUnsatCommand() {
-    CheckUnsatCommandPtr ptr = make_shared<CheckUnsatCommand>();
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newCheckUnsatCommand(SmtPrsr parser) {
+    CheckUnsatCommandPtr ptr = makeShared<CheckUnsatCommand>(parser->getArena());
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newCheckSatAssumCommand(AstList assumptions) {
+AstPtr ast_newCheckSatAssumCommand(SmtPrsr parser, AstList assumptions) {
     CheckSatAssumCommandPtr ptr =
-            make_shared<CheckSatAssumCommand>(std::move(assumptions->unwrap<PropLiteral>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<CheckSatAssumCommand>(parser->getArena(), unwrap<PropLiteral>(parser, assumptions));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newDeclareConstCommand(AstPtr symbol, AstPtr sort) {
+AstPtr ast_newDeclareConstCommand(SmtPrsr parser, AstPtr symbol, AstPtr sort) {
     DeclareConstCommandPtr ptr =
-            make_shared<DeclareConstCommand>(std::move(share<Symbol>(symbol)),
-                                             std::move(share<Sort>(sort)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<DeclareConstCommand>(parser->getArena(), share<Symbol>(parser, symbol),
+                                             share<Sort>(parser, sort));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newDeclareDatatypeCommand(AstPtr symbol, AstPtr declaration) {
+AstPtr ast_newDeclareDatatypeCommand(SmtPrsr parser, AstPtr symbol, AstPtr declaration) {
     DeclareDatatypeCommandPtr ptr =
-            make_shared<DeclareDatatypeCommand>(std::move(share<Symbol>(symbol)),
-                                                std::move(share<DatatypeDeclaration>(declaration)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<DeclareDatatypeCommand>(parser->getArena(), share<Symbol>(parser, symbol),
+                                                share<DatatypeDeclaration>(parser, declaration));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newDeclareDatatypesCommand(AstList sorts, AstList declarations) {
+AstPtr ast_newDeclareDatatypesCommand(SmtPrsr parser, AstList sorts, AstList declarations) {
     DeclareDatatypesCommandPtr ptr =
-            make_shared<DeclareDatatypesCommand>(std::move(sorts->unwrap<SortDeclaration>()),
-                                                 std::move(declarations->unwrap<DatatypeDeclaration>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<DeclareDatatypesCommand>(parser->getArena(), unwrap<SortDeclaration>(parser, sorts),
+                                                 unwrap<DatatypeDeclaration>(parser, declarations));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newDeclareFunCommand(AstPtr symbol, AstList params, AstPtr sort) {
-    DeclareFunCommandPtr ptr = make_shared<DeclareFunCommand>(std::move(share<Symbol>(symbol)),
-                                                              std::move(params->unwrap<Sort>()),
-                                                              std::move(share<Sort>(sort)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newDeclareFunCommand(SmtPrsr parser, AstPtr symbol, AstList params, AstPtr sort) {
+    DeclareFunCommandPtr ptr = makeShared<DeclareFunCommand>(parser->getArena(), share<Symbol>(parser, symbol),
+                                                              unwrap<Sort>(parser, params),
+                                                              share<Sort>(parser, sort));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newDeclareSortCommand(AstPtr symbol, AstPtr arity) {
+AstPtr ast_newDeclareSortCommand(SmtPrsr parser, AstPtr symbol, AstPtr arity) {
     DeclareSortCommandPtr ptr =
-            make_shared<DeclareSortCommand>(std::move(share<Symbol>(symbol)),
-                                            std::move(share<NumeralLiteral>(arity)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<DeclareSortCommand>(parser->getArena(), share<Symbol>(parser, symbol),
+                                            share<NumeralLiteral>(parser, arity));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newDeclareHeapCommand(AstPairList pairs) {
+AstPtr ast_newDeclareHeapCommand(SmtPrsr parser, AstPairList pairs) {
     DeclareHeapCommandPtr ptr =
-            make_shared<DeclareHeapCommand>(std::move(pairs->unwrap<Sort, Sort>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<DeclareHeapCommand>(parser->getArena(), unwrap<Sort, Sort>(parser, pairs));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newDefineFunCommand(AstPtr definition) {
+AstPtr ast_newDefineFunCommand(SmtPrsr parser, AstPtr definition) {
     DefineFunCommandPtr ptr =
-            make_shared<DefineFunCommand>(std::move(share<FunctionDefinition>(definition)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<DefineFunCommand>(parser->getArena(), share<FunctionDefinition>(parser, definition));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newDefineFunRecCommand(AstPtr definition) {
+AstPtr ast_newDefineFunRecCommand(SmtPrsr parser, AstPtr definition) {
     DefineFunRecCommandPtr ptr =
-            make_shared<DefineFunRecCommand>(std::move(share<FunctionDefinition>(definition)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<DefineFunRecCommand>(parser->getArena(), share<FunctionDefinition>(parser, definition));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newDefineFunsRecCommand(AstList declarations, AstList bodies) {
+AstPtr ast_newDefineFunsRecCommand(SmtPrsr parser, AstList declarations, AstList bodies) {
     DefineFunsRecCommandPtr ptr =
-            make_shared<DefineFunsRecCommand>(std::move(declarations->unwrap<FunctionDeclaration>()),
-                                              std::move(bodies->unwrap<Term>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<DefineFunsRecCommand>(parser->getArena(), unwrap<FunctionDeclaration>(parser, declarations),
+                                              unwrap<Term>(parser, bodies));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newDefineSortCommand(AstPtr symbol, AstList params, AstPtr sort) {
-    DefineSortCommandPtr ptr = make_shared<DefineSortCommand>(std::move(share<Symbol>(symbol)),
-                                                              std::move(params->unwrap<Symbol>()),
-                                                              std::move(share<Sort>(sort)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newDefineSortCommand(SmtPrsr parser, AstPtr symbol, AstList params, AstPtr sort) {
+    DefineSortCommandPtr ptr = makeShared<DefineSortCommand>(parser->getArena(), share<Symbol>(parser, symbol),
+                                                              unwrap<Symbol>(parser, params),
+                                                              share<Sort>(parser, sort));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newEchoCommand(AstPtr msg) {
-    EchoCommandPtr ptr = make_shared<EchoCommand>(share<StringLiteral>(msg)->value);
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newEchoCommand(SmtPrsr parser, AstPtr msg) {
+    EchoCommandPtr ptr = makeShared<EchoCommand>(parser->getArena(), share<StringLiteral>(parser, msg)->value);
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newExitCommand() {
-    ExitCommandPtr ptr = make_shared<ExitCommand>();
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newExitCommand(SmtPrsr parser) {
+    ExitCommandPtr ptr = makeShared<ExitCommand>(parser->getArena());
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newGetAssertsCommand() {
-    GetAssertsCommandPtr ptr = make_shared<GetAssertsCommand>();
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newGetAssertsCommand(SmtPrsr parser) {
+    GetAssertsCommandPtr ptr = makeShared<GetAssertsCommand>(parser->getArena());
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newGetAssignsCommand() {
-    GetAssignsCommandPtr ptr = make_shared<GetAssignsCommand>();
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newGetAssignsCommand(SmtPrsr parser) {
+    GetAssignsCommandPtr ptr = makeShared<GetAssignsCommand>(parser->getArena());
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newGetInfoCommand(AstPtr keyword) {
-    GetInfoCommandPtr ptr = make_shared<GetInfoCommand>(std::move(share<Keyword>(keyword)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newGetInfoCommand(SmtPrsr parser, AstPtr keyword) {
+    GetInfoCommandPtr ptr = makeShared<GetInfoCommand>(parser->getArena(), share<Keyword>(parser, keyword));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newGetModelCommand() {
-    GetModelCommandPtr ptr = make_shared<GetModelCommand>();
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newGetModelCommand(SmtPrsr parser) {
+    GetModelCommandPtr ptr = makeShared<GetModelCommand>(parser->getArena());
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newGetOptionCommand(AstPtr keyword) {
-    GetOptionCommandPtr ptr = make_shared<GetOptionCommand>(std::move(share<Keyword>(keyword)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newGetOptionCommand(SmtPrsr parser, AstPtr keyword) {
+    GetOptionCommandPtr ptr = makeShared<GetOptionCommand>(parser->getArena(), share<Keyword>(parser, keyword));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newGetProofCommand() {
-    GetProofCommandPtr ptr = make_shared<GetProofCommand>();
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newGetProofCommand(SmtPrsr parser) {
+    GetProofCommandPtr ptr = makeShared<GetProofCommand>(parser->getArena());
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newGetUnsatAssumsCommand() {
-    GetUnsatAssumsCommandPtr ptr = make_shared<GetUnsatAssumsCommand>();
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newGetUnsatAssumsCommand(SmtPrsr parser) {
+    GetUnsatAssumsCommandPtr ptr = makeShared<GetUnsatAssumsCommand>(parser->getArena());
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newGetUnsatCoreCommand() {
-    GetUnsatCoreCommandPtr ptr = make_shared<GetUnsatCoreCommand>();
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newGetUnsatCoreCommand(SmtPrsr parser) {
+    GetUnsatCoreCommandPtr ptr = makeShared<GetUnsatCoreCommand>(parser->getArena());
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newGetValueCommand(AstList terms) {
-    GetValueCommandPtr ptr = make_shared<GetValueCommand>(std::move(terms->unwrap<Term>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newGetValueCommand(SmtPrsr parser, AstList terms) {
+    GetValueCommandPtr ptr = makeShared<GetValueCommand>(parser->getArena(), unwrap<Term>(parser, terms));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newPopCommand(AstPtr numeral) {
-    PopCommandPtr ptr = make_shared<PopCommand>(std::move(share<NumeralLiteral>(numeral)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newPopCommand(SmtPrsr parser, AstPtr numeral) {
+    PopCommandPtr ptr = makeShared<PopCommand>(parser->getArena(), share<NumeralLiteral>(parser, numeral));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newPushCommand(AstPtr numeral) {
-    PushCommandPtr ptr = make_shared<PushCommand>(std::move(share<NumeralLiteral>(numeral)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newPushCommand(SmtPrsr parser, AstPtr numeral) {
+    PushCommandPtr ptr = makeShared<PushCommand>(parser->getArena(), share<NumeralLiteral>(parser, numeral));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newResetCommand() {
-    ResetCommandPtr ptr = make_shared<ResetCommand>();
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newResetCommand(SmtPrsr parser) {
+    ResetCommandPtr ptr = makeShared<ResetCommand>(parser->getArena());
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newResetAssertsCommand() {
-    ResetAssertsCommandPtr ptr = make_shared<ResetAssertsCommand>();
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newResetAssertsCommand(SmtPrsr parser) {
+    ResetAssertsCommandPtr ptr = makeShared<ResetAssertsCommand>(parser->getArena());
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newSetInfoCommand(AstPtr info) {
-    SetInfoCommandPtr ptr = make_shared<SetInfoCommand>(std::move(share<Attribute>(info)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newSetInfoCommand(SmtPrsr parser, AstPtr info) {
+    SetInfoCommandPtr ptr = makeShared<SetInfoCommand>(parser->getArena(), share<Attribute>(parser, info));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newSetLogicCommand(AstPtr logic) {
-    SetLogicCommandPtr ptr = make_shared<SetLogicCommand>(std::move(share<Symbol>(logic)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newSetLogicCommand(SmtPrsr parser, AstPtr logic) {
+    SetLogicCommandPtr ptr = makeShared<SetLogicCommand>(parser->getArena(), share<Symbol>(parser, logic));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newSetOptionCommand(AstPtr option) {
-    SetOptionCommandPtr ptr = make_shared<SetOptionCommand>(std::move(share<Attribute>(option)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newSetOptionCommand(SmtPrsr parser, AstPtr option) {
+    SetOptionCommandPtr ptr = makeShared<SetOptionCommand>(parser->getArena(), share<Attribute>(parser, option));
+    return parser->holdNode(ptr);
 }
 
 //ast_datatype.h
-AstPtr ast_newSortDeclaration(AstPtr symbol, AstPtr numeral) {
+AstPtr ast_newSortDeclaration(SmtPrsr parser, AstPtr symbol, AstPtr numeral) {
     SortDeclarationPtr ptr =
-            make_shared<SortDeclaration>(std::move(share<Symbol>(symbol)),
-                                         std::move(share<NumeralLiteral>(numeral)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<SortDeclaration>(parser->getArena(), share<Symbol>(parser, symbol),
+                                         share<NumeralLiteral>(parser, numeral));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newSelectorDeclaration(AstPtr symbol, AstPtr sort) {
+AstPtr ast_newSelectorDeclaration(SmtPrsr parser, AstPtr symbol, AstPtr sort) {
     SelectorDeclarationPtr ptr =
-            make_shared<SelectorDeclaration>(std::move(share<Symbol>(symbol)),
-                                             std::move(share<Sort>(sort)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<SelectorDeclaration>(parser->getArena(), share<Symbol>(parser, symbol),
+                                             share<Sort>(parser, sort));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newConstructorDeclaration(AstPtr symbol, AstList selectors) {
+AstPtr ast_newConstructorDeclaration(SmtPrsr parser, AstPtr symbol, AstList selectors) {
     ConstructorDeclarationPtr ptr =
-            make_shared<ConstructorDeclaration>(std::move(share<Symbol>(symbol)),
-                                                std::move(selectors->unwrap<SelectorDeclaration>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<ConstructorDeclaration>(parser->getArena(), share<Symbol>(parser, symbol),
+                                                unwrap<SelectorDeclaration>(parser, selectors));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newSimpleDatatypeDeclaration(AstList constructors) {
+AstPtr ast_newSimpleDatatypeDeclaration(SmtPrsr parser, AstList constructors) {
     SimpleDatatypeDeclarationPtr ptr =
-            make_shared<SimpleDatatypeDeclaration>(std::move(constructors->unwrap<ConstructorDeclaration>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<SimpleDatatypeDeclaration>(parser->getArena(), unwrap<ConstructorDeclaration>(parser, constructors));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newParametricDatatypeDeclaration(AstList params, AstList constructors) {
+AstPtr ast_newParametricDatatypeDeclaration(SmtPrsr parser, AstList params, AstList constructors) {
     ParametricDatatypeDeclarationPtr ptr =
-            make_shared<ParametricDatatypeDeclaration>(std::move(params->unwrap<Symbol>()),
-                                                       std::move(constructors->unwrap<ConstructorDeclaration>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<ParametricDatatypeDeclaration>(parser->getArena(), unwrap<Symbol>(parser, params),
+                                                       unwrap<ConstructorDeclaration>(parser, constructors));
+    return parser->holdNode(ptr);
 }
 
 // ast_fun.h
-AstPtr ast_newFunctionDeclaration(AstPtr symbol, AstList params, AstPtr sort) {
+AstPtr ast_newFunctionDeclaration(SmtPrsr parser, AstPtr symbol, AstList params, AstPtr sort) {
     FunctionDeclarationPtr ptr =
-            make_shared<FunctionDeclaration>(std::move(share<Symbol>(symbol)),
-                                             std::move(params->unwrap<SortedVariable>()),
-                                             std::move(share<Sort>(sort)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<FunctionDeclaration>(parser->getArena(), share<Symbol>(parser, symbol),
+                                             unwrap<SortedVariable>(parser, params),
+                                             share<Sort>(parser, sort));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newFunctionDefinition(AstPtr signature, AstPtr body) {
+AstPtr ast_newFunctionDefinition(SmtPrsr parser, AstPtr signature, AstPtr body) {
     FunctionDefinitionPtr ptr =
-            make_shared<FunctionDefinition>(std::move(share<FunctionDeclaration>(signature)),
-                                            std::move(share<Term>(body)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<FunctionDefinition>(parser->getArena(), share<FunctionDeclaration>(parser, signature),
+                                            share<Term>(parser, body));
+    return parser->holdNode(ptr);
 }
 
 // ast_identifier.h
-AstPtr ast_newSimpleIdentifier1(AstPtr symbol) {
-    SimpleIdentifierPtr ptr = make_shared<SimpleIdentifier>(std::move(share<Symbol>(symbol)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newSimpleIdentifier1(SmtPrsr parser, AstPtr symbol) {
+    SimpleIdentifierPtr ptr = makeShared<SimpleIdentifier>(parser->getArena(), share<Symbol>(parser, symbol));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newSimpleIdentifier2(AstPtr symbol, AstList indices) {
-    SimpleIdentifierPtr ptr = make_shared<SimpleIdentifier>(std::move(share<Symbol>(symbol)),
-                                                            std::move(indices->unwrap<Index>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newSimpleIdentifier2(SmtPrsr parser, AstPtr symbol, AstList indices) {
+    SimpleIdentifierPtr ptr = makeShared<SimpleIdentifier>(parser->getArena(), share<Symbol>(parser, symbol),
+                                                            unwrap<Index>(parser, indices));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newQualifiedIdentifier(AstPtr identifier, AstPtr sort) {
+AstPtr ast_newQualifiedIdentifier(SmtPrsr parser, AstPtr identifier, AstPtr sort) {
     QualifiedIdentifierPtr ptr =
-            make_shared<QualifiedIdentifier>(std::move(share<SimpleIdentifier>(identifier)),
-                                             std::move(share<Sort>(sort)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<QualifiedIdentifier>(parser->getArena(), share<SimpleIdentifier>(parser, identifier),
+                                             share<Sort>(parser, sort));
+    return parser->holdNode(ptr);
 }
 
 // ast_literal.h
-AstPtr ast_newNumeralLiteral(long value, unsigned int base) {
-    NumeralLiteralPtr ptr = make_shared<NumeralLiteral>(value, base);
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newNumeralLiteral(SmtPrsr parser, long value, unsigned int base) {
+    NumeralLiteralPtr ptr = makeShared<NumeralLiteral>(parser->getArena(), value, base);
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newDecimalLiteral(double value) {
-    DecimalLiteralPtr ptr = make_shared<DecimalLiteral>(value);
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newDecimalLiteral(SmtPrsr parser, double value) {
+    DecimalLiteralPtr ptr = makeShared<DecimalLiteral>(parser->getArena(), value);
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newStringLiteral(char const* value) {
-    StringLiteralPtr ptr = make_shared<StringLiteral>(value);
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newStringLiteral(SmtPrsr parser, char const* value) {
+    StringLiteralPtr ptr = makeShared<StringLiteral>(parser->getArena(), value);
+    return parser->holdNode(ptr);
 }
 
 // ast_logic.h
-AstPtr ast_newLogic(AstPtr name, AstList attributes) {
-    LogicPtr ptr = make_shared<Logic>(std::move(share<Symbol>(name)),
-                                      std::move(attributes->unwrap<Attribute>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newLogic(SmtPrsr parser, AstPtr name, AstList attributes) {
+    LogicPtr ptr = makeShared<Logic>(parser->getArena(), share<Symbol>(parser, name),
+                                      unwrap<Attribute>(parser, attributes));
+    return parser->holdNode(ptr);
 }
 
 // ast_match.h
-AstPtr ast_newQualifiedConstructor(AstPtr symbol, AstPtr sort) {
+AstPtr ast_newQualifiedConstructor(SmtPrsr parser, AstPtr symbol, AstPtr sort) {
     QualifiedConstructorPtr ptr =
-            make_shared<QualifiedConstructor>(std::move(share<Symbol>(symbol)),
-                                              std::move(share<Sort>(sort)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<QualifiedConstructor>(parser->getArena(), share<Symbol>(parser, symbol),
+                                              share<Sort>(parser, sort));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newQualifiedPattern(AstPtr constructor, AstList symbols) {
-    QualifiedPatternPtr ptr = make_shared<QualifiedPattern>(std::move(share<Constructor>(constructor)),
-                                                            std::move(symbols->unwrap<Symbol>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newQualifiedPattern(SmtPrsr parser, AstPtr constructor, AstList symbols) {
+    QualifiedPatternPtr ptr = makeShared<QualifiedPattern>(parser->getArena(), share<Constructor>(parser, constructor),
+                                                            unwrap<Symbol>(parser, symbols));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newMatchCase(AstPtr pattern, AstPtr term) {
-    MatchCasePtr ptr = make_shared<MatchCase>(std::move(share<Pattern>(pattern)),
-                                              std::move(share<Term>(term)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newMatchCase(SmtPrsr parser, AstPtr pattern, AstPtr term) {
+    MatchCasePtr ptr = makeShared<MatchCase>(parser->getArena(), share<Pattern>(parser, pattern),
+                                              share<Term>(parser, term));
+    return parser->holdNode(ptr);
 }
 
 // ast_s_expr.h
-AstPtr ast_newCompSExpression(AstList exprs) {
-    CompSExpressionPtr ptr = make_shared<CompSExpression>(std::move(exprs->unwrap<SExpression>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newCompSExpression(SmtPrsr parser, AstList exprs) {
+    CompSExpressionPtr ptr = makeShared<CompSExpression>(parser->getArena(), unwrap<SExpression>(parser, exprs));
+    return parser->holdNode(ptr);
 }
 
 // ast_script.h
-AstPtr ast_newScript(AstList cmds) {
-    ScriptPtr ptr = make_shared<Script>(std::move(cmds->unwrap<Command>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newScript(SmtPrsr parser, AstList cmds) {
+    ScriptPtr ptr = makeShared<Script>(parser->getArena(), unwrap<Command>(parser, cmds));
+    return parser->holdNode(ptr);
 }
 
 // ast_sort.h
-AstPtr ast_newSort1(AstPtr identifier) {
-    SortPtr ptr = make_shared<Sort>(std::move(share<SimpleIdentifier>(identifier)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newSort1(SmtPrsr parser, AstPtr identifier) {
+    SortPtr ptr = makeShared<Sort>(parser->getArena(), share<SimpleIdentifier>(parser, identifier));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newSort2(AstPtr identifier, AstList params) {
-    SortPtr ptr = make_shared<Sort>(std::move(share<SimpleIdentifier>(identifier)),
-                                    std::move(params->unwrap<Sort>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newSort2(SmtPrsr parser, AstPtr identifier, AstList params) {
+    SortPtr ptr = makeShared<Sort>(parser->getArena(), share<SimpleIdentifier>(parser, identifier),
+                                    unwrap<Sort>(parser, params));
+    return parser->holdNode(ptr);
 }
 
 // ast_symbol_decl.h
-AstPtr ast_newSortSymbolDeclaration(AstPtr identifier, AstPtr arity, AstList attributes) {
+AstPtr ast_newSortSymbolDeclaration(SmtPrsr parser, AstPtr identifier, AstPtr arity, AstList attributes) {
     SortSymbolDeclarationPtr ptr =
-            make_shared<SortSymbolDeclaration>(std::move(share<SimpleIdentifier>(identifier)),
-                                               std::move(share<NumeralLiteral>(arity)),
-                                               std::move(attributes->unwrap<Attribute>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<SortSymbolDeclaration>(parser->getArena(), share<SimpleIdentifier>(parser, identifier),
+                                               share<NumeralLiteral>(parser, arity),
+                                               unwrap<Attribute>(parser, attributes));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newSpecConstFunDeclaration(AstPtr constant, AstPtr sort, AstList attributes) {
+AstPtr ast_newSpecConstFunDeclaration(SmtPrsr parser, AstPtr constant, AstPtr sort, AstList attributes) {
     SpecConstFunDeclarationPtr ptr =
-            make_shared<SpecConstFunDeclaration>(std::move(share<SpecConstant>(constant)),
-                                                 std::move(share<Sort>(sort)),
-                                                 std::move(attributes->unwrap<Attribute>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<SpecConstFunDeclaration>(parser->getArena(), share<SpecConstant>(parser, constant),
+                                                 share<Sort>(parser, sort),
+                                                 unwrap<Attribute>(parser, attributes));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newMetaSpecConstFunDeclaration(AstPtr constant, AstPtr sort, AstList attributes) {
+AstPtr ast_newMetaSpecConstFunDeclaration(SmtPrsr parser, AstPtr constant, AstPtr sort, AstList attributes) {
     MetaSpecConstFunDeclarationPtr ptr =
-            make_shared<MetaSpecConstFunDeclaration>(std::move(share<MetaSpecConstant>(constant)),
-                                                     std::move(share<Sort>(sort)),
-                                                     std::move(attributes->unwrap<Attribute>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<MetaSpecConstFunDeclaration>(parser->getArena(), share<MetaSpecConstant>(parser, constant),
+                                                     share<Sort>(parser, sort),
+                                                     unwrap<Attribute>(parser, attributes));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newSimpleFunDeclaration(AstPtr identifier, AstList signature, AstList attributes) {
+AstPtr ast_newSimpleFunDeclaration(SmtPrsr parser, AstPtr identifier, AstList signature, AstList attributes) {
     SimpleFunDeclarationPtr ptr =
-            make_shared<SimpleFunDeclaration>(std::move(share<SimpleIdentifier>(identifier)),
-                                              std::move(signature->unwrap<Sort>()),
-                                              std::move(attributes->unwrap<Attribute>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<SimpleFunDeclaration>(parser->getArena(), share<SimpleIdentifier>(parser, identifier),
+                                              unwrap<Sort>(parser, signature),
+                                              unwrap<Attribute>(parser, attributes));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newParametricFunDeclaration(AstList params, AstPtr identifier, AstList signature, AstList attributes) {
+AstPtr ast_newParametricFunDeclaration(SmtPrsr parser, AstList params, AstPtr identifier, AstList signature, AstList attributes) {
     ParametricFunDeclarationPtr ptr =
-            make_shared<ParametricFunDeclaration>(std::move(params->unwrap<Symbol>()),
-                                                  std::move(share<SimpleIdentifier>(identifier)),
-                                                  std::move(signature->unwrap<Sort>()),
-                                                  std::move(attributes->unwrap<Attribute>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+            makeShared<ParametricFunDeclaration>(parser->getArena(), unwrap<Symbol>(parser, params),
+                                                  share<SimpleIdentifier>(parser, identifier),
+                                                  unwrap<Sort>(parser, signature),
+                                                  unwrap<Attribute>(parser, attributes));
+    return parser->holdNode(ptr);
 }
 
 // ast_term.h
-AstPtr ast_newQualifiedTerm(AstPtr identifier, AstList terms) {
-    QualifiedTermPtr ptr = make_shared<QualifiedTerm>(std::move(share<Identifier>(identifier)),
-                                                      std::move(terms->unwrap<Term>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newQualifiedTerm(SmtPrsr parser, AstPtr identifier, AstList terms) {
+    QualifiedTermPtr ptr = makeShared<QualifiedTerm>(parser->getArena(), share<Identifier>(parser, identifier),
+                                                      unwrap<Term>(parser, terms));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newLetTerm(AstList bindings, AstPtr term) {
-    LetTermPtr ptr = make_shared<LetTerm>(std::move(bindings->unwrap<VariableBinding>()),
-                                          std::move(share<Term>(term)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newLetTerm(SmtPrsr parser, AstList bindings, AstPtr term) {
+    LetTermPtr ptr = makeShared<LetTerm>(parser->getArena(), unwrap<VariableBinding>(parser, bindings),
+                                          share<Term>(parser, term));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newForallTerm(AstList bindings, AstPtr term) {
-    ForallTermPtr ptr = make_shared<ForallTerm>(std::move(bindings->unwrap<SortedVariable>()),
-                                                std::move(share<Term>(term)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newForallTerm(SmtPrsr parser, AstList bindings, AstPtr term) {
+    ForallTermPtr ptr = makeShared<ForallTerm>(parser->getArena(), unwrap<SortedVariable>(parser, bindings),
+                                                share<Term>(parser, term));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newExistsTerm(AstList bindings, AstPtr term) {
-    ExistsTermPtr ptr = make_shared<ExistsTerm>(std::move(bindings->unwrap<SortedVariable>()),
-                                                std::move(share<Term>(term)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newExistsTerm(SmtPrsr parser, AstList bindings, AstPtr term) {
+    ExistsTermPtr ptr = makeShared<ExistsTerm>(parser->getArena(), unwrap<SortedVariable>(parser, bindings),
+                                                share<Term>(parser, term));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newMatchTerm(AstPtr term, AstList cases) {
-    MatchTermPtr ptr = make_shared<MatchTerm>(std::move(share<Term>(term)),
-                                              std::move(cases->unwrap<MatchCase>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newMatchTerm(SmtPrsr parser, AstPtr term, AstList cases) {
+    MatchTermPtr ptr = makeShared<MatchTerm>(parser->getArena(), share<Term>(parser, term),
+                                              unwrap<MatchCase>(parser, cases));
+    return parser->holdNode(ptr);
 }
 
-AstPtr ast_newAnnotatedTerm(AstPtr term, AstList attrs) {
-    AnnotatedTermPtr ptr = make_shared<AnnotatedTerm>(std::move(share<Term>(term)),
-                                                      std::move(attrs->unwrap<Attribute>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newAnnotatedTerm(SmtPrsr parser, AstPtr term, AstList attrs) {
+    AnnotatedTermPtr ptr = makeShared<AnnotatedTerm>(parser->getArena(), share<Term>(parser, term),
+                                                      unwrap<Attribute>(parser, attrs));
+    return parser->holdNode(ptr);
 }
 
 // ast_theory.h
-AstPtr ast_newTheory(AstPtr name, AstList attributes) {
-    TheoryPtr ptr = make_shared<Theory>(std::move(share<Symbol>(name)),
-                                        std::move(attributes->unwrap<Attribute>()));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newTheory(SmtPrsr parser, AstPtr name, AstList attributes) {
+    TheoryPtr ptr = makeShared<Theory>(parser->getArena(), share<Symbol>(parser, name),
+                                        unwrap<Attribute>(parser, attributes));
+    return parser->holdNode(ptr);
 }
 
 // ast_variable.h
-AstPtr ast_newSortedVariable(AstPtr symbol, AstPtr sort) {
-    SortedVariablePtr ptr = make_shared<SortedVariable>(std::move(share<Symbol>(symbol)),
-                                                        std::move(share<Sort>(sort)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
-}
-
-AstPtr ast_newVariableBinding(AstPtr symbol, AstPtr term) {
-    VariableBindingPtr ptr = make_shared<VariableBinding>(std::move(share<Symbol>(symbol)),
-                                                          std::move(share<Term>(term)));
-    smtlib_nodemap[ptr.get()] = ptr;
-    return ptr.get();
+AstPtr ast_newSortedVariable(SmtPrsr parser, AstPtr symbol, AstPtr sort) {
+    SortedVariablePtr ptr = makeShared<SortedVariable>(parser->getArena(), share<Symbol>(parser, symbol),
+                                                        share<Sort>(parser, sort));
+    return parser->holdNode(ptr);
+}
+
+AstPtr ast_newVariableBinding(SmtPrsr parser, AstPtr symbol, AstPtr term) {
+    VariableBindingPtr ptr = makeShared<VariableBinding>(parser->getArena(), share<Symbol>(parser, symbol),
+                                                          share<Term>(parser, term));
+    return parser->holdNode(ptr);
 }
@@ -14,7 +14,8 @@ namespace smtlib {
 class ParserInternalList;
 class ParserInternalPairList;
 
-typedef class smtlib::ast::Node* AstPtr;
+/* Slot of a node held by the parser until claimed by its parent node */
+typedef smtlib::ast::NodePtr* AstPtr;
 typedef class ParserInternalList* AstList;
 typedef class ParserInternalPairList* AstPairList;
 typedef class smtlib::Parser* SmtPrsr;
@@ -22,16 +23,28 @@ typedef class smtlib::Parser* SmtPrsr;
 typedef void *AstPtr, *AstList, *AstPairList, *SmtPrsr;
 #endif
 
+#include <stdio.h>
+
+/* Opaque handle to a reentrant scanner instance (same as the flex yyscan_t) */
+typedef void* SmtScanner;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-int smt_yylex(void);
-int smt_yyparse(SmtPrsr);
+int smt_yylex_init_extra(SmtPrsr parser, SmtScanner* scanner);
+int smt_yylex_destroy(SmtScanner scanner);
+void smt_yyset_in(FILE* in, SmtScanner scanner);
+void smt_yyset_lineno(int line, SmtScanner scanner);
+void smt_yyset_column(int column, SmtScanner scanner);
+struct yy_buffer_state* smt_yy_scan_buffer(char* base, size_t size, SmtScanner scanner);
+int smt_yyparse(SmtPrsr parser, SmtScanner scanner);
 
 void ast_print(AstPtr ptr);
+void ast_echo(const char* text, size_t length);
 
 void ast_setAst(SmtPrsr parser, AstPtr ast);
+void ast_addCommand(SmtPrsr parser, AstList cmds, AstPtr cmd);
 void ast_reportError(SmtPrsr parser,
                      int rowLeft, int colLeft,
                      int rowRight, int colRight,
@@ -49,114 +62,117 @@ void ast_setLocation(SmtPrsr parser, AstPtr ptr,
                      int rowLeft, int colLeft,
                      int rowRight, int colRight);
 
-int ast_bool_value(AstPtr ptr);
+int ast_bool_value(SmtPrsr parser, AstPtr ptr);
 
 // ast_attribute.h
-AstPtr ast_newAttribute1(AstPtr keyword);
-AstPtr ast_newAttribute2(AstPtr keyword, AstPtr attr_value);
-AstPtr ast_newCompAttributeValue(AstList values);
+AstPtr ast_newAttribute1(SmtPrsr parser, AstPtr keyword);
+AstPtr ast_newAttribute2(SmtPrsr parser, AstPtr keyword, AstPtr attr_value);
+AstPtr ast_newCompAttributeValue(SmtPrsr parser, AstList values);
 
 // ast_basic.h
-AstPtr ast_newSymbol(char const* value);
-AstPtr ast_newKeyword(char const* value);
-AstPtr ast_newMetaSpecConstant(int value);
-AstPtr ast_newBooleanValue(int value);
-AstPtr ast_newPropLiteral(AstPtr symbol, int negated);
+AstPtr ast_newSymbol(SmtPrsr parser, char const* value);
+AstPtr ast_newKeyword(SmtPrsr parser, char const* value);
+/* Symbols and keywords the lexer matched with the simple symbol rules, whose syntax need not be checked again */
+AstPtr ast_newSimpleSymbol(SmtPrsr parser, char const* value);
+AstPtr ast_newSimpleKeyword(SmtPrsr parser, char const* value);
+AstPtr ast_newMetaSpecConstant(SmtPrsr parser, int value);
+AstPtr ast_newBooleanValue(SmtPrsr parser, int value);
+AstPtr ast_newPropLiteral(SmtPrsr parser, AstPtr symbol, int negated);
 
 // ast_command.h
-AstPtr ast_newAssertCommand(AstPtr term);
-AstPtr ast_newCheckSatCommand();
-AstPtr ast_newCheckUnsatCommand();
-AstPtr ast_newCheckSatAssumCommand(AstList assumptions);
-AstPtr ast_newDeclareConstCommand(AstPtr symbol, AstPtr sort);
-AstPtr ast_newDeclareDatatypeCommand(AstPtr symbol, AstPtr declaration);
-AstPtr ast_newDeclareDatatypesCommand(AstList sorts, AstList declarations);
-AstPtr ast_newDeclareFunCommand(AstPtr symbol, AstList params, AstPtr sort);
-AstPtr ast_newDeclareSortCommand(AstPtr symbol, AstPtr arity);
-AstPtr ast_newDeclareHeapCommand(AstPairList pairs);
-AstPtr ast_newDefineFunCommand(AstPtr definition);
-AstPtr ast_newDefineFunRecCommand(AstPtr definition);
-AstPtr ast_newDefineFunsRecCommand(AstList declarations, AstList bodies);
-AstPtr ast_newDefineSortCommand(AstPtr symbol, AstList params, AstPtr sort);
-AstPtr ast_newEchoCommand(AstPtr);
-AstPtr ast_newExitCommand();
-AstPtr ast_newGetAssertsCommand();
-AstPtr ast_newGetAssignsCommand();
-AstPtr ast_newGetInfoCommand(AstPtr keyword);
-AstPtr ast_newGetModelCommand();
-AstPtr ast_newGetOptionCommand(AstPtr keyword);
-AstPtr ast_newGetProofCommand();
-AstPtr ast_newGetUnsatAssumsCommand();
-AstPtr ast_newGetUnsatCoreCommand();
-AstPtr ast_newGetValueCommand(AstList terms);
-AstPtr ast_newPopCommand(AstPtr numeral);
-AstPtr ast_newPushCommand(AstPtr numeral);
-AstPtr ast_newResetCommand();
-AstPtr ast_newResetAssertsCommand();
-AstPtr ast_newSetInfoCommand(AstPtr info);
-AstPtr ast_newSetLogicCommand(AstPtr logic);
-AstPtr ast_newSetOptionCommand(AstPtr option);
+AstPtr ast_newAssertCommand(SmtPrsr parser, AstPtr term);
+AstPtr ast_newCheckSatCommand(SmtPrsr parser);
+AstPtr ast_newCheckUnsatCommand(SmtPrsr parser);
+AstPtr ast_newCheckSatAssumCommand(SmtPrsr parser, AstList assumptions);
+AstPtr ast_newDeclareConstCommand(SmtPrsr parser, AstPtr symbol, AstPtr sort);
+AstPtr ast_newDeclareDatatypeCommand(SmtPrsr parser, AstPtr symbol, AstPtr declaration);
+AstPtr ast_newDeclareDatatypesCommand(SmtPrsr parser, AstList sorts, AstList declarations);
+AstPtr ast_newDeclareFunCommand(SmtPrsr parser, AstPtr symbol, AstList params, AstPtr sort);
+AstPtr ast_newDeclareSortCommand(SmtPrsr parser, AstPtr symbol, AstPtr arity);
+AstPtr ast_newDeclareHeapCommand(SmtPrsr parser, AstPairList pairs);
+AstPtr ast_newDefineFunCommand(SmtPrsr parser, AstPtr definition);
+AstPtr ast_newDefineFunRecCommand(SmtPrsr parser, AstPtr definition);
+AstPtr ast_newDefineFunsRecCommand(SmtPrsr parser, AstList declarations, AstList bodies);
+AstPtr ast_newDefineSortCommand(SmtPrsr parser, AstPtr symbol, AstList params, AstPtr sort);
+AstPtr ast_newEchoCommand(SmtPrsr parser, AstPtr);
+AstPtr ast_newExitCommand(SmtPrsr parser);
+AstPtr ast_newGetAssertsCommand(SmtPrsr parser);
+AstPtr ast_newGetAssignsCommand(SmtPrsr parser);
+AstPtr ast_newGetInfoCommand(SmtPrsr parser, AstPtr keyword);
+AstPtr ast_newGetModelCommand(SmtPrsr parser);
+AstPtr ast_newGetOptionCommand(SmtPrsr parser, AstPtr keyword);
+AstPtr ast_newGetProofCommand(SmtPrsr parser);
+AstPtr ast_newGetUnsatAssumsCommand(SmtPrsr parser);
+AstPtr ast_newGetUnsatCoreCommand(SmtPrsr parser);
+AstPtr ast_newGetValueCommand(SmtPrsr parser, AstList terms);
+AstPtr ast_newPopCommand(SmtPrsr parser, AstPtr numeral);
+AstPtr ast_newPushCommand(SmtPrsr parser, AstPtr numeral);
+AstPtr ast_newResetCommand(SmtPrsr parser);
+AstPtr ast_newResetAssertsCommand(SmtPrsr parser);
+AstPtr ast_newSetInfoCommand(SmtPrsr parser, AstPtr info);
+AstPtr ast_newSetLogicCommand(SmtPrsr parser, AstPtr logic);
+AstPtr ast_newSetOptionCommand(SmtPrsr parser, AstPtr option);
 
 //ast_datatype.h
-AstPtr ast_newSortDeclaration(AstPtr symbol, AstPtr numeral);
-AstPtr ast_newSelectorDeclaration(AstPtr symbol, AstPtr sort);
-AstPtr ast_newConstructorDeclaration(AstPtr symbol, AstList selectors);
-AstPtr ast_newSimpleDatatypeDeclaration(AstList constructors);
-AstPtr ast_newParametricDatatypeDeclaration(AstList params, AstList constructors);
+AstPtr ast_newSortDeclaration(SmtPrsr parser, AstPtr symbol, AstPtr numeral);
+AstPtr ast_newSelectorDeclaration(SmtPrsr parser, AstPtr symbol, AstPtr sort);
+AstPtr ast_newConstructorDeclaration(SmtPrsr parser, AstPtr symbol, AstList selectors);
+AstPtr ast_newSimpleDatatypeDeclaration(SmtPrsr parser, AstList constructors);
+AstPtr ast_newParametricDatatypeDeclaration(SmtPrsr parser, AstList params, AstList constructors);
 
 // ast_fun.h
-AstPtr ast_newFunctionDeclaration(AstPtr symbol, AstList params, AstPtr sort);
-AstPtr ast_newFunctionDefinition(AstPtr signature, AstPtr body);
+AstPtr ast_newFunctionDeclaration(SmtPrsr parser, AstPtr symbol, AstList params, AstPtr sort);
+AstPtr ast_newFunctionDefinition(SmtPrsr parser, AstPtr signature, AstPtr body);
 
 // ast_identifier.h
-AstPtr ast_newSimpleIdentifier1(AstPtr symbol);
-AstPtr ast_newSimpleIdentifier2(AstPtr symbol, AstList indices);
-AstPtr ast_newQualifiedIdentifier(AstPtr identifier, AstPtr sort);
+AstPtr ast_newSimpleIdentifier1(SmtPrsr parser, AstPtr symbol);
+AstPtr ast_newSimpleIdentifier2(SmtPrsr parser, AstPtr symbol, AstList indices);
+AstPtr ast_newQualifiedIdentifier(SmtPrsr parser, AstPtr identifier, AstPtr sort);
 
 // ast_literal.h
-AstPtr ast_newNumeralLiteral(long value, unsigned int base);
-AstPtr ast_newDecimalLiteral(double value);
-AstPtr ast_newStringLiteral(char const* value);
+AstPtr ast_newNumeralLiteral(SmtPrsr parser, long value, unsigned int base);
+AstPtr ast_newDecimalLiteral(SmtPrsr parser, double value);
+AstPtr ast_newStringLiteral(SmtPrsr parser, char const* value);
 
 // ast_logic.h
-AstPtr ast_newLogic(AstPtr name, AstList attributes);
+AstPtr ast_newLogic(SmtPrsr parser, AstPtr name, AstList attributes);
 
 // ast_match.h
-AstPtr ast_newQualifiedConstructor(AstPtr symbol, AstPtr sort);
-AstPtr ast_newQualifiedPattern(AstPtr constructor, AstList symbols);
-AstPtr ast_newMatchCase(AstPtr pattern, AstPtr term);
+AstPtr ast_newQualifiedConstructor(SmtPrsr parser, AstPtr symbol, AstPtr sort);
+AstPtr ast_newQualifiedPattern(SmtPrsr parser, AstPtr constructor, AstList symbols);
+AstPtr ast_newMatchCase(SmtPrsr parser, AstPtr pattern, AstPtr term);
 
 // ast_s_expr.h
-AstPtr ast_newCompSExpression(AstList exprs);
+AstPtr ast_newCompSExpression(SmtPrsr parser, AstList exprs);
 
 // ast_script.h
-AstPtr ast_newScript(AstList cmds);
+AstPtr ast_newScript(SmtPrsr parser, AstList cmds);
 
 // ast_sort.h
-AstPtr ast_newSort1(AstPtr identifier);
-AstPtr ast_newSort2(AstPtr identifier, AstList params);
+AstPtr ast_newSort1(SmtPrsr parser, AstPtr identifier);
+AstPtr ast_newSort2(SmtPrsr parser, AstPtr identifier, AstList params);
 
 // ast_symbol_decl.h
-AstPtr ast_newSortSymbolDeclaration(AstPtr identifier, AstPtr arity, AstList attributes);
-AstPtr ast_newSpecConstFunDeclaration(AstPtr constant, AstPtr sort, AstList attributes);
-AstPtr ast_newMetaSpecConstFunDeclaration(AstPtr constant, AstPtr sort, AstList attributes);
-AstPtr ast_newSimpleFunDeclaration(AstPtr identifier, AstList signature, AstList attributes);
-AstPtr ast_newParametricFunDeclaration(AstList params, AstPtr identifier, AstList signature, AstList attributes);
+AstPtr ast_newSortSymbolDeclaration(SmtPrsr parser, AstPtr identifier, AstPtr arity, AstList attributes);
+AstPtr ast_newSpecConstFunDeclaration(SmtPrsr parser, AstPtr constant, AstPtr sort, AstList attributes);
+AstPtr ast_newMetaSpecConstFunDeclaration(SmtPrsr parser, AstPtr constant, AstPtr sort, AstList attributes);
+AstPtr ast_newSimpleFunDeclaration(SmtPrsr parser, AstPtr identifier, AstList signature, AstList attributes);
+AstPtr ast_newParametricFunDeclaration(SmtPrsr parser, AstList params, AstPtr identifier, AstList signature, AstList attributes);
 
 // ast_term.h
-AstPtr ast_newQualifiedTerm(AstPtr identifier, AstList terms);
-AstPtr ast_newLetTerm(AstList bindings, AstPtr term);
-AstPtr ast_newForallTerm(AstList bindings, AstPtr term);
-AstPtr ast_newExistsTerm(AstList bindings, AstPtr term);
-AstPtr ast_newMatchTerm(AstPtr term, AstList cases);
-AstPtr ast_newAnnotatedTerm(AstPtr term, AstList attrs);
+AstPtr ast_newQualifiedTerm(SmtPrsr parser, AstPtr identifier, AstList terms);
+AstPtr ast_newLetTerm(SmtPrsr parser, AstList bindings, AstPtr term);
+AstPtr ast_newForallTerm(SmtPrsr parser, AstList bindings, AstPtr term);
+AstPtr ast_newExistsTerm(SmtPrsr parser, AstList bindings, AstPtr term);
+AstPtr ast_newMatchTerm(SmtPrsr parser, AstPtr term, AstList cases);
+AstPtr ast_newAnnotatedTerm(SmtPrsr parser, AstPtr term, AstList attrs);
 
 // ast_theory.h
-AstPtr ast_newTheory(AstPtr name, AstList attributes);
+AstPtr ast_newTheory(SmtPrsr parser, AstPtr name, AstList attributes);
 
 // ast_variable.h
-AstPtr ast_newSortedVariable(AstPtr symbol, AstPtr sort);
-AstPtr ast_newVariableBinding(AstPtr symbol, AstPtr term);
+AstPtr ast_newSortedVariable(SmtPrsr parser, AstPtr symbol, AstPtr sort);
+AstPtr ast_newVariableBinding(SmtPrsr parser, AstPtr symbol, AstPtr term);
 
 #ifdef __cplusplus
 }; // extern "C"
@@ -1,34 +1,115 @@
 #include "smtlib_parser.h"
 
+#include "util/interner.h"
 #include "util/logger.h"
 #include "visitor/ast_syntax_checker.h"
 #include "visitor/ast_sortedness_checker.h"
 
 #include "smtlib-glue.h"
 
-#include <string>
-#include <sstream>
-#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-extern "C" {
-extern FILE* smt_yyin;
-}
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
 
 using namespace std;
 using namespace smtlib;
 using namespace smtlib::ast;
 
 shared_ptr<Node> Parser::parse(const string& filename) {
-    smt_yyin = fopen(filename.c_str(), "r");
-    if (smt_yyin) {
-        this->filename = make_shared<string>(filename.c_str());
-        smt_yyparse(this);
-        fclose(smt_yyin);
-    } else {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
         stringstream ss;
         ss << "Unable to open file '" << filename << "'";
         Logger::error("Parser::parse()", ss.str().c_str());
+        return ast;
+    }
+
+    // Streaming parses do not map the file: the scanner writes into the mapped pages,
+    // which would then stay resident until the end of the parse
+    struct stat info;
+    if (!commandHandler && fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        auto size = (size_t) info.st_size;
+
+        // Reserve room for the file and the two trailing NULs the scanner needs,
+        // then map the file privately over the start of the region.
+        // The rest of the region, as well as the end of the last file page, reads as zeros.
+        auto pageSize = (size_t) sysconf(_SC_PAGESIZE);
+        size_t length = (size + 2 + pageSize - 1) / pageSize * pageSize;
+
+        void* region = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (region != MAP_FAILED) {
+            if (mmap(region, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) != MAP_FAILED) {
+                close(fd);
+                parseBufferInPlace((char*) region, size, filename);
+                munmap(region, length);
+                return ast;
+            }
+
+            munmap(region, length);
+        }
+    }
+
+    FILE* fin = fdopen(fd, "r");
+    if (!fin) {
+        close(fd);
+        stringstream ss;
+        ss << "Unable to read file '" << filename << "'";
+        Logger::error("Parser::parse()", ss.str().c_str());
+        return ast;
     }
+
+    parseStream(fin, filename);
+    fclose(fin);
+
+    return ast;
+}
+
+NodePtr Parser::parseStream(FILE* in, const string& name) {
+    this->filename = make_shared<string>(name);
+    this->sources = make_shared<SourceMap>(Interner::intern(name));
+    this->commandStart = 0;
+
+    SmtScanner scanner;
+    smt_yylex_init_extra(this, &scanner);
+    smt_yyset_in(in, scanner);
+    smt_yyparse(this, scanner);
+    smt_yylex_destroy(scanner);
+
+    clearNodes();
+    return ast;
+}
+
+NodePtr Parser::parseBuffer(const char* data, size_t size, const string& name) {
+    vector<char> buffer(size + 2, '\0');
+    memcpy(buffer.data(), data, size);
+
+    return parseBufferInPlace(buffer.data(), size, name);
+}
+
+NodePtr Parser::parseBufferInPlace(char* buffer, size_t size, const string& name) {
+    this->filename = make_shared<string>(name);
+    this->sources = make_shared<SourceMap>(Interner::intern(name));
+    this->commandStart = 0;
+
+    SmtScanner scanner;
+    smt_yylex_init_extra(this, &scanner);
+    smt_yy_scan_buffer(buffer, size + 2, scanner);
+
+    // The scanner does not initialize the position of buffers it did not allocate
+    smt_yyset_lineno(1, scanner);
+    smt_yyset_column(0, scanner);
+
+    smt_yyparse(this, scanner);
+    smt_yylex_destroy(scanner);
+
+    clearNodes();
     return ast;
 }
 
@@ -36,6 +117,46 @@ shared_ptr<string> Parser::getFilename() {
     return filename;
 }
 
+SpanId Parser::addSpan(int rowLeft, int colLeft, int rowRight, int colRight) {
+    return sources->add(rowLeft, colLeft, rowRight, colRight);
+}
+
+const SourceMapPtr& Parser::getSourceMap() {
+    return sources;
+}
+
+void Parser::setCommandHandler(function<void(const CommandPtr&)> handler) {
+    commandHandler = std::move(handler);
+}
+
+bool Parser::hasCommandHandler() {
+    return (bool) commandHandler;
+}
+
+void Parser::handleCommand(const CommandPtr& command) {
+    if (commandHandler) {
+        commandSpansReleased = false;
+        commandHandler(command);
+
+        // The nodes of the command are created, along with their spans, before it is handled
+        if (commandSpansReleased)
+            sources->truncate(commandStart);
+        commandStart = sources->getSize();
+    }
+}
+
+void Parser::releaseCommandSpans() {
+    commandSpansReleased = true;
+}
+
+void Parser::setArena(ArenaPtr arena) {
+    this->arena = std::move(arena);
+}
+
+const ArenaPtr& Parser::getArena() {
+    return arena;
+}
+
 void Parser::setAst(NodePtr ast) {
     if (ast) {
         this->ast = ast;
@@ -46,6 +167,32 @@ NodePtr Parser::getAst() {
     return ast;
 }
 
+NodePtr* Parser::holdNode(NodePtr node) {
+    if (freeSlots.empty()) {
+        slots.push_back(std::move(node));
+        return &slots.back();
+    }
+
+    NodePtr* slot = freeSlots.back();
+    freeSlots.pop_back();
+    *slot = std::move(node);
+    return slot;
+}
+
+NodePtr Parser::claimNode(NodePtr* slot) {
+    if (!slot)
+        return NodePtr();
+
+    NodePtr node = std::move(*slot);
+    freeSlots.push_back(slot);
+    return node;
+}
+
+void Parser::clearNodes() {
+    slots.clear();
+    freeSlots.clear();
+}
+
 void Parser::reportError(int lineLeft, int colLeft,
                          int lineRight, int colRight, const char* msg) {
     Logger::parsingError(lineLeft, colLeft, lineRight, colRight, filename->c_str(), msg);
@@ -7,28 +7,138 @@
 #define SLCOMP_PARSER_SMT_PARSER_H
 
 #include "ast/ast_abstract.h"
+#include "util/arena.h"
+#include "util/source_map.h"
 
+#include <cstdio>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace smtlib {
-    /** SMT-LIB parser */
+    /**
+     * SMT-LIB parser.
+     * Each instance owns its own scanner and node slots,
+     * so distinct instances can be used concurrently from different threads.
+     */
     class Parser {
     private:
         ast::NodePtr ast;
         std::shared_ptr<std::string> filename;
+
+        /** Source spans of the nodes of the current parse */
+        SourceMapPtr sources;
+
+        /** Number of spans recorded before the current command */
+        size_t commandStart { 0 };
+
+        /** Whether the spans of the current command are released once it is handled */
+        bool commandSpansReleased { false };
+
+        /**
+         * Slots holding the nodes created during the current parse until their parent claims them.
+         * Bison semantic values point directly to these slots.
+         */
+        std::deque<ast::NodePtr> slots;
+
+        /** Slots released by claimed nodes, reused by subsequent nodes */
+        std::vector<ast::NodePtr*> freeSlots;
+
+        /** Handler receiving the top-level commands of a script as they are parsed */
+        std::function<void(const ast::CommandPtr&)> commandHandler;
+
+        /** Arena for the nodes created while parsing, if any */
+        ArenaPtr arena;
+
+        /** Parse the input read from a stream */
+        ast::NodePtr parseStream(FILE* in, const std::string& name);
+
     public:
+        /**
+         * Parse a file.
+         * Regular files are memory-mapped and scanned in place,
+         * other files (e.g. pipes) are read through a stream.
+         * When a command handler is set, files are always read through a stream,
+         * so that memory use does not grow with the size of the file.
+         */
         ast::NodePtr parse(const std::string& filename);
 
+        /**
+         * Parse an in-memory buffer.
+         * The scanner needs a writable buffer ending in two NUL characters,
+         * so the data is copied once into such a buffer.
+         * \param data     Input text
+         * \param size     Size of the input text
+         * \param name     Name of the input, used in diagnostics
+         */
+        ast::NodePtr parseBuffer(const char* data, size_t size, const std::string& name);
+
+        /**
+         * Parse a buffer in place, without copying it.
+         * The scanner temporarily writes into the buffer while scanning.
+         * \param buffer   Input text, followed by two NUL characters (buffer[size] and buffer[size + 1])
+         * \param size     Size of the input text, not counting the two NUL characters
+         * \param name     Name of the input, used in diagnostics
+         */
+        ast::NodePtr parseBufferInPlace(char* buffer, size_t size, const std::string& name);
+
+        /**
+         * Set a handler receiving each top-level command of a script as soon as it is parsed.
+         * Commands passed to the handler are not kept in the resulting script,
+         * so they can be released once handled.
+         */
+        void setCommandHandler(std::function<void(const ast::CommandPtr&)> handler);
+
+        /** Whether a command handler is set */
+        bool hasCommandHandler();
+
+        /** Pass a parsed top-level command to the command handler */
+        void handleCommand(const ast::CommandPtr& command);
+
+        /**
+         * Release the source spans of the command being handled once the handler returns.
+         * Only to be called by a command handler that keeps no node of the command.
+         */
+        void releaseCommandSpans();
+
+        /**
+         * Allocate the nodes of subsequent parses from an arena instead of the heap.
+         * A null arena restores regular heap allocation.
+         */
+        void setArena(ArenaPtr arena);
+
+        /** Get the arena nodes are allocated from, if any */
+        const ArenaPtr& getArena();
+
         /** Get input file */
         std::shared_ptr<std::string> getFilename();
 
+        /** Record the source span of a node in the current input */
+        SpanId addSpan(int rowLeft, int colLeft, int rowRight, int colRight);
+
+        /**
+         * Get the source spans of the last parse,
+         * which need to be kept as long as the nodes of the parse are used
+         */
+        const SourceMapPtr& getSourceMap();
+
         /** Get the resulting AST */
         ast::NodePtr getAst();
 
         /** Set the resulting AST */
         void setAst(ast::NodePtr ast);
 
+        /** Hold a node created during parsing until it is claimed */
+        ast::NodePtr* holdNode(ast::NodePtr node);
+
+        /** Claim a held node, releasing its slot */
+        ast::NodePtr claimNode(ast::NodePtr* slot);
+
+        /** Release all slots, including nodes that were never claimed */
+        void clearNodes();
+
         /** Report a parsing error */
         void reportError(int lineLeft, int colLeft,
                          int lineRight, int colRight, const char* msg);
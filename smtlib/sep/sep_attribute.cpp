@@ -11,6 +11,10 @@ void SimpleAttribute::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SimpleAttribute::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SimpleAttribute::toString() {
     return keyword;
 }
@@ -21,6 +25,10 @@ void SExpressionAttribute::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SExpressionAttribute::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SExpressionAttribute::toString() {
     stringstream ss;
     ss << keyword << " " << value->toString();
@@ -33,6 +41,10 @@ void SymbolAttribute::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SymbolAttribute::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SymbolAttribute::toString() {
     stringstream ss;
     ss << keyword << " " << value;
@@ -45,6 +57,10 @@ void BooleanAttribute::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void BooleanAttribute::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string BooleanAttribute::toString() {
     stringstream ss;
     ss << keyword << " " << ((value) ? "true" : "false");
@@ -57,6 +73,10 @@ void NumeralAttribute::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void NumeralAttribute::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string NumeralAttribute::toString() {
     stringstream ss;
     ss << keyword << " " << value->toString();
@@ -69,6 +89,10 @@ void DecimalAttribute::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DecimalAttribute::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DecimalAttribute::toString() {
     stringstream ss;
     ss << keyword << " " << value->toString();
@@ -81,6 +105,10 @@ void StringAttribute::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void StringAttribute::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string StringAttribute::toString() {
     stringstream ss;
     ss << keyword << " " << value->toString();
@@ -93,6 +121,10 @@ void TheoriesAttribute::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void TheoriesAttribute::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string TheoriesAttribute::toString() {
     stringstream ss;
     ss << keyword << " (";
@@ -114,6 +146,10 @@ void SortsAttribute::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SortsAttribute::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SortsAttribute::toString() {
     stringstream ss;
     ss << keyword << " (";
@@ -135,6 +171,10 @@ void FunsAttribute::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void FunsAttribute::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string FunsAttribute::toString() {
     stringstream ss;
     ss << keyword << " (";
@@ -34,12 +34,17 @@ namespace smtlib {
         class SimpleAttribute : public Attribute,
                                 public std::enable_shared_from_this<SimpleAttribute> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SIMPLE_ATTRIBUTE;
+
             inline SimpleAttribute() = default;
 
             inline explicit SimpleAttribute(std::string keyword)
                     : Attribute(std::move(keyword)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -49,6 +54,8 @@ namespace smtlib {
         class SExpressionAttribute : public Attribute,
                                      public std::enable_shared_from_this<SExpressionAttribute> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SEXPRESSION_ATTRIBUTE;
+
             SExpressionPtr value;
 
             inline SExpressionAttribute() = default;
@@ -57,7 +64,10 @@ namespace smtlib {
                     : Attribute(std::move(keyword))
                     , value(std::move(value)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -67,6 +77,8 @@ namespace smtlib {
         class SymbolAttribute : public Attribute,
                                 public std::enable_shared_from_this<SymbolAttribute> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SYMBOL_ATTRIBUTE;
+
             std::string value;
 
             inline SymbolAttribute() = default;
@@ -75,7 +87,10 @@ namespace smtlib {
                     : Attribute(std::move(keyword))
                     , value(std::move(value)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -85,6 +100,8 @@ namespace smtlib {
         class BooleanAttribute : public Attribute,
                                  public std::enable_shared_from_this<BooleanAttribute> {
         public:
+            static constexpr NodeKind KIND = NodeKind::BOOLEAN_ATTRIBUTE;
+
             bool value{};
 
             inline BooleanAttribute() = default;
@@ -93,7 +110,10 @@ namespace smtlib {
                     : Attribute(std::move(keyword))
                     , value(value) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -103,6 +123,8 @@ namespace smtlib {
         class NumeralAttribute : public Attribute,
                                  public std::enable_shared_from_this<NumeralAttribute> {
         public:
+            static constexpr NodeKind KIND = NodeKind::NUMERAL_ATTRIBUTE;
+
             NumeralLiteralPtr value;
 
             inline NumeralAttribute() = default;
@@ -111,7 +133,10 @@ namespace smtlib {
                     : Attribute(std::move(symbol))
                     , value(std::move(value)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -121,6 +146,8 @@ namespace smtlib {
         class DecimalAttribute : public Attribute,
                                  public std::enable_shared_from_this<DecimalAttribute> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECIMAL_ATTRIBUTE;
+
             DecimalLiteralPtr value;
 
             inline DecimalAttribute() = default;
@@ -129,7 +156,10 @@ namespace smtlib {
                     : Attribute(std::move(keyword))
                     , value(std::move(value)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -139,6 +169,8 @@ namespace smtlib {
         class StringAttribute : public Attribute,
                                 public std::enable_shared_from_this<StringAttribute> {
         public:
+            static constexpr NodeKind KIND = NodeKind::STRING_ATTRIBUTE;
+
             StringLiteralPtr value;
 
             inline StringAttribute() = default;
@@ -147,7 +179,10 @@ namespace smtlib {
                     : Attribute(std::move(keyword))
                     , value(std::move(value)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -157,6 +192,8 @@ namespace smtlib {
         class TheoriesAttribute : public Attribute,
                                   public std::enable_shared_from_this<TheoriesAttribute> {
         public:
+            static constexpr NodeKind KIND = NodeKind::THEORIES_ATTRIBUTE;
+
             std::vector<std::string> theories;
 
             inline TheoriesAttribute()
@@ -165,7 +202,10 @@ namespace smtlib {
             inline explicit TheoriesAttribute(std::vector<std::string> theories)
                     : theories(std::move(theories)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -175,6 +215,8 @@ namespace smtlib {
         class SortsAttribute : public Attribute,
                                public std::enable_shared_from_this<SortsAttribute> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SORTS_ATTRIBUTE;
+
             std::vector<SortSymbolDeclarationPtr> declarations;
 
             inline SortsAttribute()
@@ -183,7 +225,10 @@ namespace smtlib {
             inline explicit SortsAttribute(std::vector<SortSymbolDeclarationPtr> decls)
                     : declarations(std::move(decls)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -193,6 +238,8 @@ namespace smtlib {
         class FunsAttribute : public Attribute,
                               public std::enable_shared_from_this<FunsAttribute> {
         public:
+            static constexpr NodeKind KIND = NodeKind::FUNS_ATTRIBUTE;
+
             std::vector<FunSymbolDeclarationPtr> declarations;
 
             inline FunsAttribute()
@@ -201,7 +248,10 @@ namespace smtlib {
             inline explicit FunsAttribute(std::vector<FunSymbolDeclarationPtr> decls)
                     : declarations(std::move(decls)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
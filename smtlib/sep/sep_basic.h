@@ -26,6 +26,8 @@ namespace smtlib {
                        public Constructor,
                        public std::enable_shared_from_this<Symbol> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SYMBOL;
+
             std::string value;
 
             /**
@@ -34,7 +36,10 @@ namespace smtlib {
             inline explicit Symbol(std::string value)
                     : value(std::move(value)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -48,6 +53,8 @@ namespace smtlib {
                         public SExpression,
                         public std::enable_shared_from_this<Keyword> {
         public:
+            static constexpr NodeKind KIND = NodeKind::KEYWORD;
+
             std::string value;
 
             /**
@@ -56,7 +63,10 @@ namespace smtlib {
             inline explicit Keyword(std::string value)
                     : value(std::move(value)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -68,6 +78,8 @@ namespace smtlib {
         class MetaSpecConstant : public Node,
                                  public std::enable_shared_from_this<MetaSpecConstant> {
         public:
+            static constexpr NodeKind KIND = NodeKind::META_SPEC_CONSTANT;
+
             enum Type {
                 NUMERAL = 0,
                 DECIMAL,
@@ -82,7 +94,10 @@ namespace smtlib {
             inline explicit MetaSpecConstant(MetaSpecConstant::Type type)
                     : type(type) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -96,6 +111,8 @@ namespace smtlib {
                              public AttributeValue,
                              public std::enable_shared_from_this<BooleanValue> {
         public:
+            static constexpr NodeKind KIND = NodeKind::BOOLEAN_VALUE;
+
             bool value;
 
             /**
@@ -104,7 +121,10 @@ namespace smtlib {
             inline explicit BooleanValue(bool value)
                     : value(value) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -114,6 +134,8 @@ namespace smtlib {
         class PropLiteral : public Node,
                             public std::enable_shared_from_this<PropLiteral> {
         public:
+            static constexpr NodeKind KIND = NodeKind::PROP_LITERAL;
+
             std::string value;
             bool negated;
 
@@ -125,7 +147,10 @@ namespace smtlib {
                     : value(std::move(value))
                     , negated(negated) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
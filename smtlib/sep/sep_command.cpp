@@ -11,6 +11,10 @@ void AssertCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void AssertCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string AssertCommand::toString() {
     stringstream ss;
     ss << "(" << KW_ASSERT << " " << term->toString() << ")";
@@ -23,6 +27,10 @@ void CheckSatCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void CheckSatCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string CheckSatCommand::toString() {
     stringstream ss;
     ss << "(" << KW_CHK_SAT << ")";
@@ -35,6 +43,10 @@ void CheckUnsatCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void CheckUnsatCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string CheckUnsatCommand::toString() {
     stringstream ss;
     ss << "(" << KW_CHK_UNSAT << ")";
@@ -47,6 +59,10 @@ void CheckSatAssumCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void CheckSatAssumCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string CheckSatAssumCommand::toString() {
     stringstream ss;
     ss << "(" << KW_CHK_SAT_ASSUM << " (";
@@ -68,6 +84,10 @@ void DeclareConstCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DeclareConstCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DeclareConstCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DECL_CONST << " " << name << " " << sort->toString() << ")";
@@ -80,6 +100,10 @@ void DeclareDatatypeCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DeclareDatatypeCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DeclareDatatypeCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DECL_DATATYPE << " " << name << " " << declaration->toString() << ")";
@@ -92,6 +116,10 @@ void DeclareDatatypesCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DeclareDatatypesCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DeclareDatatypesCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DECL_DATATYPES << " (";
@@ -122,6 +150,10 @@ void DeclareFunCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DeclareFunCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DeclareFunCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DECL_FUN << " " << name << " (";
@@ -144,6 +176,10 @@ void DeclareSortCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DeclareSortCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DeclareSortCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DECL_SORT << " " << name << " " << arity << ")";
@@ -156,6 +192,10 @@ void DeclareHeapCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DeclareHeapCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DeclareHeapCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DECL_HEAP << " ";
@@ -174,6 +214,10 @@ void DefineFunCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DefineFunCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DefineFunCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DEF_FUN << " " << definition->toString() << ")";
@@ -186,6 +230,10 @@ void DefineFunRecCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DefineFunRecCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DefineFunRecCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DEF_FUN_REC << " " << definition->toString() << ")";
@@ -198,6 +246,10 @@ void DefineFunsRecCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DefineFunsRecCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DefineFunsRecCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DEF_FUNS_REC << " (";
@@ -228,6 +280,10 @@ void DefineSortCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DefineSortCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DefineSortCommand::toString() {
     stringstream ss;
     ss << "(" << KW_DEF_SORT << " " << name << " (";
@@ -249,6 +305,10 @@ void EchoCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void EchoCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string EchoCommand::toString() {
     stringstream ss;
     ss << "(" << KW_ECHO << " " << message << ")";
@@ -261,6 +321,10 @@ void ExitCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ExitCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ExitCommand::toString() {
     stringstream ss;
     ss << "(" << KW_EXIT << ")";
@@ -273,6 +337,10 @@ void GetAssertsCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetAssertsCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetAssertsCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_ASSERTS << ")";
@@ -285,6 +353,10 @@ void GetAssignsCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetAssignsCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetAssignsCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_ASSIGNS << ")";
@@ -297,6 +369,10 @@ void GetInfoCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetInfoCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetInfoCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_INFO << " " << flag << ")";
@@ -309,6 +385,10 @@ void GetModelCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetModelCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetModelCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_MODEL << ")";
@@ -321,6 +401,10 @@ void GetOptionCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetOptionCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetOptionCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_OPT << " " << option << ")";
@@ -333,6 +417,10 @@ void GetProofCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetProofCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetProofCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_PROOF << ")";
@@ -345,6 +433,10 @@ void GetUnsatAssumsCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetUnsatAssumsCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetUnsatAssumsCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_UNSAT_ASSUMS << ")";
@@ -357,6 +449,10 @@ void GetUnsatCoreCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetUnsatCoreCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetUnsatCoreCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_UNSAT_CORE << ")";
@@ -369,6 +465,10 @@ void GetValueCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void GetValueCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string GetValueCommand::toString() {
     stringstream ss;
     ss << "(" << KW_GET_VALUE << " (";
@@ -390,6 +490,10 @@ void PopCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void PopCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string PopCommand::toString() {
     stringstream ss;
     ss << "(" << KW_POP << " " << levelCount << ")";
@@ -402,6 +506,10 @@ void PushCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void PushCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string PushCommand::toString() {
     stringstream ss;
     ss << "(" << KW_PUSH << " " << levelCount << ")";
@@ -414,6 +522,10 @@ void ResetCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ResetCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ResetCommand::toString() {
     stringstream ss;
     ss << "(" << KW_RESET << ")";
@@ -426,6 +538,10 @@ void ResetAssertsCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ResetAssertsCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ResetAssertsCommand::toString() {
     stringstream ss;
     ss << "(" << KW_RESET_ASSERTS << ")";
@@ -438,6 +554,10 @@ void SetInfoCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SetInfoCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SetInfoCommand::toString() {
     stringstream ss;
     ss << "(" << KW_SET_INFO << " " << info->toString() << ")";
@@ -450,6 +570,10 @@ void SetLogicCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SetLogicCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SetLogicCommand::toString() {
     stringstream ss;
     ss << "(" << KW_SET_LOGIC << " " << logic << ")";
@@ -462,6 +586,10 @@ void SetOptionCommand::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SetOptionCommand::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SetOptionCommand::toString() {
     stringstream ss;
     ss << "(" << KW_SET_OPT << " " << option->toString() << ")";
@@ -30,6 +30,8 @@ namespace smtlib {
         class AssertCommand : public Command,
                               public std::enable_shared_from_this<AssertCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::ASSERT_COMMAND;
+
             TermPtr term;
 
             /**
@@ -38,7 +40,10 @@ namespace smtlib {
             inline explicit AssertCommand(TermPtr term)
                     : term(std::move(term)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -48,9 +53,14 @@ namespace smtlib {
         class CheckSatCommand : public Command,
                                 public std::enable_shared_from_this<CheckSatCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::CHECK_SAT_COMMAND;
+
             inline CheckSatCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -60,9 +70,14 @@ namespace smtlib {
         class CheckUnsatCommand : public Command,
                                   public std::enable_shared_from_this<CheckUnsatCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::CHECK_UNSAT_COMMAND;
+
             inline CheckUnsatCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -72,6 +87,8 @@ namespace smtlib {
         class CheckSatAssumCommand : public Command,
                                      public std::enable_shared_from_this<CheckSatAssumCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::CHECK_SAT_ASSUM_COMMAND;
+
             std::vector<PropLiteralPtr> assumptions;
 
             /**
@@ -80,7 +97,10 @@ namespace smtlib {
             inline explicit CheckSatAssumCommand(std::vector<PropLiteralPtr> assumptions)
                     : assumptions(std::move(assumptions)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -90,6 +110,8 @@ namespace smtlib {
         class DeclareConstCommand : public Command,
                                     public std::enable_shared_from_this<DeclareConstCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECLARE_CONST_COMMAND;
+
             std::string name;
             SortPtr sort;
 
@@ -101,7 +123,10 @@ namespace smtlib {
                     : name(std::move(name))
                     , sort(std::move(sort)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -111,6 +136,8 @@ namespace smtlib {
         class DeclareDatatypeCommand : public Command,
                                        public std::enable_shared_from_this<DeclareDatatypeCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECLARE_DATATYPE_COMMAND;
+
             std::string name;
             DatatypeDeclarationPtr declaration;
 
@@ -122,7 +149,10 @@ namespace smtlib {
                     : name(std::move(name))
                     , declaration(std::move(declaration)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -132,6 +162,8 @@ namespace smtlib {
         class DeclareDatatypesCommand : public Command,
                                         public std::enable_shared_from_this<DeclareDatatypesCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECLARE_DATATYPES_COMMAND;
+
             std::vector<SortDeclarationPtr> sorts;
             std::vector<DatatypeDeclarationPtr> declarations;
 
@@ -144,7 +176,10 @@ namespace smtlib {
                     : sorts(std::move(sorts))
                     , declarations(std::move(declarations)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -154,6 +189,8 @@ namespace smtlib {
         class DeclareFunCommand : public Command,
                                   public std::enable_shared_from_this<DeclareFunCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECLARE_FUN_COMMAND;
+
             std::string name;
             std::vector<SortPtr> parameters;
             SortPtr sort;
@@ -170,7 +207,10 @@ namespace smtlib {
                     , parameters(std::move(parameters))
                     , sort(std::move(sort)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -180,6 +220,8 @@ namespace smtlib {
         class DeclareSortCommand : public Command,
                                    public std::enable_shared_from_this<DeclareSortCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECLARE_SORT_COMMAND;
+
             std::string name;
             size_t arity;
 
@@ -191,7 +233,10 @@ namespace smtlib {
                     : name(std::move(name))
                     , arity(arity) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -201,6 +246,8 @@ namespace smtlib {
         class DeclareHeapCommand : public Command,
                                    public std::enable_shared_from_this<DeclareHeapCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DECLARE_HEAP_COMMAND;
+
             std::vector<std::pair<SortPtr,SortPtr>> locDataPairs;
 
             /**
@@ -210,7 +257,10 @@ namespace smtlib {
             inline explicit DeclareHeapCommand(std::vector<std::pair<SortPtr,SortPtr>> locDataPairs)
                     : locDataPairs(std::move(locDataPairs)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -220,6 +270,8 @@ namespace smtlib {
         class DefineFunCommand : public Command,
                                  public std::enable_shared_from_this<DefineFunCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DEFINE_FUN_COMMAND;
+
             FunctionDefinitionPtr definition;
 
             /**
@@ -250,7 +302,10 @@ namespace smtlib {
                                                                       std::move(sort),
                                                                       std::move(body))) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -260,6 +315,8 @@ namespace smtlib {
         class DefineFunRecCommand : public Command,
                                     public std::enable_shared_from_this<DefineFunRecCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DEFINE_FUN_REC_COMMAND;
+
             FunctionDefinitionPtr definition;
 
             /**
@@ -293,7 +350,10 @@ namespace smtlib {
                                                                       std::move(body))) {}
 
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -303,6 +363,8 @@ namespace smtlib {
         class DefineFunsRecCommand : public Command,
                                      public std::enable_shared_from_this<DefineFunsRecCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DEFINE_FUNS_REC_COMMAND;
+
             std::vector<FunctionDeclarationPtr> declarations;
             std::vector<TermPtr> bodies;
 
@@ -315,7 +377,10 @@ namespace smtlib {
                     : declarations(std::move(declarations))
                     , bodies(std::move(bodies)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -325,6 +390,8 @@ namespace smtlib {
         class DefineSortCommand : public Command,
                                   public std::enable_shared_from_this<DefineSortCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DEFINE_SORT_COMMAND;
+
             std::string name;
             std::vector<std::string> parameters;
             SortPtr sort;
@@ -341,7 +408,10 @@ namespace smtlib {
                     , sort(std::move(sort))
                     , parameters(std::move(parameters)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -351,6 +421,8 @@ namespace smtlib {
         class EchoCommand : public Command,
                             public std::enable_shared_from_this<EchoCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::ECHO_COMMAND;
+
             std::string message;
 
             /**
@@ -359,7 +431,10 @@ namespace smtlib {
             inline explicit EchoCommand(std::string message)
                     : message(std::move(message)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -369,9 +444,14 @@ namespace smtlib {
         class ExitCommand : public Command,
                             public std::enable_shared_from_this<ExitCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::EXIT_COMMAND;
+
             inline ExitCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -381,9 +461,14 @@ namespace smtlib {
         class GetAssertsCommand : public Command,
                                   public std::enable_shared_from_this<GetAssertsCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_ASSERTS_COMMAND;
+
             inline GetAssertsCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -393,9 +478,14 @@ namespace smtlib {
         class GetAssignsCommand : public Command,
                                   public std::enable_shared_from_this<GetAssignsCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_ASSIGNS_COMMAND;
+
             inline GetAssignsCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -405,6 +495,8 @@ namespace smtlib {
         class GetInfoCommand : public Command,
                                public std::enable_shared_from_this<GetInfoCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_INFO_COMMAND;
+
             std::string flag;
 
             /**
@@ -413,7 +505,10 @@ namespace smtlib {
             inline explicit GetInfoCommand(std::string flag)
                     : flag(std::move(flag)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -423,9 +518,14 @@ namespace smtlib {
         class GetModelCommand : public Command,
                                 public std::enable_shared_from_this<GetModelCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_MODEL_COMMAND;
+
             inline GetModelCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -435,6 +535,8 @@ namespace smtlib {
         class GetOptionCommand : public Command,
                                  public std::enable_shared_from_this<GetOptionCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_OPTION_COMMAND;
+
             std::string option;
 
             /**
@@ -443,7 +545,10 @@ namespace smtlib {
             inline explicit GetOptionCommand(std::string option)
                     : option(std::move(option)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -453,9 +558,14 @@ namespace smtlib {
         class GetProofCommand : public Command,
                                 public std::enable_shared_from_this<GetProofCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_PROOF_COMMAND;
+
             inline GetProofCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -465,9 +575,14 @@ namespace smtlib {
         class GetUnsatAssumsCommand : public Command,
                                       public std::enable_shared_from_this<GetUnsatAssumsCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_UNSAT_ASSUMS_COMMAND;
+
             inline GetUnsatAssumsCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -477,9 +592,14 @@ namespace smtlib {
         class GetUnsatCoreCommand : public Command,
                                     public std::enable_shared_from_this<GetUnsatCoreCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_UNSAT_CORE_COMMAND;
+
             inline GetUnsatCoreCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -489,6 +609,8 @@ namespace smtlib {
         class GetValueCommand : public Command,
                                 public std::enable_shared_from_this<GetValueCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::GET_VALUE_COMMAND;
+
             std::vector<TermPtr> terms;
 
             /**
@@ -497,7 +619,10 @@ namespace smtlib {
             inline explicit GetValueCommand(std::vector<TermPtr> terms)
                 : terms(std::move(terms)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -507,6 +632,8 @@ namespace smtlib {
         class PopCommand : public Command,
                            public std::enable_shared_from_this<PopCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::POP_COMMAND;
+
             long levelCount;
 
             /**
@@ -515,7 +642,10 @@ namespace smtlib {
             inline explicit PopCommand(long levelCount)
                     : levelCount(levelCount) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -525,6 +655,8 @@ namespace smtlib {
         class PushCommand : public Command,
                             public std::enable_shared_from_this<PushCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::PUSH_COMMAND;
+
             long levelCount;
 
             /**
@@ -533,7 +665,10 @@ namespace smtlib {
             inline explicit PushCommand(long levelCount)
                     : levelCount(levelCount) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -543,9 +678,14 @@ namespace smtlib {
         class ResetCommand : public Command,
                              public std::enable_shared_from_this<ResetCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::RESET_COMMAND;
+
             inline ResetCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -555,9 +695,14 @@ namespace smtlib {
         class ResetAssertsCommand : public Command,
                                     public std::enable_shared_from_this<ResetAssertsCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::RESET_ASSERTS_COMMAND;
+
             inline ResetAssertsCommand() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -567,6 +712,8 @@ namespace smtlib {
         class SetInfoCommand : public Command,
                                public std::enable_shared_from_this<SetInfoCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SET_INFO_COMMAND;
+
             AttributePtr info;
 
             /**
@@ -575,7 +722,10 @@ namespace smtlib {
             inline explicit SetInfoCommand(AttributePtr info)
                     : info(std::move(info)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -585,6 +735,8 @@ namespace smtlib {
         class SetLogicCommand : public Command,
                                 public std::enable_shared_from_this<SetLogicCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SET_LOGIC_COMMAND;
+
             std::string logic;
 
             /**
@@ -593,7 +745,10 @@ namespace smtlib {
             inline explicit SetLogicCommand(std::string logic)
                     : logic(std::move(logic)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -603,6 +758,8 @@ namespace smtlib {
         class SetOptionCommand : public Command,
                                  public std::enable_shared_from_this<SetOptionCommand> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SET_OPTION_COMMAND;
+
             AttributePtr option;
 
             /**
@@ -611,7 +768,10 @@ namespace smtlib {
             inline explicit SetOptionCommand(AttributePtr option)
                     : option(std::move(option)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
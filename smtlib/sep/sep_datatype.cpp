@@ -11,6 +11,10 @@ void SortDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SortDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SortDeclaration::toString() {
     stringstream ss;
     ss << "(" << name << " " << arity << ")";
@@ -23,6 +27,10 @@ void SelectorDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SelectorDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SelectorDeclaration::toString() {
     stringstream ss;
     ss << "(" << name << " " << sort->toString() << ")";
@@ -35,6 +43,10 @@ void ConstructorDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ConstructorDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ConstructorDeclaration::toString() {
     stringstream ss;
     ss << "(" << name;
@@ -53,6 +65,10 @@ void SimpleDatatypeDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SimpleDatatypeDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SimpleDatatypeDeclaration::toString() {
     stringstream ss;
     ss << "(";
@@ -74,6 +90,10 @@ void ParametricDatatypeDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ParametricDatatypeDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ParametricDatatypeDeclaration::toString() {
     stringstream ss;
     ss << "(par (";
@@ -18,6 +18,8 @@ namespace smtlib {
         class SortDeclaration : public Node,
                                 public std::enable_shared_from_this<SortDeclaration> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SORT_DECLARATION;
+
             std::string name;
             size_t arity;
 
@@ -29,7 +31,10 @@ namespace smtlib {
                     : name(std::move(name))
                     , arity(arity) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -39,6 +44,8 @@ namespace smtlib {
         class SelectorDeclaration : public Node,
                                     public std::enable_shared_from_this<SelectorDeclaration> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SELECTOR_DECLARATION;
+
             std::string name;
             SortPtr sort;
 
@@ -50,7 +57,10 @@ namespace smtlib {
                     : name(std::move(name))
                     , sort(std::move(sort)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -60,6 +70,8 @@ namespace smtlib {
         class ConstructorDeclaration : public Node,
                                        public std::enable_shared_from_this<ConstructorDeclaration> {
         public:
+            static constexpr NodeKind KIND = NodeKind::CONSTRUCTOR_DECLARATION;
+
             std::string name;
             std::vector<SelectorDeclarationPtr> selectors;
 
@@ -72,7 +84,10 @@ namespace smtlib {
                     : name(std::move(name))
                     , selectors(std::move(selectors)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -87,6 +102,8 @@ namespace smtlib {
         class SimpleDatatypeDeclaration : public DatatypeDeclaration,
                                           public std::enable_shared_from_this<SimpleDatatypeDeclaration> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SIMPLE_DATATYPE_DECLARATION;
+
             std::vector<ConstructorDeclarationPtr> constructors;
 
             /**
@@ -95,7 +112,10 @@ namespace smtlib {
             inline explicit SimpleDatatypeDeclaration(std::vector<ConstructorDeclarationPtr> constructors)
                     : constructors(std::move(constructors)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -105,6 +125,8 @@ namespace smtlib {
         class ParametricDatatypeDeclaration : public DatatypeDeclaration,
                                               public std::enable_shared_from_this<ParametricDatatypeDeclaration> {
         public:
+            static constexpr NodeKind KIND = NodeKind::PARAMETRIC_DATATYPE_DECLARATION;
+
             std::vector<std::string> parameters;
             std::vector<ConstructorDeclarationPtr> constructors;
 
@@ -117,7 +139,10 @@ namespace smtlib {
                     : parameters(std::move(parameters))
                     , constructors(std::move(constructors)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
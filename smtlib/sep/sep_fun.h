@@ -22,6 +22,8 @@ namespace smtlib {
         class FunctionDeclaration : public Node,
                                     public std::enable_shared_from_this<FunctionDeclaration> {
         public:
+            static constexpr NodeKind KIND = NodeKind::FUNCTION_DECLARATION;
+
             std::string name;
             std::vector<SortedVariablePtr> parameters;
             SortPtr sort;
@@ -38,7 +40,10 @@ namespace smtlib {
                     , parameters(std::move(parameters))
                     , sort(std::move(sort)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -48,6 +53,8 @@ namespace smtlib {
         class FunctionDefinition : public Node,
                                    public std::enable_shared_from_this<FunctionDefinition> {
         public:
+            static constexpr NodeKind KIND = NodeKind::FUNCTION_DEFINITION;
+
             FunctionDeclarationPtr signature;
             TermPtr body;
 
@@ -76,7 +83,10 @@ namespace smtlib {
                                                                       std::move(sort))) {}
 
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -11,6 +11,17 @@ void SimpleIdentifier::accept(Visitor0 *visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SimpleIdentifier::accept(RawVisitor0 *visitor) {
+    visitor->visit(this);
+}
+
+SymbolId SimpleIdentifier::getNameId() {
+    if (!isIndexed())
+        return Interner::intern(name);
+
+    return Interner::intern(toString());
+}
+
 string SimpleIdentifier::toString() {
     if (!isIndexed())
         return name;
@@ -33,6 +44,10 @@ void QualifiedIdentifier::accept(Visitor0 *visitor) {
     visitor->visit(shared_from_this());
 }
 
+void QualifiedIdentifier::accept(RawVisitor0 *visitor) {
+    visitor->visit(this);
+}
+
 string QualifiedIdentifier::toString() {
     stringstream ss;
     ss << "(as " << identifier->toString() << " " << sort->toString() << ")";
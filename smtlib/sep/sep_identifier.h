@@ -11,6 +11,8 @@
 #include "sep_interfaces.h"
 #include "sep_sort.h"
 
+#include "util/interner.h"
+
 #include <memory>
 #include <vector>
 
@@ -23,6 +25,8 @@ namespace smtlib {
         class SimpleIdentifier : public Identifier,
                                  public std::enable_shared_from_this<SimpleIdentifier> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SIMPLE_IDENTIFIER;
+
             std::string name;
             std::vector<IndexPtr> indices;
 
@@ -44,7 +48,13 @@ namespace smtlib {
 
             inline bool isIndexed() { return !indices.empty(); }
 
+            /** Interned identifier of the textual representation, as used to key symbol tables */
+            SymbolId getNameId();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -54,6 +64,8 @@ namespace smtlib {
         class QualifiedIdentifier : public Identifier,
                                     public std::enable_shared_from_this<QualifiedIdentifier> {
         public:
+            static constexpr NodeKind KIND = NodeKind::QUALIFIED_IDENTIFIER;
+
             SimpleIdentifierPtr identifier;
             SortPtr sort;
 
@@ -65,7 +77,10 @@ namespace smtlib {
                     : identifier(std::move(identifier))
                     , sort(std::move(sort)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
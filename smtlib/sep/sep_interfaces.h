@@ -3,6 +3,9 @@
 
 #include "sep_abstract.h"
 
+#include <cstddef>
+#include <cstdint>
+
 namespace smtlib {
     namespace sep {
 
@@ -12,7 +15,22 @@ namespace smtlib {
         class SExpression : public virtual Node {
         };
 
+        /** Identifier of a term in a TermTable */
+        typedef uint32_t TermId;
+
         class Term : public virtual Node {
+        public:
+            /** Identifier of the term in the TermTable it was interned in, or 0 if it was not interned */
+            TermId termId { 0 };
+
+            /** Structural hash of the term, set when it is interned (equal terms have equal hashes) */
+            size_t termHash { 0 };
+
+            /**
+             * Sort of the term, carried over from the sortedness check of the translated term
+             * (empty if the term was not checked, or has no sort)
+             */
+            SortPtr inferredSort;
         };
 
         class Identifier : public virtual Node,
@@ -18,6 +18,8 @@ namespace smtlib {
         class QualifiedConstructor : public Constructor,
                                      public std::enable_shared_from_this<QualifiedConstructor> {
         public:
+            static constexpr NodeKind KIND = NodeKind::QUALIFIED_CONSTRUCTOR;
+
             std::string name;
             SortPtr sort;
 
@@ -25,7 +27,10 @@ namespace smtlib {
                     : name(std::move(name))
                     , sort(std::move(sort)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -35,6 +40,8 @@ namespace smtlib {
         class QualifiedPattern : public Pattern,
                                  public std::enable_shared_from_this<QualifiedPattern> {
         public:
+            static constexpr NodeKind KIND = NodeKind::QUALIFIED_PATTERN;
+
             ConstructorPtr constructor;
             std::vector<std::string> arguments;
 
@@ -43,7 +50,10 @@ namespace smtlib {
                     : constructor(std::move(constructor))
                     , arguments(std::move(args)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -53,6 +63,8 @@ namespace smtlib {
         class MatchCase : public Node,
                           public std::enable_shared_from_this<MatchCase> {
         public:
+            static constexpr NodeKind KIND = NodeKind::MATCH_CASE;
+
             PatternPtr pattern;
             TermPtr term;
 
@@ -60,7 +72,10 @@ namespace smtlib {
                     : pattern(std::move(pattern))
                     , term(std::move(term)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
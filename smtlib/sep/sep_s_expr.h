@@ -19,6 +19,8 @@ namespace smtlib {
                                 public AttributeValue,
                                 public std::enable_shared_from_this<CompSExpression> {
         public:
+            static constexpr NodeKind KIND = NodeKind::COMP_SEXPRESSION;
+
             std::vector<SExpressionPtr> expressions;
 
             /**
@@ -27,7 +29,10 @@ namespace smtlib {
             inline explicit CompSExpression(std::vector<SExpressionPtr> exprs)
                     : expressions(std::move(exprs)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -9,10 +9,30 @@ bool Sort::hasArgs() {
     return !arguments.empty();
 }
 
+const CanonicalSort* Sort::getCanonical() {
+    const CanonicalSort* result = canonical.load(memory_order_acquire);
+    if (result)
+        return result;
+
+    vector<const CanonicalSort*> args;
+    args.reserve(arguments.size());
+    for (const auto& arg : arguments) {
+        args.push_back(arg->getCanonical());
+    }
+
+    result = SortTable::get(Interner::intern(name), args);
+    canonical.store(result, memory_order_release);
+    return result;
+}
+
 void Sort::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void Sort::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string Sort::toString() {
     if (!hasArgs())
         return name;
@@ -21,7 +41,7 @@ string Sort::toString() {
     ss << "(" << name;
 
     for (const auto& arg : arguments) {
-        ss << " " << arg;
+        ss << " " << arg->toString();
     }
 
     ss << ")";
@@ -9,6 +9,9 @@
 #include "sep_abstract.h"
 #include "sep_basic.h"
 
+#include "util/sort_table.h"
+
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -18,6 +21,8 @@ namespace smtlib {
         class Sort : public Node,
                      public std::enable_shared_from_this<Sort> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SORT;
+
             std::string name;
             std::vector<SortPtr> arguments;
 
@@ -40,9 +45,21 @@ namespace smtlib {
             /** Checks whether the sort has arguments */
             bool hasArgs();
 
+            /**
+             * Get the canonical form of the sort, which is the same object for all equal sorts.
+             * It is computed on first use, so the sort must not be modified afterwards.
+             */
+            const CanonicalSort* getCanonical();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
+
+        private:
+            std::atomic<const CanonicalSort*> canonical { nullptr };
         };
     }
 }
@@ -12,6 +12,10 @@ void SortSymbolDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SortSymbolDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SortSymbolDeclaration::toString() {
     stringstream ss;
     ss << "(" << identifier->toString() << " " << arity;
@@ -30,6 +34,10 @@ void SpecConstFunDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SpecConstFunDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SpecConstFunDeclaration::toString() {
     stringstream ss;
     ss << "(" << constant->toString() << " " << sort->toString();
@@ -48,6 +56,10 @@ void MetaSpecConstFunDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void MetaSpecConstFunDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string MetaSpecConstFunDeclaration::toString() {
     stringstream ss;
     ss << "(" << constant->toString() << " " << sort->toString();
@@ -66,6 +78,10 @@ void SimpleFunDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SimpleFunDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SimpleFunDeclaration::toString() {
     stringstream ss;
     ss << "(" << identifier->toString();
@@ -88,6 +104,10 @@ void ParametricFunDeclaration::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ParametricFunDeclaration::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ParametricFunDeclaration::toString() {
     stringstream ss;
     ss << "(par (";
@@ -29,6 +29,8 @@ namespace smtlib {
                                       public AttributeValue,
                                       public std::enable_shared_from_this<SortSymbolDeclaration> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SORT_SYMBOL_DECLARATION;
+
             SimpleIdentifierPtr identifier;
             long arity;
             std::vector<AttributePtr> attributes;
@@ -55,7 +57,10 @@ namespace smtlib {
                     , arity(arity)
                     , attributes(std::move(attributes)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -77,6 +82,8 @@ namespace smtlib {
         class SpecConstFunDeclaration : public FunSymbolDeclaration,
                                         public std::enable_shared_from_this<SpecConstFunDeclaration> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SPEC_CONST_FUN_DECLARATION;
+
             SpecConstantPtr constant;
             SortPtr sort;
             std::vector<AttributePtr> attributes;
@@ -104,7 +111,10 @@ namespace smtlib {
                     , sort(std::move(sort))
                     , attributes(std::move(attributes)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -117,6 +127,8 @@ namespace smtlib {
         class MetaSpecConstFunDeclaration : public FunSymbolDeclaration,
                                             public std::enable_shared_from_this<MetaSpecConstFunDeclaration> {
         public:
+            static constexpr NodeKind KIND = NodeKind::META_SPEC_CONST_FUN_DECLARATION;
+
             MetaSpecConstantPtr constant;
             SortPtr sort;
             std::vector<AttributePtr> attributes;
@@ -144,7 +156,10 @@ namespace smtlib {
                     , sort(std::move(sort))
                     , attributes(std::move(attributes)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -157,6 +172,8 @@ namespace smtlib {
         class SimpleFunDeclaration : public FunSymbolDeclaration,
                                      public std::enable_shared_from_this<SimpleFunDeclaration> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SIMPLE_FUN_DECLARATION;
+
             SimpleIdentifierPtr identifier;
             std::vector<SortPtr> signature;
             std::vector<AttributePtr> attributes;
@@ -188,7 +205,10 @@ namespace smtlib {
                     , signature(std::move(signature))
                     , attributes(std::move(attributes)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -201,6 +221,8 @@ namespace smtlib {
         class ParametricFunDeclaration : public FunSymbolDeclaration,
                                          public std::enable_shared_from_this<ParametricFunDeclaration> {
         public:
+            static constexpr NodeKind KIND = NodeKind::PARAMETRIC_FUN_DECLARATION;
+
             std::vector<std::string> parameters;
             SimpleIdentifierPtr identifier;
             std::vector<SortPtr> signature;
@@ -235,10 +257,39 @@ namespace smtlib {
                     , signature(std::move(signature))
                     , attributes(std::move(attributes)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
+
+        /** Function symbol declarations are of the kinds of the four classes above */
+        template<>
+        struct NodeKinds<FunSymbolDeclaration> {
+            static inline bool contains(NodeKind kind) {
+                return kind == NodeKind::SPEC_CONST_FUN_DECLARATION
+                       || kind == NodeKind::META_SPEC_CONST_FUN_DECLARATION
+                       || kind == NodeKind::SIMPLE_FUN_DECLARATION
+                       || kind == NodeKind::PARAMETRIC_FUN_DECLARATION;
+            }
+
+            static inline FunSymbolDeclaration* cast(Node* node) {
+                switch (node->getKind()) {
+                    case NodeKind::SPEC_CONST_FUN_DECLARATION:
+                        return NodeKinds<SpecConstFunDeclaration>::cast(node);
+                    case NodeKind::META_SPEC_CONST_FUN_DECLARATION:
+                        return NodeKinds<MetaSpecConstFunDeclaration>::cast(node);
+                    case NodeKind::SIMPLE_FUN_DECLARATION:
+                        return NodeKinds<SimpleFunDeclaration>::cast(node);
+                    case NodeKind::PARAMETRIC_FUN_DECLARATION:
+                        return NodeKinds<ParametricFunDeclaration>::cast(node);
+                    default:
+                        return nullptr;
+                }
+            }
+        };
     }
 }
 
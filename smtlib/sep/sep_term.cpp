@@ -1,5 +1,7 @@
 #include "sep_term.h"
 
+#include "util/stack_guard.h"
+
 #include <sstream>
 
 using namespace std;
@@ -7,11 +9,23 @@ using namespace smtlib::sep;
 
 /* ================================== QualifiedTerm =================================== */
 
+QualifiedTerm::~QualifiedTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { terms.clear(); });
+}
+
 void QualifiedTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void QualifiedTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string QualifiedTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(" << identifier->toString();
 
@@ -25,11 +39,27 @@ string QualifiedTerm::toString() {
 
 /* ===================================== LetTerm ====================================== */
 
+LetTerm::~LetTerm() {
+    if (StackGuard::isLow()) {
+        StackGuard::runOnNewSegment([this] {
+            bindings.clear();
+            term.reset();
+        });
+    }
+}
+
 void LetTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void LetTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string LetTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(let (";
 
@@ -46,11 +76,23 @@ string LetTerm::toString() {
 
 /* ==================================== ForallTerm ==================================== */
 
+ForallTerm::~ForallTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { term.reset(); });
+}
+
 void ForallTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ForallTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ForallTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(forall (";
 
@@ -67,11 +109,23 @@ string ForallTerm::toString() {
 
 /* ==================================== ExistsTerm ==================================== */
 
+ExistsTerm::~ExistsTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { term.reset(); });
+}
+
 void ExistsTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ExistsTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ExistsTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(exists (";
 
@@ -88,11 +142,27 @@ string ExistsTerm::toString() {
 
 /* ==================================== MatchTerm ===================================== */
 
+MatchTerm::~MatchTerm() {
+    if (StackGuard::isLow()) {
+        StackGuard::runOnNewSegment([this] {
+            term.reset();
+            cases.clear();
+        });
+    }
+}
+
 void MatchTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void MatchTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string MatchTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(match " << term->toString();
 
@@ -106,11 +176,23 @@ string MatchTerm::toString() {
 
 /* ================================== AnnotatedTerm =================================== */
 
+AnnotatedTerm::~AnnotatedTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { term.reset(); });
+}
+
 void AnnotatedTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void AnnotatedTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string AnnotatedTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "( ! " << term->toString() << " ";
 
@@ -131,6 +213,10 @@ void TrueTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void TrueTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string TrueTerm::toString() {
     return "true";
 }
@@ -141,17 +227,33 @@ void FalseTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void FalseTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string FalseTerm::toString() {
     return "false";
 }
 
 /* ===================================== NotTerm ====================================== */
 
+NotTerm::~NotTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { term.reset(); });
+}
+
 void NotTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void NotTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string NotTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(not " << term->toString() << ")";
     return ss.str();
@@ -159,11 +261,23 @@ string NotTerm::toString() {
 
 /* =================================== ImpliesTerm ==================================== */
 
+ImpliesTerm::~ImpliesTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { terms.clear(); });
+}
+
 void ImpliesTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void ImpliesTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string ImpliesTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(=> ";
 
@@ -180,11 +294,23 @@ string ImpliesTerm::toString() {
 
 /* ===================================== AndTerm ====================================== */
 
+AndTerm::~AndTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { terms.clear(); });
+}
+
 void AndTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void AndTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string AndTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(and ";
 
@@ -201,11 +327,23 @@ string AndTerm::toString() {
 
 /* ====================================== OrTerm ====================================== */
 
+OrTerm::~OrTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { terms.clear(); });
+}
+
 void OrTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void OrTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string OrTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(or ";
 
@@ -222,11 +360,23 @@ string OrTerm::toString() {
 
 /* ===================================== XorTerm ====================================== */
 
+XorTerm::~XorTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { terms.clear(); });
+}
+
 void XorTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void XorTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string XorTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(xor ";
 
@@ -243,11 +393,23 @@ string XorTerm::toString() {
 
 /* ==================================== EqualsTerm ==================================== */
 
+EqualsTerm::~EqualsTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { terms.clear(); });
+}
+
 void EqualsTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void EqualsTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string EqualsTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(= ";
 
@@ -264,11 +426,23 @@ string EqualsTerm::toString() {
 
 /* =================================== DistinctTerm =================================== */
 
+DistinctTerm::~DistinctTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { terms.clear(); });
+}
+
 void DistinctTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void DistinctTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string DistinctTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(distinct ";
 
@@ -285,11 +459,28 @@ string DistinctTerm::toString() {
 
 /* ===================================== IteTerm ====================================== */
 
+IteTerm::~IteTerm() {
+    if (StackGuard::isLow()) {
+        StackGuard::runOnNewSegment([this] {
+            testTerm.reset();
+            thenTerm.reset();
+            elseTerm.reset();
+        });
+    }
+}
+
 void IteTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void IteTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string IteTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(ite " << testTerm->toString() << " "
        << thenTerm->toString() << " " << elseTerm->toString() << ")";
@@ -303,6 +494,10 @@ void EmpTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void EmpTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string EmpTerm::toString() {
     stringstream ss;
 
@@ -325,11 +520,23 @@ string EmpTerm::toString() {
 
 /* ===================================== SepTerm ====================================== */
 
+SepTerm::~SepTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { terms.clear(); });
+}
+
 void SepTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SepTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SepTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(sep ";
 
@@ -346,11 +553,23 @@ string SepTerm::toString() {
 
 /* ===================================== WandTerm ===================================== */
 
+WandTerm::~WandTerm() {
+    if (StackGuard::isLow())
+        StackGuard::runOnNewSegment([this] { terms.clear(); });
+}
+
 void WandTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void WandTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string WandTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(wand ";
 
@@ -367,11 +586,27 @@ string WandTerm::toString() {
 
 /* ===================================== PtoTerm ====================================== */
 
+PtoTerm::~PtoTerm() {
+    if (StackGuard::isLow()) {
+        StackGuard::runOnNewSegment([this] {
+            leftTerm.reset();
+            rightTerm.reset();
+        });
+    }
+}
+
 void PtoTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void PtoTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string PtoTerm::toString() {
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<string>([&] { return toString(); });
+
     stringstream ss;
     ss << "(pto " << leftTerm->toString() << " " << rightTerm->toString() << ")";
     return ss.str();
@@ -383,6 +618,10 @@ void NilTerm::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void NilTerm::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string NilTerm::toString() {
     if(sort) {
         stringstream ss;
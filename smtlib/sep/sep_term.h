@@ -22,6 +22,8 @@ namespace smtlib {
         class QualifiedTerm : public Term,
                               public std::enable_shared_from_this<QualifiedTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::QUALIFIED_TERM;
+
             IdentifierPtr identifier;
             std::vector<TermPtr> terms;
 
@@ -36,7 +38,12 @@ namespace smtlib {
                     : identifier(std::move(identifier))
                     , terms(std::move(terms)) {}
 
+            ~QualifiedTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -46,6 +53,8 @@ namespace smtlib {
         class LetTerm : public Term,
                         public std::enable_shared_from_this<LetTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::LET_TERM;
+
             std::vector<VariableBindingPtr> bindings;
             TermPtr term;
 
@@ -57,7 +66,12 @@ namespace smtlib {
                     : bindings(std::move(bindings))
                     , term(std::move(term)) {}
 
+            ~LetTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -67,6 +81,8 @@ namespace smtlib {
         class ForallTerm : public Term,
                            public std::enable_shared_from_this<ForallTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::FORALL_TERM;
+
             std::vector<SortedVariablePtr> bindings;
             TermPtr term;
 
@@ -78,7 +94,12 @@ namespace smtlib {
                     : bindings(std::move(bindings))
                     , term(std::move(term)) {}
 
+            ~ForallTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -88,6 +109,8 @@ namespace smtlib {
         class ExistsTerm : public Term,
                            public std::enable_shared_from_this<ExistsTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::EXISTS_TERM;
+
             std::vector<SortedVariablePtr> bindings;
             TermPtr term;
 
@@ -99,7 +122,12 @@ namespace smtlib {
                     : bindings(std::move(bindings))
                     , term(std::move(term)) {}
 
+            ~ExistsTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -109,6 +137,8 @@ namespace smtlib {
         class MatchTerm : public Term,
                           public std::enable_shared_from_this<MatchTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::MATCH_TERM;
+
             TermPtr term;
             std::vector<MatchCasePtr> cases;
 
@@ -120,7 +150,12 @@ namespace smtlib {
                     : term(std::move(term))
                     , cases(std::move(cases)) {}
 
+            ~MatchTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -130,6 +165,8 @@ namespace smtlib {
         class AnnotatedTerm : public Term,
                               public std::enable_shared_from_this<AnnotatedTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::ANNOTATED_TERM;
+
             TermPtr term;
             std::vector<AttributePtr> attributes;
 
@@ -141,7 +178,12 @@ namespace smtlib {
                     : term(std::move(term))
                     , attributes(std::move(attributes)) {}
 
+            ~AnnotatedTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -151,9 +193,14 @@ namespace smtlib {
         class TrueTerm : public Term,
                          public std::enable_shared_from_this<TrueTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::TRUE_TERM;
+
             inline TrueTerm() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -163,9 +210,14 @@ namespace smtlib {
         class FalseTerm : public Term,
                           public std::enable_shared_from_this<FalseTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::FALSE_TERM;
+
             inline FalseTerm() = default;
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -175,6 +227,8 @@ namespace smtlib {
         class NotTerm : public Term,
                         public std::enable_shared_from_this<NotTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::NOT_TERM;
+
             TermPtr term;
 
             /**
@@ -183,7 +237,12 @@ namespace smtlib {
             inline explicit NotTerm(TermPtr term)
                     : term(std::move(term)) {}
 
+            ~NotTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -193,6 +252,8 @@ namespace smtlib {
         class ImpliesTerm : public Term,
                             public std::enable_shared_from_this<ImpliesTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::IMPLIES_TERM;
+
             std::vector<TermPtr> terms;
 
             /**
@@ -201,7 +262,12 @@ namespace smtlib {
             inline explicit ImpliesTerm(std::vector<TermPtr> terms)
                     : terms(std::move(terms)) {}
 
+            ~ImpliesTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -211,6 +277,8 @@ namespace smtlib {
         class AndTerm : public Term,
                         public std::enable_shared_from_this<AndTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::AND_TERM;
+
             std::vector<TermPtr> terms;
 
             /** Default constructor */
@@ -222,7 +290,12 @@ namespace smtlib {
             inline explicit AndTerm(std::vector<TermPtr> terms)
                     : terms(std::move(terms)) {}
 
+            ~AndTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -232,6 +305,8 @@ namespace smtlib {
         class OrTerm : public Term,
                        public std::enable_shared_from_this<OrTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::OR_TERM;
+
             std::vector<TermPtr> terms;
 
             /**
@@ -240,7 +315,12 @@ namespace smtlib {
             inline explicit OrTerm(std::vector<TermPtr> terms)
                     : terms(std::move(terms)) {}
 
+            ~OrTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
 
@@ -251,6 +331,8 @@ namespace smtlib {
         class XorTerm : public Term,
                         public std::enable_shared_from_this<XorTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::XOR_TERM;
+
             std::vector<TermPtr> terms;
 
             /**
@@ -259,7 +341,12 @@ namespace smtlib {
             inline explicit XorTerm(std::vector<TermPtr> terms)
                     : terms(std::move(terms)) {}
 
+            ~XorTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -269,6 +356,8 @@ namespace smtlib {
         class EqualsTerm : public Term,
                            public std::enable_shared_from_this<EqualsTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::EQUALS_TERM;
+
             std::vector<TermPtr> terms;
 
             /**
@@ -277,7 +366,12 @@ namespace smtlib {
             inline explicit EqualsTerm(std::vector<TermPtr> terms)
                     : terms(std::move(terms)) {}
 
+            ~EqualsTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -287,6 +381,8 @@ namespace smtlib {
         class DistinctTerm : public Term,
                              public std::enable_shared_from_this<DistinctTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::DISTINCT_TERM;
+
             std::vector<TermPtr> terms;
 
             /**
@@ -295,7 +391,12 @@ namespace smtlib {
             inline explicit DistinctTerm(std::vector<TermPtr> terms)
                     : terms(std::move(terms)) {}
 
+            ~DistinctTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -305,6 +406,8 @@ namespace smtlib {
         class IteTerm : public Term,
                         public std::enable_shared_from_this<IteTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::ITE_TERM;
+
             TermPtr testTerm;
             TermPtr thenTerm;
             TermPtr elseTerm;
@@ -319,7 +422,12 @@ namespace smtlib {
                     , thenTerm(std::move(thenTerm))
                     , elseTerm(std::move(elseTerm)) {}
 
+            ~IteTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -329,6 +437,8 @@ namespace smtlib {
         class EmpTerm : public Term,
                         public std::enable_shared_from_this<EmpTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::EMP_TERM;
+
             SortPtr locSort;
             SortPtr dataSort;
 
@@ -336,7 +446,10 @@ namespace smtlib {
                     : locSort(std::move(locSort))
                     , dataSort(std::move(dataSort)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -346,6 +459,8 @@ namespace smtlib {
         class SepTerm : public Term,
                         public std::enable_shared_from_this<SepTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SEP_TERM;
+
             std::vector<TermPtr> terms;
 
             /** Default constructor */
@@ -357,7 +472,12 @@ namespace smtlib {
             inline explicit SepTerm(std::vector<TermPtr> terms)
                     : terms(std::move(terms)) {}
 
+            ~SepTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -367,12 +487,19 @@ namespace smtlib {
         class WandTerm : public Term,
                          public std::enable_shared_from_this<WandTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::WAND_TERM;
+
             std::vector<TermPtr> terms;
 
             explicit WandTerm(std::vector<TermPtr> terms)
                     : terms(std::move(terms)) {}
 
+            ~WandTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -382,6 +509,8 @@ namespace smtlib {
         class PtoTerm : public Term,
                         public std::enable_shared_from_this<PtoTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::PTO_TERM;
+
             TermPtr leftTerm;
             TermPtr rightTerm;
 
@@ -393,7 +522,12 @@ namespace smtlib {
                     : leftTerm(std::move(leftTerm))
                     , rightTerm(std::move(rightTerm)) {}
 
+            ~PtoTerm();
+
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -403,6 +537,8 @@ namespace smtlib {
         class NilTerm : public Term,
                         public std::enable_shared_from_this<NilTerm> {
         public:
+            static constexpr NodeKind KIND = NodeKind::NIL_TERM;
+
             SortPtr sort;
 
             /** Default constructor */
@@ -414,7 +550,10 @@ namespace smtlib {
             inline explicit NilTerm(SortPtr sort)
                     : sort(std::move(sort)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -0,0 +1,359 @@
+#include "sep_term_table.h"
+
+#include "sep_identifier.h"
+#include "sep_literal.h"
+#include "sep_sort.h"
+#include "sep_term.h"
+#include "sep_variable.h"
+
+#include <cstring>
+#include <functional>
+
+using namespace std;
+using namespace smtlib::sep;
+
+namespace {
+    size_t combine(size_t seed, size_t value) {
+        return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+    }
+
+    /** Cast a term to its concrete class, which never has Term as a virtual base */
+    template<class T>
+    inline T* as(Term* term) {
+        return static_cast<T*>(term);
+    }
+
+    size_t hashOf(const TermPtr& term) {
+        return term ? term->termHash : 0;
+    }
+
+    size_t hashOf(const SortPtr& sort) {
+        return sort ? sort->getCanonical()->hash : 0;
+    }
+
+    size_t hashOf(const vector<TermPtr>& terms) {
+        size_t hash = terms.size();
+        for (const auto& term : terms) {
+            hash = combine(hash, hashOf(term));
+        }
+        return hash;
+    }
+
+    size_t hashOf(SimpleIdentifier* id) {
+        size_t hash = std::hash<string>()(id->name);
+        for (const auto& index : id->indices) {
+            hash = combine(hash, std::hash<string>()(index->toString()));
+        }
+        return hash;
+    }
+
+    const CanonicalSort* canonical(const SortPtr& sort) {
+        return sort ? sort->getCanonical() : nullptr;
+    }
+
+    bool equal(SimpleIdentifier* id1, SimpleIdentifier* id2) {
+        if (id1->name != id2->name || id1->indices.size() != id2->indices.size())
+            return false;
+
+        for (size_t i = 0, sz = id1->indices.size(); i < sz; i++) {
+            if (id1->indices[i]->toString() != id2->indices[i]->toString())
+                return false;
+        }
+
+        return true;
+    }
+
+    /** Hash of a term whose subterms have already been interned */
+    size_t computeHash(Term* term) {
+        size_t hash = (size_t) term->getKind();
+
+        switch (term->getKind()) {
+            case NodeKind::SIMPLE_IDENTIFIER:
+                return combine(hash, hashOf(as<SimpleIdentifier>(term)));
+
+            case NodeKind::QUALIFIED_IDENTIFIER: {
+                auto id = as<QualifiedIdentifier>(term);
+                hash = combine(hash, id->identifier ? hashOf(id->identifier.get()) : 0);
+                return combine(hash, hashOf(id->sort));
+            }
+
+            case NodeKind::NUMERAL_LITERAL: {
+                auto literal = as<NumeralLiteral>(term);
+                return combine(combine(hash, std::hash<long>()(literal->value)), literal->base);
+            }
+
+            case NodeKind::DECIMAL_LITERAL:
+                return combine(hash, std::hash<double>()(as<DecimalLiteral>(term)->value));
+
+            case NodeKind::STRING_LITERAL:
+                return combine(hash, std::hash<string>()(as<StringLiteral>(term)->value));
+
+            case NodeKind::QUALIFIED_TERM: {
+                auto qterm = as<QualifiedTerm>(term);
+                hash = combine(hash, hashOf(qterm->identifier));
+                return combine(hash, hashOf(qterm->terms));
+            }
+
+            case NodeKind::LET_TERM: {
+                auto let = as<LetTerm>(term);
+                for (const auto& bind : let->bindings) {
+                    hash = combine(hash, std::hash<string>()(bind->name));
+                    hash = combine(hash, hashOf(bind->term));
+                }
+                return combine(hash, hashOf(let->term));
+            }
+
+            case NodeKind::FORALL_TERM:
+            case NodeKind::EXISTS_TERM: {
+                bool forall = term->getKind() == NodeKind::FORALL_TERM;
+                const auto& bindings = forall ? as<ForallTerm>(term)->bindings : as<ExistsTerm>(term)->bindings;
+                const auto& body = forall ? as<ForallTerm>(term)->term : as<ExistsTerm>(term)->term;
+
+                for (const auto& bind : bindings) {
+                    hash = combine(hash, std::hash<string>()(bind->name));
+                    hash = combine(hash, hashOf(bind->sort));
+                }
+                return combine(hash, hashOf(body));
+            }
+
+            case NodeKind::MATCH_TERM:
+                return combine(hash, hashOf(as<MatchTerm>(term)->term));
+
+            case NodeKind::ANNOTATED_TERM:
+                return combine(hash, hashOf(as<AnnotatedTerm>(term)->term));
+
+            case NodeKind::NOT_TERM:
+                return combine(hash, hashOf(as<NotTerm>(term)->term));
+
+            case NodeKind::IMPLIES_TERM:
+                return combine(hash, hashOf(as<ImpliesTerm>(term)->terms));
+
+            case NodeKind::AND_TERM:
+                return combine(hash, hashOf(as<AndTerm>(term)->terms));
+
+            case NodeKind::OR_TERM:
+                return combine(hash, hashOf(as<OrTerm>(term)->terms));
+
+            case NodeKind::XOR_TERM:
+                return combine(hash, hashOf(as<XorTerm>(term)->terms));
+
+            case NodeKind::EQUALS_TERM:
+                return combine(hash, hashOf(as<EqualsTerm>(term)->terms));
+
+            case NodeKind::DISTINCT_TERM:
+                return combine(hash, hashOf(as<DistinctTerm>(term)->terms));
+
+            case NodeKind::SEP_TERM:
+                return combine(hash, hashOf(as<SepTerm>(term)->terms));
+
+            case NodeKind::WAND_TERM:
+                return combine(hash, hashOf(as<WandTerm>(term)->terms));
+
+            case NodeKind::ITE_TERM: {
+                auto ite = as<IteTerm>(term);
+                hash = combine(hash, hashOf(ite->testTerm));
+                hash = combine(hash, hashOf(ite->thenTerm));
+                return combine(hash, hashOf(ite->elseTerm));
+            }
+
+            case NodeKind::EMP_TERM: {
+                auto emp = as<EmpTerm>(term);
+                return combine(combine(hash, hashOf(emp->locSort)), hashOf(emp->dataSort));
+            }
+
+            case NodeKind::PTO_TERM: {
+                auto pto = as<PtoTerm>(term);
+                return combine(combine(hash, hashOf(pto->leftTerm)), hashOf(pto->rightTerm));
+            }
+
+            case NodeKind::NIL_TERM:
+                return combine(hash, hashOf(as<NilTerm>(term)->sort));
+
+            default:
+                // True and false terms
+                return hash;
+        }
+    }
+
+    /** Structural equality of two terms with equal hashes, whose subterms have already been interned */
+    bool equal(Term* term1, Term* term2) {
+        if (term1->getKind() != term2->getKind())
+            return false;
+
+        // Subterms are already interned, so they are compared as pointers
+        switch (term1->getKind()) {
+            case NodeKind::SIMPLE_IDENTIFIER:
+                return equal(as<SimpleIdentifier>(term1), as<SimpleIdentifier>(term2));
+
+            case NodeKind::QUALIFIED_IDENTIFIER: {
+                auto id1 = as<QualifiedIdentifier>(term1);
+                auto id2 = as<QualifiedIdentifier>(term2);
+                return id1->identifier == id2->identifier && canonical(id1->sort) == canonical(id2->sort);
+            }
+
+            case NodeKind::NUMERAL_LITERAL: {
+                auto literal1 = as<NumeralLiteral>(term1);
+                auto literal2 = as<NumeralLiteral>(term2);
+                return literal1->value == literal2->value && literal1->base == literal2->base;
+            }
+
+            case NodeKind::DECIMAL_LITERAL: {
+                // Compare the representations, so that values such as NaN are still equal to themselves
+                double value1 = as<DecimalLiteral>(term1)->value;
+                double value2 = as<DecimalLiteral>(term2)->value;
+                return memcmp(&value1, &value2, sizeof(double)) == 0;
+            }
+
+            case NodeKind::STRING_LITERAL:
+                return as<StringLiteral>(term1)->value == as<StringLiteral>(term2)->value;
+
+            case NodeKind::QUALIFIED_TERM: {
+                auto qterm1 = as<QualifiedTerm>(term1);
+                auto qterm2 = as<QualifiedTerm>(term2);
+                return qterm1->identifier == qterm2->identifier && qterm1->terms == qterm2->terms;
+            }
+
+            case NodeKind::LET_TERM: {
+                auto let1 = as<LetTerm>(term1);
+                auto let2 = as<LetTerm>(term2);
+                if (let1->term != let2->term || let1->bindings.size() != let2->bindings.size())
+                    return false;
+
+                for (size_t i = 0, sz = let1->bindings.size(); i < sz; i++) {
+                    if (let1->bindings[i]->name != let2->bindings[i]->name
+                        || let1->bindings[i]->term != let2->bindings[i]->term)
+                        return false;
+                }
+
+                return true;
+            }
+
+            case NodeKind::FORALL_TERM:
+            case NodeKind::EXISTS_TERM: {
+                bool forall = term1->getKind() == NodeKind::FORALL_TERM;
+                const auto& bindings1 = forall ? as<ForallTerm>(term1)->bindings : as<ExistsTerm>(term1)->bindings;
+                const auto& bindings2 = forall ? as<ForallTerm>(term2)->bindings : as<ExistsTerm>(term2)->bindings;
+                const auto& body1 = forall ? as<ForallTerm>(term1)->term : as<ExistsTerm>(term1)->term;
+                const auto& body2 = forall ? as<ForallTerm>(term2)->term : as<ExistsTerm>(term2)->term;
+
+                if (body1 != body2 || bindings1.size() != bindings2.size())
+                    return false;
+
+                for (size_t i = 0, sz = bindings1.size(); i < sz; i++) {
+                    if (bindings1[i]->name != bindings2[i]->name
+                        || canonical(bindings1[i]->sort) != canonical(bindings2[i]->sort))
+                        return false;
+                }
+
+                return true;
+            }
+
+            case NodeKind::NOT_TERM:
+                return as<NotTerm>(term1)->term == as<NotTerm>(term2)->term;
+
+            case NodeKind::IMPLIES_TERM:
+                return as<ImpliesTerm>(term1)->terms == as<ImpliesTerm>(term2)->terms;
+
+            case NodeKind::AND_TERM:
+                return as<AndTerm>(term1)->terms == as<AndTerm>(term2)->terms;
+
+            case NodeKind::OR_TERM:
+                return as<OrTerm>(term1)->terms == as<OrTerm>(term2)->terms;
+
+            case NodeKind::XOR_TERM:
+                return as<XorTerm>(term1)->terms == as<XorTerm>(term2)->terms;
+
+            case NodeKind::EQUALS_TERM:
+                return as<EqualsTerm>(term1)->terms == as<EqualsTerm>(term2)->terms;
+
+            case NodeKind::DISTINCT_TERM:
+                return as<DistinctTerm>(term1)->terms == as<DistinctTerm>(term2)->terms;
+
+            case NodeKind::SEP_TERM:
+                return as<SepTerm>(term1)->terms == as<SepTerm>(term2)->terms;
+
+            case NodeKind::WAND_TERM:
+                return as<WandTerm>(term1)->terms == as<WandTerm>(term2)->terms;
+
+            case NodeKind::ITE_TERM: {
+                auto ite1 = as<IteTerm>(term1);
+                auto ite2 = as<IteTerm>(term2);
+                return ite1->testTerm == ite2->testTerm && ite1->thenTerm == ite2->thenTerm
+                       && ite1->elseTerm == ite2->elseTerm;
+            }
+
+            case NodeKind::EMP_TERM: {
+                auto emp1 = as<EmpTerm>(term1);
+                auto emp2 = as<EmpTerm>(term2);
+                return canonical(emp1->locSort) == canonical(emp2->locSort)
+                       && canonical(emp1->dataSort) == canonical(emp2->dataSort);
+            }
+
+            case NodeKind::PTO_TERM: {
+                auto pto1 = as<PtoTerm>(term1);
+                auto pto2 = as<PtoTerm>(term2);
+                return pto1->leftTerm == pto2->leftTerm && pto1->rightTerm == pto2->rightTerm;
+            }
+
+            case NodeKind::NIL_TERM:
+                return canonical(as<NilTerm>(term1)->sort) == canonical(as<NilTerm>(term2)->sort);
+
+            case NodeKind::TRUE_TERM:
+            case NodeKind::FALSE_TERM:
+                return true;
+
+            default:
+                // Match and annotated terms
+                return false;
+        }
+    }
+}
+
+TermPtr TermTable::getTerm(TermId id) {
+    if (id == 0 || id > terms.size())
+        return TermPtr();
+
+    return terms[id - 1];
+}
+
+void TermTable::place(size_t hash, Term* term) {
+    size_t mask = slots.size() - 1;
+    size_t pos = hash & mask;
+    while (slots[pos].term)
+        pos = (pos + 1) & mask;
+
+    slots[pos].hash = hash;
+    slots[pos].term = term;
+}
+
+TermPtr TermTable::internTerm(const TermPtr& term) {
+    if (!term || term->termId != 0)
+        return term;
+
+    // Equal terms may have different sorts (e.g. variables bound in different scopes),
+    // so the sorts they are annotated with are compared as well
+    size_t hash = combine(computeHash(term.get()), hashOf(term->inferredSort));
+    term->termHash = hash;
+
+    size_t mask = slots.size() - 1;
+    for (size_t pos = hash & mask; slots[pos].term; pos = (pos + 1) & mask) {
+        Term* slotTerm = slots[pos].term;
+        if (slots[pos].hash == hash && canonical(slotTerm->inferredSort) == canonical(term->inferredSort)
+            && equal(slotTerm, term.get()))
+            return terms[slotTerm->termId - 1];
+    }
+
+    terms.push_back(term);
+    term->termId = (TermId) terms.size();
+
+    // Keep the load factor under 1/2
+    if (2 * terms.size() > slots.size()) {
+        slots.assign(2 * slots.size(), Slot());
+        for (const auto& t : terms)
+            place(t->termHash, t.get());
+    } else {
+        place(hash, term.get());
+    }
+
+    return term;
+}
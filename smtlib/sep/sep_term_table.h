@@ -0,0 +1,66 @@
+/**
+ * \file sep_term_table.h
+ * \brief Hash-consing of SMT-LIB+SEPLOG terms.
+ */
+
+#ifndef SLCOMP_PARSER_SEP_TERM_TABLE_H
+#define SLCOMP_PARSER_SEP_TERM_TABLE_H
+
+#include "sep_interfaces.h"
+
+#include <memory>
+#include <vector>
+
+namespace smtlib {
+    namespace sep {
+        /**
+         * Table of hash-consed terms, in which structurally equal terms are represented by the same node.
+         * Terms are interned bottom-up, so the subterms of a term are already shared when it is interned,
+         * and two terms are equal if they are of the same kind, have the same symbols and sorts,
+         * the same subterm nodes, and are annotated with the same sort. Each distinct term is given an identifier, unique within the table,
+         * and a structural hash, which can both be used as memoization keys.
+         * Match terms and annotated terms are never merged with other terms.
+         * Shared terms keep the location of their first occurrence.
+         */
+        class TermTable {
+        public:
+            /**
+             * Get the term in the table that is equal to the given term, adding the term if there is none.
+             * \param term  Term whose subterms have already been interned
+             * \return The shared term, which is of the same class as the given term
+             */
+            template<class T>
+            inline std::shared_ptr<T> intern(const std::shared_ptr<T>& term) {
+                // T is never a virtual base of Term, so the shared term can be cast back
+                return std::static_pointer_cast<T>(internTerm(term));
+            }
+
+            /** Get the term with the given identifier, or null if there is none */
+            TermPtr getTerm(TermId id);
+
+            /** Number of distinct terms in the table */
+            inline size_t size() { return terms.size(); }
+
+        private:
+            /** Position in the open-addressing table, empty if it has no term */
+            struct Slot {
+                size_t hash = 0;
+                Term* term = nullptr;
+            };
+
+            /** Interned terms, in the order of their identifiers */
+            std::vector<TermPtr> terms;
+
+            /** Open-addressing table with linear probing, whose size is a power of two */
+            std::vector<Slot> slots = std::vector<Slot>(1024);
+
+            void place(size_t hash, Term* term);
+
+            TermPtr internTerm(const TermPtr& term);
+        };
+
+        typedef std::shared_ptr<TermTable> TermTablePtr;
+    }
+}
+
+#endif //SLCOMP_PARSER_SEP_TERM_TABLE_H
@@ -9,6 +9,10 @@ void Theory::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void Theory::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string Theory::toString() {
     stringstream ss;
     ss << "(theory  " << name;
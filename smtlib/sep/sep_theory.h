@@ -21,6 +21,8 @@ namespace smtlib {
         class Theory : public Root,
                        public std::enable_shared_from_this<Theory> {
         public:
+            static constexpr NodeKind KIND = NodeKind::THEORY;
+
             std::string name;
             std::vector<AttributePtr> attributes;
 
@@ -40,7 +42,10 @@ namespace smtlib {
                     : name(std::move(name))
                     , attributes(std::move(attributes)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
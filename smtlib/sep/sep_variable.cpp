@@ -11,6 +11,10 @@ void SortedVariable::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void SortedVariable::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string SortedVariable::toString() {
     stringstream ss;
     ss << name << " " << sort->toString();
@@ -23,6 +27,10 @@ void VariableBinding::accept(Visitor0* visitor) {
     visitor->visit(shared_from_this());
 }
 
+void VariableBinding::accept(RawVisitor0* visitor) {
+    visitor->visit(this);
+}
+
 string VariableBinding::toString() {
     stringstream ss;
     ss << name << " " << term->toString();
@@ -20,6 +20,8 @@ namespace smtlib {
         class SortedVariable : public Node,
                                public std::enable_shared_from_this<SortedVariable> {
         public:
+            static constexpr NodeKind KIND = NodeKind::SORTED_VARIABLE;
+
             std::string name;
             SortPtr sort;
 
@@ -31,7 +33,10 @@ namespace smtlib {
                     : name(std::move(name))
                     , sort(std::move(sort)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -41,6 +46,8 @@ namespace smtlib {
         class VariableBinding : public Node,
                                 public std::enable_shared_from_this<VariableBinding> {
         public:
+            static constexpr NodeKind KIND = NodeKind::VARIABLE_BINDING;
+
             std::string name;
             TermPtr term;
 
@@ -52,7 +59,10 @@ namespace smtlib {
                     : name(std::move(name))
                     , term(std::move(term)) {}
 
+            inline NodeKind getKind() override { return KIND; }
+
             void accept(Visitor0* visitor) override;
+            void accept(RawVisitor0* visitor) override;
 
             std::string toString() override;
         };
@@ -5,94 +5,254 @@
 using namespace std;
 using namespace smtlib::sep;
 
-SymbolStack::SymbolStack() {
-    push();
+namespace {
+    /** Append the function entries of a table for a symbol */
+    void appendFunEntries(const SymbolTablePtr& table, SymbolId id, std::vector<FunEntryPtr>& entries) {
+        FunEntryMap& funs = table->getFuns();
+        auto it = funs.find(id);
+        if (it != funs.end())
+            entries.insert(entries.end(), it->second.begin(), it->second.end());
+    }
 }
 
-SymbolTablePtr SymbolStack::getTopLevel() {
-    return stack[stack.size() - 1];
-}
+SymbolStack::SymbolStack()
+        : global(make_shared<SymbolTable>()) {}
+
+void SymbolStack::collectHeap() {
+    heap.clear();
+    heapMarks.clear();
 
-std::vector<SymbolTablePtr>& SymbolStack::getLevels() {
-    return stack;
+    for (const auto& layer : layers) {
+        const HeapEntryMap& layerHeap = layer->getHeap();
+        heap.insert(heap.end(), layerHeap.begin(), layerHeap.end());
+    }
+
+    for (const auto& table : sealed) {
+        const HeapEntryMap& sealedHeap = table->getHeap();
+        heap.insert(heap.end(), sealedHeap.begin(), sealedHeap.end());
+    }
+
+    const HeapEntryMap& globalHeap = global->getHeap();
+    heap.insert(heap.end(), globalHeap.begin(), globalHeap.end());
 }
 
 bool SymbolStack::push() {
-    size_t size = stack.size();
-    stack.push_back(make_shared<SymbolTable>());
-    return (stack.size() == size + 1);
+    sorts.push();
+    funs.push();
+    vars.push();
+    heapMarks.push_back(heap.size());
+    return true;
 }
 
 bool SymbolStack::push(size_t levels) {
-    size_t size = stack.size();
-    for (int i = 0; i < levels; i++)
-        stack.push_back(make_shared<SymbolTable>());
-    return (stack.size() == size + levels);
+    for (size_t i = 0; i < levels; i++)
+        push();
+    return true;
 }
 
 bool SymbolStack::pop() {
-    if (stack.size() <= 1) {
+    if (heapMarks.empty())
         return false;
-    } else {
-        size_t size = stack.size();
-        stack.erase(stack.begin() + (stack.size() - 1));
-        return (stack.size() == size - 1);
-    }
+
+    if (sorts.hasScopeBindings())
+        expansions.clear();
+    if (funs.hasScopeBindings())
+        instances.clear();
+
+    sorts.pop();
+    funs.pop();
+    vars.pop();
+    heap.resize(heapMarks.back());
+    heapMarks.pop_back();
+    return true;
 }
 
 bool SymbolStack::pop(size_t levels) {
-    if (stack.size() <= 1 + levels || levels == 0) {
+    if (levels == 0 || heapMarks.size() < levels)
         return false;
+
+    for (size_t i = 0; i < levels; i++)
+        pop();
+    return true;
+}
+
+void SymbolStack::reset() {
+    sorts.clear();
+    funs.clear();
+    vars.clear();
+    expansions.clear();
+    instances.clear();
+
+    // Sealed tables may be shared with other stacks, so only the entries kept on reset are copied out of them
+    if (!sealed.empty()) {
+        SymbolTablePtr table = make_shared<SymbolTable>();
+        for (const auto& sealedTable : sealed) {
+            table->mergeTheoryEntries(sealedTable);
+        }
+        table->mergeTheoryEntries(global);
+
+        global = table;
+        sealed.clear();
+        current.reset();
     } else {
-        size_t size = stack.size();
-        stack.erase(stack.begin() + (stack.size() - levels), stack.begin() + (stack.size() - 1));
-        return (stack.size() == size - 1);
+        global->reset();
     }
+    collectHeap();
 }
 
-void SymbolStack::reset() {
-    pop(stack.size() - 1);
-    getTopLevel()->reset();
+void SymbolStack::mount(const SymbolTablePtr& layer) {
+    layers.push_back(layer);
+    current.reset();
+    expansions.clear();
+    collectHeap();
+}
+
+SymbolTablePtr SymbolStack::mountTopLevel() {
+    SymbolTablePtr layer = global;
+    global = make_shared<SymbolTable>();
+    mount(layer);
+    return layer;
+}
+
+std::vector<SymbolTablePtr> SymbolStack::getLayers() {
+    return layers;
+}
+
+void SymbolStack::keepSourceMap(const SourceMapPtr& sources) {
+    if (sources)
+        sourceMaps.push_back(sources);
+}
+
+const std::vector<SourceMapPtr>& SymbolStack::getSourceMaps() {
+    return sourceMaps;
+}
+
+bool SymbolStack::isEmpty() {
+    return heapMarks.empty() && sealed.empty() && global->isEmpty();
+}
+
+size_t SymbolStack::getDepth() {
+    return heapMarks.size();
+}
+
+void SymbolStack::seal() {
+    SymbolTablePtr table = global;
+    global = make_shared<SymbolTable>();
+
+    while (!sealed.empty() && sealed.back()->getSize() <= table->getSize()) {
+        SymbolTablePtr merged = make_shared<SymbolTable>();
+        merged->merge(sealed.back());
+        merged->merge(table);
+
+        sealed.pop_back();
+        table = merged;
+    }
+
+    sealed.push_back(table);
+    current.reset();
+}
+
+SymbolSnapshotPtr SymbolStack::snapshot() {
+    if (!global->isEmpty())
+        seal();
+
+    if (!current) {
+        auto result = make_shared<SymbolSnapshot>();
+        result->layers = layers;
+        result->sealed = sealed;
+        current = result;
+    }
+
+    return current;
+}
+
+void SymbolStack::restore(const SymbolSnapshotPtr& snapshot) {
+    pop(getDepth());
+
+    // Memoized expansions and instances stay valid while the entries are the same
+    if (snapshot == current && global->isEmpty())
+        return;
+
+    layers = snapshot->layers;
+    sealed = snapshot->sealed;
+    global = make_shared<SymbolTable>();
+    current = snapshot;
+
+    expansions.clear();
+    instances.clear();
+    collectHeap();
 }
 
 SortEntryPtr SymbolStack::getSortEntry(const string& name) {
-    for (const auto& lvl : stack) {
-        SortEntryPtr entry = lvl->getSortEntry(name);
-        if (entry)
-            return entry;
+    SymbolId id;
+    if (!Interner::find(name, id))
+        return SortEntryPtr();
+    return getSortEntry(id);
+}
+
+SortEntryPtr SymbolStack::getSortEntry(SymbolId id) {
+    SortEntryPtr entry = sorts.get(id);
+    if (!entry)
+        entry = global->getSortEntry(id);
+
+    for (auto it = sealed.rbegin(); !entry && it != sealed.rend(); it++) {
+        entry = (*it)->getSortEntry(id);
+    }
+
+    for (auto it = layers.rbegin(); !entry && it != layers.rend(); it++) {
+        entry = (*it)->getSortEntry(id);
     }
-    return SortEntryPtr();
+    return entry;
 }
 
 std::vector<FunEntryPtr> SymbolStack::getFunEntry(const string& name) {
+    SymbolId id;
+    if (!Interner::find(name, id))
+        return std::vector<FunEntryPtr>();
+    return getFunEntry(id);
+}
+
+std::vector<FunEntryPtr> SymbolStack::getFunEntry(SymbolId id) {
     std::vector<FunEntryPtr> result;
-    for (const auto& lvl : stack) {
-        std::vector<FunEntryPtr> entries = lvl->getFunEntry(name);
-        result.insert(result.end(), entries.begin(), entries.end());
+    for (const auto& layer : layers) {
+        appendFunEntries(layer, id, result);
     }
+    for (const auto& table : sealed) {
+        appendFunEntries(table, id, result);
+    }
+    appendFunEntries(global, id, result);
+    funs.getAll(id, result);
     return result;
 }
 
 VarEntryPtr SymbolStack::getVarEntry(const string& name) {
-    for (const auto& lvl : stack) {
-        VarEntryPtr entry = lvl->getVarEntry(name);
-        if (entry)
-            return entry;
+    SymbolId id;
+    if (!Interner::find(name, id))
+        return VarEntryPtr();
+    return getVarEntry(id);
+}
+
+VarEntryPtr SymbolStack::getVarEntry(SymbolId id) {
+    VarEntryPtr entry = vars.get(id);
+    if (!entry)
+        entry = global->getVarEntry(id);
+
+    for (auto it = sealed.rbegin(); !entry && it != sealed.rend(); it++) {
+        entry = (*it)->getVarEntry(id);
+    }
+
+    for (auto it = layers.rbegin(); !entry && it != layers.rend(); it++) {
+        entry = (*it)->getVarEntry(id);
     }
-    return VarEntryPtr();
+    return entry;
 }
 
 SortEntryPtr SymbolStack::findDuplicate(const SortEntryPtr& entry) {
-    for (const auto& lvl : stack) {
-        SortEntryPtr dup = lvl->getSortEntry(entry->name);
-        if (dup)
-            return dup;
-    }
-    return SortEntryPtr();
+    return getSortEntry(entry->id);
 }
 
 FunEntryPtr SymbolStack::findDuplicate(const FunEntryPtr& entry) {
-    std::vector<FunEntryPtr> knownFuns = getFunEntry(entry->name);
+    std::vector<FunEntryPtr> knownFuns = getFunEntry(entry->id);
     for (const auto& fun : knownFuns) {
         if (entry->params.empty() && fun->params.empty()) {
             if (equal(entry->signature, fun->signature)) {
@@ -108,7 +268,14 @@ FunEntryPtr SymbolStack::findDuplicate(const FunEntryPtr& entry) {
 }
 
 VarEntryPtr SymbolStack::findDuplicate(const VarEntryPtr& entry) {
-    return getTopLevel()->getVarEntry(entry->name);
+    if (vars.getDepth() > 0)
+        return vars.getInScope(entry->id);
+
+    VarEntryPtr dup = global->getVarEntry(entry->id);
+    for (auto it = sealed.rbegin(); !dup && it != sealed.rend(); it++) {
+        dup = (*it)->getVarEntry(entry->id);
+    }
+    return dup;
 }
 
 SortPtr SymbolStack::replace(const SortPtr& sort, unordered_map<string, SortPtr>& mapping) {
@@ -144,21 +311,17 @@ HeapEntry SymbolStack::findDuplicate(const HeapEntry& entry) {
     const SortPtr& locSortExp = expand(entry.first);
     const SortPtr& dataSortExp = expand(entry.second);
 
-    string locSortStr = std::move(locSortExp->toString());
-    string dataSortExpStr = std::move(dataSortExp->toString());
-
-    for (const auto& lvl : stack) {
-        const HeapEntryMap& heap = lvl->getHeap();
+    const CanonicalSort* locSortCan = locSortExp->getCanonical();
+    const CanonicalSort* dataSortCan = dataSortExp->getCanonical();
 
-        auto found = find_if(heap.begin(), heap.end(),
-                             [&](const pair<SortPtr, SortPtr>& p) {
-                                 return locSortStr == p.first->toString() &&
-                                        dataSortExpStr == p.second->toString();
-                             });
+    auto found = find_if(heap.begin(), heap.end(),
+                         [&](const pair<SortPtr, SortPtr>& p) {
+                             return locSortCan == p.first->getCanonical() &&
+                                    dataSortCan == p.second->getCanonical();
+                         });
 
-        if(found != heap.end())  {
-            return (*found);
-        }
+    if(found != heap.end())  {
+        return (*found);
     }
 
     return make_pair(SortPtr(), SortPtr());
@@ -168,6 +331,39 @@ SortPtr SymbolStack::expand(const SortPtr& sort) {
     if (!sort)
         return sort;
 
+    // Expansions only depend on the sort entries, so they are memoized until these change
+    const CanonicalSort* canonical = sort->getCanonical();
+    auto it = expansions.find(canonical);
+    if (it == expansions.end()) {
+        // Expanding may add the expanded forms of the sort arguments, so the result is inserted afterwards
+        SortPtr result = expandUncached(sort);
+        it = expansions.emplace(canonical, result).first;
+    }
+
+    const SortPtr& expanded = it->second;
+    if (!expanded)
+        return SortPtr();
+
+    // Sorts without definitions to expand are returned as they are
+    if (expanded->getCanonical() == canonical)
+        return sort;
+
+    return expanded;
+}
+
+SortPtr& SymbolStack::getInstance(const FunEntryPtr& entry, const std::vector<SortPtr>& argSorts, bool& known) {
+    std::vector<const CanonicalSort*> key;
+    key.reserve(argSorts.size());
+    for (const auto& argSort : argSorts) {
+        key.push_back(argSort->getCanonical());
+    }
+
+    auto inserted = instances[entry.get()].emplace(std::move(key), SortPtr());
+    known = !inserted.second;
+    return inserted.first->second;
+}
+
+SortPtr SymbolStack::expandUncached(const SortPtr& sort) {
     SortEntryPtr entry = getSortEntry(sort->name);
     if (!sort->hasArgs()) {
         if (entry) {
@@ -188,7 +384,7 @@ SortPtr SymbolStack::expand(const SortPtr& sort) {
 
             if (entry->params.size() == sort->arguments.size()) {
                 unordered_map<string, SortPtr> mapping;
-                for (int i = 0; i < entry->params.size(); i++) {
+                for (size_t i = 0; i < entry->params.size(); i++) {
                     mapping[entry->params[i]] = sort->arguments[i];
                 }
 
@@ -224,7 +420,7 @@ SortPtr SymbolStack::expand(const SortPtr& sort) {
 
 bool SymbolStack::equal(const SortPtr& sort1, const SortPtr& sort2) {
     if (sort1 && sort2) {
-        return sort1->toString() == sort2->toString();
+        return sort1->getCanonical() == sort2->getCanonical();
     } else {
         return false;
     }
@@ -313,22 +509,35 @@ bool SymbolStack::equal(const vector<string>& params1,
 
 SortEntryPtr SymbolStack::tryAdd(const SortEntryPtr& entry) {
     SortEntryPtr dup = findDuplicate(entry);
-    if (!dup)
-        getTopLevel()->add(entry);
+    if (!dup) {
+        expansions.clear();
+        if (sorts.getDepth() == 0)
+            global->add(entry);
+        else
+            sorts.add(entry->id, entry);
+    }
     return dup;
 }
 
 FunEntryPtr SymbolStack::tryAdd(const FunEntryPtr& entry) {
     FunEntryPtr dup = findDuplicate(entry);
-    if (!dup)
-        getTopLevel()->add(entry);
+    if (!dup) {
+        if (funs.getDepth() == 0)
+            global->add(entry);
+        else
+            funs.add(entry->id, entry);
+    }
     return dup;
 }
 
 VarEntryPtr SymbolStack::tryAdd(const VarEntryPtr& entry) {
     VarEntryPtr dup = findDuplicate(entry);
-    if (!dup)
-        getTopLevel()->add(entry);
+    if (!dup) {
+        if (vars.getDepth() == 0)
+            global->add(entry);
+        else
+            vars.add(entry->id, entry);
+    }
     return dup;
 }
 
@@ -337,7 +546,9 @@ HeapEntry SymbolStack::tryAdd(const HeapEntry& entry) {
 
     HeapEntry dup = findDuplicate(entryExp);
     if(!dup.first || !dup.second) {
-        getTopLevel()->add(entryExp);
+        if (heapMarks.empty())
+            global->add(entryExp);
+        heap.push_back(entryExp);
     }
     return dup;
 }
@@ -3,14 +3,96 @@
 
 #include "sep_symbol_table.h"
 
+#include "util/layer_cache.h"
+#include "util/scoped_map.h"
+#include "util/sort_table.h"
+#include "util/source_map.h"
+
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace smtlib {
     namespace sep {
+        /** Snapshot of the layers and of the global level of a stack (see SymbolStack::snapshot()) */
+        struct SymbolSnapshot {
+            /** Read-only layers, from the bottom up */
+            std::vector<SymbolTablePtr> layers;
+
+            /** Read-only tables of the global level, from the oldest */
+            std::vector<SymbolTablePtr> sealed;
+        };
+
+        typedef std::shared_ptr<const SymbolSnapshot> SymbolSnapshotPtr;
+
+        /**
+         * Stack of symbol tables, consisting of read-only layers at the bottom, a global level
+         * and the levels pushed on top of it (by binders and push commands).
+         * The entries of the pushed levels are indexed together, in scoped maps whose scopes are
+         * the levels, so that lookups take the same time whatever the depth of the stack, and
+         * pushing or popping a level costs only as much as the entries added in it.
+         * Entries of inner levels shadow those of outer levels, then those of the global level
+         * and of the layers. The global level and the layers are kept as tables, so that the
+         * global level can become a layer, and layers can be shared between stacks.
+         * The entries of the global level can also be sealed into read-only tables, so that a
+         * snapshot of the global level and of the layers can be shared with other stacks,
+         * e.g. to check the commands of a script in parallel (see snapshot()).
+         */
         class SymbolStack {
         private:
-            std::vector<SymbolTablePtr> stack;
+            /** Read-only layers at the bottom of the stack */
+            std::vector<SymbolTablePtr> layers;
+
+            /** Read-only tables of the entries of the global level sealed by snapshots, from the oldest */
+            std::vector<SymbolTablePtr> sealed;
+
+            /** Table of the entries of the global level added since the last snapshot */
+            SymbolTablePtr global;
+
+            /** Snapshot of the layers and of the sealed tables (empty if they changed since it was taken) */
+            SymbolSnapshotPtr current;
+
+            /** Source spans of the nodes of the theories and logics loaded into the stack */
+            std::vector<SourceMapPtr> sourceMaps;
+
+            /**
+             * Seal the entries of the global level added since the last snapshot.
+             * Sealed tables are merged while the previous one is not larger than the last one,
+             * so that there are only logarithmically many of them.
+             */
+            void seal();
+
+            /** Index of the entries of the pushed levels */
+            ScopedMap<SymbolId, SortEntryPtr> sorts;
+            ScopedMap<SymbolId, FunEntryPtr> funs;
+            ScopedMap<SymbolId, VarEntryPtr> vars;
+
+            /**
+             * Expanded forms of sorts, by canonical sort (with an empty sort if a sort cannot be expanded).
+             * Cleared when sort entries are added or removed.
+             */
+            std::unordered_map<const CanonicalSort*, SortPtr> expansions;
+
+            /** Result sorts of parametric functions, by canonical sorts of their arguments */
+            typedef std::unordered_map<std::vector<const CanonicalSort*>, SortPtr, CanonicalSortsHash> InstanceMap;
+
+            /**
+             * Instances of parametric functions, by function entry.
+             * Cleared when function entries are removed, so that their addresses are not reused.
+             */
+            std::unordered_map<const FunEntry*, InstanceMap> instances;
+
+            /** Expand a sort, without looking up or updating the expanded forms */
+            SortPtr expandUncached(const SortPtr& sort);
+
+            /** Heap pairs of all levels, from the bottom up */
+            HeapEntryMap heap;
+
+            /** Number of heap pairs when each pushed level was pushed */
+            std::vector<size_t> heapMarks;
+
+            /** Collect the heap pairs of the layers, of the sealed tables and of the global level */
+            void collectHeap();
 
             bool equal(const SortPtr& sort1, const SortPtr& sort2);
 
@@ -28,9 +110,10 @@ namespace smtlib {
         public:
             SymbolStack();
 
-            SymbolTablePtr getTopLevel();
-
-            std::vector<SymbolTablePtr>& getLevels();
+            /** Get the accepted pairs of location and data sorts, from the bottom up */
+            inline const HeapEntryMap& getHeap() {
+                return heap;
+            }
 
             bool push();
             bool push(size_t levels);
@@ -40,17 +123,81 @@ namespace smtlib {
 
             void reset();
 
+            /**
+             * Mount a read-only layer (e.g. loaded from a theory file) below the global level.
+             * Layers are mounted into stacks without pushed levels.
+             * Entries are never added to or removed from mounted layers,
+             * so the same layer can be shared by several stacks.
+             */
+            void mount(const SymbolTablePtr& layer);
+
+            /**
+             * Turn the global level into a mounted layer, replacing it with an empty level.
+             * \return The new layer
+             */
+            SymbolTablePtr mountTopLevel();
+
+            /** Get the mounted layers, from the bottom up */
+            std::vector<SymbolTablePtr> getLayers();
+
+            /**
+             * Keep the source spans of a loaded theory or logic as long as the stack,
+             * since its entries reference the nodes of the theory or logic (kept through resets)
+             */
+            void keepSourceMap(const SourceMapPtr& sources);
+
+            /** Get the source spans kept by the stack, from the first kept */
+            const std::vector<SourceMapPtr>& getSourceMaps();
+
+            /** Whether the stack has no pushed levels and no entries in the global level */
+            bool isEmpty();
+
+            /** Number of pushed levels */
+            size_t getDepth();
+
+            /**
+             * Take a snapshot of the layers and of the global level, sealing the entries of the global level.
+             * Entries are never added to or removed from the tables of a snapshot, so it can be shared by
+             * several stacks, and it stays the same whatever is later added to the stack.
+             * Consecutive snapshots are the same object while no entries are added to the global level.
+             * Pushed levels are not part of snapshots.
+             */
+            SymbolSnapshotPtr snapshot();
+
+            /**
+             * Replace the layers and the global level with a snapshot (taken from this or another stack),
+             * dropping the pushed levels.
+             * Entries added to the global level afterwards are only added to this stack.
+             */
+            void restore(const SymbolSnapshotPtr& snapshot);
+
             SortEntryPtr getSortEntry(const std::string& name);
             std::vector<FunEntryPtr> getFunEntry(const std::string& name);
             VarEntryPtr getVarEntry(const std::string& name);
 
+            SortEntryPtr getSortEntry(SymbolId id);
+            std::vector<FunEntryPtr> getFunEntry(SymbolId id);
+            VarEntryPtr getVarEntry(SymbolId id);
+
             SortEntryPtr findDuplicate(const SortEntryPtr& entry);
             FunEntryPtr findDuplicate(const FunEntryPtr& entry);
             VarEntryPtr findDuplicate(const VarEntryPtr& entry);
             HeapEntry findDuplicate(const HeapEntry& entry);
 
+            /**
+             * Expand the sort definitions in a sort.
+             * \return The expanded sort, or an empty sort if a definition is applied to the wrong number of arguments
+             */
             SortPtr expand(const SortPtr& sort);
 
+            /**
+             * Get the result sort of a parametric function, instantiated for arguments of the given sorts.
+             * Instances are memoized, so the returned slot only needs to be filled the first time.
+             * \param known    Set to whether the slot was already filled
+             *                  (with an empty sort, if the function does not apply to such arguments)
+             */
+            SortPtr& getInstance(const FunEntryPtr& entry, const std::vector<SortPtr>& argSorts, bool& known);
+
             SortPtr replace(const SortPtr&,
                             std::unordered_map<std::string, SortPtr>& mapping);
 
@@ -61,6 +208,9 @@ namespace smtlib {
         };
 
         typedef std::shared_ptr<SymbolStack> SymbolStackPtr;
+
+        /** Cache of the layers loaded from theory and logic files */
+        typedef LayerCache<SymbolTable> SymbolLayerCache;
     }
 }
 
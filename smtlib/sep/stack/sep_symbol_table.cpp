@@ -7,8 +7,20 @@
 using namespace std;
 using namespace smtlib::sep;
 
-SortEntryPtr SymbolTable::getSortEntry(const string& name) {
-    auto it = sorts.find(name);
+namespace {
+    /** Whether a sort entry comes from a theory file, and is thus kept on reset */
+    inline bool isTheoryEntry(const SortEntryPtr& entry) {
+        return (bool) nodeCast<SortSymbolDeclaration>(entry->source);
+    }
+
+    /** Whether a function entry comes from a theory file, and is thus kept on reset */
+    inline bool isTheoryEntry(const FunEntryPtr& entry) {
+        return (bool) nodeCast<FunSymbolDeclaration>(entry->source);
+    }
+}
+
+SortEntryPtr SymbolTable::getSortEntry(SymbolId id) {
+    auto it = sorts.find(id);
     if (it != sorts.end()) {
         return it->second;
     } else {
@@ -17,8 +29,8 @@ SortEntryPtr SymbolTable::getSortEntry(const string& name) {
     }
 }
 
-std::vector<FunEntryPtr> SymbolTable::getFunEntry(const string& name) {
-    auto it = funs.find(name);
+std::vector<FunEntryPtr> SymbolTable::getFunEntry(SymbolId id) {
+    auto it = funs.find(id);
     if (it != funs.end()) {
         return it->second;
     } else {
@@ -27,8 +39,8 @@ std::vector<FunEntryPtr> SymbolTable::getFunEntry(const string& name) {
     }
 }
 
-VarEntryPtr SymbolTable::getVarEntry(const string& name) {
-    auto it = vars.find(name);
+VarEntryPtr SymbolTable::getVarEntry(SymbolId id) {
+    auto it = vars.find(id);
     if (it != vars.end()) {
         return it->second;
     } else {
@@ -38,8 +50,8 @@ VarEntryPtr SymbolTable::getVarEntry(const string& name) {
 }
 
 bool SymbolTable::add(const SortEntryPtr& entry) {
-    if (sorts.find(entry->name) == sorts.end()) {
-        sorts[entry->name] = entry;
+    if (sorts.find(entry->id) == sorts.end()) {
+        sorts[entry->id] = entry;
         return true;
     } else {
         return false;
@@ -47,13 +59,13 @@ bool SymbolTable::add(const SortEntryPtr& entry) {
 }
 
 bool SymbolTable::add(const FunEntryPtr& entry) {
-    funs[entry->name].push_back(entry);
+    funs[entry->id].push_back(entry);
     return true;
 }
 
 bool SymbolTable::add(const VarEntryPtr& entry) {
-    if (vars.find(entry->name) == vars.end()) {
-        vars[entry->name] = entry;
+    if (vars.find(entry->id) == vars.end()) {
+        vars[entry->id] = entry;
         return true;
     } else {
         return false;
@@ -65,39 +77,63 @@ bool SymbolTable::add(const HeapEntry& heapPair) {
     return true;
 }
 
+void SymbolTable::merge(const SymbolTablePtr& table) {
+    // The entries of the global level are never duplicated, so only overloads need ordering
+    sorts.insert(table->sorts.begin(), table->sorts.end());
+    vars.insert(table->vars.begin(), table->vars.end());
+
+    for (const auto& fun : table->funs) {
+        std::vector<FunEntryPtr>& entries = funs[fun.first];
+        entries.insert(entries.end(), fun.second.begin(), fun.second.end());
+    }
+    heap.insert(heap.end(), table->heap.begin(), table->heap.end());
+}
+
+void SymbolTable::mergeTheoryEntries(const SymbolTablePtr& table) {
+    for (const auto& sort : table->sorts) {
+        if (isTheoryEntry(sort.second))
+            sorts.insert(sort);
+    }
+
+    for (const auto& fun : table->funs) {
+        for (const auto& entry : fun.second) {
+            if (isTheoryEntry(entry))
+                funs[fun.first].push_back(entry);
+        }
+    }
+    heap.insert(heap.end(), table->heap.begin(), table->heap.end());
+}
+
 void SymbolTable::reset() {
     // Clear all variables
     vars.clear();
 
     // Erase sort entries that do not come from theory files
-    std::vector<SortEntryPtr> sortEntries;
-    for (const auto& sort : sorts) {
-        sortEntries.push_back(sort.second);
-    }
-
-    for (const auto& sortEntry : sortEntries) {
-        if (!dynamic_pointer_cast<SortSymbolDeclaration>(sortEntry->source)) {
-            sorts.erase(sortEntry->name);
-        }
+    for (auto it = sorts.begin(); it != sorts.end();) {
+        if (!isTheoryEntry(it->second))
+            it = sorts.erase(it);
+        else
+            it++;
     }
 
     // Erase function entries that do not come from theory files
-    vector<string> funKeys;
-    vector<std::vector<FunEntryPtr>> funEntries;
-    for (const auto& fun : funs) {
-        funKeys.push_back(fun.first);
-        funEntries.push_back(fun.second);
+    for (auto it = funs.begin(); it != funs.end();) {
+        std::vector<FunEntryPtr>& entries = it->second;
+        entries.erase(remove_if(entries.begin(), entries.end(),
+                                [](const FunEntryPtr& entry) { return !isTheoryEntry(entry); }),
+                      entries.end());
+
+        if (entries.empty())
+            it = funs.erase(it);
+        else
+            it++;
     }
+}
 
-    for (size_t i = 0, szi = funKeys.size(); i < szi; i++) {
-        std::vector<FunEntryPtr>& entry = funs[funKeys[i]];
-        for (size_t j = 0, szj = funEntries[i].size(); j < szj; j++) {
-            if (!dynamic_pointer_cast<FunSymbolDeclaration>(funEntries[i][j]->source)) {
-                entry.erase(entry.begin() + j);
-            }
-        }
+bool SymbolTable::isEmpty() {
+    return sorts.empty() && funs.empty() && vars.empty() && heap.empty();
+}
 
-        if (entry.empty())
-            funs.erase(funKeys[i]);
-    }
+size_t SymbolTable::getSize() {
+    return sorts.size() + funs.size() + vars.size() + heap.size();
 }
@@ -30,6 +30,7 @@
 
 #include "util/global_values.h"
 #include "util/logger.h"
+#include "util/stack_guard.h"
 
 #include <sstream>
 
@@ -38,11 +39,20 @@ using namespace smtlib;
 using namespace smtlib::sep;
 
 void Translator::setFileLocation(const sep::NodePtr& output, const ast::NodePtr& source) {
-    output->filename = source->filename;
-    output->rowLeft = source->rowLeft;
-    output->colLeft = source->colLeft;
-    output->rowRight = source->rowRight;
-    output->colRight = source->colRight;
+    output->span = source->span;
+}
+
+void Translator::annotate(sep::Term* output, ast::Term* source) {
+    if (!source->inferredSort)
+        return;
+
+    // Terms share a few sorts, so each is translated once
+    const CanonicalSort* canonical = source->inferredSort->getCanonical();
+    auto it = annotations.find(canonical);
+    if (it == annotations.end())
+        it = annotations.emplace(canonical, translate(source->inferredSort)).first;
+
+    output->inferredSort = it->second;
 }
 
 sep::AttributePtr Translator::translate(const ast::AttributePtr& attr) {
@@ -50,84 +60,93 @@ sep::AttributePtr Translator::translate(const ast::AttributePtr& attr) {
     ast::AttributeValuePtr value = attr->value;
 
     if (value) {
-        ast::SymbolPtr val1 = dynamic_pointer_cast<ast::Symbol>(value);
-        if (val1) {
-            auto result = std::move(make_shared<sep::SymbolAttribute>(keyword, val1->value));
+        switch (value->getKind()) {
+            case ast::NodeKind::SYMBOL: {
+                auto result = makeShared<sep::SymbolAttribute>(arena,
+                        keyword, ast::nodeCast<ast::Symbol>(value)->value);
 
-            setFileLocation(result, attr);
-            return result;
-        }
+                setFileLocation(result, attr);
+                return result;
+            }
 
-        ast::BooleanValuePtr val2 = dynamic_pointer_cast<ast::BooleanValue>(value);
-        if (val2) {
-            auto result = make_shared<sep::BooleanAttribute>(keyword, val2->value);
+            case ast::NodeKind::BOOLEAN_VALUE: {
+                auto result = makeShared<sep::BooleanAttribute>(arena,
+                        keyword, ast::nodeCast<ast::BooleanValue>(value)->value);
 
-            setFileLocation(result, attr);
-            return result;
-        }
+                setFileLocation(result, attr);
+                return result;
+            }
 
-        ast::NumeralLiteralPtr val3 = dynamic_pointer_cast<ast::NumeralLiteral>(value);
-        if (val3) {
-            auto result = make_shared<sep::NumeralAttribute>(keyword, std::move(translate(val3)));
+            case ast::NodeKind::NUMERAL_LITERAL: {
+                auto result = makeShared<sep::NumeralAttribute>(arena,
+                        keyword, std::move(translate(ast::nodeCast<ast::NumeralLiteral>(value))));
 
-            setFileLocation(result, attr);
-            return result;
-        }
+                setFileLocation(result, attr);
+                return result;
+            }
 
-        ast::DecimalLiteralPtr val4 = dynamic_pointer_cast<ast::DecimalLiteral>(value);
-        if (val4) {
-            auto result = make_shared<sep::DecimalAttribute>(keyword, std::move(translate(val4)));
+            case ast::NodeKind::DECIMAL_LITERAL: {
+                auto result = makeShared<sep::DecimalAttribute>(arena,
+                        keyword, std::move(translate(ast::nodeCast<ast::DecimalLiteral>(value))));
 
-            setFileLocation(result, attr);
-            return result;
-        }
+                setFileLocation(result, attr);
+                return result;
+            }
 
-        ast::StringLiteralPtr val5 = dynamic_pointer_cast<ast::StringLiteral>(value);
-        if (val5) {
-            auto result = make_shared<sep::StringAttribute>(keyword, std::move(translate(val5)));
+            case ast::NodeKind::STRING_LITERAL: {
+                auto result = makeShared<sep::StringAttribute>(arena,
+                        keyword, std::move(translate(ast::nodeCast<ast::StringLiteral>(value))));
 
-            setFileLocation(result, attr);
-            return result;
-        }
+                setFileLocation(result, attr);
+                return result;
+            }
 
-        ast::CompAttributeValuePtr val6 = dynamic_pointer_cast<ast::CompAttributeValue>(value);
+            case ast::NodeKind::COMP_ATTRIBUTE_VALUE: {
+                ast::CompAttributeValuePtr val = ast::nodeCast<ast::CompAttributeValue>(value);
 
-        if (val6 && keyword == KW_THEORIES) {
-            auto newTheories = std::move(translateToString<ast::AttributeValue>(val6->values));
-            auto result = make_shared<sep::TheoriesAttribute>(std::move(newTheories));
+                if (keyword == KW_THEORIES) {
+                    auto newTheories = std::move(translateToString<ast::AttributeValue>(val->values));
+                    auto result = makeShared<sep::TheoriesAttribute>(arena, std::move(newTheories));
 
-            setFileLocation(result, attr);
-            return result;
-        }
+                    setFileLocation(result, attr);
+                    return result;
+                }
 
-        if (val6 && keyword == KW_SORTS) {
-            auto newSorts = std::move(translateToSmtCast<ast::AttributeValue,
-                    ast::SortSymbolDeclaration, sep::SortSymbolDeclaration>(val6->values));
-            auto result = make_shared<sep::SortsAttribute>(std::move(newSorts));
+                if (keyword == KW_SORTS) {
+                    auto newSorts = std::move(translateToSmtCast<ast::AttributeValue,
+                            ast::SortSymbolDeclaration, sep::SortSymbolDeclaration>(val->values));
+                    auto result = makeShared<sep::SortsAttribute>(arena, std::move(newSorts));
 
-            setFileLocation(result, attr);
-            return result;
-        }
+                    setFileLocation(result, attr);
+                    return result;
+                }
 
-        if (val6 && keyword == KW_FUNS) {
-            auto newFuns = std::move(translateToSmtCast<ast::AttributeValue,
-                    ast::FunSymbolDeclaration, sep::FunSymbolDeclaration>(val6->values));
-            auto result = make_shared<sep::FunsAttribute>(std::move(newFuns));
+                if (keyword == KW_FUNS) {
+                    auto newFuns = std::move(translateToSmtCast<ast::AttributeValue,
+                            ast::FunSymbolDeclaration, sep::FunSymbolDeclaration>(val->values));
+                    auto result = makeShared<sep::FunsAttribute>(arena, std::move(newFuns));
 
-            setFileLocation(result, attr);
-            return result;
-        }
+                    setFileLocation(result, attr);
+                    return result;
+                }
 
-        ast::SExpressionPtr val7 = dynamic_pointer_cast<ast::SExpression>(value);
-        if (val7) {
-            auto result = make_shared<sep::SExpressionAttribute>(keyword, translate(val7));
+                break;
+            }
+
+            case ast::NodeKind::COMP_SEXPRESSION: {
+                auto result = makeShared<sep::SExpressionAttribute>(arena,
+                        keyword, translate(ast::nodeCast<ast::CompSExpression>(value)));
 
-            setFileLocation(result, attr);
-            return result;
+                setFileLocation(result, attr);
+                return result;
+            }
+
+            default:
+                break;
         }
 
     } else {
-        auto result = make_shared<sep::SimpleAttribute>(attr->keyword->value);
+        auto result = makeShared<sep::SimpleAttribute>(arena, attr->keyword->value);
 
         setFileLocation(result, attr);
         return result;
@@ -137,14 +156,14 @@ sep::AttributePtr Translator::translate(const ast::AttributePtr& attr) {
 }
 
 sep::SymbolPtr Translator::translate(const ast::SymbolPtr& symbol) {
-    auto result = make_shared<sep::Symbol>(symbol->value);
+    auto result = makeShared<sep::Symbol>(arena, symbol->value);
 
     setFileLocation(result, symbol);
     return result;
 }
 
 sep::KeywordPtr Translator::translate(const ast::KeywordPtr& keyword) {
-    auto result = make_shared<sep::Keyword>(keyword->value);
+    auto result = makeShared<sep::Keyword>(arena, keyword->value);
 
     setFileLocation(result, keyword);
     return result;
@@ -155,11 +174,11 @@ sep::MetaSpecConstantPtr Translator::translate(const ast::MetaSpecConstantPtr& c
     sep::MetaSpecConstantPtr result;
 
     if (type == ast::MetaSpecConstant::Type::NUMERAL) {
-        result = make_shared<sep::MetaSpecConstant>(sep::MetaSpecConstant::Type::NUMERAL);
+        result = makeShared<sep::MetaSpecConstant>(arena, sep::MetaSpecConstant::Type::NUMERAL);
     } else if (type == ast::MetaSpecConstant::Type::DECIMAL) {
-        result = make_shared<sep::MetaSpecConstant>(sep::MetaSpecConstant::Type::DECIMAL);
+        result = makeShared<sep::MetaSpecConstant>(arena, sep::MetaSpecConstant::Type::DECIMAL);
     } else {
-        result = make_shared<sep::MetaSpecConstant>(sep::MetaSpecConstant::Type::STRING);
+        result = makeShared<sep::MetaSpecConstant>(arena, sep::MetaSpecConstant::Type::STRING);
     }
 
     setFileLocation(result, constant);
@@ -167,14 +186,14 @@ sep::MetaSpecConstantPtr Translator::translate(const ast::MetaSpecConstantPtr& c
 }
 
 sep::BooleanValuePtr Translator::translate(const ast::BooleanValuePtr& value) {
-    auto result = make_shared<sep::BooleanValue>(value->value);
+    auto result = makeShared<sep::BooleanValue>(arena, value->value);
 
     setFileLocation(result, value);
     return result;
 }
 
 sep::PropLiteralPtr Translator::translate(const ast::PropLiteralPtr& literal) {
-    auto result = make_shared<sep::PropLiteral>(std::move(literal->symbol->toString()), literal->negated);
+    auto result = makeShared<sep::PropLiteral>(arena, std::move(literal->symbol->toString()), literal->negated);
 
     setFileLocation(result, literal);
     return result;
@@ -182,7 +201,7 @@ sep::PropLiteralPtr Translator::translate(const ast::PropLiteralPtr& literal) {
 
 sep::LogicPtr Translator::translate(const ast::LogicPtr& logic) {
     auto newAttrs = std::move(translateToSmt<ast::Attribute, sep::Attribute>(logic->attributes));
-    auto result = make_shared<sep::Logic>(logic->name->value, std::move(newAttrs));
+    auto result = makeShared<sep::Logic>(arena, logic->name->value, std::move(newAttrs));
 
     setFileLocation(result, logic);
     return result;
@@ -190,7 +209,7 @@ sep::LogicPtr Translator::translate(const ast::LogicPtr& logic) {
 
 sep::ScriptPtr Translator::translate(const ast::ScriptPtr& script) {
     auto newCmds = std::move(translateToSmt<ast::Command, sep::Command>(script->commands));
-    auto result = make_shared<sep::Script>(std::move(newCmds));
+    auto result = makeShared<sep::Script>(arena, std::move(newCmds));
 
     setFileLocation(result, script);
     return result;
@@ -198,192 +217,99 @@ sep::ScriptPtr Translator::translate(const ast::ScriptPtr& script) {
 
 sep::TheoryPtr Translator::translate(const ast::TheoryPtr& theory) {
     auto newAttrs = std::move(translateToSmt<ast::Attribute, sep::Attribute>(theory->attributes));
-    auto result = make_shared<sep::Theory>(theory->name->value, std::move(newAttrs));
+    auto result = makeShared<sep::Theory>(arena, theory->name->value, std::move(newAttrs));
 
     setFileLocation(result, theory);
     return result;
 }
 
 sep::CommandPtr Translator::translate(const ast::CommandPtr& cmd) {
-    ast::AssertCommandPtr cmd1 = dynamic_pointer_cast<ast::AssertCommand>(cmd);
-    if (cmd1) {
-        return translate(cmd1);
-    }
-
-    ast::CheckSatCommandPtr cmd2 = dynamic_pointer_cast<ast::CheckSatCommand>(cmd);
-    if (cmd2) {
-        return translate(cmd2);
-    }
-
-    ast::CheckUnsatCommandPtr cmd2b = dynamic_pointer_cast<ast::CheckUnsatCommand>(cmd);
-    if (cmd2b) {
-        return translate(cmd2b);
-    }
-
-    ast::CheckSatAssumCommandPtr cmd3 = dynamic_pointer_cast<ast::CheckSatAssumCommand>(cmd);
-    if (cmd3) {
-        return translate(cmd3);
-    }
-
-    ast::DeclareConstCommandPtr cmd4 = dynamic_pointer_cast<ast::DeclareConstCommand>(cmd);
-    if (cmd4) {
-        return translate(cmd4);
-    }
-
-    ast::DeclareDatatypeCommandPtr cmd5 = dynamic_pointer_cast<ast::DeclareDatatypeCommand>(cmd);
-    if (cmd5) {
-        return translate(cmd5);
-    }
-
-    ast::DeclareDatatypesCommandPtr cmd6 = dynamic_pointer_cast<ast::DeclareDatatypesCommand>(cmd);
-    if (cmd6) {
-        return translate(cmd6);
-    }
-
-    ast::DeclareFunCommandPtr cmd7 = dynamic_pointer_cast<ast::DeclareFunCommand>(cmd);
-    if (cmd7) {
-        return translate(cmd7);
-    }
-
-    ast::DeclareSortCommandPtr cmd8 = dynamic_pointer_cast<ast::DeclareSortCommand>(cmd);
-    if (cmd8) {
-        return translate(cmd8);
-    }
-
-    ast::DeclareHeapCommandPtr cmd8b = dynamic_pointer_cast<ast::DeclareHeapCommand>(cmd);
-    if (cmd8b) {
-        return translate(cmd8b);
-    }
-
-    ast::DefineFunCommandPtr cmd9 = dynamic_pointer_cast<ast::DefineFunCommand>(cmd);
-    if (cmd9) {
-        return translate(cmd9);
-    }
-
-    ast::DefineFunRecCommandPtr cmd10 = dynamic_pointer_cast<ast::DefineFunRecCommand>(cmd);
-    if (cmd10) {
-        return translate(cmd10);
-    }
-
-    ast::DefineFunsRecCommandPtr cmd11 = dynamic_pointer_cast<ast::DefineFunsRecCommand>(cmd);
-    if (cmd11) {
-        return translate(cmd11);
-    }
-
-    ast::DefineSortCommandPtr cmd12 = dynamic_pointer_cast<ast::DefineSortCommand>(cmd);
-    if (cmd12) {
-        return translate(cmd12);
-    }
-
-    ast::EchoCommandPtr cmd13 = dynamic_pointer_cast<ast::EchoCommand>(cmd);
-    if (cmd13) {
-        return translate(cmd13);
-    }
-
-    ast::ExitCommandPtr cmd14 = dynamic_pointer_cast<ast::ExitCommand>(cmd);
-    if (cmd14) {
-        return translate(cmd14);
-    }
-
-    ast::GetAssertsCommandPtr cmd15 = dynamic_pointer_cast<ast::GetAssertsCommand>(cmd);
-    if (cmd15) {
-        return translate(cmd15);
-    }
-
-    ast::GetAssignsCommandPtr cmd16 = dynamic_pointer_cast<ast::GetAssignsCommand>(cmd);
-    if (cmd16) {
-        return translate(cmd16);
-    }
-
-    ast::GetInfoCommandPtr cmd17 = dynamic_pointer_cast<ast::GetInfoCommand>(cmd);
-    if (cmd17) {
-        return translate(cmd17);
-    }
-
-    ast::GetModelCommandPtr cmd18 = dynamic_pointer_cast<ast::GetModelCommand>(cmd);
-    if (cmd18) {
-        return translate(cmd18);
-    }
-
-    ast::GetOptionCommandPtr cmd19 = dynamic_pointer_cast<ast::GetOptionCommand>(cmd);
-    if (cmd19) {
-        return translate(cmd19);
-    }
-
-    ast::GetProofCommandPtr cmd20 = dynamic_pointer_cast<ast::GetProofCommand>(cmd);
-    if (cmd20) {
-        return translate(cmd20);
-    }
-
-    ast::GetUnsatAssumsCommandPtr cmd21 = dynamic_pointer_cast<ast::GetUnsatAssumsCommand>(cmd);
-    if (cmd21) {
-        return translate(cmd21);
-    }
-
-    ast::GetUnsatCoreCommandPtr cmd22 = dynamic_pointer_cast<ast::GetUnsatCoreCommand>(cmd);
-    if (cmd22) {
-        return translate(cmd22);
-    }
-
-    ast::GetValueCommandPtr cmd23 = dynamic_pointer_cast<ast::GetValueCommand>(cmd);
-    if (cmd23) {
-        return translate(cmd23);
-    }
-
-    ast::PopCommandPtr cmd24 = dynamic_pointer_cast<ast::PopCommand>(cmd);
-    if (cmd24) {
-        return translate(cmd24);
-    }
-
-    ast::PushCommandPtr cmd25 = dynamic_pointer_cast<ast::PushCommand>(cmd);
-    if (cmd25) {
-        return translate(cmd25);
-    }
-
-    ast::ResetCommandPtr cmd26 = dynamic_pointer_cast<ast::ResetCommand>(cmd);
-    if (cmd26) {
-        return translate(cmd26);
-    }
-
-    ast::ResetAssertsCommandPtr cmd27 = dynamic_pointer_cast<ast::ResetAssertsCommand>(cmd);
-    if (cmd27) {
-        return translate(cmd27);
-    }
-
-    ast::SetInfoCommandPtr cmd28 = dynamic_pointer_cast<ast::SetInfoCommand>(cmd);
-    if (cmd28) {
-        return translate(cmd28);
+    switch (cmd->getKind()) {
+        case ast::NodeKind::ASSERT_COMMAND:
+            return translate(ast::nodeCast<ast::AssertCommand>(cmd));
+        case ast::NodeKind::CHECK_SAT_COMMAND:
+            return translate(ast::nodeCast<ast::CheckSatCommand>(cmd));
+        case ast::NodeKind::CHECK_UNSAT_COMMAND:
+            return translate(ast::nodeCast<ast::CheckUnsatCommand>(cmd));
+        case ast::NodeKind::CHECK_SAT_ASSUM_COMMAND:
+            return translate(ast::nodeCast<ast::CheckSatAssumCommand>(cmd));
+        case ast::NodeKind::DECLARE_CONST_COMMAND:
+            return translate(ast::nodeCast<ast::DeclareConstCommand>(cmd));
+        case ast::NodeKind::DECLARE_DATATYPE_COMMAND:
+            return translate(ast::nodeCast<ast::DeclareDatatypeCommand>(cmd));
+        case ast::NodeKind::DECLARE_DATATYPES_COMMAND:
+            return translate(ast::nodeCast<ast::DeclareDatatypesCommand>(cmd));
+        case ast::NodeKind::DECLARE_FUN_COMMAND:
+            return translate(ast::nodeCast<ast::DeclareFunCommand>(cmd));
+        case ast::NodeKind::DECLARE_SORT_COMMAND:
+            return translate(ast::nodeCast<ast::DeclareSortCommand>(cmd));
+        case ast::NodeKind::DECLARE_HEAP_COMMAND:
+            return translate(ast::nodeCast<ast::DeclareHeapCommand>(cmd));
+        case ast::NodeKind::DEFINE_FUN_COMMAND:
+            return translate(ast::nodeCast<ast::DefineFunCommand>(cmd));
+        case ast::NodeKind::DEFINE_FUN_REC_COMMAND:
+            return translate(ast::nodeCast<ast::DefineFunRecCommand>(cmd));
+        case ast::NodeKind::DEFINE_FUNS_REC_COMMAND:
+            return translate(ast::nodeCast<ast::DefineFunsRecCommand>(cmd));
+        case ast::NodeKind::DEFINE_SORT_COMMAND:
+            return translate(ast::nodeCast<ast::DefineSortCommand>(cmd));
+        case ast::NodeKind::ECHO_COMMAND:
+            return translate(ast::nodeCast<ast::EchoCommand>(cmd));
+        case ast::NodeKind::EXIT_COMMAND:
+            return translate(ast::nodeCast<ast::ExitCommand>(cmd));
+        case ast::NodeKind::GET_ASSERTS_COMMAND:
+            return translate(ast::nodeCast<ast::GetAssertsCommand>(cmd));
+        case ast::NodeKind::GET_ASSIGNS_COMMAND:
+            return translate(ast::nodeCast<ast::GetAssignsCommand>(cmd));
+        case ast::NodeKind::GET_INFO_COMMAND:
+            return translate(ast::nodeCast<ast::GetInfoCommand>(cmd));
+        case ast::NodeKind::GET_MODEL_COMMAND:
+            return translate(ast::nodeCast<ast::GetModelCommand>(cmd));
+        case ast::NodeKind::GET_OPTION_COMMAND:
+            return translate(ast::nodeCast<ast::GetOptionCommand>(cmd));
+        case ast::NodeKind::GET_PROOF_COMMAND:
+            return translate(ast::nodeCast<ast::GetProofCommand>(cmd));
+        case ast::NodeKind::GET_UNSAT_ASSUMS_COMMAND:
+            return translate(ast::nodeCast<ast::GetUnsatAssumsCommand>(cmd));
+        case ast::NodeKind::GET_UNSAT_CORE_COMMAND:
+            return translate(ast::nodeCast<ast::GetUnsatCoreCommand>(cmd));
+        case ast::NodeKind::GET_VALUE_COMMAND:
+            return translate(ast::nodeCast<ast::GetValueCommand>(cmd));
+        case ast::NodeKind::POP_COMMAND:
+            return translate(ast::nodeCast<ast::PopCommand>(cmd));
+        case ast::NodeKind::PUSH_COMMAND:
+            return translate(ast::nodeCast<ast::PushCommand>(cmd));
+        case ast::NodeKind::RESET_COMMAND:
+            return translate(ast::nodeCast<ast::ResetCommand>(cmd));
+        case ast::NodeKind::RESET_ASSERTS_COMMAND:
+            return translate(ast::nodeCast<ast::ResetAssertsCommand>(cmd));
+        case ast::NodeKind::SET_INFO_COMMAND:
+            return translate(ast::nodeCast<ast::SetInfoCommand>(cmd));
+        case ast::NodeKind::SET_LOGIC_COMMAND:
+            return translate(ast::nodeCast<ast::SetLogicCommand>(cmd));
+        case ast::NodeKind::SET_OPTION_COMMAND:
+            return translate(ast::nodeCast<ast::SetOptionCommand>(cmd));
+        default:
+            return sep::CommandPtr();
     }
-
-    ast::SetLogicCommandPtr cmd29 = dynamic_pointer_cast<ast::SetLogicCommand>(cmd);
-    if (cmd29) {
-        return translate(cmd29);
-    }
-
-    ast::SetOptionCommandPtr cmd30 = dynamic_pointer_cast<ast::SetOptionCommand>(cmd);
-    if (cmd30) {
-        return translate(cmd30);
-    }
-
-    return sep::CommandPtr();
 }
 
 sep::AssertCommandPtr Translator::translate(const ast::AssertCommandPtr& cmd) {
-    auto result = make_shared<sep::AssertCommand>(std::move(translate(cmd->term)));
+    auto result = makeShared<sep::AssertCommand>(arena, std::move(translate(cmd->term)));
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::CheckSatCommandPtr Translator::translate(const ast::CheckSatCommandPtr& cmd) {
-    auto result = make_shared<sep::CheckSatCommand>();
+    auto result = makeShared<sep::CheckSatCommand>(arena);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::CheckUnsatCommandPtr Translator::translate(const ast::CheckUnsatCommandPtr& cmd) {
-    auto result = make_shared<sep::CheckUnsatCommand>();
+    auto result = makeShared<sep::CheckUnsatCommand>(arena);
 
     setFileLocation(result, cmd);
     return result;
@@ -391,14 +317,14 @@ sep::CheckUnsatCommandPtr Translator::translate(const ast::CheckUnsatCommandPtr&
 
 sep::CheckSatAssumCommandPtr Translator::translate(const ast::CheckSatAssumCommandPtr& cmd) {
     auto newAssums = std::move(translateToSmt<ast::PropLiteral, sep::PropLiteral>(cmd->assumptions));
-    auto result = make_shared<sep::CheckSatAssumCommand>(std::move(newAssums));
+    auto result = makeShared<sep::CheckSatAssumCommand>(arena, std::move(newAssums));
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::DeclareConstCommandPtr Translator::translate(const ast::DeclareConstCommandPtr& cmd) {
-    auto result = make_shared<sep::DeclareConstCommand>(cmd->symbol->value,
+    auto result = makeShared<sep::DeclareConstCommand>(arena, cmd->symbol->value,
                                                         std::move(translate(cmd->sort)));
 
     setFileLocation(result, cmd);
@@ -406,7 +332,7 @@ sep::DeclareConstCommandPtr Translator::translate(const ast::DeclareConstCommand
 }
 
 sep::DeclareDatatypeCommandPtr Translator::translate(const ast::DeclareDatatypeCommandPtr& cmd) {
-    auto result = make_shared<sep::DeclareDatatypeCommand>(std::move(cmd->symbol->toString()),
+    auto result = makeShared<sep::DeclareDatatypeCommand>(arena, std::move(cmd->symbol->toString()),
                                                            std::move(translate(cmd->declaration)));
 
     setFileLocation(result, cmd);
@@ -416,7 +342,7 @@ sep::DeclareDatatypeCommandPtr Translator::translate(const ast::DeclareDatatypeC
 sep::DeclareDatatypesCommandPtr Translator::translate(const ast::DeclareDatatypesCommandPtr& cmd) {
     auto newSorts = std::move(translateToSmt<ast::SortDeclaration, sep::SortDeclaration>(cmd->sorts));
     auto newDecls = std::move(translateToSmt<ast::DatatypeDeclaration, sep::DatatypeDeclaration>(cmd->declarations));
-    auto result = make_shared<sep::DeclareDatatypesCommand>(std::move(newSorts), std::move(newDecls));
+    auto result = makeShared<sep::DeclareDatatypesCommand>(arena, std::move(newSorts), std::move(newDecls));
 
     setFileLocation(result, cmd);
     return result;
@@ -424,7 +350,7 @@ sep::DeclareDatatypesCommandPtr Translator::translate(const ast::DeclareDatatype
 
 sep::DeclareFunCommandPtr Translator::translate(const ast::DeclareFunCommandPtr& cmd) {
     auto newParams = std::move(translateToSmt<ast::Sort, sep::Sort>(cmd->parameters));
-    auto result = make_shared<sep::DeclareFunCommand>(cmd->symbol->value,
+    auto result = makeShared<sep::DeclareFunCommand>(arena, cmd->symbol->value,
                                                       std::move(newParams),
                                                       std::move(translate(cmd->sort)));
 
@@ -433,14 +359,14 @@ sep::DeclareFunCommandPtr Translator::translate(const ast::DeclareFunCommandPtr&
 }
 
 sep::DeclareSortCommandPtr Translator::translate(const ast::DeclareSortCommandPtr& cmd) {
-    auto result = make_shared<sep::DeclareSortCommand>(cmd->symbol->value, cmd->arity->value);
+    auto result = makeShared<sep::DeclareSortCommand>(arena, cmd->symbol->value, cmd->arity->value);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::DeclareHeapCommandPtr Translator::translate(const ast::DeclareHeapCommandPtr& cmd) {
-    auto result = make_shared<sep::DeclareHeapCommand>(
+    auto result = makeShared<sep::DeclareHeapCommand>(arena,
             std::move(translateToSmt<ast::Sort, ast::Sort, sep::Sort, sep::Sort>(cmd->locDataPairs)));
 
     setFileLocation(result, cmd);
@@ -448,14 +374,14 @@ sep::DeclareHeapCommandPtr Translator::translate(const ast::DeclareHeapCommandPt
 }
 
 sep::DefineFunCommandPtr Translator::translate(const ast::DefineFunCommandPtr& cmd) {
-    auto result = make_shared<sep::DefineFunCommand>(std::move(translate(cmd->definition)));
+    auto result = makeShared<sep::DefineFunCommand>(arena, std::move(translate(cmd->definition)));
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::DefineFunRecCommandPtr Translator::translate(const ast::DefineFunRecCommandPtr& cmd) {
-    auto result = make_shared<sep::DefineFunRecCommand>(std::move(translate(cmd->definition)));
+    auto result = makeShared<sep::DefineFunRecCommand>(arena, std::move(translate(cmd->definition)));
     setFileLocation(result, cmd);
     return result;
 }
@@ -463,7 +389,7 @@ sep::DefineFunRecCommandPtr Translator::translate(const ast::DefineFunRecCommand
 sep::DefineFunsRecCommandPtr Translator::translate(const ast::DefineFunsRecCommandPtr& cmd) {
     auto newDecls = std::move(translateToSmt<ast::FunctionDeclaration, sep::FunctionDeclaration>(cmd->declarations));
     auto newBodies = std::move(translateToSmt<ast::Term, sep::Term>(cmd->bodies));
-    auto result = make_shared<sep::DefineFunsRecCommand>(std::move(newDecls), std::move(newBodies));
+    auto result = makeShared<sep::DefineFunsRecCommand>(arena, std::move(newDecls), std::move(newBodies));
 
     setFileLocation(result, cmd);
     return result;
@@ -475,7 +401,7 @@ sep::DefineSortCommandPtr Translator::translate(const ast::DefineSortCommandPtr&
         newParams.push_back(param->value);
     }
 
-    auto result = make_shared<sep::DefineSortCommand>(cmd->symbol->value,
+    auto result = makeShared<sep::DefineSortCommand>(arena, cmd->symbol->value,
                                                       std::move(newParams),
                                                       std::move(translate(cmd->sort)));
 
@@ -484,70 +410,70 @@ sep::DefineSortCommandPtr Translator::translate(const ast::DefineSortCommandPtr&
 }
 
 sep::EchoCommandPtr Translator::translate(const ast::EchoCommandPtr& cmd) {
-    auto result = make_shared<sep::EchoCommand>(cmd->message);
+    auto result = makeShared<sep::EchoCommand>(arena, cmd->message);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::ExitCommandPtr Translator::translate(const ast::ExitCommandPtr& cmd) {
-    auto result = make_shared<sep::ExitCommand>();
+    auto result = makeShared<sep::ExitCommand>(arena);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::GetAssertsCommandPtr Translator::translate(const ast::GetAssertsCommandPtr& cmd) {
-    auto result = make_shared<sep::GetAssertsCommand>();
+    auto result = makeShared<sep::GetAssertsCommand>(arena);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::GetAssignsCommandPtr Translator::translate(const ast::GetAssignsCommandPtr& cmd) {
-    auto result = make_shared<sep::GetAssignsCommand>();
+    auto result = makeShared<sep::GetAssignsCommand>(arena);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::GetInfoCommandPtr Translator::translate(const ast::GetInfoCommandPtr& cmd) {
-    auto result = make_shared<sep::GetInfoCommand>(cmd->flag->value);
+    auto result = makeShared<sep::GetInfoCommand>(arena, cmd->flag->value);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::GetModelCommandPtr Translator::translate(const ast::GetModelCommandPtr& cmd) {
-    auto result = make_shared<sep::GetModelCommand>();
+    auto result = makeShared<sep::GetModelCommand>(arena);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::GetOptionCommandPtr Translator::translate(const ast::GetOptionCommandPtr& cmd) {
-    auto result = make_shared<sep::GetOptionCommand>(cmd->option->value);
+    auto result = makeShared<sep::GetOptionCommand>(arena, cmd->option->value);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::GetProofCommandPtr Translator::translate(const ast::GetProofCommandPtr& cmd) {
-    auto result = make_shared<sep::GetProofCommand>();
+    auto result = makeShared<sep::GetProofCommand>(arena);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::GetUnsatAssumsCommandPtr Translator::translate(const ast::GetUnsatAssumsCommandPtr& cmd) {
-    auto result = make_shared<sep::GetUnsatAssumsCommand>();
+    auto result = makeShared<sep::GetUnsatAssumsCommand>(arena);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::GetUnsatCoreCommandPtr Translator::translate(const ast::GetUnsatCoreCommandPtr& cmd) {
-    auto result = make_shared<sep::GetUnsatCoreCommand>();
+    auto result = makeShared<sep::GetUnsatCoreCommand>(arena);
 
     setFileLocation(result, cmd);
     return result;
@@ -555,329 +481,326 @@ sep::GetUnsatCoreCommandPtr Translator::translate(const ast::GetUnsatCoreCommand
 
 sep::GetValueCommandPtr Translator::translate(const ast::GetValueCommandPtr& cmd) {
     auto newTerms = std::move(translateToSmt<ast::Term, sep::Term>(cmd->terms));
-    auto result = make_shared<sep::GetValueCommand>(std::move(newTerms));
+    auto result = makeShared<sep::GetValueCommand>(arena, std::move(newTerms));
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::PopCommandPtr Translator::translate(const ast::PopCommandPtr& cmd) {
-    auto result = make_shared<sep::PopCommand>(cmd->numeral->value);
+    auto result = makeShared<sep::PopCommand>(arena, cmd->numeral->value);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::PushCommandPtr Translator::translate(const ast::PushCommandPtr& cmd) {
-    auto result = make_shared<sep::PushCommand>(cmd->numeral->value);
+    auto result = makeShared<sep::PushCommand>(arena, cmd->numeral->value);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::ResetCommandPtr Translator::translate(const ast::ResetCommandPtr& cmd) {
-    auto result = make_shared<sep::ResetCommand>();
+    auto result = makeShared<sep::ResetCommand>(arena);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::ResetAssertsCommandPtr Translator::translate(const ast::ResetAssertsCommandPtr& cmd) {
-    auto result = make_shared<sep::ResetAssertsCommand>();
+    auto result = makeShared<sep::ResetAssertsCommand>(arena);
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::SetInfoCommandPtr Translator::translate(const ast::SetInfoCommandPtr& cmd) {
-    auto result = make_shared<sep::SetInfoCommand>(std::move(translate(cmd->info)));
+    auto result = makeShared<sep::SetInfoCommand>(arena, std::move(translate(cmd->info)));
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::SetLogicCommandPtr Translator::translate(const ast::SetLogicCommandPtr& cmd) {
-    auto result = make_shared<sep::SetLogicCommand>(std::move(cmd->logic->toString()));
+    auto result = makeShared<sep::SetLogicCommand>(arena, std::move(cmd->logic->toString()));
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::SetOptionCommandPtr Translator::translate(const ast::SetOptionCommandPtr& cmd) {
-    auto result = make_shared<sep::SetOptionCommand>(std::move(translate(cmd->option)));
+    auto result = makeShared<sep::SetOptionCommand>(arena, std::move(translate(cmd->option)));
 
     setFileLocation(result, cmd);
     return result;
 }
 
 sep::TermPtr Translator::translate(const ast::TermPtr& term) {
-    ast::SimpleIdentifierPtr term1 = dynamic_pointer_cast<ast::SimpleIdentifier>(term);
-    if (term1) {
-        string symbol = std::move(term1->symbol->toString());
-
-        if (symbol == "true") {
-            auto result = make_shared<sep::TrueTerm>();
-            setFileLocation(result, term);
-            return result;
-        } else if (symbol == "false") {
-            auto result = make_shared<sep::FalseTerm>();
-            setFileLocation(result, term);
-            return result;
-        } else if (symbol == "emp") {
-            ast::SortPtr locPtr;
-            ast::SortPtr dataPtr;
+    // Continue deeply nested translations on a new stack segment
+    if (StackGuard::isLow())
+        return StackGuard::callOnNewSegment<sep::TermPtr>([&] { return translate(term); });
 
-            if (term1->indices.size() == 2) {
-                locPtr = dynamic_pointer_cast<ast::Sort>(term1->indices[0]);
-                ast::SymbolPtr locSymbol = dynamic_pointer_cast<ast::Symbol>(term1->indices[0]);
+    switch (term->getKind()) {
+        case ast::NodeKind::SIMPLE_IDENTIFIER: {
+            ast::SimpleIdentifierPtr term1 = ast::nodeCast<ast::SimpleIdentifier>(term);
+            string symbol = std::move(term1->symbol->toString());
 
-                if (!locPtr && locSymbol) {
-                    locPtr = make_shared<ast::Sort>(make_shared<ast::SimpleIdentifier>(locSymbol));
+            if (symbol == "true") {
+                auto result = makeShared<sep::TrueTerm>(arena);
+                setFileLocation(result, term);
+                return share(result, term);
+            } else if (symbol == "false") {
+                auto result = makeShared<sep::FalseTerm>(arena);
+                setFileLocation(result, term);
+                return share(result, term);
+            } else if (symbol == "emp") {
+                ast::SortPtr locPtr;
+                ast::SortPtr dataPtr;
+
+                if (term1->indices.size() == 2) {
+                    locPtr = ast::nodeCast<ast::Sort>(term1->indices[0]);
+                    ast::SymbolPtr locSymbol = ast::nodeCast<ast::Symbol>(term1->indices[0]);
+
+                    if (!locPtr && locSymbol) {
+                        locPtr = make_shared<ast::Sort>(make_shared<ast::SimpleIdentifier>(locSymbol));
+                    }
+
+                    dataPtr = ast::nodeCast<ast::Sort>(term1->indices[1]);
+                    ast::SymbolPtr dataSymbol = ast::nodeCast<ast::Symbol>(term1->indices[1]);
+
+                    if (!dataPtr && dataSymbol) {
+                        dataPtr = make_shared<ast::Sort>(make_shared<ast::SimpleIdentifier>(dataSymbol));
+                    }
+
+                    if (locPtr && dataPtr) {
+                        auto result = makeShared<sep::EmpTerm>(arena, std::move(translate(locPtr)),
+                                                                std::move(translate(dataPtr)));
+                        setFileLocation(result, term);
+                        return share(result, term);
+                    }
+                } else {
+                    stringstream ss;
+                    ss << term1->toString() << " (at " << term1->getRowLeft() << ":" << term1->getColLeft()
+                       << " - " << term1->getRowRight() << ":" << term1->getColRight() << ")";
+
+                    if (term1->indices.empty()) {
+                        ss << " has no indices specifying location and data sorts";
+                    } else if (term1->indices.size() == 1) {
+                        ss << " has only one index (discarded upon translation)";
+                    } else if (term1->indices.size() > 2) {
+                        ss << " has too many indices (all discarded upon translation)";
+                    }
+
+                    Logger::error("smtlib::sep::Translator::translate()", ss.str().c_str());
                 }
 
-                dataPtr = dynamic_pointer_cast<ast::Sort>(term1->indices[1]);
-                ast::SymbolPtr dataSymbol = dynamic_pointer_cast<ast::Symbol>(term1->indices[1]);
+                auto result = makeShared<sep::EmpTerm>(arena, sep::SortPtr(), sep::SortPtr());
 
-                if (!dataPtr && dataSymbol) {
-                    dataPtr = make_shared<ast::Sort>(make_shared<ast::SimpleIdentifier>(dataSymbol));
-                }
+                setFileLocation(result, term);
+                return share(result, term);
+            } else if (symbol == "nil") {
+                auto result = makeShared<sep::NilTerm>(arena);
+                setFileLocation(result, term);
+                return share(result, term);
+            } else
+                return translate(term1);
+        }
 
-                if (locPtr && dataPtr) {
-                    auto result = make_shared<sep::EmpTerm>(std::move(translate(locPtr)),
-                                                            std::move(translate(dataPtr)));
-                    setFileLocation(result, term);
-                    return result;
-                }
+        case ast::NodeKind::QUALIFIED_IDENTIFIER: {
+            ast::QualifiedIdentifierPtr term2 = ast::nodeCast<ast::QualifiedIdentifier>(term);
+            if (term2->identifier->toString() == "nil") {
+                auto result = makeShared<sep::NilTerm>(arena, std::move(translate(term2->sort)));
+                setFileLocation(result, term);
+                return share(result, term);
             } else {
-                stringstream ss;
-                ss << term1->toString() << " (at " << term1->rowLeft << ":" << term1->colLeft
-                   << " - " << term1->rowRight << ":" << term1->colRight << ")";
-
-                if (term1->indices.empty()) {
-                    ss << " has no indices specifying location and data sorts";
-                } else if (term1->indices.size() == 1) {
-                    ss << " has only one index (discarded upon translation)";
-                } else if (term1->indices.size() > 2) {
-                    ss << " has too many indices (all discarded upon translation)";
-                }
-
-                Logger::error("smtlib::sep::Translator::translate()", ss.str().c_str());
+                return translate(term2);
             }
+        }
 
-            auto result = make_shared<sep::EmpTerm>(sep::SortPtr(), sep::SortPtr());
-
-            setFileLocation(result, term);
-            return result;
-        } else if (symbol == "nil") {
-            auto result = make_shared<sep::NilTerm>();
+        case ast::NodeKind::NUMERAL_LITERAL: {
+            ast::NumeralLiteralPtr term3 = ast::nodeCast<ast::NumeralLiteral>(term);
+            auto result = makeShared<sep::NumeralLiteral>(arena, term3->value, term3->base);
             setFileLocation(result, term);
-            return result;
-        } else
-            return translate(term1);
-    }
+            return share(result, term);
+        }
 
-    ast::QualifiedIdentifierPtr term2 = dynamic_pointer_cast<ast::QualifiedIdentifier>(term);
-    if (term2) {
-        if (term2->identifier->toString() == "nil") {
-            auto result = make_shared<sep::NilTerm>(std::move(translate(term2->sort)));
+        case ast::NodeKind::DECIMAL_LITERAL: {
+            ast::DecimalLiteralPtr term4 = ast::nodeCast<ast::DecimalLiteral>(term);
+            auto result = makeShared<sep::DecimalLiteral>(arena, term4->value);
             setFileLocation(result, term);
-            return result;
-        } else {
-            return translate(term2);
+            return share(result, term);
         }
-    }
 
-    ast::NumeralLiteralPtr term3 = dynamic_pointer_cast<ast::NumeralLiteral>(term);
-    if (term3) {
-        auto result = make_shared<sep::NumeralLiteral>(term3->value, term3->base);
-        setFileLocation(result, term);
-        return result;
-    }
+        case ast::NodeKind::STRING_LITERAL: {
+            ast::StringLiteralPtr term5 = ast::nodeCast<ast::StringLiteral>(term);
+            auto result = makeShared<sep::StringLiteral>(arena, term5->value);
+            setFileLocation(result, term);
+            return share(result, term);
+        }
 
-    ast::DecimalLiteralPtr term4 = dynamic_pointer_cast<ast::DecimalLiteral>(term);
-    if (term4) {
-        auto result = make_shared<sep::DecimalLiteral>(term4->value);
-        setFileLocation(result, term);
-        return result;
-    }
+        case ast::NodeKind::QUALIFIED_TERM: {
+            ast::QualifiedTermPtr term6 = ast::nodeCast<ast::QualifiedTerm>(term);
+            string identifier = std::move(term6->identifier->toString());
+            if (identifier == "not") {
+                if (term6->terms.size() == 1) {
+                    auto result = makeShared<sep::NotTerm>(arena, translate(term6->terms[0]));
+                    setFileLocation(result, term);
+                    return share(result, term);
+                }
+            } else if (identifier == "=>" || identifier == "and"
+                       || identifier == "or" || identifier == "xor"
+                       || identifier == "=" || identifier == "distinct"
+                       || identifier == "sep" || identifier == "wand") {
+
+                std::vector<sep::TermPtr> newTerms;
+                for (const auto& t : term6->terms) {
+                    newTerms.push_back(std::move(translate(t)));
+                }
 
-    ast::StringLiteralPtr term5 = dynamic_pointer_cast<ast::StringLiteral>(term);
-    if (term5) {
-        auto result = make_shared<sep::StringLiteral>(term5->value);
-        setFileLocation(result, term);
-        return result;
-    }
+                if (identifier == "=>") {
+                    auto result = makeShared<sep::ImpliesTerm>(arena, std::move(newTerms));
+                    setFileLocation(result, term);
+                    return share(result, term);
+                } else if (identifier == "and") {
+                    auto result = makeShared<sep::AndTerm>(arena, std::move(newTerms));
+                    setFileLocation(result, term);
+                    return share(result, term);
+                } else if (identifier == "or") {
+                    auto result = makeShared<sep::OrTerm>(arena, std::move(newTerms));
+                    setFileLocation(result, term);
+                    return share(result, term);
+                } else if (identifier == "xor") {
+                    auto result = makeShared<sep::XorTerm>(arena, std::move(newTerms));
+                    setFileLocation(result, term);
+                    return share(result, term);
+                } else if (identifier == "=") {
+                    auto result = makeShared<sep::EqualsTerm>(arena, std::move(newTerms));
+                    setFileLocation(result, term);
+                    return share(result, term);
+                } else if (identifier == "distinct") {
+                    auto result = makeShared<sep::DistinctTerm>(arena, std::move(newTerms));
+                    setFileLocation(result, term);
+                    return share(result, term);
+                } else if (identifier == "sep") {
+                    auto result = makeShared<sep::SepTerm>(arena, std::move(newTerms));
+                    setFileLocation(result, term);
+                    return share(result, term);
+                } else if (identifier == "wand") {
+                    auto result = makeShared<sep::WandTerm>(arena, std::move(newTerms));
+                    setFileLocation(result, term);
+                    return share(result, term);
+                }
+            } else if (identifier == "ite") {
+                if (term6->terms.size() == 3) {
+                    auto result = makeShared<sep::IteTerm>(arena, std::move(translate(term6->terms[0])),
+                                                            std::move(translate(term6->terms[1])),
+                                                            std::move(translate(term6->terms[2])));
+                    setFileLocation(result, term);
+                    return share(result, term);
+                }
+            } else if (identifier == "pto") {
+                if (term6->terms.size() == 2) {
+                    auto result = makeShared<sep::PtoTerm>(arena, std::move(translate(term6->terms[0])),
+                                                            std::move(translate(term6->terms[1])));
+                    setFileLocation(result, term);
+                    return share(result, term);
+                }
+            } else {
+                std::vector<sep::TermPtr> newTerms;
+                for (const auto& t : term6->terms) {
+                    newTerms.push_back(std::move(translate(t)));
+                }
 
-    ast::QualifiedTermPtr term6 = dynamic_pointer_cast<ast::QualifiedTerm>(term);
-    if (term6) {
-        string identifier = std::move(term6->identifier->toString());
-        if (identifier == "not") {
-            if (term6->terms.size() == 1) {
-                auto result = make_shared<sep::NotTerm>(translate(term6->terms[0]));
+                auto result = makeShared<sep::QualifiedTerm>(arena, std::move(translate(term6->identifier)),
+                                                              std::move(newTerms));
                 setFileLocation(result, term);
-                return result;
-            }
-        } else if (identifier == "=>" || identifier == "and"
-                   || identifier == "or" || identifier == "xor"
-                   || identifier == "=" || identifier == "distinct"
-                   || identifier == "sep" || identifier == "wand") {
-
-            std::vector<sep::TermPtr> newTerms;
-            for (const auto& t : term6->terms) {
-                newTerms.push_back(std::move(translate(t)));
+                return share(result, term);
             }
 
-            if (identifier == "=>") {
-                auto result = make_shared<sep::ImpliesTerm>(std::move(newTerms));
-                setFileLocation(result, term);
-                return result;
-            } else if (identifier == "and") {
-                auto result = make_shared<sep::AndTerm>(std::move(newTerms));
-                setFileLocation(result, term);
-                return result;
-            } else if (identifier == "or") {
-                auto result = make_shared<sep::OrTerm>(std::move(newTerms));
-                setFileLocation(result, term);
-                return result;
-            } else if (identifier == "xor") {
-                auto result = make_shared<sep::XorTerm>(std::move(newTerms));
-                setFileLocation(result, term);
-                return result;
-            } else if (identifier == "=") {
-                auto result = make_shared<sep::EqualsTerm>(std::move(newTerms));
-                setFileLocation(result, term);
-                return result;
-            } else if (identifier == "distinct") {
-                auto result = make_shared<sep::DistinctTerm>(std::move(newTerms));
-                setFileLocation(result, term);
-                return result;
-            } else if (identifier == "sep") {
-                auto result = make_shared<sep::SepTerm>(std::move(newTerms));
-                setFileLocation(result, term);
-                return result;
-            } else if (identifier == "wand") {
-                auto result = make_shared<sep::WandTerm>(std::move(newTerms));
-                setFileLocation(result, term);
-                return result;
-            }
-        } else if (identifier == "ite") {
-            if (term6->terms.size() == 3) {
-                auto result = make_shared<sep::IteTerm>(std::move(translate(term6->terms[0])),
-                                                        std::move(translate(term6->terms[1])),
-                                                        std::move(translate(term6->terms[2])));
-                setFileLocation(result, term);
-                return result;
-            }
-        } else if (identifier == "pto") {
-            if (term6->terms.size() == 2) {
-                auto result = make_shared<sep::PtoTerm>(std::move(translate(term6->terms[0])),
-                                                        std::move(translate(term6->terms[1])));
-                setFileLocation(result, term);
-                return result;
-            }
-        } else {
-            std::vector<sep::TermPtr> newTerms;
-            for (const auto& t : term6->terms) {
-                newTerms.push_back(std::move(translate(t)));
-            }
-
-            auto result = make_shared<sep::QualifiedTerm>(std::move(translate(term6->identifier)),
-                                                          std::move(newTerms));
-            setFileLocation(result, term);
-            return result;
+            break;
         }
-    }
 
-    ast::LetTermPtr term7 = dynamic_pointer_cast<ast::LetTerm>(term);
-    if (term7) {
-        return translate(term7);
-    }
+        case ast::NodeKind::LET_TERM:
+            return translate(ast::nodeCast<ast::LetTerm>(term));
 
-    ast::ForallTermPtr term8 = dynamic_pointer_cast<ast::ForallTerm>(term);
-    if (term8) {
-        return translate(term8);
-    }
+        case ast::NodeKind::FORALL_TERM:
+            return translate(ast::nodeCast<ast::ForallTerm>(term));
+
+        case ast::NodeKind::EXISTS_TERM: {
+            ast::ExistsTermPtr term9 = ast::nodeCast<ast::ExistsTerm>(term);
+            std::vector<sep::SortedVariablePtr> newBindings;
+            for (const auto& bind : term9->bindings) {
+                newBindings.push_back(std::move(translate(bind)));
+            }
 
-    ast::ExistsTermPtr term9 = dynamic_pointer_cast<ast::ExistsTerm>(term);
-    if (term9) {
-        std::vector<sep::SortedVariablePtr> newBindings;
-        for (const auto& bind : term9->bindings) {
-            newBindings.push_back(std::move(translate(bind)));
+            auto result = makeShared<sep::ExistsTerm>(arena, std::move(newBindings),
+                                                       std::move(translate(term9->term)));
+            setFileLocation(result, term);
+            return share(result, term);
         }
 
-        auto result = make_shared<sep::ExistsTerm>(std::move(newBindings),
-                                                   std::move(translate(term9->term)));
-        setFileLocation(result, term);
-        return result;
-    }
+        case ast::NodeKind::MATCH_TERM:
+            return translate(ast::nodeCast<ast::MatchTerm>(term));
 
-    ast::MatchTermPtr term10 = dynamic_pointer_cast<ast::MatchTerm>(term);
-    if (term10) {
-        return translate(term10);
-    }
+        case ast::NodeKind::ANNOTATED_TERM:
+            return translate(ast::nodeCast<ast::AnnotatedTerm>(term));
 
-    ast::AnnotatedTermPtr term11 = dynamic_pointer_cast<ast::AnnotatedTerm>(term);
-    if (term11) {
-        return translate(term11);
+        default:
+            break;
     }
 
     return sep::TermPtr();
 }
 
 sep::IndexPtr Translator::translate(const ast::IndexPtr& index) {
-    ast::SymbolPtr index1 = dynamic_pointer_cast<ast::Symbol>(index);
-    if (index1) {
-        return translate(index1);
-    }
-
-    ast::NumeralLiteralPtr index2 = dynamic_pointer_cast<ast::NumeralLiteral>(index);
-    if (index2) {
-        return translate(index2);
+    switch (index->getKind()) {
+        case ast::NodeKind::SYMBOL:
+            return translate(ast::nodeCast<ast::Symbol>(index));
+        case ast::NodeKind::NUMERAL_LITERAL:
+            return translate(ast::nodeCast<ast::NumeralLiteral>(index));
+        default:
+            return sep::IndexPtr();
     }
-
-    return sep::IndexPtr();
 }
 
 sep::IdentifierPtr Translator::translate(const ast::IdentifierPtr& id) {
-    ast::SimpleIdentifierPtr id1 = dynamic_pointer_cast<ast::SimpleIdentifier>(id);
-    if (id1) {
-        return translate(id1);
-    }
-
-    ast::QualifiedIdentifierPtr id2 = dynamic_pointer_cast<ast::QualifiedIdentifier>(id);
-    if (id2) {
-        return translate(id2);
+    switch (id->getKind()) {
+        case ast::NodeKind::SIMPLE_IDENTIFIER:
+            return translate(ast::nodeCast<ast::SimpleIdentifier>(id));
+        case ast::NodeKind::QUALIFIED_IDENTIFIER:
+            return translate(ast::nodeCast<ast::QualifiedIdentifier>(id));
+        default:
+            return sep::IdentifierPtr();
     }
-
-    return sep::IdentifierPtr();
 }
 
 sep::SimpleIdentifierPtr Translator::translate(const ast::SimpleIdentifierPtr& id) {
     auto newIndices = std::move(translateToSmt<ast::Index, sep::Index>(id->indices));
-    auto result = make_shared<sep::SimpleIdentifier>(id->symbol->value, std::move(newIndices));
+    auto result = makeShared<sep::SimpleIdentifier>(arena, id->symbol->value, std::move(newIndices));
 
     setFileLocation(result, id);
-    return result;
+    return share(result, id);
 }
 
 sep::QualifiedIdentifierPtr Translator::translate(const ast::QualifiedIdentifierPtr& id) {
-    auto result = make_shared<sep::QualifiedIdentifier>(std::move(translate(id->identifier)),
+    auto result = makeShared<sep::QualifiedIdentifier>(arena, std::move(translate(id->identifier)),
                                                         std::move(translate(id->sort)));
 
     setFileLocation(result, id);
-    return result;
+    return share(result, id);
 }
 
 sep::SortPtr Translator::translate(const ast::SortPtr& sort) {
     auto newArgs = std::move(translateToSmt<ast::Sort, sep::Sort>(sort->arguments));
-    auto result = make_shared<sep::Sort>(std::move(sort->identifier->toString()), std::move(newArgs));
+    auto result = makeShared<sep::Sort>(arena, std::move(sort->identifier->toString()), std::move(newArgs));
 
     setFileLocation(result, sort);
     return result;
 }
 
 sep::SortedVariablePtr Translator::translate(const ast::SortedVariablePtr& var) {
-    auto result = make_shared<sep::SortedVariable>(var->symbol->value,
+    auto result = makeShared<sep::SortedVariable>(arena, var->symbol->value,
                                                    std::move(translate(var->sort)));
 
     setFileLocation(result, var);
@@ -885,7 +808,7 @@ sep::SortedVariablePtr Translator::translate(const ast::SortedVariablePtr& var)
 }
 
 sep::VariableBindingPtr Translator::translate(const ast::VariableBindingPtr& binding) {
-    auto result = make_shared<sep::VariableBinding>(binding->symbol->value,
+    auto result = makeShared<sep::VariableBinding>(arena, binding->symbol->value,
                                                     std::move(translate(binding->term)));
 
     setFileLocation(result, binding);
@@ -893,7 +816,7 @@ sep::VariableBindingPtr Translator::translate(const ast::VariableBindingPtr& bin
 }
 
 sep::FunctionDefinitionPtr Translator::translate(const ast::FunctionDefinitionPtr& def) {
-    auto result = make_shared<sep::FunctionDefinition>(std::move(translate(def->signature)),
+    auto result = makeShared<sep::FunctionDefinition>(arena, std::move(translate(def->signature)),
                                                        std::move(translate(def->body)));
 
     setFileLocation(result, def);
@@ -902,7 +825,7 @@ sep::FunctionDefinitionPtr Translator::translate(const ast::FunctionDefinitionPt
 
 sep::FunctionDeclarationPtr Translator::translate(const ast::FunctionDeclarationPtr& decl) {
     auto newParams = translateToSmt<ast::SortedVariable, sep::SortedVariable>(decl->parameters);
-    auto result = make_shared<sep::FunctionDeclaration>(decl->symbol->value,
+    auto result = makeShared<sep::FunctionDeclaration>(arena, decl->symbol->value,
                                                         std::move(newParams),
                                                         std::move(translate(decl->sort)));
 
@@ -911,84 +834,75 @@ sep::FunctionDeclarationPtr Translator::translate(const ast::FunctionDeclaration
 }
 
 sep::SpecConstantPtr Translator::translate(const ast::SpecConstantPtr& constant) {
-    ast::NumeralLiteralPtr const1 = dynamic_pointer_cast<ast::NumeralLiteral>(constant);
-    if (const1) {
-        return translate(const1);
-    }
-
-    ast::DecimalLiteralPtr const2 = dynamic_pointer_cast<ast::DecimalLiteral>(constant);
-    if (const2) {
-        return translate(const2);
-    }
-
-    ast::StringLiteralPtr const3 = dynamic_pointer_cast<ast::StringLiteral>(constant);
-    if (const3) {
-        return translate(const3);
+    switch (constant->getKind()) {
+        case ast::NodeKind::NUMERAL_LITERAL:
+            return translate(ast::nodeCast<ast::NumeralLiteral>(constant));
+        case ast::NodeKind::DECIMAL_LITERAL:
+            return translate(ast::nodeCast<ast::DecimalLiteral>(constant));
+        case ast::NodeKind::STRING_LITERAL:
+            return translate(ast::nodeCast<ast::StringLiteral>(constant));
+        default:
+            return sep::SpecConstantPtr();
     }
-    return sep::SpecConstantPtr();
 }
 
 sep::DecimalLiteralPtr Translator::translate(const ast::DecimalLiteralPtr& literal) {
-    auto result = make_shared<sep::DecimalLiteral>(literal->value);
+    auto result = makeShared<sep::DecimalLiteral>(arena, literal->value);
 
     setFileLocation(result, literal);
-    return result;
+    return share(result, literal);
 }
 
 sep::NumeralLiteralPtr Translator::translate(const ast::NumeralLiteralPtr& literal) {
-    auto result = make_shared<sep::NumeralLiteral>(literal->value, literal->base);
+    auto result = makeShared<sep::NumeralLiteral>(arena, literal->value, literal->base);
 
     setFileLocation(result, literal);
-    return result;
+    return share(result, literal);
 }
 
 sep::StringLiteralPtr Translator::translate(const ast::StringLiteralPtr& literal) {
-    auto result = make_shared<sep::StringLiteral>(literal->value);
+    auto result = makeShared<sep::StringLiteral>(arena, literal->value);
 
     setFileLocation(result, literal);
-    return result;
+    return share(result, literal);
 }
 
 sep::SExpressionPtr Translator::translate(const ast::SExpressionPtr& exp) {
-    ast::SymbolPtr exp1 = dynamic_pointer_cast<ast::Symbol>(exp);
-    if (exp1) {
-        return translate(exp1);
+    switch (exp->getKind()) {
+        case ast::NodeKind::SYMBOL:
+            return translate(ast::nodeCast<ast::Symbol>(exp));
+        case ast::NodeKind::KEYWORD:
+            return translate(ast::nodeCast<ast::Keyword>(exp));
+        case ast::NodeKind::NUMERAL_LITERAL:
+            return translate(ast::nodeCast<ast::NumeralLiteral>(exp));
+        case ast::NodeKind::DECIMAL_LITERAL:
+            return translate(ast::nodeCast<ast::DecimalLiteral>(exp));
+        case ast::NodeKind::STRING_LITERAL:
+            return translate(ast::nodeCast<ast::StringLiteral>(exp));
+        case ast::NodeKind::COMP_SEXPRESSION:
+            return translate(ast::nodeCast<ast::CompSExpression>(exp));
+        default:
+            return sep::SExpressionPtr();
     }
-
-    ast::KeywordPtr exp2 = dynamic_pointer_cast<ast::Keyword>(exp);
-    if (exp2) {
-        return translate(exp2);
-    }
-
-    ast::SpecConstantPtr exp3 = dynamic_pointer_cast<ast::SpecConstant>(exp);
-    if (exp3) {
-        return translate(exp3);
-    }
-
-    ast::CompSExpressionPtr exp4 = dynamic_pointer_cast<ast::CompSExpression>(exp);
-    if (exp4) {
-        return translate(exp4);
-    }
-    return sep::SExpressionPtr();
 }
 
 sep::CompSExpressionPtr Translator::translate(const ast::CompSExpressionPtr& exp) {
     auto newExps = std::move(translateToSmt<ast::SExpression, sep::SExpression>(exp->expressions));
-    auto result = make_shared<sep::CompSExpression>(std::move(newExps));
+    auto result = makeShared<sep::CompSExpression>(arena, std::move(newExps));
 
     setFileLocation(result, exp);
     return result;
 }
 
 sep::SortDeclarationPtr Translator::translate(const ast::SortDeclarationPtr& decl) {
-    auto result = make_shared<sep::SortDeclaration>(decl->symbol->value, decl->arity->value);
+    auto result = makeShared<sep::SortDeclaration>(arena, decl->symbol->value, decl->arity->value);
 
     setFileLocation(result, decl);
     return result;
 }
 
 sep::SelectorDeclarationPtr Translator::translate(const ast::SelectorDeclarationPtr& decl) {
-    auto result = make_shared<sep::SelectorDeclaration>(decl->symbol->value,
+    auto result = makeShared<sep::SelectorDeclaration>(arena, decl->symbol->value,
                                                         std::move(translate(decl->sort)));
 
     setFileLocation(result, decl);
@@ -997,31 +911,27 @@ sep::SelectorDeclarationPtr Translator::translate(const ast::SelectorDeclaration
 
 sep::ConstructorDeclarationPtr Translator::translate(const ast::ConstructorDeclarationPtr& decl) {
     auto newSels = std::move(translateToSmt<ast::SelectorDeclaration, sep::SelectorDeclaration>(decl->selectors));
-    auto result = make_shared<sep::ConstructorDeclaration>(decl->symbol->value, std::move(newSels));
+    auto result = makeShared<sep::ConstructorDeclaration>(arena, decl->symbol->value, std::move(newSels));
 
     setFileLocation(result, decl);
     return result;
 }
 
 sep::DatatypeDeclarationPtr Translator::translate(const ast::DatatypeDeclarationPtr& decl) {
-    ast::SimpleDatatypeDeclarationPtr decl1 = dynamic_pointer_cast<ast::SimpleDatatypeDeclaration>(decl);
-    if (decl1) {
-        return translate(decl1);
-    }
-
-    ast::ParametricDatatypeDeclarationPtr decl2 = dynamic_pointer_cast<ast::ParametricDatatypeDeclaration>(
-            decl);
-    if (decl2) {
-        return translate(decl2);
+    switch (decl->getKind()) {
+        case ast::NodeKind::SIMPLE_DATATYPE_DECLARATION:
+            return translate(ast::nodeCast<ast::SimpleDatatypeDeclaration>(decl));
+        case ast::NodeKind::PARAMETRIC_DATATYPE_DECLARATION:
+            return translate(ast::nodeCast<ast::ParametricDatatypeDeclaration>(decl));
+        default:
+            return sep::SimpleDatatypeDeclarationPtr();
     }
-
-    return sep::SimpleDatatypeDeclarationPtr();
 }
 
 sep::SimpleDatatypeDeclarationPtr Translator::translate(const ast::SimpleDatatypeDeclarationPtr& decl) {
     auto newCons = std::move(
             translateToSmt<ast::ConstructorDeclaration, sep::ConstructorDeclaration>(decl->constructors));
-    auto result = make_shared<sep::SimpleDatatypeDeclaration>(std::move(newCons));
+    auto result = makeShared<sep::SimpleDatatypeDeclaration>(arena, std::move(newCons));
 
     setFileLocation(result, decl);
     return result;
@@ -1035,7 +945,7 @@ sep::ParametricDatatypeDeclarationPtr Translator::translate(const ast::Parametri
 
     auto newCons = std::move(
             translateToSmt<ast::ConstructorDeclaration, sep::ConstructorDeclaration>(decl->constructors));
-    auto result = make_shared<sep::ParametricDatatypeDeclaration>(std::move(newParams), std::move(newCons));
+    auto result = makeShared<sep::ParametricDatatypeDeclaration>(arena, std::move(newParams), std::move(newCons));
 
     setFileLocation(result, decl);
     return result;
@@ -1043,7 +953,7 @@ sep::ParametricDatatypeDeclarationPtr Translator::translate(const ast::Parametri
 
 sep::SortSymbolDeclarationPtr Translator::translate(const ast::SortSymbolDeclarationPtr& decl) {
     auto newAttrs = std::move(translateToSmt<ast::Attribute, sep::Attribute>(decl->attributes));
-    auto result = make_shared<sep::SortSymbolDeclaration>(std::move(translate(decl->identifier)),
+    auto result = makeShared<sep::SortSymbolDeclaration>(arena, std::move(translate(decl->identifier)),
                                                           decl->arity->value,
                                                           std::move(newAttrs));
 
@@ -1052,32 +962,23 @@ sep::SortSymbolDeclarationPtr Translator::translate(const ast::SortSymbolDeclara
 }
 
 sep::FunSymbolDeclarationPtr Translator::translate(const ast::FunSymbolDeclarationPtr& decl) {
-    ast::SpecConstFunDeclarationPtr decl1 = dynamic_pointer_cast<ast::SpecConstFunDeclaration>(decl);
-    if (decl1) {
-        return translate(decl1);
-    }
-
-    ast::MetaSpecConstFunDeclarationPtr decl2 = dynamic_pointer_cast<ast::MetaSpecConstFunDeclaration>(decl);
-    if (decl2) {
-        return translate(decl2);
-    }
-
-    ast::SimpleFunDeclarationPtr decl3 = dynamic_pointer_cast<ast::SimpleFunDeclaration>(decl);
-    if (decl3) {
-        return translate(decl3);
-    }
-
-    ast::ParametricFunDeclarationPtr decl4 = dynamic_pointer_cast<ast::ParametricFunDeclaration>(decl);
-    if (decl4) {
-        return translate(decl4);
+    switch (decl->getKind()) {
+        case ast::NodeKind::SPEC_CONST_FUN_DECLARATION:
+            return translate(ast::nodeCast<ast::SpecConstFunDeclaration>(decl));
+        case ast::NodeKind::META_SPEC_CONST_FUN_DECLARATION:
+            return translate(ast::nodeCast<ast::MetaSpecConstFunDeclaration>(decl));
+        case ast::NodeKind::SIMPLE_FUN_DECLARATION:
+            return translate(ast::nodeCast<ast::SimpleFunDeclaration>(decl));
+        case ast::NodeKind::PARAMETRIC_FUN_DECLARATION:
+            return translate(ast::nodeCast<ast::ParametricFunDeclaration>(decl));
+        default:
+            return sep::FunSymbolDeclarationPtr();
     }
-
-    return sep::FunSymbolDeclarationPtr();
 }
 
 sep::SpecConstFunDeclarationPtr Translator::translate(const ast::SpecConstFunDeclarationPtr& decl) {
     auto newAttrs = std::move(translateToSmt<ast::Attribute, sep::Attribute>(decl->attributes));
-    auto result = make_shared<sep::SpecConstFunDeclaration>(std::move(translate(decl->constant)),
+    auto result = makeShared<sep::SpecConstFunDeclaration>(arena, std::move(translate(decl->constant)),
                                                             std::move(translate(decl->sort)),
                                                             std::move(newAttrs));
 
@@ -1087,7 +988,7 @@ sep::SpecConstFunDeclarationPtr Translator::translate(const ast::SpecConstFunDec
 
 sep::MetaSpecConstFunDeclarationPtr Translator::translate(const ast::MetaSpecConstFunDeclarationPtr& decl) {
     auto newAttrs = std::move(translateToSmt<ast::Attribute, sep::Attribute>(decl->attributes));
-    auto result = make_shared<sep::MetaSpecConstFunDeclaration>(std::move(translate(decl->constant)),
+    auto result = makeShared<sep::MetaSpecConstFunDeclaration>(arena, std::move(translate(decl->constant)),
                                                                 std::move(translate(decl->sort)),
                                                                 std::move(newAttrs));
 
@@ -1098,7 +999,7 @@ sep::MetaSpecConstFunDeclarationPtr Translator::translate(const ast::MetaSpecCon
 sep::SimpleFunDeclarationPtr Translator::translate(const ast::SimpleFunDeclarationPtr& decl) {
     auto newSign = translateToSmt<ast::Sort, sep::Sort>(decl->signature);
     auto newAttrs = translateToSmt<ast::Attribute, sep::Attribute>(decl->attributes);
-    auto result = make_shared<sep::SimpleFunDeclaration>(std::move(translate(decl->identifier)),
+    auto result = makeShared<sep::SimpleFunDeclaration>(arena, std::move(translate(decl->identifier)),
                                                          std::move(newSign),
                                                          std::move(newAttrs));
 
@@ -1114,7 +1015,7 @@ sep::ParametricFunDeclarationPtr Translator::translate(const ast::ParametricFunD
 
     auto newSign = std::move(translateToSmt<ast::Sort, sep::Sort>(decl->signature));
     auto newAttrs = std::move(translateToSmt<ast::Attribute, sep::Attribute>(decl->attributes));
-    auto result = make_shared<sep::ParametricFunDeclaration>(std::move(newParams),
+    auto result = makeShared<sep::ParametricFunDeclaration>(arena, std::move(newParams),
                                                              std::move(translate(decl->identifier)),
                                                              std::move(newSign),
                                                              std::move(newAttrs));
@@ -1124,21 +1025,18 @@ sep::ParametricFunDeclarationPtr Translator::translate(const ast::ParametricFunD
 }
 
 sep::ConstructorPtr Translator::translate(const ast::ConstructorPtr& cons) {
-    ast::SymbolPtr cons1 = dynamic_pointer_cast<ast::Symbol>(cons);
-    if (cons1) {
-        return translate(cons1);
-    }
-
-    ast::QualifiedConstructorPtr cons2 = dynamic_pointer_cast<ast::QualifiedConstructor>(cons);
-    if (cons2) {
-        return translate(cons2);
+    switch (cons->getKind()) {
+        case ast::NodeKind::SYMBOL:
+            return translate(ast::nodeCast<ast::Symbol>(cons));
+        case ast::NodeKind::QUALIFIED_CONSTRUCTOR:
+            return translate(ast::nodeCast<ast::QualifiedConstructor>(cons));
+        default:
+            return sep::ConstructorPtr();
     }
-
-    return sep::ConstructorPtr();
 }
 
 sep::QualifiedConstructorPtr Translator::translate(const ast::QualifiedConstructorPtr& cons) {
-    auto result = make_shared<sep::QualifiedConstructor>(cons->symbol->value,
+    auto result = makeShared<sep::QualifiedConstructor>(arena, cons->symbol->value,
                                                          std::move(translate(cons->sort)));
 
     setFileLocation(result, cons);
@@ -1146,17 +1044,16 @@ sep::QualifiedConstructorPtr Translator::translate(const ast::QualifiedConstruct
 }
 
 sep::PatternPtr Translator::translate(const ast::PatternPtr& pattern) {
-    ast::ConstructorPtr pattern1 = dynamic_pointer_cast<ast::Constructor>(pattern);
-    if (pattern1) {
-        return translate(pattern1);
+    switch (pattern->getKind()) {
+        case ast::NodeKind::SYMBOL:
+            return translate(ast::nodeCast<ast::Symbol>(pattern));
+        case ast::NodeKind::QUALIFIED_CONSTRUCTOR:
+            return translate(ast::nodeCast<ast::QualifiedConstructor>(pattern));
+        case ast::NodeKind::QUALIFIED_PATTERN:
+            return translate(ast::nodeCast<ast::QualifiedPattern>(pattern));
+        default:
+            return sep::PatternPtr();
     }
-
-    ast::QualifiedPatternPtr pattern2 = dynamic_pointer_cast<ast::QualifiedPattern>(pattern);
-    if (pattern2) {
-        return translate(pattern2);
-    }
-
-    return sep::PatternPtr();
 }
 
 sep::QualifiedPatternPtr Translator::translate(const ast::QualifiedPatternPtr& pattern) {
@@ -1165,7 +1062,7 @@ sep::QualifiedPatternPtr Translator::translate(const ast::QualifiedPatternPtr& p
         newArgs.push_back(arg->value);
     }
 
-    auto result = make_shared<sep::QualifiedPattern>(std::move(translate(pattern->constructor)),
+    auto result = makeShared<sep::QualifiedPattern>(arena, std::move(translate(pattern->constructor)),
                                                      std::move(newArgs));
 
     setFileLocation(result, pattern);
@@ -1173,7 +1070,7 @@ sep::QualifiedPatternPtr Translator::translate(const ast::QualifiedPatternPtr& p
 }
 
 sep::MatchCasePtr Translator::translate(const ast::MatchCasePtr& mcase) {
-    auto result = make_shared<sep::MatchCase>(std::move(translate(mcase->pattern)),
+    auto result = makeShared<sep::MatchCase>(arena, std::move(translate(mcase->pattern)),
                                               std::move(translate(mcase->term)));
 
     setFileLocation(result, mcase);
@@ -1182,48 +1079,48 @@ sep::MatchCasePtr Translator::translate(const ast::MatchCasePtr& mcase) {
 
 sep::QualifiedTermPtr Translator::translate(const ast::QualifiedTermPtr& term) {
     auto newTerms = std::move(translateToSmt<ast::Term, sep::Term>(term->terms));
-    auto result = make_shared<sep::QualifiedTerm>(std::move(translate(term->identifier)), std::move(newTerms));
+    auto result = makeShared<sep::QualifiedTerm>(arena, std::move(translate(term->identifier)), std::move(newTerms));
 
     setFileLocation(result, term);
-    return result;
+    return share(result, term);
 }
 
 sep::LetTermPtr Translator::translate(const ast::LetTermPtr& term) {
     auto newBindings = std::move(translateToSmt<ast::VariableBinding, sep::VariableBinding>(term->bindings));
-    auto result = make_shared<sep::LetTerm>(std::move(newBindings), std::move(translate(term->term)));
+    auto result = makeShared<sep::LetTerm>(arena, std::move(newBindings), std::move(translate(term->term)));
 
     setFileLocation(result, term);
-    return result;
+    return share(result, term);
 }
 
 sep::ForallTermPtr Translator::translate(const ast::ForallTermPtr& term) {
     auto newBindings = std::move(translateToSmt<ast::SortedVariable, sep::SortedVariable>(term->bindings));
-    auto result = make_shared<sep::ForallTerm>(std::move(newBindings), std::move(translate(term->term)));
+    auto result = makeShared<sep::ForallTerm>(arena, std::move(newBindings), std::move(translate(term->term)));
 
     setFileLocation(result, term);
-    return result;
+    return share(result, term);
 }
 
 sep::ExistsTermPtr Translator::translate(const ast::ExistsTermPtr& term) {
     auto newBindings = std::move(translateToSmt<ast::SortedVariable, sep::SortedVariable>(term->bindings));
-    auto result = make_shared<sep::ExistsTerm>(std::move(newBindings), std::move(translate(term->term)));
+    auto result = makeShared<sep::ExistsTerm>(arena, std::move(newBindings), std::move(translate(term->term)));
 
     setFileLocation(result, term);
-    return result;
+    return share(result, term);
 }
 
 sep::MatchTermPtr Translator::translate(const ast::MatchTermPtr& term) {
     auto newCases = std::move(translateToSmt<ast::MatchCase, sep::MatchCase>(term->cases));
-    auto result = make_shared<sep::MatchTerm>(std::move(translate(term->term)), std::move(newCases));
+    auto result = makeShared<sep::MatchTerm>(arena, std::move(translate(term->term)), std::move(newCases));
 
     setFileLocation(result, term);
-    return result;
+    return share(result, term);
 }
 
 sep::AnnotatedTermPtr Translator::translate(const ast::AnnotatedTermPtr& term) {
     auto newAttrs = std::move(translateToSmt<ast::Attribute, sep::Attribute>(term->attributes));
-    auto result = make_shared<sep::AnnotatedTerm>(std::move(translate(term->term)), std::move(newAttrs));
+    auto result = makeShared<sep::AnnotatedTerm>(arena, std::move(translate(term->term)), std::move(newAttrs));
 
     setFileLocation(result, term);
-    return result;
+    return share(result, term);
 }
@@ -7,20 +7,33 @@
 #include "sep/sep_abstract.h"
 #include "sep/sep_classes.h"
 #include "sep/sep_interfaces.h"
+#include "sep/sep_term_table.h"
+#include "util/arena.h"
+#include "util/sort_table.h"
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 namespace smtlib {
     namespace sep {
         class Translator {
         private:
+            /** Arena for the translated nodes, if any */
+            ArenaPtr arena;
+
+            /** Table in which the translated terms are hash-consed, if any */
+            TermTablePtr terms;
+
+            /** Translated sort annotations, by canonical sort */
+            std::unordered_map<const CanonicalSort*, sep::SortPtr> annotations;
+
             template<class astT1, class astT2, class smtT>
             std::vector<std::shared_ptr<smtT>> translateToSmtCast(const std::vector<std::shared_ptr<astT1>>& vec) {
                 std::vector<std::shared_ptr<smtT>> newVec;
 
                 for (const auto elem : vec) {
-                    auto temp = std::dynamic_pointer_cast<astT2>(elem);
+                    auto temp = ast::nodeCast<astT2>(elem);
                     if (temp) {
                         newVec.push_back(translate(temp));
                     }
@@ -65,7 +78,36 @@ namespace smtlib {
 
             void setFileLocation(const sep::NodePtr& output, const ast::NodePtr& source);
 
+            /** Carry the sort annotation of a term over to its translation */
+            void annotate(sep::Term* output, ast::Term* source);
+
+            /**
+             * Annotate a translated term with the sort of its source,
+             * and get its shared version, if terms are hash-consed
+             */
+            template<class T, class S>
+            inline std::shared_ptr<T> share(const std::shared_ptr<T>& term, const std::shared_ptr<S>& source) {
+                annotate(term.get(), source.get());
+                return terms ? terms->intern(term) : term;
+            }
+
         public:
+            inline Translator() = default;
+
+            /**
+             * \param arena    Arena to allocate the translated nodes from
+             */
+            inline explicit Translator(ArenaPtr arena)
+                    : arena(std::move(arena)) {}
+
+            /**
+             * \param arena    Arena to allocate the translated nodes from (may be null)
+             * \param terms    Table in which to hash-cons the translated terms
+             */
+            inline Translator(ArenaPtr arena, TermTablePtr terms)
+                    : arena(std::move(arena))
+                    , terms(std::move(terms)) {}
+
             sep::AttributePtr translate(const ast::AttributePtr&);
 
             sep::SymbolPtr translate(const ast::SymbolPtr&);
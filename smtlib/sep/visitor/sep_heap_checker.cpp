@@ -4,6 +4,7 @@
 #include "util/error_messages.h"
 
 #include <algorithm>
+#include <cassert>
 #include <iostream>
 
 using namespace std;
@@ -30,73 +31,58 @@ void HeapChecker::addError(const string& message, const NodePtr& node) {
 
 bool HeapChecker::isValidLocSort(const SortPtr& locSort) {
     const SortPtr& locSortExp = stack->expand(locSort);
-    const string& locSortExpStr = locSortExp->toString();
+    const CanonicalSort* locSortCan = locSortExp->getCanonical();
 
-    const auto& levels = stack->getLevels();
+    const auto& heap = stack->getHeap();
+    const auto& found = find_if(heap.begin(), heap.end(),
+                                [&](const pair<SortPtr, SortPtr>& p) {
+                                    return locSortCan == p.first->getCanonical();
+                                });
 
-    for (const auto& lvl : levels) {
-        const auto& heap = lvl->getHeap();
-        const auto& found = find_if(heap.begin(), heap.end(),
-                                    [&](const pair<SortPtr, SortPtr>& p) {
-                                        return locSortExpStr == p.first->toString();
-                                    });
-        if (found != heap.end()) {
-            return true;
-        }
-    }
-
-    return false;
+    return found != heap.end();
 }
 
 vector<string> HeapChecker::getAcceptedLocDataPairs() {
-    const auto& levels = stack->getLevels();
     vector<string> result;
 
-    for (const auto& lvl : levels) {
-        const auto& heap = lvl->getHeap();
-        for (const auto& pair : heap) {
-            stringstream ss;
-            ss << "(" << pair.first->toString()
-               << ", " << pair.second->toString() << ")";
+    for (const auto& pair : stack->getHeap()) {
+        stringstream ss;
+        ss << "(" << pair.first->toString()
+           << ", " << pair.second->toString() << ")";
 
-            result.push_back(ss.str());
-        }
+        result.push_back(ss.str());
     }
 
     return result;
 }
 
 vector<string> HeapChecker::getAcceptedLocSorts() {
-    const auto& levels = stack->getLevels();
     vector<string> result;
 
-    for (const auto& lvl : levels) {
-        const auto& heap = lvl->getHeap();
-        for (const auto& pair : heap) {
-            const string& loc = pair.first->toString();
-            const auto& found = find_if(result.begin(), result.end(),
-                                        [&](const string& str) {
-                                            return str == loc;
-                                        });
-
-            if(found == result.end()) {
-                result.push_back(pair.first->toString());
-            }
+    for (const auto& pair : stack->getHeap()) {
+        const string& loc = pair.first->toString();
+        const auto& found = find_if(result.begin(), result.end(),
+                                    [&](const string& str) {
+                                        return str == loc;
+                                    });
+
+        if(found == result.end()) {
+            result.push_back(pair.first->toString());
         }
     }
 
     return result;
 }
 
-void HeapChecker::visitWithStack(const EmpTermPtr& node) {
+void HeapChecker::visitWithStack(EmpTerm* node) {
     if (!node->locSort || !node->dataSort) {
         NodeErrorPtr nodeErr;
 
         if (!node->locSort)
-            nodeErr = addError(ErrorMessages::ERR_UNSPECIFIED_LOC_SORT, node, nodeErr);
+            nodeErr = addError(ErrorMessages::ERR_UNSPECIFIED_LOC_SORT, node->shared_from_this(), nodeErr);
 
         if (!node->dataSort)
-            addError(ErrorMessages::ERR_UNSPECIFIED_DATA_SORT, node, nodeErr);
+            addError(ErrorMessages::ERR_UNSPECIFIED_DATA_SORT, node->shared_from_this(), nodeErr);
 
         return;
     }
@@ -105,39 +91,54 @@ void HeapChecker::visitWithStack(const EmpTermPtr& node) {
     if (!found.first || !found.second) {
         const string& msg = ErrorMessages::buildLocDataPairUnaccepted(node->locSort, node->dataSort,
                                                                       getAcceptedLocDataPairs());
-        addError(msg, node);
+        addError(msg, node->shared_from_this());
     }
 }
 
-void HeapChecker::visitWithStack(const PtoTermPtr& node) {
+SortPtr HeapChecker::getSort(const TermPtr& term) {
+    // Terms are annotated with their sorts by the sortedness check, so they are only inferred again without it
+    if (term->inferredSort)
+        return term->inferredSort;
+
+    size_t depth = stack->getDepth();
+
     TermSorterContextPtr ctx = make_shared<TermSorterContext>(stack);
-    TermSorterPtr sorter = make_shared<TermSorter>(ctx);
+    TermSorter sorter(ctx);
+    SortPtr sort = sorter.run(term);
+
+    // The sorter leaves the stack as it found it, so that later commands see the same levels
+    assert(stack->getDepth() == depth);
+    (void) depth;
 
+    return sort;
+}
+
+void HeapChecker::visitWithStack(PtoTerm* node) {
     NodeErrorPtr nodeErr;
     /*if(dynamic_pointer_cast<NilTerm>(node->leftTerm)) {
-        nodeErr = addError(ErrorMessages::ERR_PTO_LEFT_NIL, node, nodeErr);
+        nodeErr = addError(ErrorMessages::ERR_PTO_LEFT_NIL, node->shared_from_this(), nodeErr);
     }*/
 
-    SortPtr leftSort = sorter->run(node->leftTerm);
-    SortPtr rightSort = sorter->run(node->rightTerm);
+    SortPtr leftSort = getSort(node->leftTerm);
+    SortPtr rightSort = getSort(node->rightTerm);
 
     HeapEntry found = stack->findDuplicate(make_pair(leftSort, rightSort));
     if (!found.first || !found.second) {
         const string& msg = ErrorMessages::buildLocDataPairUnaccepted(leftSort, rightSort,
                                                                       getAcceptedLocDataPairs());
-        addError(msg, node, nodeErr);
+        addError(msg, node->shared_from_this(), nodeErr);
     }
 }
 
-void HeapChecker::visitWithStack(const NilTermPtr& node) {
+void HeapChecker::visitWithStack(NilTerm* node) {
     if (!node->sort) {
-        addError(ErrorMessages::ERR_UNSPECIFIED_NIL_SORT, node);
+        addError(ErrorMessages::ERR_UNSPECIFIED_NIL_SORT, node->shared_from_this());
         return;
     }
 
     if (!isValidLocSort(node->sort)) {
         const string& msg = ErrorMessages::buildLocSortUnaccepted(node->sort, getAcceptedLocSorts());
-        addError(msg, node);
+        addError(msg, node->shared_from_this());
     }
 }
 
@@ -160,8 +161,8 @@ string HeapChecker::getErrors() {
 
     for (const auto& error : errors) {
         if (error->node) {
-            ss << error->node->rowLeft << ":" << error->node->colLeft
-               << " - " << error->node->rowRight << ":" << error->node->colRight << "   ";
+            ss << error->node->getRowLeft() << ":" << error->node->getColLeft()
+               << " - " << error->node->getRowRight() << ":" << error->node->getColRight() << "   ";
 
             string nodestr = error->node->toString();
             if (nodestr.length() > 100)
@@ -181,3 +182,17 @@ string HeapChecker::getErrors() {
 
     return ss.str();
 }
+
+void HeapChecker::clearErrors() {
+    errors.clear();
+}
+
+vector<HeapChecker::NodeErrorPtr> HeapChecker::takeErrors() {
+    vector<NodeErrorPtr> result;
+    result.swap(errors);
+    return result;
+}
+
+void HeapChecker::addErrors(const vector<NodeErrorPtr>& errs) {
+    errors.insert(errors.end(), errs.begin(), errs.end());
+}
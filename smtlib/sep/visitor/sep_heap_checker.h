@@ -50,6 +50,9 @@ namespace smtlib {
             std::vector<std::string> getAcceptedLocDataPairs();
             std::vector<std::string> getAcceptedLocSorts();
 
+            /** Get the sort of a term, from its annotation if it has one */
+            SortPtr getSort(const TermPtr& term);
+
         public:
 
             NodeErrorPtr addError(const std::string& message,
@@ -61,12 +64,21 @@ namespace smtlib {
 
             inline explicit HeapChecker() = default;
 
-            void visitWithStack(const EmpTermPtr& node) override;
-            void visitWithStack(const PtoTermPtr& node) override;
-            void visitWithStack(const NilTermPtr& node) override;
+            void visitWithStack(EmpTerm* node) override;
+            void visitWithStack(PtoTerm* node) override;
+            void visitWithStack(NilTerm* node) override;
 
             bool check(const NodePtr& node);
             std::string getErrors();
+
+            /** Discard the errors found so far */
+            void clearErrors();
+
+            /** Remove the errors found so far and return them */
+            std::vector<NodeErrorPtr> takeErrors();
+
+            /** Add errors (e.g. taken from another checker) after the errors found so far */
+            void addErrors(const std::vector<NodeErrorPtr>& errs);
         };
 
         typedef std::shared_ptr<HeapChecker> HeapCheckerPtr;
@@ -8,12 +8,13 @@
 using namespace std;
 using namespace smtlib::sep;
 
-void TermSorter::visit(const SimpleIdentifierPtr& node) {
-    VarEntryPtr varInfo = ctx->getStack()->getVarEntry(node->toString());
+void TermSorter::visit(SimpleIdentifier* node) {
+    SymbolId nameId = node->getNameId();
+    VarEntryPtr varInfo = ctx->getStack()->getVarEntry(nameId);
     if (varInfo) {
         ret = varInfo->sort;
     } else {
-        vector<FunEntryPtr> infos = ctx->getStack()->getFunEntry(node->toString());
+        vector<FunEntryPtr> infos = ctx->getStack()->getFunEntry(nameId);
         vector<SortPtr> possibleSorts;
         for (const auto& info : infos) {
             if (info->signature.size() == 1 && info->params.empty())
@@ -26,8 +27,8 @@ void TermSorter::visit(const SimpleIdentifierPtr& node) {
     }
 }
 
-void TermSorter::visit(const QualifiedIdentifierPtr& node) {
-    vector<FunEntryPtr> infos = ctx->getStack()->getFunEntry(node->identifier->toString());
+void TermSorter::visit(QualifiedIdentifier* node) {
+    vector<FunEntryPtr> infos = ctx->getStack()->getFunEntry(node->identifier->getNameId());
     SortPtr retExpanded = ctx->getStack()->expand(node->sort);
 
     vector<SortPtr> retSorts;
@@ -41,7 +42,7 @@ void TermSorter::visit(const QualifiedIdentifierPtr& node) {
 
                 if (mapping.size() == info->params.size()) {
                     SortPtr retSort = ctx->getStack()->replace(info->signature[0], mapping);
-                    if (retSort->toString() == retExpanded->toString()) {
+                    if (retSort->getCanonical() == retExpanded->getCanonical()) {
                         ret = retSort;
                         return;
                     }
@@ -51,12 +52,12 @@ void TermSorter::visit(const QualifiedIdentifierPtr& node) {
         }
     }
 
-    if (retSorts.size() == 1 && retSorts[0]->toString() == retExpanded->toString()) {
+    if (retSorts.size() == 1 && retSorts[0]->getCanonical() == retExpanded->getCanonical()) {
         ret = retSorts[0];
     }
 }
 
-void TermSorter::visit(const DecimalLiteralPtr& node) {
+void TermSorter::visit(DecimalLiteral* node) {
     vector<FunEntryPtr> entries = ctx->getStack()->getFunEntry(MSCONST_DECIMAL);
     if (entries.size() == 1) {
         if (entries[0]->signature.size() == 1) {
@@ -65,7 +66,7 @@ void TermSorter::visit(const DecimalLiteralPtr& node) {
     }
 }
 
-void TermSorter::visit(const NumeralLiteralPtr& node) {
+void TermSorter::visit(NumeralLiteral* node) {
     vector<FunEntryPtr> entries = ctx->getStack()->getFunEntry(MSCONST_NUMERAL);
     if (entries.size() == 1) {
         if (entries[0]->signature.size() == 1) {
@@ -74,7 +75,7 @@ void TermSorter::visit(const NumeralLiteralPtr& node) {
     }
 }
 
-void TermSorter::visit(const StringLiteralPtr& node) {
+void TermSorter::visit(StringLiteral* node) {
     vector<FunEntryPtr> entries = ctx->getStack()->getFunEntry(MSCONST_STRING);
     if (entries.size() == 1) {
         if (entries[0]->signature.size() == 1) {
@@ -83,9 +84,10 @@ void TermSorter::visit(const StringLiteralPtr& node) {
     }
 }
 
-void TermSorter::visit(const QualifiedTermPtr& node) {
+void TermSorter::visit(QualifiedTerm* node) {
     vector<SortPtr> argSorts;
     vector<TermPtr>& terms = node->terms;
+    argSorts.reserve(terms.size());
     for (const auto& term : terms) {
         SortPtr result = wrappedVisit(term);
         if (result)
@@ -95,99 +97,71 @@ void TermSorter::visit(const QualifiedTermPtr& node) {
         }
     }
 
-    SimpleIdentifierPtr id = dynamic_pointer_cast<SimpleIdentifier>(node->identifier);
-    QualifiedIdentifierPtr qid = dynamic_pointer_cast<QualifiedIdentifier>(node->identifier);
+    SimpleIdentifierPtr id = nodeCast<SimpleIdentifier>(node->identifier);
+    QualifiedIdentifierPtr qid = nodeCast<QualifiedIdentifier>(node->identifier);
 
     SortPtr retExpanded;
-    string name;
+    SymbolId nameId;
 
     if (id) {
-        name = id->toString();
+        nameId = id->getNameId();
     } else {
-        name = qid->identifier->toString();
+        nameId = qid->identifier->getNameId();
         retExpanded = ctx->getStack()->expand(qid->sort);
     }
 
-    vector<FunEntryPtr> infos = ctx->getStack()->getFunEntry(name);
+    vector<FunEntryPtr> infos = ctx->getStack()->getFunEntry(nameId);
     vector<SortPtr> retSorts;
+    size_t argCount = argSorts.size();
 
     for (const auto& info : infos) {
-        vector<SortPtr> funSig;
-        if (argSorts.size() >= 2) {
-            if (info->assocL) {
-                funSig.push_back(info->signature[0]);
-                for (int i = 0; i < argSorts.size() - 1; i++) {
-                    funSig.push_back(info->signature[1]);
-                }
-                funSig.push_back(info->signature[2]);
-            } else if (info->assocR) {
-                for (int i = 0; i < argSorts.size() - 1; i++) {
-                    funSig.push_back(info->signature[0]);
-                }
-                funSig.push_back(info->signature[1]);
-                funSig.push_back(info->signature[2]);
-            } else if (info->chainable || info->pairwise) {
-                for (int i = 0; i < argSorts.size(); i++) {
-                    funSig.push_back(info->signature[0]);
-                }
-                funSig.push_back(info->signature[2]);
-            } else {
-                funSig.insert(funSig.begin(), info->signature.begin(), info->signature.end());
-            }
-        } else {
-            funSig.insert(funSig.begin(), info->signature.begin(), info->signature.end());
-        }
+        // Match the arguments against the signature, accounting for the attributes of the function
+        if (!info->acceptsArity(argCount))
+            continue;
 
-        if (argSorts.size() == funSig.size() - 1) {
+        if (info->params.empty()) {
             bool fits = true;
-            if (info->params.empty()) {
-                for (size_t i = 0, sz = funSig.size() - 1; i < sz; i++) {
-                    if (funSig[i]->toString() != argSorts[i]->toString())
-                        fits = false;
-                }
+            for (size_t i = 0; i < argCount && fits; i++) {
+                fits = info->getArgumentSort(i, argCount)->getCanonical() == argSorts[i]->getCanonical();
+            }
 
-                if (id) {
-                    if (fits)
-                        retSorts.push_back(funSig[funSig.size() - 1]);
-                } else {
-                    SortPtr retSort = funSig[funSig.size() - 1];
-                    if (fits && retSort->toString() == retExpanded->toString()) {
-                        ret = retSort;
-                        return;
-                    }
-                }
-            } else {
+            if (!fits)
+                continue;
+
+            const SortPtr& retSort = info->getResultSort(argCount);
+            if (id) {
+                retSorts.push_back(retSort);
+            } else if (retSort->getCanonical() == retExpanded->getCanonical()) {
+                ret = retSort;
+                return;
+            }
+        } else {
+            // Instances only depend on the argument sorts, so they are computed once for each
+            bool known;
+            SortPtr& instance = ctx->getStack()->getInstance(info, argSorts, known);
+            if (!known) {
                 unordered_map<string, SortPtr> mapping;
 
-                for (size_t i = 0, sz = funSig.size() - 1; i < sz; i++) {
-                    fits = fits && unify(funSig[i], argSorts[i], info->params, mapping);
+                bool fits = true;
+                for (size_t i = 0; i < argCount && fits; i++) {
+                    fits = unify(info->getArgumentSort(i, argCount), argSorts[i], info->params, mapping);
                 }
 
-                if (fits && mapping.size() == info->params.size()) {
-                    SortPtr retSort = funSig[funSig.size() - 1];
-                    retSort = ctx->getStack()->replace(retSort, mapping);
-                    string retSortString = retSort->toString();
-                    if (id) {
-                        retSorts.push_back(retSort);
-                    } else {
-                        if (retSortString == retExpanded->toString()) {
-                            ret = retSort;
-                            return;
-                        }
-                    }
-                }
+                if (fits && mapping.size() == info->params.size())
+                    instance = ctx->getStack()->replace(info->getResultSort(argCount), mapping);
             }
-        }
-    }
 
-    vector<string> argSortsStr;
-    for (const auto& sort : argSorts) {
-        argSortsStr.push_back(sort->toString());
-    }
+            SortPtr retSort = instance;
+            if (!retSort)
+                continue;
 
-    vector<string> retSortsStr;
-    for (const auto& sort : retSorts) {
-        retSortsStr.push_back(sort->toString());
+            if (id) {
+                retSorts.push_back(retSort);
+            } else if (retSort->getCanonical() == retExpanded->getCanonical()) {
+                ret = retSort;
+                return;
+            }
+        }
     }
 
     if (id && retSorts.size() == 1) {
@@ -195,32 +169,37 @@ void TermSorter::visit(const QualifiedTermPtr& node) {
     }
 }
 
-void TermSorter::visit(const LetTermPtr& node) {
+void TermSorter::visit(LetTerm* node) {
     ctx->getStack()->push();
 
+    bool bound = true;
     for (const auto& binding : node->bindings) {
         SortPtr result = wrappedVisit(binding->term);
-        if (result) {
-            ctx->getStack()->tryAdd(make_shared<VarEntry>(binding->name, result, node));
-        } else {
-            return;
+        if (!result) {
+            bound = false;
+            break;
         }
+
+        ctx->getStack()->tryAdd(make_shared<VarEntry>(binding->name, result, node->shared_from_this()));
     }
 
-    SortPtr result = wrappedVisit(node->term);
-    if (result) {
-        ret = result;
+    if (bound) {
+        SortPtr result = wrappedVisit(node->term);
+        if (result) {
+            ret = result;
+        }
     }
 
     ctx->getStack()->pop();
 }
 
-void TermSorter::visit(const ForallTermPtr& node) {
+void TermSorter::visit(ForallTerm* node) {
     ctx->getStack()->push();
 
     for (const auto& bind : node->bindings) {
         ctx->getStack()->tryAdd(
-            make_shared<VarEntry>(bind->name, std::move(ctx->getStack()->expand(bind->sort)), node));
+            make_shared<VarEntry>(bind->name, std::move(ctx->getStack()->expand(bind->sort)),
+                                  node->shared_from_this()));
     }
 
     SortPtr result = wrappedVisit(node->term);
@@ -231,12 +210,13 @@ void TermSorter::visit(const ForallTermPtr& node) {
     ctx->getStack()->pop();
 }
 
-void TermSorter::visit(const ExistsTermPtr& node) {
+void TermSorter::visit(ExistsTerm* node) {
     ctx->getStack()->push();
 
     for (const auto& bind : node->bindings) {
         ctx->getStack()->tryAdd(
-            make_shared<VarEntry>(bind->name, std::move(ctx->getStack()->expand(bind->sort)), node));
+            make_shared<VarEntry>(bind->name, std::move(ctx->getStack()->expand(bind->sort)),
+                                  node->shared_from_this()));
     }
 
     SortPtr result = wrappedVisit(node->term);
@@ -247,7 +227,7 @@ void TermSorter::visit(const ExistsTermPtr& node) {
     ctx->getStack()->pop();
 }
 
-void TermSorter::visit(const MatchTermPtr& node) {
+void TermSorter::visit(MatchTerm* node) {
     vector<SortPtr> caseSorts;
 
     for (const auto& caseIt : node->cases) {
@@ -263,10 +243,10 @@ void TermSorter::visit(const MatchTermPtr& node) {
     }
 
     if (caseSorts.size() == node->cases.size()) {
-        string case1 = caseSorts[0]->toString();
+        const CanonicalSort* case1 = caseSorts[0]->getCanonical();
         bool equalCases = true;
         for (size_t i = 1, sz = caseSorts.size(); i < sz; i++) {
-            if (caseSorts[1]->toString() != case1) {
+            if (caseSorts[i]->getCanonical() != case1) {
                 equalCases = false;
                 break;
             }
@@ -276,25 +256,25 @@ void TermSorter::visit(const MatchTermPtr& node) {
     }
 }
 
-void TermSorter::visit(const AnnotatedTermPtr& node) {
+void TermSorter::visit(AnnotatedTerm* node) {
     ret = wrappedVisit(node->term);
 }
 
-void TermSorter::visit(const TrueTermPtr& node) {
+void TermSorter::visit(TrueTerm* node) {
     ret = make_shared<Sort>(SORT_BOOL);
 }
 
-void TermSorter::visit(const FalseTermPtr& node) {
+void TermSorter::visit(FalseTerm* node) {
     ret = make_shared<Sort>(SORT_BOOL);
 }
 
-void TermSorter::visit(const NotTermPtr& node) {
+void TermSorter::visit(NotTerm* node) {
     SortPtr sort = wrappedVisit(node->term);
     if (sort->name == SORT_BOOL)
         ret = make_shared<Sort>(SORT_BOOL);
 }
 
-void TermSorter::visit(const ImpliesTermPtr& node) {
+void TermSorter::visit(ImpliesTerm* node) {
     bool sorted = true;
     auto terms = node->terms;
 
@@ -308,7 +288,7 @@ void TermSorter::visit(const ImpliesTermPtr& node) {
         ret = make_shared<Sort>(SORT_BOOL);
 }
 
-void TermSorter::visit(const AndTermPtr& node) {
+void TermSorter::visit(AndTerm* node) {
     bool sorted = true;
     auto terms = node->terms;
 
@@ -322,7 +302,7 @@ void TermSorter::visit(const AndTermPtr& node) {
         ret = make_shared<Sort>(SORT_BOOL);
 }
 
-void TermSorter::visit(const OrTermPtr& node) {
+void TermSorter::visit(OrTerm* node) {
     bool sorted = true;
     auto terms = node->terms;
 
@@ -336,7 +316,7 @@ void TermSorter::visit(const OrTermPtr& node) {
         ret = make_shared<Sort>(SORT_BOOL);
 }
 
-void TermSorter::visit(const XorTermPtr& node) {
+void TermSorter::visit(XorTerm* node) {
     bool sorted = true;
     auto terms = node->terms;
 
@@ -350,7 +330,7 @@ void TermSorter::visit(const XorTermPtr& node) {
         ret = make_shared<Sort>(SORT_BOOL);
 }
 
-void TermSorter::visit(const EqualsTermPtr& node) {
+void TermSorter::visit(EqualsTerm* node) {
     bool sorted = true;
     auto terms = node->terms;
 
@@ -364,7 +344,7 @@ void TermSorter::visit(const EqualsTermPtr& node) {
         ret = make_shared<Sort>(SORT_BOOL);
 }
 
-void TermSorter::visit(const DistinctTermPtr& node) {
+void TermSorter::visit(DistinctTerm* node) {
     bool sorted = true;
     auto terms = node->terms;
 
@@ -378,20 +358,20 @@ void TermSorter::visit(const DistinctTermPtr& node) {
         ret = make_shared<Sort>(SORT_BOOL);
 }
 
-void TermSorter::visit(const IteTermPtr& node) {
+void TermSorter::visit(IteTerm* node) {
     SortPtr resultThen = wrappedVisit(node->thenTerm);
     SortPtr resultElse = wrappedVisit(node->elseTerm);
 
-    if (resultThen->toString() == resultElse->toString()) {
+    if (resultThen->getCanonical() == resultElse->getCanonical()) {
         ret = resultThen;
     }
 }
 
-void TermSorter::visit(const EmpTermPtr& node) {
+void TermSorter::visit(EmpTerm* node) {
     ret = make_shared<Sort>(SORT_BOOL);
 }
 
-void TermSorter::visit(const SepTermPtr& node) {
+void TermSorter::visit(SepTerm* node) {
     bool sorted = true;
     auto terms = node->terms;
 
@@ -405,15 +385,15 @@ void TermSorter::visit(const SepTermPtr& node) {
         ret = make_shared<Sort>(SORT_BOOL);
 }
 
-void TermSorter::visit(const WandTermPtr& node) {
+void TermSorter::visit(WandTerm* node) {
     ret = make_shared<Sort>(SORT_BOOL);
 }
 
-void TermSorter::visit(const PtoTermPtr& node) {
+void TermSorter::visit(PtoTerm* node) {
     ret = make_shared<Sort>(SORT_BOOL);
 }
 
-void TermSorter::visit(const NilTermPtr& node) {
+void TermSorter::visit(NilTerm* node) {
     if (node->sort) {
         ret = ctx->getStack()->expand(node->sort);
     }
@@ -430,7 +410,7 @@ bool TermSorter::unify(const SortPtr& sort1, const SortPtr& sort2,
 
     if (isParam) {
         if (mapping[sort1Name]) {
-            return mapping[sort1Name]->toString() == sort2->toString();
+            return mapping[sort1Name]->getCanonical() == sort2->getCanonical();
         } else {
             mapping[sort1Name] = sort2;
             return true;
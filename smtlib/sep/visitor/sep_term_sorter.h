@@ -33,7 +33,7 @@ namespace smtlib {
 
         /* ==================================== TermSorter ==================================== */
         /** Determines the sort of a term */
-        class TermSorter : public DummyVisitor1<SortPtr> {
+        class TermSorter : public DummyRawVisitor1<SortPtr> {
         private:
             ITermSorterContextPtr ctx;
 
@@ -45,39 +45,35 @@ namespace smtlib {
             inline explicit TermSorter(ITermSorterContextPtr ctx)
                     : ctx(std::move(ctx)) {}
 
-            void visit(const SimpleIdentifierPtr& node) override;
-            void visit(const QualifiedIdentifierPtr& node) override;
-            void visit(const DecimalLiteralPtr& node) override;
-            void visit(const NumeralLiteralPtr& node) override;
-            void visit(const StringLiteralPtr& node) override;
-
-            void visit(const QualifiedTermPtr& node) override;
-            void visit(const LetTermPtr& node) override;
-            void visit(const ForallTermPtr& node) override;
-            void visit(const ExistsTermPtr& node) override;
-            void visit(const MatchTermPtr& node) override;
-            void visit(const AnnotatedTermPtr& node) override;
-
-            void visit(const TrueTermPtr& node) override;
-            void visit(const FalseTermPtr& node) override;
-            void visit(const NotTermPtr& node) override;
-            void visit(const ImpliesTermPtr& node) override;
-            void visit(const AndTermPtr& node) override;
-            void visit(const OrTermPtr& node) override;
-            void visit(const XorTermPtr& node) override;
-            void visit(const EqualsTermPtr& node) override;
-            void visit(const DistinctTermPtr& node) override;
-            void visit(const IteTermPtr& node) override;
-
-            void visit(const EmpTermPtr& node) override;
-            void visit(const SepTermPtr& node) override;
-            void visit(const WandTermPtr& node) override;
-            void visit(const PtoTermPtr& node) override;
-            void visit(const NilTermPtr& node) override;
-
-            SortPtr run(const NodePtr& node) override {
-                return wrappedVisit(node);
-            }
+            void visit(SimpleIdentifier* node) override;
+            void visit(QualifiedIdentifier* node) override;
+            void visit(DecimalLiteral* node) override;
+            void visit(NumeralLiteral* node) override;
+            void visit(StringLiteral* node) override;
+
+            void visit(QualifiedTerm* node) override;
+            void visit(LetTerm* node) override;
+            void visit(ForallTerm* node) override;
+            void visit(ExistsTerm* node) override;
+            void visit(MatchTerm* node) override;
+            void visit(AnnotatedTerm* node) override;
+
+            void visit(TrueTerm* node) override;
+            void visit(FalseTerm* node) override;
+            void visit(NotTerm* node) override;
+            void visit(ImpliesTerm* node) override;
+            void visit(AndTerm* node) override;
+            void visit(OrTerm* node) override;
+            void visit(XorTerm* node) override;
+            void visit(EqualsTerm* node) override;
+            void visit(DistinctTerm* node) override;
+            void visit(IteTerm* node) override;
+
+            void visit(EmpTerm* node) override;
+            void visit(SepTerm* node) override;
+            void visit(WandTerm* node) override;
+            void visit(PtoTerm* node) override;
+            void visit(NilTerm* node) override;
         };
 
         typedef std::shared_ptr<TermSorter> TermSorterPtr;
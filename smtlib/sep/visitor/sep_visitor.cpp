@@ -8,6 +8,7 @@
 #include "sep/sep_symbol_decl.h"
 #include "sep/sep_term.h"
 #include "sep/sep_theory.h"
+#include "util/stack_guard.h"
 
 using namespace smtlib::sep;
 
@@ -15,6 +16,13 @@ void Visitor0::visit0(const NodePtr& node) {
     if (!node) {
         return;
     }
+
+    // Continue deeply nested traversals on a new stack segment
+    if (StackGuard::isLow()) {
+        StackGuard::runOnNewSegment([&] { node->accept(this); });
+        return;
+    }
+
     node->accept(this);
 }
 
@@ -355,3 +363,353 @@ void DummyVisitor0::visit(const VariableBindingPtr& node) {
     visit0(node->term);
 }
 
+void RawVisitor0::visit0(Node* node) {
+    if (!node) {
+        return;
+    }
+
+    // Continue deeply nested traversals on a new stack segment
+    if (StackGuard::isLow()) {
+        StackGuard::runOnNewSegment([&] { node->accept(this); });
+        return;
+    }
+
+    node->accept(this);
+}
+
+void DummyRawVisitor0::visit(SimpleAttribute* node) {}
+
+void DummyRawVisitor0::visit(SExpressionAttribute* node) {
+    visit0(node->value);
+}
+
+void DummyRawVisitor0::visit(SymbolAttribute* node) {}
+
+void DummyRawVisitor0::visit(BooleanAttribute* node) {}
+
+void DummyRawVisitor0::visit(NumeralAttribute* node) {
+    visit0(node->value);
+}
+
+void DummyRawVisitor0::visit(DecimalAttribute* node) {
+    visit0(node->value);
+}
+
+void DummyRawVisitor0::visit(StringAttribute* node) {
+    visit0(node->value);
+}
+
+void DummyRawVisitor0::visit(TheoriesAttribute* node) {}
+
+void DummyRawVisitor0::visit(SortsAttribute* node) {
+    visit0(node->declarations);
+}
+
+void DummyRawVisitor0::visit(FunsAttribute* node) {
+    visit0(node->declarations);
+}
+
+void DummyRawVisitor0::visit(Symbol* node) {}
+
+void DummyRawVisitor0::visit(Keyword* node) {}
+
+void DummyRawVisitor0::visit(MetaSpecConstant* node) {}
+
+void DummyRawVisitor0::visit(BooleanValue* node) {}
+
+void DummyRawVisitor0::visit(PropLiteral* node) {}
+
+void DummyRawVisitor0::visit(AssertCommand* node) {
+    visit0(node->term);
+}
+
+void DummyRawVisitor0::visit(CheckSatCommand* node) {}
+
+void DummyRawVisitor0::visit(CheckUnsatCommand* node) {}
+
+void DummyRawVisitor0::visit(CheckSatAssumCommand* node) {
+    visit0(node->assumptions);
+}
+
+void DummyRawVisitor0::visit(DeclareConstCommand* node) {
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(DeclareDatatypeCommand* node) {
+    visit0(node->declaration);
+}
+
+void DummyRawVisitor0::visit(DeclareDatatypesCommand* node) {
+    visit0(node->sorts);
+    visit0(node->declarations);
+}
+
+void DummyRawVisitor0::visit(DeclareFunCommand* node) {
+    visit0(node->parameters);
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(DeclareSortCommand* node) {}
+
+void DummyRawVisitor0::visit(DeclareHeapCommand* node) {
+    visit0(node->locDataPairs);
+}
+
+void DummyRawVisitor0::visit(DefineFunCommand* node) {
+    visit0(node->definition);
+}
+
+void DummyRawVisitor0::visit(DefineFunRecCommand* node) {
+    visit0(node->definition);
+}
+
+void DummyRawVisitor0::visit(DefineFunsRecCommand* node) {
+    visit0(node->declarations);
+    visit0(node->bodies);
+}
+
+void DummyRawVisitor0::visit(DefineSortCommand* node) {
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(EchoCommand* node) {}
+
+void DummyRawVisitor0::visit(ExitCommand* node) {}
+
+void DummyRawVisitor0::visit(GetAssertsCommand* node) {}
+
+void DummyRawVisitor0::visit(GetAssignsCommand* node) {}
+
+void DummyRawVisitor0::visit(GetInfoCommand* node) {}
+
+void DummyRawVisitor0::visit(GetModelCommand* node) {}
+
+void DummyRawVisitor0::visit(GetOptionCommand* node) {}
+
+void DummyRawVisitor0::visit(GetProofCommand* node) {}
+
+void DummyRawVisitor0::visit(GetUnsatAssumsCommand* node) {}
+
+void DummyRawVisitor0::visit(GetUnsatCoreCommand* node) {}
+
+void DummyRawVisitor0::visit(GetValueCommand* node) {
+    visit0(node->terms);
+}
+
+void DummyRawVisitor0::visit(PopCommand* node) {}
+
+void DummyRawVisitor0::visit(PushCommand* node) {}
+
+void DummyRawVisitor0::visit(ResetCommand* node) {}
+
+void DummyRawVisitor0::visit(ResetAssertsCommand* node) {}
+
+void DummyRawVisitor0::visit(SetInfoCommand* node) {
+    visit0(node->info);
+}
+
+void DummyRawVisitor0::visit(SetLogicCommand* node) {}
+
+void DummyRawVisitor0::visit(SetOptionCommand* node) {
+    visit0(node->option);
+}
+
+void DummyRawVisitor0::visit(SortDeclaration* node) {}
+
+void DummyRawVisitor0::visit(SelectorDeclaration* node) {
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(ConstructorDeclaration* node) {
+    visit0(node->selectors);
+}
+
+void DummyRawVisitor0::visit(SimpleDatatypeDeclaration* node) {
+    visit0(node->constructors);
+}
+
+void DummyRawVisitor0::visit(ParametricDatatypeDeclaration* node) {
+    visit0(node->constructors);
+}
+
+void DummyRawVisitor0::visit(FunctionDeclaration* node) {
+    visit0(node->parameters);
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(FunctionDefinition* node) {
+    visit0(node->signature);
+    visit0(node->body);
+}
+
+void DummyRawVisitor0::visit(SimpleIdentifier* node) {
+    visit0(node->indices);
+}
+
+void DummyRawVisitor0::visit(QualifiedIdentifier* node) {
+    visit0(node->identifier);
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(NumeralLiteral* node) {}
+
+void DummyRawVisitor0::visit(DecimalLiteral* node) {}
+
+void DummyRawVisitor0::visit(StringLiteral* node) {}
+
+void DummyRawVisitor0::visit(Logic* node) {
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(Theory* node) {
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(Script* node) {
+    visit0(node->commands);
+}
+
+void DummyRawVisitor0::visit(QualifiedConstructor* node) {
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(QualifiedPattern* node) {
+    visit0(node->constructor);
+}
+
+void DummyRawVisitor0::visit(MatchCase* node) {
+    visit0(node->pattern);
+    visit0(node->term);
+}
+
+void DummyRawVisitor0::visit(CompSExpression* node) {
+    visit0(node->expressions);
+}
+
+void DummyRawVisitor0::visit(Sort* node) {
+    visit0(node->arguments);
+}
+
+void DummyRawVisitor0::visit(SortSymbolDeclaration* node) {
+    visit0(node->identifier);
+       visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(SpecConstFunDeclaration* node) {
+    visit0(node->constant);
+    visit0(node->sort);
+       visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(MetaSpecConstFunDeclaration* node) {
+    visit0(node->constant);
+    visit0(node->sort);
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(SimpleFunDeclaration* node) {
+    visit0(node->identifier);
+    visit0(node->signature);
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(ParametricFunDeclaration* node) {
+    visit0(node->identifier);
+    visit0(node->signature);
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(QualifiedTerm* node) {
+    visit0(node->identifier);
+    visit0(node->terms);
+}
+
+void DummyRawVisitor0::visit(LetTerm* node) {
+    visit0(node->bindings);
+    visit0(node->term);
+}
+
+void DummyRawVisitor0::visit(ForallTerm* node) {
+    visit0(node->bindings);
+    visit0(node->term);
+}
+
+void DummyRawVisitor0::visit(ExistsTerm* node) {
+    visit0(node->bindings);
+    visit0(node->term);
+}
+
+void DummyRawVisitor0::visit(MatchTerm* node) {
+    visit0(node->term);
+    visit0(node->cases);
+}
+
+void DummyRawVisitor0::visit(AnnotatedTerm* node) {
+    visit0(node->term);
+    visit0(node->attributes);
+}
+
+void DummyRawVisitor0::visit(TrueTerm* node) {}
+
+void DummyRawVisitor0::visit(FalseTerm* node) {}
+
+void DummyRawVisitor0::visit(NotTerm* node) {
+    visit0(node->term);
+}
+
+void DummyRawVisitor0::visit(ImpliesTerm* node) {
+    visit0(node->terms);
+}
+
+void DummyRawVisitor0::visit(AndTerm* node) {
+    visit0(node->terms);
+}
+
+void DummyRawVisitor0::visit(OrTerm* node) {
+    visit0(node->terms);
+}
+
+void DummyRawVisitor0::visit(XorTerm* node) {
+    visit0(node->terms);
+}
+
+void DummyRawVisitor0::visit(EqualsTerm* node) {
+    visit0(node->terms);
+}
+
+void DummyRawVisitor0::visit(DistinctTerm* node) {
+    visit0(node->terms);
+}
+
+void DummyRawVisitor0::visit(IteTerm* node) {
+    visit0(node->testTerm);
+    visit0(node->thenTerm);
+    visit0(node->elseTerm);
+}
+
+void DummyRawVisitor0::visit(EmpTerm* node) {}
+
+void DummyRawVisitor0::visit(SepTerm* node) {
+    visit0(node->terms);
+}
+
+void DummyRawVisitor0::visit(WandTerm* node) {
+    visit0(node->terms);
+}
+
+void DummyRawVisitor0::visit(PtoTerm* node) {
+    visit0(node->leftTerm);
+    visit0(node->rightTerm);
+}
+
+void DummyRawVisitor0::visit(NilTerm* node) {
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(SortedVariable* node) {
+    visit0(node->sort);
+}
+
+void DummyRawVisitor0::visit(VariableBinding* node) {
+    visit0(node->term);
+}
@@ -261,6 +261,264 @@ namespace smtlib {
             void visit(const SortedVariablePtr& node) override;
             void visit(const VariableBindingPtr& node) override;
         };
+
+        /* =================================== RawVisitor0 ==================================== */
+        /**
+         * A visitor for the smtlib::sep hierarchy that does not share ownership of the nodes it visits.
+         * Nodes are passed as raw pointers, so visiting them does not touch their reference counts.
+         * The nodes must be kept alive by their owners while they are being visited
+         */
+        class RawVisitor0 {
+        protected:
+            virtual void visit0(Node* node);
+
+            template<class T>
+            void visit0(const std::shared_ptr<T>& node) {
+                visit0(static_cast<Node*>(node.get()));
+            }
+
+            template<class T>
+            void visit0(const std::vector<std::shared_ptr<T>>& arr) {
+                for (const auto& item : arr) {
+                    visit0(item);
+                }
+            }
+
+            template<class T1, class T2>
+            void visit0(const std::vector<std::pair<std::shared_ptr<T1>, std::shared_ptr<T2>>>& arr) {
+                for (const auto& pair : arr) {
+                    visit0(pair.first);
+                    visit0(pair.second);
+                }
+            }
+        public:
+            virtual void visit(SimpleAttribute* node) = 0;
+            virtual void visit(SExpressionAttribute* node) = 0;
+            virtual void visit(SymbolAttribute* node) = 0;
+            virtual void visit(BooleanAttribute* node) = 0;
+            virtual void visit(NumeralAttribute* node) = 0;
+            virtual void visit(DecimalAttribute* node) = 0;
+            virtual void visit(StringAttribute* node) = 0;
+            virtual void visit(TheoriesAttribute* node) = 0;
+            virtual void visit(SortsAttribute* node) = 0;
+            virtual void visit(FunsAttribute* node) = 0;
+
+            virtual void visit(Symbol* node) = 0;
+            virtual void visit(Keyword* node) = 0;
+            virtual void visit(MetaSpecConstant* node) = 0;
+            virtual void visit(BooleanValue* node) = 0;
+            virtual void visit(PropLiteral* node) = 0;
+
+            virtual void visit(AssertCommand* node) = 0;
+            virtual void visit(CheckSatCommand* node) = 0;
+            virtual void visit(CheckUnsatCommand* node) = 0;
+            virtual void visit(CheckSatAssumCommand* node) = 0;
+            virtual void visit(DeclareConstCommand* node) = 0;
+            virtual void visit(DeclareDatatypeCommand* node) = 0;
+            virtual void visit(DeclareDatatypesCommand* node) = 0;
+            virtual void visit(DeclareFunCommand* node) = 0;
+            virtual void visit(DeclareSortCommand* node) = 0;
+            virtual void visit(DeclareHeapCommand* node) = 0;
+            virtual void visit(DefineFunCommand* node) = 0;
+            virtual void visit(DefineFunRecCommand* node) = 0;
+            virtual void visit(DefineFunsRecCommand* node) = 0;
+            virtual void visit(DefineSortCommand* node) = 0;
+            virtual void visit(EchoCommand* node) = 0;
+            virtual void visit(ExitCommand* node) = 0;
+            virtual void visit(GetAssertsCommand* node) = 0;
+            virtual void visit(GetAssignsCommand* node) = 0;
+            virtual void visit(GetInfoCommand* node) = 0;
+            virtual void visit(GetModelCommand* node) = 0;
+            virtual void visit(GetOptionCommand* node) = 0;
+            virtual void visit(GetProofCommand* node) = 0;
+            virtual void visit(GetUnsatAssumsCommand* node) = 0;
+            virtual void visit(GetUnsatCoreCommand* node) = 0;
+            virtual void visit(GetValueCommand* node) = 0;
+            virtual void visit(PopCommand* node) = 0;
+            virtual void visit(PushCommand* node) = 0;
+            virtual void visit(ResetCommand* node) = 0;
+            virtual void visit(ResetAssertsCommand* node) = 0;
+            virtual void visit(SetInfoCommand* node) = 0;
+            virtual void visit(SetLogicCommand* node) = 0;
+            virtual void visit(SetOptionCommand* node) = 0;
+
+            virtual void visit(SortDeclaration* node) = 0;
+            virtual void visit(SelectorDeclaration* node) = 0;
+            virtual void visit(ConstructorDeclaration* node) = 0;
+            virtual void visit(SimpleDatatypeDeclaration* node) = 0;
+            virtual void visit(ParametricDatatypeDeclaration* node) = 0;
+
+            virtual void visit(FunctionDeclaration* node) = 0;
+            virtual void visit(FunctionDefinition* node) = 0;
+
+            virtual void visit(SimpleIdentifier* node) = 0;
+            virtual void visit(QualifiedIdentifier* node) = 0;
+
+            virtual void visit(NumeralLiteral* node) = 0;
+            virtual void visit(DecimalLiteral* node) = 0;
+            virtual void visit(StringLiteral* node) = 0;
+
+            virtual void visit(Logic* node) = 0;
+            virtual void visit(Theory* node) = 0;
+            virtual void visit(Script* node) = 0;
+
+            virtual void visit(QualifiedConstructor* node) = 0;
+            virtual void visit(QualifiedPattern* node) = 0;
+            virtual void visit(MatchCase* node) = 0;
+
+            virtual void visit(CompSExpression* node) = 0;
+
+            virtual void visit(Sort* node) = 0;
+
+            virtual void visit(SortSymbolDeclaration* node) = 0;
+            virtual void visit(SpecConstFunDeclaration* node) = 0;
+            virtual void visit(MetaSpecConstFunDeclaration* node) = 0;
+            virtual void visit(SimpleFunDeclaration* node) = 0;
+            virtual void visit(ParametricFunDeclaration* node) = 0;
+
+            virtual void visit(QualifiedTerm* node) = 0;
+            virtual void visit(LetTerm* node) = 0;
+            virtual void visit(ForallTerm* node) = 0;
+            virtual void visit(ExistsTerm* node) = 0;
+            virtual void visit(MatchTerm* node) = 0;
+            virtual void visit(AnnotatedTerm* node) = 0;
+
+            virtual void visit(TrueTerm* node) = 0;
+            virtual void visit(FalseTerm* node) = 0;
+            virtual void visit(NotTerm* node) = 0;
+            virtual void visit(ImpliesTerm* node) = 0;
+            virtual void visit(AndTerm* node) = 0;
+            virtual void visit(OrTerm* node) = 0;
+            virtual void visit(XorTerm* node) = 0;
+            virtual void visit(EqualsTerm* node) = 0;
+            virtual void visit(DistinctTerm* node) = 0;
+            virtual void visit(IteTerm* node) = 0;
+
+            virtual void visit(EmpTerm* node) = 0;
+            virtual void visit(SepTerm* node) = 0;
+            virtual void visit(WandTerm* node) = 0;
+            virtual void visit(PtoTerm* node) = 0;
+            virtual void visit(NilTerm* node) = 0;
+
+            virtual void visit(SortedVariable* node) = 0;
+            virtual void visit(VariableBinding* node) = 0;
+        };
+
+        /* ================================= DummyRawVisitor0 ================================= */
+        /** A dummy (empty) implementation of RawVisitor0 */
+        class DummyRawVisitor0 : public virtual RawVisitor0 {
+        public:
+            void visit(SimpleAttribute* node) override;
+            void visit(SExpressionAttribute* node) override;
+            void visit(SymbolAttribute* node) override;
+            void visit(BooleanAttribute* node) override;
+            void visit(NumeralAttribute* node) override;
+            void visit(DecimalAttribute* node) override;
+            void visit(StringAttribute* node) override;
+            void visit(TheoriesAttribute* node) override;
+            void visit(SortsAttribute* node) override;
+            void visit(FunsAttribute* node) override;
+
+            void visit(Symbol* node) override;
+            void visit(Keyword* node) override;
+            void visit(MetaSpecConstant* node) override;
+            void visit(BooleanValue* node) override;
+            void visit(PropLiteral* node) override;
+
+            void visit(AssertCommand* node) override;
+            void visit(CheckSatCommand* node) override;
+            void visit(CheckUnsatCommand* node) override;
+            void visit(CheckSatAssumCommand* node) override;
+            void visit(DeclareConstCommand* node) override;
+            void visit(DeclareDatatypeCommand* node) override;
+            void visit(DeclareDatatypesCommand* node) override;
+            void visit(DeclareFunCommand* node) override;
+            void visit(DeclareSortCommand* node) override;
+            void visit(DeclareHeapCommand* node) override;
+            void visit(DefineFunCommand* node) override;
+            void visit(DefineFunRecCommand* node) override;
+            void visit(DefineFunsRecCommand* node) override;
+            void visit(DefineSortCommand* node) override;
+            void visit(EchoCommand* node) override;
+            void visit(ExitCommand* node) override;
+            void visit(GetAssertsCommand* node) override;
+            void visit(GetAssignsCommand* node) override;
+            void visit(GetInfoCommand* node) override;
+            void visit(GetModelCommand* node) override;
+            void visit(GetOptionCommand* node) override;
+            void visit(GetProofCommand* node) override;
+            void visit(GetUnsatAssumsCommand* node) override;
+            void visit(GetUnsatCoreCommand* node) override;
+            void visit(GetValueCommand* node) override;
+            void visit(PopCommand* node) override;
+            void visit(PushCommand* node) override;
+            void visit(ResetCommand* node) override;
+            void visit(ResetAssertsCommand* node) override;
+            void visit(SetInfoCommand* node) override;
+            void visit(SetLogicCommand* node) override;
+            void visit(SetOptionCommand* node) override;
+
+            void visit(SortDeclaration* node) override;
+            void visit(SelectorDeclaration* node) override;
+            void visit(ConstructorDeclaration* node) override;
+            void visit(SimpleDatatypeDeclaration* node) override;
+            void visit(ParametricDatatypeDeclaration* node) override;
+
+            void visit(FunctionDeclaration* node) override;
+            void visit(FunctionDefinition* node) override;
+
+            void visit(SimpleIdentifier* node) override;
+            void visit(QualifiedIdentifier* node) override;
+
+            void visit(NumeralLiteral* node) override;
+            void visit(DecimalLiteral* node) override;
+            void visit(StringLiteral* node) override;
+
+            void visit(Logic* node) override;
+            void visit(Theory* node) override;
+            void visit(Script* node) override;
+
+            void visit(QualifiedConstructor* node) override;
+            void visit(QualifiedPattern* node) override;
+            void visit(MatchCase* node) override;
+
+            void visit(CompSExpression* node) override;
+
+            void visit(Sort* node) override;
+
+            void visit(SortSymbolDeclaration* node) override;
+            void visit(SpecConstFunDeclaration* node) override;
+            void visit(MetaSpecConstFunDeclaration* node) override;
+            void visit(SimpleFunDeclaration* node) override;
+            void visit(ParametricFunDeclaration* node) override;
+
+            void visit(QualifiedTerm* node) override;
+            void visit(LetTerm* node) override;
+            void visit(ForallTerm* node) override;
+            void visit(ExistsTerm* node) override;
+            void visit(MatchTerm* node) override;
+            void visit(AnnotatedTerm* node) override;
+
+            void visit(TrueTerm* node) override;
+            void visit(FalseTerm* node) override;
+            void visit(NotTerm* node) override;
+            void visit(ImpliesTerm* node) override;
+            void visit(AndTerm* node) override;
+            void visit(OrTerm* node) override;
+            void visit(XorTerm* node) override;
+            void visit(EqualsTerm* node) override;
+            void visit(DistinctTerm* node) override;
+            void visit(IteTerm* node) override;
+
+            void visit(EmpTerm* node) override;
+            void visit(SepTerm* node) override;
+            void visit(WandTerm* node) override;
+            void visit(PtoTerm* node) override;
+            void visit(NilTerm* node) override;
+
+            void visit(SortedVariable* node) override;
+            void visit(VariableBinding* node) override;
+        };
     }
 }
 
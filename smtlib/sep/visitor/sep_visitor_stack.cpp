@@ -23,13 +23,38 @@ void VisitorWithStack0::loadTheory(const string& theory) {
     FILE *f = fopen(path.c_str(), "r");
     if (f) {
         fclose(f);
+
+        // Without any declarations in the stack, loading the theory only depends on the mounted layers
+        FileTime time;
+        bool cacheable = stack->isEmpty() && getFileTime(path, time);
+
+        SymbolLayerCache::Entry cached;
+        if (cacheable && SymbolLayerCache::find(path, time, stack->getLayers(), cached)) {
+            for (const auto& layer : cached.layers) {
+                stack->mount(layer);
+            }
+            for (const auto& sources : cached.sourceMaps) {
+                stack->keepSourceMap(sources);
+            }
+            return;
+        }
+
         ParserPtr parser = make_shared<Parser>();
         TranslatorPtr translator = make_shared<Translator>();
 
         smtlib::ast::NodePtr ast = parser->parse(path);
-        if (auto theoryAst = dynamic_pointer_cast<smtlib::ast::Theory>(ast)) {
+        if (auto theoryAst = smtlib::ast::nodeCast<smtlib::ast::Theory>(ast)) {
             TheoryPtr theorySmt = translator->translate(theoryAst);
+            stack->keepSourceMap(parser->getSourceMap());
             visit0(theorySmt);
+
+            if (cacheable) {
+                SymbolLayerCache::Entry entry;
+                entry.bases = stack->getLayers();
+                entry.layers.push_back(stack->mountTopLevel());
+                entry.sourceMaps.push_back(parser->getSourceMap());
+                SymbolLayerCache::add(path, time, entry);
+            }
         }
     }
 }
@@ -41,44 +66,78 @@ void VisitorWithStack0::loadLogic(const string& logic) {
     if (f) {
         fclose(f);
 
+        FileTime time;
+        bool cacheable = stack->isEmpty() && currentTheories.empty() && getFileTime(path, time);
+
+        SymbolLayerCache::Entry cached;
+        if (cacheable && SymbolLayerCache::find(path, time, stack->getLayers(), cached)) {
+            for (const auto& layer : cached.layers) {
+                stack->mount(layer);
+            }
+            for (const auto& sources : cached.sourceMaps) {
+                stack->keepSourceMap(sources);
+            }
+            currentTheories = cached.theories;
+            return;
+        }
+
+        std::vector<SymbolTablePtr> bases = stack->getLayers();
+        size_t keptSourceMaps = stack->getSourceMaps().size();
+
         ParserPtr parser = make_shared<Parser>();
         TranslatorPtr translator = make_shared<Translator>();
 
         smtlib::ast::NodePtr ast = parser->parse(path);
-        if (auto logicAst = dynamic_pointer_cast<smtlib::ast::Logic>(ast)) {
+        if (auto logicAst = smtlib::ast::nodeCast<smtlib::ast::Logic>(ast)) {
             LogicPtr logicSmt = translator->translate(logicAst);
+            stack->keepSourceMap(parser->getSourceMap());
             visit0(logicSmt);
+
+            // Cache the logic only if all of its theories were loaded as layers
+            if (cacheable && stack->isEmpty()) {
+                std::vector<SymbolTablePtr> layers = stack->getLayers();
+
+                SymbolLayerCache::Entry entry;
+                entry.bases = bases;
+                entry.layers.assign(layers.begin() + bases.size(), layers.end());
+                entry.theories = currentTheories;
+
+                // Along with those of its theories
+                const std::vector<SourceMapPtr>& sourceMaps = stack->getSourceMaps();
+                entry.sourceMaps.assign(sourceMaps.begin() + keptSourceMaps, sourceMaps.end());
+                SymbolLayerCache::add(path, time, entry);
+            }
         }
     }
 }
 
-SortEntryPtr VisitorWithStack0::buildEntry(const SortSymbolDeclarationPtr& node) {
+SortEntryPtr VisitorWithStack0::buildEntry(SortSymbolDeclaration* node) {
     return make_shared<SortEntry>(node->identifier->toString(),
-                                  node->arity, node->attributes, node);
+                                  node->arity, node->attributes, node->shared_from_this());
 }
 
-SortEntryPtr VisitorWithStack0::buildEntry(const DeclareSortCommandPtr& node) {
-    return make_shared<SortEntry>(node->name, node->arity, node);
+SortEntryPtr VisitorWithStack0::buildEntry(DeclareSortCommand* node) {
+    return make_shared<SortEntry>(node->name, node->arity, node->shared_from_this());
 }
 
-SortEntryPtr VisitorWithStack0::buildEntry(const DefineSortCommandPtr& node) {
+SortEntryPtr VisitorWithStack0::buildEntry(DefineSortCommand* node) {
     return make_shared<SortEntry>(node->name, node->parameters.size(), node->parameters,
-                                  stack->expand(node->sort), node);
+                                  stack->expand(node->sort), node->shared_from_this());
 }
 
-FunEntryPtr VisitorWithStack0::buildEntry(const SpecConstFunDeclarationPtr& node) {
+FunEntryPtr VisitorWithStack0::buildEntry(SpecConstFunDeclaration* node) {
     std::vector<SortPtr> sig;
     sig.push_back(stack->expand(node->sort));
-    return make_shared<FunEntry>(node->constant->toString(), sig, node->attributes, node);
+    return make_shared<FunEntry>(node->constant->toString(), sig, node->attributes, node->shared_from_this());
 }
 
-FunEntryPtr VisitorWithStack0::buildEntry(const MetaSpecConstFunDeclarationPtr& node) {
+FunEntryPtr VisitorWithStack0::buildEntry(MetaSpecConstFunDeclaration* node) {
     std::vector<SortPtr> sig;
     sig.push_back(stack->expand(node->sort));
-    return make_shared<FunEntry>(node->constant->toString(), sig, node->attributes, node);
+    return make_shared<FunEntry>(node->constant->toString(), sig, node->attributes, node->shared_from_this());
 }
 
-FunEntryPtr VisitorWithStack0::buildEntry(const SimpleFunDeclarationPtr& node) {
+FunEntryPtr VisitorWithStack0::buildEntry(SimpleFunDeclaration* node) {
     std::vector<SortPtr> newsig;
 
     for (const auto& sort : node->signature) {
@@ -86,7 +145,7 @@ FunEntryPtr VisitorWithStack0::buildEntry(const SimpleFunDeclarationPtr& node) {
     }
 
     FunEntryPtr funEntry = make_shared<FunEntry>(node->identifier->toString(),
-                                                 newsig, node->attributes, node);
+                                                 newsig, node->attributes, node->shared_from_this());
 
     for (const auto& attr : node->attributes) {
         if (attr->toString() == KW_RIGHT_ASSOC) {
@@ -109,14 +168,14 @@ FunEntryPtr VisitorWithStack0::buildEntry(const SimpleFunDeclarationPtr& node) {
     return funEntry;
 }
 
-FunEntryPtr VisitorWithStack0::buildEntry(const ParametricFunDeclarationPtr& node) {
+FunEntryPtr VisitorWithStack0::buildEntry(ParametricFunDeclaration* node) {
     std::vector<SortPtr> newsig;
     for (const auto& sort : node->signature) {
         newsig.push_back(stack->expand(sort));
     }
 
     FunEntryPtr funEntry = make_shared<FunEntry>(node->identifier->toString(), newsig,
-                                                 node->parameters, node->attributes, node);
+                                                 node->parameters, node->attributes, node->shared_from_this());
 
     for (const auto& attr : node->attributes) {
         if (attr->toString() == KW_RIGHT_ASSOC) {
@@ -139,14 +198,14 @@ FunEntryPtr VisitorWithStack0::buildEntry(const ParametricFunDeclarationPtr& nod
     return funEntry;
 }
 
-FunEntryPtr VisitorWithStack0::buildEntry(const DeclareConstCommandPtr& node) {
+FunEntryPtr VisitorWithStack0::buildEntry(DeclareConstCommand* node) {
     std::vector<SortPtr> sig;
     sig.push_back(stack->expand(node->sort));
 
-    return make_shared<FunEntry>(node->name, sig, node);
+    return make_shared<FunEntry>(node->name, sig, node->shared_from_this());
 }
 
-FunEntryPtr VisitorWithStack0::buildEntry(const DeclareFunCommandPtr& node) {
+FunEntryPtr VisitorWithStack0::buildEntry(DeclareFunCommand* node) {
     std::vector<SortPtr> newsig;
 
     for (const auto& sort : node->parameters) {
@@ -156,10 +215,10 @@ FunEntryPtr VisitorWithStack0::buildEntry(const DeclareFunCommandPtr& node) {
     SortPtr retsort = stack->expand(node->sort);
     newsig.push_back(retsort);
 
-    return make_shared<FunEntry>(node->name, newsig, node);
+    return make_shared<FunEntry>(node->name, newsig, node->shared_from_this());
 }
 
-FunEntryPtr VisitorWithStack0::buildEntry(const DefineFunCommandPtr& node) {
+FunEntryPtr VisitorWithStack0::buildEntry(DefineFunCommand* node) {
     std::vector<SortPtr> newsig;
     for (const auto& param : node->definition->signature->parameters) {
         newsig.push_back(stack->expand(param->sort));
@@ -167,10 +226,10 @@ FunEntryPtr VisitorWithStack0::buildEntry(const DefineFunCommandPtr& node) {
     newsig.push_back(stack->expand(node->definition->signature->sort));
 
     return make_shared<FunEntry>(node->definition->signature->name,
-                                 newsig, node->definition->body, node);
+                                 newsig, node->definition->body, node->shared_from_this());
 }
 
-FunEntryPtr VisitorWithStack0::buildEntry(const DefineFunRecCommandPtr& node) {
+FunEntryPtr VisitorWithStack0::buildEntry(DefineFunRecCommand* node) {
     std::vector<SortPtr> newsig;
     for (const auto& param : node->definition->signature->parameters) {
         newsig.push_back(stack->expand(param->sort));
@@ -178,10 +237,10 @@ FunEntryPtr VisitorWithStack0::buildEntry(const DefineFunRecCommandPtr& node) {
     newsig.push_back(stack->expand(node->definition->signature->sort));
 
     return make_shared<FunEntry>(node->definition->signature->name,
-                                 newsig, node->definition->body, node);
+                                 newsig, node->definition->body, node->shared_from_this());
 }
 
-std::vector<FunEntryPtr> VisitorWithStack0::buildEntry(const DefineFunsRecCommandPtr& node) {
+std::vector<FunEntryPtr> VisitorWithStack0::buildEntry(DefineFunsRecCommand* node) {
     std::vector<FunEntryPtr> infos;
     for (size_t i = 0, sz = node->declarations.size(); i < sz; i++) {
         std::vector<SortPtr> newsig;
@@ -191,22 +250,22 @@ std::vector<FunEntryPtr> VisitorWithStack0::buildEntry(const DefineFunsRecComman
         newsig.push_back(stack->expand(node->declarations[i]->sort));
 
         infos.push_back(make_shared<FunEntry>(node->declarations[i]->name,
-                                              newsig, node->bodies[i], node));
+                                              newsig, node->bodies[i], node->shared_from_this()));
     }
 
     return infos;
 }
 
-DatatypeEntryPtr VisitorWithStack0::buildEntry(const DeclareDatatypeCommandPtr& node) {
+DatatypeEntryPtr VisitorWithStack0::buildEntry(DeclareDatatypeCommand* node) {
     string typeName = node->name;
-    DatatypeEntryPtr entry = make_shared<DatatypeEntry>(typeName, node);
+    DatatypeEntryPtr entry = make_shared<DatatypeEntry>(typeName, node->shared_from_this());
 
     ParametricDatatypeDeclarationPtr pdecl =
-            dynamic_pointer_cast<ParametricDatatypeDeclaration>(node->declaration);
+            nodeCast<ParametricDatatypeDeclaration>(node->declaration);
 
     if (pdecl) {
         // Add datatype (parametric) sort info
-        entry->sort = make_shared<SortEntry>(typeName, pdecl->parameters.size(), node);
+        entry->sort = make_shared<SortEntry>(typeName, pdecl->parameters.size(), node->shared_from_this());
 
         // Build a sort representing the datatype
         // (to be used in the signatures of the constructors and selectors)
@@ -234,24 +293,26 @@ DatatypeEntryPtr VisitorWithStack0::buildEntry(const DeclareDatatypeCommandPtr&
                 selSig.push_back(stack->expand(sel->sort));
 
                 // Add selector function info
-                entry->funs.push_back(make_shared<FunEntry>(selName, selSig, pdecl->parameters, node));
+                entry->funs.push_back(make_shared<FunEntry>(selName, selSig, pdecl->parameters,
+                                                            node->shared_from_this()));
             }
 
             // Add constructor function info
             consSig.push_back(typeSort);
-            entry->funs.push_back(make_shared<FunEntry>(consName, consSig, pdecl->parameters, node));
+            entry->funs.push_back(make_shared<FunEntry>(consName, consSig, pdecl->parameters,
+                                                        node->shared_from_this()));
         }
 
     } else {
         // Add datatype (non-parametric) sort info
-        entry->sort = make_shared<SortEntry>(typeName, 0, node);
+        entry->sort = make_shared<SortEntry>(typeName, 0, node->shared_from_this());
 
         // Build a sort representing the datatype (to be used in the signatures of the constructors and selectors)
         SortPtr typeSort = make_shared<Sort>(node->name);
         typeSort = stack->expand(typeSort);
 
         SimpleDatatypeDeclarationPtr sdecl =
-                dynamic_pointer_cast<SimpleDatatypeDeclaration>(node->declaration);
+                nodeCast<SimpleDatatypeDeclaration>(node->declaration);
 
         for (const auto& cons : sdecl->constructors) {
             // Start building function info for current constructor
@@ -270,28 +331,28 @@ DatatypeEntryPtr VisitorWithStack0::buildEntry(const DeclareDatatypeCommandPtr&
                 selSig.push_back(stack->expand(sel->sort));
 
                 // Add selector function info
-                entry->funs.push_back(make_shared<FunEntry>(selName, selSig, node));
+                entry->funs.push_back(make_shared<FunEntry>(selName, selSig, node->shared_from_this()));
             }
 
             // Add constructor function info
             consSig.push_back(typeSort);
-            entry->funs.push_back(make_shared<FunEntry>(consName, consSig, node));
+            entry->funs.push_back(make_shared<FunEntry>(consName, consSig, node->shared_from_this()));
         }
     }
 
     return entry;
 }
 
-std::vector<DatatypeEntryPtr> VisitorWithStack0::buildEntry(const DeclareDatatypesCommandPtr& node) {
+std::vector<DatatypeEntryPtr> VisitorWithStack0::buildEntry(DeclareDatatypesCommand* node) {
     std::vector<DatatypeEntryPtr> entries;
     std::vector<SortDeclarationPtr> datatypeSorts = node->sorts;
 
     for (const auto& sort : datatypeSorts) {
         // Create datatype entry
-        DatatypeEntryPtr entry = make_shared<DatatypeEntry>(sort->name, node);
+        DatatypeEntryPtr entry = make_shared<DatatypeEntry>(sort->name, node->shared_from_this());
 
         // Add datatype sort info
-        entry->sort = make_shared<SortEntry>(sort->name, (size_t) sort->arity, node);
+        entry->sort = make_shared<SortEntry>(sort->name, (size_t) sort->arity, node->shared_from_this());
 
         // Add new datatype entry to list
         entries.push_back(entry);
@@ -299,7 +360,7 @@ std::vector<DatatypeEntryPtr> VisitorWithStack0::buildEntry(const DeclareDatatyp
 
     for (size_t i = 0, sz = datatypeSorts.size(); i < sz; i++) {
         ParametricDatatypeDeclarationPtr pdecl =
-                dynamic_pointer_cast<ParametricDatatypeDeclaration>(node->declarations[i]);
+                nodeCast<ParametricDatatypeDeclaration>(node->declarations[i]);
         if (pdecl) {
             // Build a sort representing the datatype
             // (to be used in the signatures of the constructors and selectors)
@@ -326,12 +387,14 @@ std::vector<DatatypeEntryPtr> VisitorWithStack0::buildEntry(const DeclareDatatyp
                     selSig.push_back(stack->expand(sel->sort));
 
                     // Add selector function info
-                    entries[i]->funs.push_back(make_shared<FunEntry>(selName, selSig, pdecl->parameters, node));
+                    entries[i]->funs.push_back(make_shared<FunEntry>(selName, selSig, pdecl->parameters,
+                                                                     node->shared_from_this()));
                 }
 
                 // Add constructor function info
                 consSig.push_back(typeSort);
-                entries[i]->funs.push_back(make_shared<FunEntry>(consName, consSig, pdecl->parameters, node));
+                entries[i]->funs.push_back(make_shared<FunEntry>(consName, consSig, pdecl->parameters,
+                                                                 node->shared_from_this()));
             }
         } else {
             // Build a sort representing the datatype
@@ -341,7 +404,7 @@ std::vector<DatatypeEntryPtr> VisitorWithStack0::buildEntry(const DeclareDatatyp
             typeSort = stack->expand(typeSort);
 
             SimpleDatatypeDeclarationPtr sdecl =
-                    dynamic_pointer_cast<SimpleDatatypeDeclaration>(node->declarations[i]);
+                    nodeCast<SimpleDatatypeDeclaration>(node->declarations[i]);
 
             for (const auto& cons : sdecl->constructors) {
                 // Start building function info for current constructor
@@ -359,12 +422,12 @@ std::vector<DatatypeEntryPtr> VisitorWithStack0::buildEntry(const DeclareDatatyp
                     selSig.push_back(stack->expand(sel->sort));
 
                     // Add selector function info
-                    entries[i]->funs.push_back(make_shared<FunEntry>(selName, selSig, node));
+                    entries[i]->funs.push_back(make_shared<FunEntry>(selName, selSig, node->shared_from_this()));
                 }
 
                 // Add constructor function info
                 consSig.push_back(typeSort);
-                entries[i]->funs.push_back(make_shared<FunEntry>(consName, consSig, node));
+                entries[i]->funs.push_back(make_shared<FunEntry>(consName, consSig, node->shared_from_this()));
             }
         }
     }
@@ -373,93 +436,93 @@ std::vector<DatatypeEntryPtr> VisitorWithStack0::buildEntry(const DeclareDatatyp
 }
 
 
-void VisitorWithStack0::visit(const SimpleAttributePtr& node) {
+void VisitorWithStack0::visit(SimpleAttribute* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const SExpressionAttributePtr& node) {
+void VisitorWithStack0::visit(SExpressionAttribute* node) {
     visitWithStack(node);
     visit0(node->value);
 }
 
-void VisitorWithStack0::visit(const SymbolAttributePtr& node) {
+void VisitorWithStack0::visit(SymbolAttribute* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const BooleanAttributePtr& node) {
+void VisitorWithStack0::visit(BooleanAttribute* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const NumeralAttributePtr& node) {
+void VisitorWithStack0::visit(NumeralAttribute* node) {
     visitWithStack(node);
     visit0(node->value);
 }
 
-void VisitorWithStack0::visit(const DecimalAttributePtr& node) {
+void VisitorWithStack0::visit(DecimalAttribute* node) {
     visitWithStack(node);
     visit0(node->value);
 }
 
-void VisitorWithStack0::visit(const StringAttributePtr& node) {
+void VisitorWithStack0::visit(StringAttribute* node) {
     visitWithStack(node);
     visit0(node->value);
 }
 
-void VisitorWithStack0::visit(const TheoriesAttributePtr& node) {
+void VisitorWithStack0::visit(TheoriesAttribute* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const SortsAttributePtr& node) {
+void VisitorWithStack0::visit(SortsAttribute* node) {
     visitWithStack(node);
 
     visit0(node->declarations);
 }
 
-void VisitorWithStack0::visit(const FunsAttributePtr& node) {
+void VisitorWithStack0::visit(FunsAttribute* node) {
     visitWithStack(node);
 
     visit0(node->declarations);
 }
 
-void VisitorWithStack0::visit(const SymbolPtr& node) {
+void VisitorWithStack0::visit(Symbol* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const KeywordPtr& node) {
+void VisitorWithStack0::visit(Keyword* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const MetaSpecConstantPtr& node) {
+void VisitorWithStack0::visit(MetaSpecConstant* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const BooleanValuePtr& node) {
+void VisitorWithStack0::visit(BooleanValue* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const PropLiteralPtr& node) {
+void VisitorWithStack0::visit(PropLiteral* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const AssertCommandPtr& node) {
+void VisitorWithStack0::visit(AssertCommand* node) {
     visitWithStack(node);
     visit0(node->term);
 }
 
-void VisitorWithStack0::visit(const CheckSatCommandPtr& node) {
+void VisitorWithStack0::visit(CheckSatCommand* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const CheckUnsatCommandPtr& node) {
+void VisitorWithStack0::visit(CheckUnsatCommand* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const CheckSatAssumCommandPtr& node) {
+void VisitorWithStack0::visit(CheckSatAssumCommand* node) {
     visitWithStack(node);
     visit0(node->assumptions);
 }
 
-void VisitorWithStack0::visit(const DeclareConstCommandPtr& node) {
+void VisitorWithStack0::visit(DeclareConstCommand* node) {
     FunEntryPtr entry = buildEntry(node);
     stack->tryAdd(entry);
 
@@ -468,7 +531,7 @@ void VisitorWithStack0::visit(const DeclareConstCommandPtr& node) {
     visit0(node->sort);
 }
 
-void VisitorWithStack0::visit(const DeclareDatatypeCommandPtr& node) {
+void VisitorWithStack0::visit(DeclareDatatypeCommand* node) {
     DatatypeEntryPtr entry = buildEntry(node);
     stack->tryAdd(entry->sort);
 
@@ -481,7 +544,7 @@ void VisitorWithStack0::visit(const DeclareDatatypeCommandPtr& node) {
     visit0(node->declaration);
 }
 
-void VisitorWithStack0::visit(const DeclareDatatypesCommandPtr& node) {
+void VisitorWithStack0::visit(DeclareDatatypesCommand* node) {
     std::vector<DatatypeEntryPtr> entries = buildEntry(node);
     for (const auto& entry : entries) {
         stack->tryAdd(entry->sort);
@@ -497,7 +560,7 @@ void VisitorWithStack0::visit(const DeclareDatatypesCommandPtr& node) {
     visit0(node->declarations);
 }
 
-void VisitorWithStack0::visit(const DeclareFunCommandPtr& node) {
+void VisitorWithStack0::visit(DeclareFunCommand* node) {
     FunEntryPtr entry = buildEntry(node);
     stack->tryAdd(entry);
 
@@ -507,14 +570,14 @@ void VisitorWithStack0::visit(const DeclareFunCommandPtr& node) {
     visit0(node->sort);
 }
 
-void VisitorWithStack0::visit(const DeclareSortCommandPtr& node) {
+void VisitorWithStack0::visit(DeclareSortCommand* node) {
     SortEntryPtr entry = buildEntry(node);
     stack->tryAdd(entry);
 
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const DeclareHeapCommandPtr& node) {
+void VisitorWithStack0::visit(DeclareHeapCommand* node) {
     for(const auto& pair : node->locDataPairs) {
         stack->tryAdd(pair);
     }
@@ -524,7 +587,7 @@ void VisitorWithStack0::visit(const DeclareHeapCommandPtr& node) {
     visit0(node->locDataPairs);
 }
 
-void VisitorWithStack0::visit(const DefineFunCommandPtr& node) {
+void VisitorWithStack0::visit(DefineFunCommand* node) {
     FunEntryPtr entry = buildEntry(node);
     stack->tryAdd(entry);
 
@@ -534,7 +597,8 @@ void VisitorWithStack0::visit(const DefineFunCommandPtr& node) {
     stack->push();
 
     for(const auto& param : node->definition->signature->parameters) {
-        stack->tryAdd(make_shared<VarEntry>(param->name, std::move(stack->expand(param->sort)), node));
+        stack->tryAdd(make_shared<VarEntry>(param->name, std::move(stack->expand(param->sort)),
+                                            node->shared_from_this()));
     }
 
     visit0(node->definition);
@@ -543,7 +607,7 @@ void VisitorWithStack0::visit(const DefineFunCommandPtr& node) {
     stack->pop();
 }
 
-void VisitorWithStack0::visit(const DefineFunRecCommandPtr& node) {
+void VisitorWithStack0::visit(DefineFunRecCommand* node) {
     FunEntryPtr entry = buildEntry(node);
     stack->tryAdd(entry);
 
@@ -553,7 +617,8 @@ void VisitorWithStack0::visit(const DefineFunRecCommandPtr& node) {
     stack->push();
 
     for(const auto& param : node->definition->signature->parameters) {
-        stack->tryAdd(make_shared<VarEntry>(param->name, std::move(stack->expand(param->sort)), node));
+        stack->tryAdd(make_shared<VarEntry>(param->name, std::move(stack->expand(param->sort)),
+                                            node->shared_from_this()));
     }
 
     visit0(node->definition);
@@ -562,7 +627,7 @@ void VisitorWithStack0::visit(const DefineFunRecCommandPtr& node) {
     stack->pop();
 }
 
-void VisitorWithStack0::visit(const DefineFunsRecCommandPtr& node) {
+void VisitorWithStack0::visit(DefineFunsRecCommand* node) {
     std::vector<FunEntryPtr> entries = buildEntry(node);
     for (const auto& entry : entries) {
         stack->tryAdd(entry);
@@ -575,7 +640,8 @@ void VisitorWithStack0::visit(const DefineFunsRecCommandPtr& node) {
         stack->push();
 
         for(const auto& param : node->declarations[i]->parameters) {
-            stack->tryAdd(make_shared<VarEntry>(param->name, std::move(stack->expand(param->sort)), node));
+            stack->tryAdd(make_shared<VarEntry>(param->name, std::move(stack->expand(param->sort)),
+                                                node->shared_from_this()));
         }
 
         visit0(node->declarations[i]);
@@ -586,7 +652,7 @@ void VisitorWithStack0::visit(const DefineFunsRecCommandPtr& node) {
     }
 }
 
-void VisitorWithStack0::visit(const DefineSortCommandPtr& node) {
+void VisitorWithStack0::visit(DefineSortCommand* node) {
     SortEntryPtr entry = buildEntry(node);
     stack->tryAdd(entry);
 
@@ -595,64 +661,64 @@ void VisitorWithStack0::visit(const DefineSortCommandPtr& node) {
     visit0(node->sort);
 }
 
-void VisitorWithStack0::visit(const EchoCommandPtr& node) {
+void VisitorWithStack0::visit(EchoCommand* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const ExitCommandPtr& node) {
+void VisitorWithStack0::visit(ExitCommand* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const GetAssertsCommandPtr& node) {
+void VisitorWithStack0::visit(GetAssertsCommand* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const GetAssignsCommandPtr& node) {
+void VisitorWithStack0::visit(GetAssignsCommand* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const GetInfoCommandPtr& node) {
+void VisitorWithStack0::visit(GetInfoCommand* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const GetModelCommandPtr& node) {
+void VisitorWithStack0::visit(GetModelCommand* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const GetOptionCommandPtr& node) {
+void VisitorWithStack0::visit(GetOptionCommand* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const GetProofCommandPtr& node) {
+void VisitorWithStack0::visit(GetProofCommand* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const GetUnsatAssumsCommandPtr& node) {
+void VisitorWithStack0::visit(GetUnsatAssumsCommand* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const GetUnsatCoreCommandPtr& node) {
+void VisitorWithStack0::visit(GetUnsatCoreCommand* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const GetValueCommandPtr& node) {
+void VisitorWithStack0::visit(GetValueCommand* node) {
     visitWithStack(node);
     visit0(node->terms);
 }
 
-void VisitorWithStack0::visit(const PopCommandPtr& node) {
+void VisitorWithStack0::visit(PopCommand* node) {
     stack->pop((size_t) node->levelCount);
 
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const PushCommandPtr& node) {
+void VisitorWithStack0::visit(PushCommand* node) {
     stack->push((size_t) node->levelCount);
 
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const ResetCommandPtr& node) {
+void VisitorWithStack0::visit(ResetCommand* node) {
     stack->reset();
     currentLogic = "";
     currentTheories.clear();
@@ -660,16 +726,16 @@ void VisitorWithStack0::visit(const ResetCommandPtr& node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const ResetAssertsCommandPtr& node) {
+void VisitorWithStack0::visit(ResetAssertsCommand* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const SetInfoCommandPtr& node) {
+void VisitorWithStack0::visit(SetInfoCommand* node) {
     visitWithStack(node);
     visit0(node->info);
 }
 
-void VisitorWithStack0::visit(const SetLogicCommandPtr& node) {
+void VisitorWithStack0::visit(SetLogicCommand* node) {
     if (currentLogic.empty()) {
         currentLogic = node->logic;
         loadLogic(node->logic);
@@ -678,76 +744,76 @@ void VisitorWithStack0::visit(const SetLogicCommandPtr& node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const SetOptionCommandPtr& node) {
+void VisitorWithStack0::visit(SetOptionCommand* node) {
     visitWithStack(node);
     visit0(node->option);
 }
 
-void VisitorWithStack0::visit(const SortDeclarationPtr& node) {
+void VisitorWithStack0::visit(SortDeclaration* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const SelectorDeclarationPtr& node) {
+void VisitorWithStack0::visit(SelectorDeclaration* node) {
     visitWithStack(node);
     visit0(node->sort);
 }
 
-void VisitorWithStack0::visit(const ConstructorDeclarationPtr& node) {
+void VisitorWithStack0::visit(ConstructorDeclaration* node) {
     visitWithStack(node);
     visit0(node->selectors);
 }
 
-void VisitorWithStack0::visit(const SimpleDatatypeDeclarationPtr& node) {
+void VisitorWithStack0::visit(SimpleDatatypeDeclaration* node) {
     visitWithStack(node);
     visit0(node->constructors);
 }
 
-void VisitorWithStack0::visit(const ParametricDatatypeDeclarationPtr& node) {
+void VisitorWithStack0::visit(ParametricDatatypeDeclaration* node) {
     visitWithStack(node);
     visit0(node->constructors);
 }
 
-void VisitorWithStack0::visit(const FunctionDeclarationPtr& node) {
+void VisitorWithStack0::visit(FunctionDeclaration* node) {
     visitWithStack(node);
 
     visit0(node->parameters);
     visit0(node->sort);
 }
 
-void VisitorWithStack0::visit(const FunctionDefinitionPtr& node) {
+void VisitorWithStack0::visit(FunctionDefinition* node) {
     visitWithStack(node);
 
     visit0(node->signature);
     visit0(node->body);
 }
 
-void VisitorWithStack0::visit(const SimpleIdentifierPtr& node) {
+void VisitorWithStack0::visit(SimpleIdentifier* node) {
     visitWithStack(node);
     visit0(node->indices);
 }
 
-void VisitorWithStack0::visit(const QualifiedIdentifierPtr& node) {
+void VisitorWithStack0::visit(QualifiedIdentifier* node) {
     visitWithStack(node);
 
     visit0(node->identifier);
     visit0(node->sort);
 }
 
-void VisitorWithStack0::visit(const NumeralLiteralPtr& node) {
+void VisitorWithStack0::visit(NumeralLiteral* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const DecimalLiteralPtr& node) {
+void VisitorWithStack0::visit(DecimalLiteral* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const StringLiteralPtr& node) {
+void VisitorWithStack0::visit(StringLiteral* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const LogicPtr& node) {
+void VisitorWithStack0::visit(Logic* node) {
     for (const auto& attr : node->attributes) {
-        if (auto theoriesAttr = dynamic_pointer_cast<TheoriesAttribute>(attr)) {
+        if (auto theoriesAttr = nodeCast<TheoriesAttribute>(attr)) {
             for (const auto& theory : theoriesAttr->theories) {
                 auto found = find(currentTheories.begin(), currentTheories.end(), theory);
 
@@ -764,56 +830,56 @@ void VisitorWithStack0::visit(const LogicPtr& node) {
     visit0(node->attributes);
 }
 
-void VisitorWithStack0::visit(const TheoryPtr& node) {
+void VisitorWithStack0::visit(Theory* node) {
     visitWithStack(node);
 
     for (const auto& attr : node->attributes) {
-        if (auto sortsAttr = dynamic_pointer_cast<SortsAttribute>(attr)) {
+        if (auto sortsAttr = nodeCast<SortsAttribute>(attr)) {
             visit0(sortsAttr);
         }
 
-        if (auto funsAttr = dynamic_pointer_cast<FunsAttribute>(attr)) {
+        if (auto funsAttr = nodeCast<FunsAttribute>(attr)) {
             visit0(funsAttr);
         }
     }
 }
 
-void VisitorWithStack0::visit(const ScriptPtr& node) {
+void VisitorWithStack0::visit(Script* node) {
     visitWithStack(node);
 
     visit0(node->commands);
 }
 
-void VisitorWithStack0::visit(const QualifiedConstructorPtr& node) {
+void VisitorWithStack0::visit(QualifiedConstructor* node) {
     visitWithStack(node);
     visit0(node->sort);
 }
 
-void VisitorWithStack0::visit(const QualifiedPatternPtr& node) {
+void VisitorWithStack0::visit(QualifiedPattern* node) {
     visitWithStack(node);
     visit0(node->constructor);
 }
 
-void VisitorWithStack0::visit(const MatchCasePtr& node) {
+void VisitorWithStack0::visit(MatchCase* node) {
     visitWithStack(node);
 
     visit0(node->pattern);
     visit0(node->term);
 }
 
-void VisitorWithStack0::visit(const CompSExpressionPtr& node) {
+void VisitorWithStack0::visit(CompSExpression* node) {
     visitWithStack(node);
 
     visit0(node->expressions);
 }
 
-void VisitorWithStack0::visit(const SortPtr& node) {
+void VisitorWithStack0::visit(Sort* node) {
     visitWithStack(node);
 
     visit0(node->arguments);
 }
 
-void VisitorWithStack0::visit(const SortSymbolDeclarationPtr& node) {
+void VisitorWithStack0::visit(SortSymbolDeclaration* node) {
     SortEntryPtr entry = buildEntry(node);
     stack->tryAdd(entry);
 
@@ -823,7 +889,7 @@ void VisitorWithStack0::visit(const SortSymbolDeclarationPtr& node) {
     visit0(node->attributes);
 }
 
-void VisitorWithStack0::visit(const SpecConstFunDeclarationPtr& node) {
+void VisitorWithStack0::visit(SpecConstFunDeclaration* node) {
     FunEntryPtr entry = buildEntry(node);
     stack->tryAdd(entry);
 
@@ -834,7 +900,7 @@ void VisitorWithStack0::visit(const SpecConstFunDeclarationPtr& node) {
     visit0(node->attributes);
 }
 
-void VisitorWithStack0::visit(const MetaSpecConstFunDeclarationPtr& node) {
+void VisitorWithStack0::visit(MetaSpecConstFunDeclaration* node) {
     FunEntryPtr entry = buildEntry(node);
     stack->tryAdd(entry);
 
@@ -845,7 +911,7 @@ void VisitorWithStack0::visit(const MetaSpecConstFunDeclarationPtr& node) {
     visit0(node->attributes);
 }
 
-void VisitorWithStack0::visit(const SimpleFunDeclarationPtr& node) {
+void VisitorWithStack0::visit(SimpleFunDeclaration* node) {
     FunEntryPtr entry = buildEntry(node);
     stack->tryAdd(entry);
 
@@ -856,7 +922,7 @@ void VisitorWithStack0::visit(const SimpleFunDeclarationPtr& node) {
     visit0(node->attributes);
 }
 
-void VisitorWithStack0::visit(const ParametricFunDeclarationPtr& node) {
+void VisitorWithStack0::visit(ParametricFunDeclaration* node) {
     FunEntryPtr entry = buildEntry(node);
     stack->tryAdd(entry);
 
@@ -867,14 +933,14 @@ void VisitorWithStack0::visit(const ParametricFunDeclarationPtr& node) {
     visit0(node->attributes);
 }
 
-void VisitorWithStack0::visit(const QualifiedTermPtr& node) {
+void VisitorWithStack0::visit(QualifiedTerm* node) {
     visitWithStack(node);
 
     visit0(node->identifier);
     visit0(node->terms);
 }
 
-void VisitorWithStack0::visit(const LetTermPtr& node) {
+void VisitorWithStack0::visit(LetTerm* node) {
     visitWithStack(node);
 
     // New stack level for bindings
@@ -885,7 +951,7 @@ void VisitorWithStack0::visit(const LetTermPtr& node) {
         TermSorterPtr sorter = make_shared<TermSorter>(ctx);
 
         SortPtr result = sorter->run(binding->term);
-        stack->tryAdd(make_shared<VarEntry>(binding->name, result, node));
+        stack->tryAdd(make_shared<VarEntry>(binding->name, result, node->shared_from_this()));
     }
 
     visit0(node->bindings);
@@ -895,14 +961,15 @@ void VisitorWithStack0::visit(const LetTermPtr& node) {
     stack->pop();
 }
 
-void VisitorWithStack0::visit(const ForallTermPtr& node) {
+void VisitorWithStack0::visit(ForallTerm* node) {
     visitWithStack(node);
 
     // New stack level for bindings
     stack->push();
 
     for (const auto& bind : node->bindings) {
-        stack->tryAdd(make_shared<VarEntry>(bind->name, std::move(stack->expand(bind->sort)), node));
+        stack->tryAdd(make_shared<VarEntry>(bind->name, std::move(stack->expand(bind->sort)),
+                                            node->shared_from_this()));
     }
 
     visit0(node->bindings);
@@ -912,14 +979,15 @@ void VisitorWithStack0::visit(const ForallTermPtr& node) {
     stack->pop();
 }
 
-void VisitorWithStack0::visit(const ExistsTermPtr& node) {
+void VisitorWithStack0::visit(ExistsTerm* node) {
     visitWithStack(node);
 
     // New stack level for bindings
     stack->push();
 
     for (const auto& bind : node->bindings) {
-        stack->tryAdd(make_shared<VarEntry>(bind->name, std::move(stack->expand(bind->sort)), node));
+        stack->tryAdd(make_shared<VarEntry>(bind->name, std::move(stack->expand(bind->sort)),
+                                            node->shared_from_this()));
     }
 
     visit0(node->bindings);
@@ -929,71 +997,71 @@ void VisitorWithStack0::visit(const ExistsTermPtr& node) {
     stack->pop();
 }
 
-void VisitorWithStack0::visit(const MatchTermPtr& node) {
+void VisitorWithStack0::visit(MatchTerm* node) {
     visitWithStack(node);
 
     visit0(node->term);
     visit0(node->cases);
 }
 
-void VisitorWithStack0::visit(const AnnotatedTermPtr& node) {
+void VisitorWithStack0::visit(AnnotatedTerm* node) {
     visitWithStack(node);
 
     visit0(node->term);
     visit0(node->attributes);
 }
 
-void VisitorWithStack0::visit(const TrueTermPtr& node) {
+void VisitorWithStack0::visit(TrueTerm* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const FalseTermPtr& node) {
+void VisitorWithStack0::visit(FalseTerm* node) {
     visitWithStack(node);
 }
 
-void VisitorWithStack0::visit(const NotTermPtr& node) {
+void VisitorWithStack0::visit(NotTerm* node) {
     visitWithStack(node);
 
     visit0(node->term);
 }
 
-void VisitorWithStack0::visit(const ImpliesTermPtr& node) {
+void VisitorWithStack0::visit(ImpliesTerm* node) {
     visitWithStack(node);
 
     visit0(node->terms);
 }
 
-void VisitorWithStack0::visit(const AndTermPtr& node) {
+void VisitorWithStack0::visit(AndTerm* node) {
     visitWithStack(node);
 
     visit0(node->terms);
 }
 
-void VisitorWithStack0::visit(const OrTermPtr& node) {
+void VisitorWithStack0::visit(OrTerm* node) {
     visitWithStack(node);
 
     visit0(node->terms);
 }
 
-void VisitorWithStack0::visit(const XorTermPtr& node) {
+void VisitorWithStack0::visit(XorTerm* node) {
     visitWithStack(node);
 
     visit0(node->terms);
 }
 
-void VisitorWithStack0::visit(const EqualsTermPtr& node) {
+void VisitorWithStack0::visit(EqualsTerm* node) {
     visitWithStack(node);
 
     visit0(node->terms);
 }
 
-void VisitorWithStack0::visit(const DistinctTermPtr& node) {
+void VisitorWithStack0::visit(DistinctTerm* node) {
     visitWithStack(node);
 
     visit0(node->terms);
 }
 
-void VisitorWithStack0::visit(const IteTermPtr& node) {
+void VisitorWithStack0::visit(IteTerm* node) {
     visitWithStack(node);
 
     visit0(node->testTerm);
@@ -1001,7 +1069,7 @@ void VisitorWithStack0::visit(const IteTermPtr& node) {
     visit0(node->elseTerm);
 }
 
-void VisitorWithStack0::visit(const EmpTermPtr& node) {
+void VisitorWithStack0::visit(EmpTerm* node) {
     visitWithStack(node);
 
     if(node->dataSort)
@@ -1011,38 +1079,38 @@ void VisitorWithStack0::visit(const EmpTermPtr& node) {
         visit0(node->locSort);
 }
 
-void VisitorWithStack0::visit(const SepTermPtr& node) {
+void VisitorWithStack0::visit(SepTerm* node) {
     visitWithStack(node);
 
     visit0(node->terms);
 }
 
-void VisitorWithStack0::visit(const WandTermPtr& node) {
+void VisitorWithStack0::visit(WandTerm* node) {
     visitWithStack(node);
 
     visit0(node->terms);
 }
 
-void VisitorWithStack0::visit(const PtoTermPtr& node) {
+void VisitorWithStack0::visit(PtoTerm* node) {
     visitWithStack(node);
 
     visit0(node->leftTerm);
     visit0(node->rightTerm);
 }
 
-void VisitorWithStack0::visit(const NilTermPtr& node) {
+void VisitorWithStack0::visit(NilTerm* node) {
     visitWithStack(node);
 
     visit0(node->sort);
 }
 
-void VisitorWithStack0::visit(const SortedVariablePtr& node) {
+void VisitorWithStack0::visit(SortedVariable* node) {
     visitWithStack(node);
 
     visit0(node->sort);
 }
 
-void VisitorWithStack0::visit(const VariableBindingPtr& node) {
+void VisitorWithStack0::visit(VariableBinding* node) {
     visitWithStack(node);
 
     visit0(node->term);
@@ -1050,113 +1118,113 @@ void VisitorWithStack0::visit(const VariableBindingPtr& node) {
 
 /* ============================== DummyVisitorWithStack0 ============================== */
 
-void DummyVisitorWithStack0::visitWithStack(const SimpleAttributePtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const SExpressionAttributePtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const SymbolAttributePtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const BooleanAttributePtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const NumeralAttributePtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const DecimalAttributePtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const StringAttributePtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const TheoriesAttributePtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const SortsAttributePtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const FunsAttributePtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const SymbolPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const KeywordPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const MetaSpecConstantPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const BooleanValuePtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const PropLiteralPtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const AssertCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const CheckSatCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const CheckUnsatCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const CheckSatAssumCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const DeclareConstCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const DeclareDatatypeCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const DeclareDatatypesCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const DeclareFunCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const DeclareSortCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const DeclareHeapCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const DefineFunCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const DefineFunRecCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const DefineFunsRecCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const DefineSortCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const EchoCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const ExitCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const GetAssertsCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const GetAssignsCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const GetInfoCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const GetModelCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const GetOptionCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const GetProofCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const GetUnsatAssumsCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const GetUnsatCoreCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const GetValueCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const PopCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const PushCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const ResetCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const ResetAssertsCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const SetInfoCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const SetLogicCommandPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const SetOptionCommandPtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const SortDeclarationPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const SelectorDeclarationPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const ConstructorDeclarationPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const SimpleDatatypeDeclarationPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const ParametricDatatypeDeclarationPtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const FunctionDeclarationPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const FunctionDefinitionPtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const SimpleIdentifierPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const QualifiedIdentifierPtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const NumeralLiteralPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const DecimalLiteralPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const StringLiteralPtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const LogicPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const TheoryPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const ScriptPtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const QualifiedConstructorPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const QualifiedPatternPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const MatchCasePtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const CompSExpressionPtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const SortPtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const SortSymbolDeclarationPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const SpecConstFunDeclarationPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const MetaSpecConstFunDeclarationPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const SimpleFunDeclarationPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const ParametricFunDeclarationPtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const QualifiedTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const LetTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const ForallTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const ExistsTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const MatchTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const AnnotatedTermPtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const TrueTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const FalseTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const NotTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const ImpliesTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const AndTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const OrTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const XorTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const EqualsTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const DistinctTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const IteTermPtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const EmpTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const SepTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const WandTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const PtoTermPtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const NilTermPtr& node) {}
-
-void DummyVisitorWithStack0::visitWithStack(const SortedVariablePtr& node) {}
-void DummyVisitorWithStack0::visitWithStack(const VariableBindingPtr& node) {}
+void DummyVisitorWithStack0::visitWithStack(SimpleAttribute* node) {}
+void DummyVisitorWithStack0::visitWithStack(SExpressionAttribute* node) {}
+void DummyVisitorWithStack0::visitWithStack(SymbolAttribute* node) {}
+void DummyVisitorWithStack0::visitWithStack(BooleanAttribute* node) {}
+void DummyVisitorWithStack0::visitWithStack(NumeralAttribute* node) {}
+void DummyVisitorWithStack0::visitWithStack(DecimalAttribute* node) {}
+void DummyVisitorWithStack0::visitWithStack(StringAttribute* node) {}
+void DummyVisitorWithStack0::visitWithStack(TheoriesAttribute* node) {}
+void DummyVisitorWithStack0::visitWithStack(SortsAttribute* node) {}
+void DummyVisitorWithStack0::visitWithStack(FunsAttribute* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(Symbol* node) {}
+void DummyVisitorWithStack0::visitWithStack(Keyword* node) {}
+void DummyVisitorWithStack0::visitWithStack(MetaSpecConstant* node) {}
+void DummyVisitorWithStack0::visitWithStack(BooleanValue* node) {}
+void DummyVisitorWithStack0::visitWithStack(PropLiteral* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(AssertCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(CheckSatCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(CheckUnsatCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(CheckSatAssumCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(DeclareConstCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(DeclareDatatypeCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(DeclareDatatypesCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(DeclareFunCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(DeclareSortCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(DeclareHeapCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(DefineFunCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(DefineFunRecCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(DefineFunsRecCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(DefineSortCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(EchoCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(ExitCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(GetAssertsCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(GetAssignsCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(GetInfoCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(GetModelCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(GetOptionCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(GetProofCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(GetUnsatAssumsCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(GetUnsatCoreCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(GetValueCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(PopCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(PushCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(ResetCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(ResetAssertsCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(SetInfoCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(SetLogicCommand* node) {}
+void DummyVisitorWithStack0::visitWithStack(SetOptionCommand* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(SortDeclaration* node) {}
+void DummyVisitorWithStack0::visitWithStack(SelectorDeclaration* node) {}
+void DummyVisitorWithStack0::visitWithStack(ConstructorDeclaration* node) {}
+void DummyVisitorWithStack0::visitWithStack(SimpleDatatypeDeclaration* node) {}
+void DummyVisitorWithStack0::visitWithStack(ParametricDatatypeDeclaration* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(FunctionDeclaration* node) {}
+void DummyVisitorWithStack0::visitWithStack(FunctionDefinition* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(SimpleIdentifier* node) {}
+void DummyVisitorWithStack0::visitWithStack(QualifiedIdentifier* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(NumeralLiteral* node) {}
+void DummyVisitorWithStack0::visitWithStack(DecimalLiteral* node) {}
+void DummyVisitorWithStack0::visitWithStack(StringLiteral* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(Logic* node) {}
+void DummyVisitorWithStack0::visitWithStack(Theory* node) {}
+void DummyVisitorWithStack0::visitWithStack(Script* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(QualifiedConstructor* node) {}
+void DummyVisitorWithStack0::visitWithStack(QualifiedPattern* node) {}
+void DummyVisitorWithStack0::visitWithStack(MatchCase* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(CompSExpression* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(Sort* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(SortSymbolDeclaration* node) {}
+void DummyVisitorWithStack0::visitWithStack(SpecConstFunDeclaration* node) {}
+void DummyVisitorWithStack0::visitWithStack(MetaSpecConstFunDeclaration* node) {}
+void DummyVisitorWithStack0::visitWithStack(SimpleFunDeclaration* node) {}
+void DummyVisitorWithStack0::visitWithStack(ParametricFunDeclaration* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(QualifiedTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(LetTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(ForallTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(ExistsTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(MatchTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(AnnotatedTerm* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(TrueTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(FalseTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(NotTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(ImpliesTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(AndTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(OrTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(XorTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(EqualsTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(DistinctTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(IteTerm* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(EmpTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(SepTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(WandTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(PtoTerm* node) {}
+void DummyVisitorWithStack0::visitWithStack(NilTerm* node) {}
+
+void DummyVisitorWithStack0::visitWithStack(SortedVariable* node) {}
+void DummyVisitorWithStack0::visitWithStack(VariableBinding* node) {}
@@ -16,31 +16,31 @@ namespace smtlib {
          * The regular `visit()` methods build the stack and are final.
          * When inheriting, add functionality by overriding the `visitWithStack()` methods.
          */
-        class VisitorWithStack0 : public virtual Visitor0 {
+        class VisitorWithStack0 : public virtual RawVisitor0 {
         protected:
             SymbolStackPtr stack;
             std::vector<std::string> currentTheories;
             std::string currentLogic;
             ConfigurationPtr config;
 
-            SortEntryPtr buildEntry(const SortSymbolDeclarationPtr& node);
-            SortEntryPtr buildEntry(const DeclareSortCommandPtr& node);
-            SortEntryPtr buildEntry(const DefineSortCommandPtr& node);
+            SortEntryPtr buildEntry(SortSymbolDeclaration* node);
+            SortEntryPtr buildEntry(DeclareSortCommand* node);
+            SortEntryPtr buildEntry(DefineSortCommand* node);
 
-            FunEntryPtr buildEntry(const SpecConstFunDeclarationPtr& node);
-            FunEntryPtr buildEntry(const MetaSpecConstFunDeclarationPtr& node);
-            FunEntryPtr buildEntry(const SimpleFunDeclarationPtr& node);
-            FunEntryPtr buildEntry(const ParametricFunDeclarationPtr& node);
+            FunEntryPtr buildEntry(SpecConstFunDeclaration* node);
+            FunEntryPtr buildEntry(MetaSpecConstFunDeclaration* node);
+            FunEntryPtr buildEntry(SimpleFunDeclaration* node);
+            FunEntryPtr buildEntry(ParametricFunDeclaration* node);
 
-            FunEntryPtr buildEntry(const DeclareConstCommandPtr& node);
-            FunEntryPtr buildEntry(const DeclareFunCommandPtr& node);
-            FunEntryPtr buildEntry(const DefineFunCommandPtr& node);
-            FunEntryPtr buildEntry(const DefineFunRecCommandPtr& node);
+            FunEntryPtr buildEntry(DeclareConstCommand* node);
+            FunEntryPtr buildEntry(DeclareFunCommand* node);
+            FunEntryPtr buildEntry(DefineFunCommand* node);
+            FunEntryPtr buildEntry(DefineFunRecCommand* node);
 
-            std::vector<FunEntryPtr> buildEntry(const DefineFunsRecCommandPtr& node);
+            std::vector<FunEntryPtr> buildEntry(DefineFunsRecCommand* node);
 
-            DatatypeEntryPtr buildEntry(const DeclareDatatypeCommandPtr& node);
-            std::vector<DatatypeEntryPtr> buildEntry(const DeclareDatatypesCommandPtr& node);
+            DatatypeEntryPtr buildEntry(DeclareDatatypeCommand* node);
+            std::vector<DatatypeEntryPtr> buildEntry(DeclareDatatypesCommand* node);
 
             void loadTheory(const std::string& theory);
             void loadLogic(const std::string& logic);
@@ -49,227 +49,230 @@ namespace smtlib {
                     : stack(std::make_shared<SymbolStack>())
                     , config(std::make_shared<Configuration>()) {}
 
-            void visit(const SimpleAttributePtr& node) final;
-            void visit(const SExpressionAttributePtr& node) final;
-            void visit(const SymbolAttributePtr& node) final;
-            void visit(const BooleanAttributePtr& node) final;
-            void visit(const NumeralAttributePtr& node) final;
-            void visit(const DecimalAttributePtr& node) final;
-            void visit(const StringAttributePtr& node) final;
-            void visit(const TheoriesAttributePtr& node) final;
-            void visit(const SortsAttributePtr& node) final;
-            void visit(const FunsAttributePtr& node) final;
-
-            void visit(const SymbolPtr& node) final;
-            void visit(const KeywordPtr& node) final;
-            void visit(const MetaSpecConstantPtr& node) final;
-            void visit(const BooleanValuePtr& node) final;
-            void visit(const PropLiteralPtr& node) final;
-
-            void visit(const AssertCommandPtr& node) final;
-            void visit(const CheckSatCommandPtr& node) final;
-            void visit(const CheckUnsatCommandPtr& node) final;
-            void visit(const CheckSatAssumCommandPtr& node) final;
-            void visit(const DeclareConstCommandPtr& node) final;
-            void visit(const DeclareDatatypeCommandPtr& node) final;
-            void visit(const DeclareDatatypesCommandPtr& node) final;
-            void visit(const DeclareFunCommandPtr& node) final;
-            void visit(const DeclareSortCommandPtr& node) final;
-            void visit(const DeclareHeapCommandPtr& node) final;
-            void visit(const DefineFunCommandPtr& node) final;
-            void visit(const DefineFunRecCommandPtr& node) final;
-            void visit(const DefineFunsRecCommandPtr& node) final;
-            void visit(const DefineSortCommandPtr& node) final;
-            void visit(const EchoCommandPtr& node) final;
-            void visit(const ExitCommandPtr& node) final;
-            void visit(const GetAssertsCommandPtr& node) final;
-            void visit(const GetAssignsCommandPtr& node) final;
-            void visit(const GetInfoCommandPtr& node) final;
-            void visit(const GetModelCommandPtr& node) final;
-            void visit(const GetOptionCommandPtr& node) final;
-            void visit(const GetProofCommandPtr& node) final;
-            void visit(const GetUnsatAssumsCommandPtr& node) final;
-            void visit(const GetUnsatCoreCommandPtr& node) final;
-            void visit(const GetValueCommandPtr& node) final;
-            void visit(const PopCommandPtr& node) final;
-            void visit(const PushCommandPtr& node) final;
-            void visit(const ResetCommandPtr& node) final;
-            void visit(const ResetAssertsCommandPtr& node) final;
-            void visit(const SetInfoCommandPtr& node) final;
-            void visit(const SetLogicCommandPtr& node) final;
-            void visit(const SetOptionCommandPtr& node) final;
-
-            void visit(const SortDeclarationPtr& node) final;
-            void visit(const SelectorDeclarationPtr& node) final;
-            void visit(const ConstructorDeclarationPtr& node) final;
-            void visit(const SimpleDatatypeDeclarationPtr& node) final;
-            void visit(const ParametricDatatypeDeclarationPtr& node) final;
-
-            void visit(const FunctionDeclarationPtr& node) final;
-            void visit(const FunctionDefinitionPtr& node) final;
-
-            void visit(const SimpleIdentifierPtr& node) final;
-            void visit(const QualifiedIdentifierPtr& node) final;
-
-            void visit(const NumeralLiteralPtr& node) final;
-            void visit(const DecimalLiteralPtr& node) final;
-            void visit(const StringLiteralPtr& node) final;
-
-            void visit(const LogicPtr& node) final;
-            void visit(const TheoryPtr& node) final;
-            void visit(const ScriptPtr& node) final;
-
-            void visit(const QualifiedConstructorPtr& node) final;
-            void visit(const QualifiedPatternPtr& node) final;
-            void visit(const MatchCasePtr& node) final;
-
-            void visit(const CompSExpressionPtr& node) final;
-
-            void visit(const SortPtr& node) final;
-
-            void visit(const SortSymbolDeclarationPtr& node) final;
-            void visit(const SpecConstFunDeclarationPtr& node) final;
-            void visit(const MetaSpecConstFunDeclarationPtr& node) final;
-            void visit(const SimpleFunDeclarationPtr& node) final;
-            void visit(const ParametricFunDeclarationPtr& node) final;
-
-            void visit(const QualifiedTermPtr& node) final;
-            void visit(const LetTermPtr& node) final;
-            void visit(const ForallTermPtr& node) final;
-            void visit(const ExistsTermPtr& node) final;
-            void visit(const MatchTermPtr& node) final;
-            void visit(const AnnotatedTermPtr& node) final;
-
-            void visit(const TrueTermPtr& node) final;
-            void visit(const FalseTermPtr& node) final;
-            void visit(const NotTermPtr& node) final;
-            void visit(const ImpliesTermPtr& node) final;
-            void visit(const AndTermPtr& node) final;
-            void visit(const OrTermPtr& node) final;
-            void visit(const XorTermPtr& node) final;
-            void visit(const EqualsTermPtr& node) final;
-            void visit(const DistinctTermPtr& node) final;
-            void visit(const IteTermPtr& node) final;
-
-            void visit(const EmpTermPtr& node) final;
-            void visit(const SepTermPtr& node) final;
-            void visit(const WandTermPtr& node) final;
-            void visit(const PtoTermPtr& node) final;
-            void visit(const NilTermPtr& node) final;
-
-            void visit(const SortedVariablePtr& node) final;
-            void visit(const VariableBindingPtr& node) final;
-
-            virtual void visitWithStack(const SimpleAttributePtr& node) = 0;
-            virtual void visitWithStack(const SExpressionAttributePtr& node) = 0;
-            virtual void visitWithStack(const SymbolAttributePtr& node) = 0;
-            virtual void visitWithStack(const BooleanAttributePtr& node) = 0;
-            virtual void visitWithStack(const NumeralAttributePtr& node) = 0;
-            virtual void visitWithStack(const DecimalAttributePtr& node) = 0;
-            virtual void visitWithStack(const StringAttributePtr& node) = 0;
-            virtual void visitWithStack(const TheoriesAttributePtr& node) = 0;
-            virtual void visitWithStack(const SortsAttributePtr& node) = 0;
-            virtual void visitWithStack(const FunsAttributePtr& node) = 0;
-
-            virtual void visitWithStack(const SymbolPtr& node) = 0;
-            virtual void visitWithStack(const KeywordPtr& node) = 0;
-            virtual void visitWithStack(const MetaSpecConstantPtr& node) = 0;
-            virtual void visitWithStack(const BooleanValuePtr& node) = 0;
-            virtual void visitWithStack(const PropLiteralPtr& node) = 0;
-
-            virtual void visitWithStack(const AssertCommandPtr& node) = 0;
-            virtual void visitWithStack(const CheckSatCommandPtr& node) = 0;
-            virtual void visitWithStack(const CheckUnsatCommandPtr& node) = 0;
-            virtual void visitWithStack(const CheckSatAssumCommandPtr& node) = 0;
-            virtual void visitWithStack(const DeclareConstCommandPtr& node) = 0;
-            virtual void visitWithStack(const DeclareDatatypeCommandPtr& node) = 0;
-            virtual void visitWithStack(const DeclareDatatypesCommandPtr& node) = 0;
-            virtual void visitWithStack(const DeclareFunCommandPtr& node) = 0;
-            virtual void visitWithStack(const DeclareSortCommandPtr& node) = 0;
-            virtual void visitWithStack(const DeclareHeapCommandPtr& node) = 0;
-            virtual void visitWithStack(const DefineFunCommandPtr& node) = 0;
-            virtual void visitWithStack(const DefineFunRecCommandPtr& node) = 0;
-            virtual void visitWithStack(const DefineFunsRecCommandPtr& node) = 0;
-            virtual void visitWithStack(const DefineSortCommandPtr& node) = 0;
-            virtual void visitWithStack(const EchoCommandPtr& node) = 0;
-            virtual void visitWithStack(const ExitCommandPtr& node) = 0;
-            virtual void visitWithStack(const GetAssertsCommandPtr& node) = 0;
-            virtual void visitWithStack(const GetAssignsCommandPtr& node) = 0;
-            virtual void visitWithStack(const GetInfoCommandPtr& node) = 0;
-            virtual void visitWithStack(const GetModelCommandPtr& node) = 0;
-            virtual void visitWithStack(const GetOptionCommandPtr& node) = 0;
-            virtual void visitWithStack(const GetProofCommandPtr& node) = 0;
-            virtual void visitWithStack(const GetUnsatAssumsCommandPtr& node) = 0;
-            virtual void visitWithStack(const GetUnsatCoreCommandPtr& node) = 0;
-            virtual void visitWithStack(const GetValueCommandPtr& node) = 0;
-            virtual void visitWithStack(const PopCommandPtr& node) = 0;
-            virtual void visitWithStack(const PushCommandPtr& node) = 0;
-            virtual void visitWithStack(const ResetCommandPtr& node) = 0;
-            virtual void visitWithStack(const ResetAssertsCommandPtr& node) = 0;
-            virtual void visitWithStack(const SetInfoCommandPtr& node) = 0;
-            virtual void visitWithStack(const SetLogicCommandPtr& node) = 0;
-            virtual void visitWithStack(const SetOptionCommandPtr& node) = 0;
-
-            virtual void visitWithStack(const SortDeclarationPtr& node) = 0;
-            virtual void visitWithStack(const SelectorDeclarationPtr& node) = 0;
-            virtual void visitWithStack(const ConstructorDeclarationPtr& node) = 0;
-            virtual void visitWithStack(const SimpleDatatypeDeclarationPtr& node) = 0;
-            virtual void visitWithStack(const ParametricDatatypeDeclarationPtr& node) = 0;
-
-            virtual void visitWithStack(const FunctionDeclarationPtr& node) = 0;
-            virtual void visitWithStack(const FunctionDefinitionPtr& node) = 0;
-
-            virtual void visitWithStack(const SimpleIdentifierPtr& node) = 0;
-            virtual void visitWithStack(const QualifiedIdentifierPtr& node) = 0;
-
-            virtual void visitWithStack(const NumeralLiteralPtr& node) = 0;
-            virtual void visitWithStack(const DecimalLiteralPtr& node) = 0;
-            virtual void visitWithStack(const StringLiteralPtr& node) = 0;
-
-            virtual void visitWithStack(const LogicPtr& node) = 0;
-            virtual void visitWithStack(const TheoryPtr& node) = 0;
-            virtual void visitWithStack(const ScriptPtr& node) = 0;
-
-            virtual void visitWithStack(const QualifiedConstructorPtr& node) = 0;
-            virtual void visitWithStack(const QualifiedPatternPtr& node) = 0;
-            virtual void visitWithStack(const MatchCasePtr& node) = 0;
-
-            virtual void visitWithStack(const CompSExpressionPtr& node) = 0;
-
-            virtual void visitWithStack(const SortPtr& node) = 0;
-
-            virtual void visitWithStack(const SortSymbolDeclarationPtr& node) = 0;
-            virtual void visitWithStack(const SpecConstFunDeclarationPtr& node) = 0;
-            virtual void visitWithStack(const MetaSpecConstFunDeclarationPtr& node) = 0;
-            virtual void visitWithStack(const SimpleFunDeclarationPtr& node) = 0;
-            virtual void visitWithStack(const ParametricFunDeclarationPtr& node) = 0;
-
-            virtual void visitWithStack(const QualifiedTermPtr& node) = 0;
-            virtual void visitWithStack(const LetTermPtr& node) = 0;
-            virtual void visitWithStack(const ForallTermPtr& node) = 0;
-            virtual void visitWithStack(const ExistsTermPtr& node) = 0;
-            virtual void visitWithStack(const MatchTermPtr& node) = 0;
-            virtual void visitWithStack(const AnnotatedTermPtr& node) = 0;
-
-            virtual void visitWithStack(const TrueTermPtr& node) = 0;
-            virtual void visitWithStack(const FalseTermPtr& node) = 0;
-            virtual void visitWithStack(const NotTermPtr& node) = 0;
-            virtual void visitWithStack(const ImpliesTermPtr& node) = 0;
-            virtual void visitWithStack(const AndTermPtr& node) = 0;
-            virtual void visitWithStack(const OrTermPtr& node) = 0;
-            virtual void visitWithStack(const XorTermPtr& node) = 0;
-            virtual void visitWithStack(const EqualsTermPtr& node) = 0;
-            virtual void visitWithStack(const DistinctTermPtr& node) = 0;
-            virtual void visitWithStack(const IteTermPtr& node) = 0;
-
-            virtual void visitWithStack(const EmpTermPtr& node) = 0;
-            virtual void visitWithStack(const SepTermPtr& node) = 0;
-            virtual void visitWithStack(const WandTermPtr& node) = 0;
-            virtual void visitWithStack(const PtoTermPtr& node) = 0;
-            virtual void visitWithStack(const NilTermPtr& node) = 0;
-
-            virtual void visitWithStack(const SortedVariablePtr& node) = 0;
-            virtual void visitWithStack(const VariableBindingPtr& node) = 0;
+            /** Get the symbol stack built by the visitor */
+            inline SymbolStackPtr getStack() { return stack; }
+
+            void visit(SimpleAttribute* node) final;
+            void visit(SExpressionAttribute* node) final;
+            void visit(SymbolAttribute* node) final;
+            void visit(BooleanAttribute* node) final;
+            void visit(NumeralAttribute* node) final;
+            void visit(DecimalAttribute* node) final;
+            void visit(StringAttribute* node) final;
+            void visit(TheoriesAttribute* node) final;
+            void visit(SortsAttribute* node) final;
+            void visit(FunsAttribute* node) final;
+
+            void visit(Symbol* node) final;
+            void visit(Keyword* node) final;
+            void visit(MetaSpecConstant* node) final;
+            void visit(BooleanValue* node) final;
+            void visit(PropLiteral* node) final;
+
+            void visit(AssertCommand* node) final;
+            void visit(CheckSatCommand* node) final;
+            void visit(CheckUnsatCommand* node) final;
+            void visit(CheckSatAssumCommand* node) final;
+            void visit(DeclareConstCommand* node) final;
+            void visit(DeclareDatatypeCommand* node) final;
+            void visit(DeclareDatatypesCommand* node) final;
+            void visit(DeclareFunCommand* node) final;
+            void visit(DeclareSortCommand* node) final;
+            void visit(DeclareHeapCommand* node) final;
+            void visit(DefineFunCommand* node) final;
+            void visit(DefineFunRecCommand* node) final;
+            void visit(DefineFunsRecCommand* node) final;
+            void visit(DefineSortCommand* node) final;
+            void visit(EchoCommand* node) final;
+            void visit(ExitCommand* node) final;
+            void visit(GetAssertsCommand* node) final;
+            void visit(GetAssignsCommand* node) final;
+            void visit(GetInfoCommand* node) final;
+            void visit(GetModelCommand* node) final;
+            void visit(GetOptionCommand* node) final;
+            void visit(GetProofCommand* node) final;
+            void visit(GetUnsatAssumsCommand* node) final;
+            void visit(GetUnsatCoreCommand* node) final;
+            void visit(GetValueCommand* node) final;
+            void visit(PopCommand* node) final;
+            void visit(PushCommand* node) final;
+            void visit(ResetCommand* node) final;
+            void visit(ResetAssertsCommand* node) final;
+            void visit(SetInfoCommand* node) final;
+            void visit(SetLogicCommand* node) final;
+            void visit(SetOptionCommand* node) final;
+
+            void visit(SortDeclaration* node) final;
+            void visit(SelectorDeclaration* node) final;
+            void visit(ConstructorDeclaration* node) final;
+            void visit(SimpleDatatypeDeclaration* node) final;
+            void visit(ParametricDatatypeDeclaration* node) final;
+
+            void visit(FunctionDeclaration* node) final;
+            void visit(FunctionDefinition* node) final;
+
+            void visit(SimpleIdentifier* node) final;
+            void visit(QualifiedIdentifier* node) final;
+
+            void visit(NumeralLiteral* node) final;
+            void visit(DecimalLiteral* node) final;
+            void visit(StringLiteral* node) final;
+
+            void visit(Logic* node) final;
+            void visit(Theory* node) final;
+            void visit(Script* node) final;
+
+            void visit(QualifiedConstructor* node) final;
+            void visit(QualifiedPattern* node) final;
+            void visit(MatchCase* node) final;
+
+            void visit(CompSExpression* node) final;
+
+            void visit(Sort* node) final;
+
+            void visit(SortSymbolDeclaration* node) final;
+            void visit(SpecConstFunDeclaration* node) final;
+            void visit(MetaSpecConstFunDeclaration* node) final;
+            void visit(SimpleFunDeclaration* node) final;
+            void visit(ParametricFunDeclaration* node) final;
+
+            void visit(QualifiedTerm* node) final;
+            void visit(LetTerm* node) final;
+            void visit(ForallTerm* node) final;
+            void visit(ExistsTerm* node) final;
+            void visit(MatchTerm* node) final;
+            void visit(AnnotatedTerm* node) final;
+
+            void visit(TrueTerm* node) final;
+            void visit(FalseTerm* node) final;
+            void visit(NotTerm* node) final;
+            void visit(ImpliesTerm* node) final;
+            void visit(AndTerm* node) final;
+            void visit(OrTerm* node) final;
+            void visit(XorTerm* node) final;
+            void visit(EqualsTerm* node) final;
+            void visit(DistinctTerm* node) final;
+            void visit(IteTerm* node) final;
+
+            void visit(EmpTerm* node) final;
+            void visit(SepTerm* node) final;
+            void visit(WandTerm* node) final;
+            void visit(PtoTerm* node) final;
+            void visit(NilTerm* node) final;
+
+            void visit(SortedVariable* node) final;
+            void visit(VariableBinding* node) final;
+
+            virtual void visitWithStack(SimpleAttribute* node) = 0;
+            virtual void visitWithStack(SExpressionAttribute* node) = 0;
+            virtual void visitWithStack(SymbolAttribute* node) = 0;
+            virtual void visitWithStack(BooleanAttribute* node) = 0;
+            virtual void visitWithStack(NumeralAttribute* node) = 0;
+            virtual void visitWithStack(DecimalAttribute* node) = 0;
+            virtual void visitWithStack(StringAttribute* node) = 0;
+            virtual void visitWithStack(TheoriesAttribute* node) = 0;
+            virtual void visitWithStack(SortsAttribute* node) = 0;
+            virtual void visitWithStack(FunsAttribute* node) = 0;
+
+            virtual void visitWithStack(Symbol* node) = 0;
+            virtual void visitWithStack(Keyword* node) = 0;
+            virtual void visitWithStack(MetaSpecConstant* node) = 0;
+            virtual void visitWithStack(BooleanValue* node) = 0;
+            virtual void visitWithStack(PropLiteral* node) = 0;
+
+            virtual void visitWithStack(AssertCommand* node) = 0;
+            virtual void visitWithStack(CheckSatCommand* node) = 0;
+            virtual void visitWithStack(CheckUnsatCommand* node) = 0;
+            virtual void visitWithStack(CheckSatAssumCommand* node) = 0;
+            virtual void visitWithStack(DeclareConstCommand* node) = 0;
+            virtual void visitWithStack(DeclareDatatypeCommand* node) = 0;
+            virtual void visitWithStack(DeclareDatatypesCommand* node) = 0;
+            virtual void visitWithStack(DeclareFunCommand* node) = 0;
+            virtual void visitWithStack(DeclareSortCommand* node) = 0;
+            virtual void visitWithStack(DeclareHeapCommand* node) = 0;
+            virtual void visitWithStack(DefineFunCommand* node) = 0;
+            virtual void visitWithStack(DefineFunRecCommand* node) = 0;
+            virtual void visitWithStack(DefineFunsRecCommand* node) = 0;
+            virtual void visitWithStack(DefineSortCommand* node) = 0;
+            virtual void visitWithStack(EchoCommand* node) = 0;
+            virtual void visitWithStack(ExitCommand* node) = 0;
+            virtual void visitWithStack(GetAssertsCommand* node) = 0;
+            virtual void visitWithStack(GetAssignsCommand* node) = 0;
+            virtual void visitWithStack(GetInfoCommand* node) = 0;
+            virtual void visitWithStack(GetModelCommand* node) = 0;
+            virtual void visitWithStack(GetOptionCommand* node) = 0;
+            virtual void visitWithStack(GetProofCommand* node) = 0;
+            virtual void visitWithStack(GetUnsatAssumsCommand* node) = 0;
+            virtual void visitWithStack(GetUnsatCoreCommand* node) = 0;
+            virtual void visitWithStack(GetValueCommand* node) = 0;
+            virtual void visitWithStack(PopCommand* node) = 0;
+            virtual void visitWithStack(PushCommand* node) = 0;
+            virtual void visitWithStack(ResetCommand* node) = 0;
+            virtual void visitWithStack(ResetAssertsCommand* node) = 0;
+            virtual void visitWithStack(SetInfoCommand* node) = 0;
+            virtual void visitWithStack(SetLogicCommand* node) = 0;
+            virtual void visitWithStack(SetOptionCommand* node) = 0;
+
+            virtual void visitWithStack(SortDeclaration* node) = 0;
+            virtual void visitWithStack(SelectorDeclaration* node) = 0;
+            virtual void visitWithStack(ConstructorDeclaration* node) = 0;
+            virtual void visitWithStack(SimpleDatatypeDeclaration* node) = 0;
+            virtual void visitWithStack(ParametricDatatypeDeclaration* node) = 0;
+
+            virtual void visitWithStack(FunctionDeclaration* node) = 0;
+            virtual void visitWithStack(FunctionDefinition* node) = 0;
+
+            virtual void visitWithStack(SimpleIdentifier* node) = 0;
+            virtual void visitWithStack(QualifiedIdentifier* node) = 0;
+
+            virtual void visitWithStack(NumeralLiteral* node) = 0;
+            virtual void visitWithStack(DecimalLiteral* node) = 0;
+            virtual void visitWithStack(StringLiteral* node) = 0;
+
+            virtual void visitWithStack(Logic* node) = 0;
+            virtual void visitWithStack(Theory* node) = 0;
+            virtual void visitWithStack(Script* node) = 0;
+
+            virtual void visitWithStack(QualifiedConstructor* node) = 0;
+            virtual void visitWithStack(QualifiedPattern* node) = 0;
+            virtual void visitWithStack(MatchCase* node) = 0;
+
+            virtual void visitWithStack(CompSExpression* node) = 0;
+
+            virtual void visitWithStack(Sort* node) = 0;
+
+            virtual void visitWithStack(SortSymbolDeclaration* node) = 0;
+            virtual void visitWithStack(SpecConstFunDeclaration* node) = 0;
+            virtual void visitWithStack(MetaSpecConstFunDeclaration* node) = 0;
+            virtual void visitWithStack(SimpleFunDeclaration* node) = 0;
+            virtual void visitWithStack(ParametricFunDeclaration* node) = 0;
+
+            virtual void visitWithStack(QualifiedTerm* node) = 0;
+            virtual void visitWithStack(LetTerm* node) = 0;
+            virtual void visitWithStack(ForallTerm* node) = 0;
+            virtual void visitWithStack(ExistsTerm* node) = 0;
+            virtual void visitWithStack(MatchTerm* node) = 0;
+            virtual void visitWithStack(AnnotatedTerm* node) = 0;
+
+            virtual void visitWithStack(TrueTerm* node) = 0;
+            virtual void visitWithStack(FalseTerm* node) = 0;
+            virtual void visitWithStack(NotTerm* node) = 0;
+            virtual void visitWithStack(ImpliesTerm* node) = 0;
+            virtual void visitWithStack(AndTerm* node) = 0;
+            virtual void visitWithStack(OrTerm* node) = 0;
+            virtual void visitWithStack(XorTerm* node) = 0;
+            virtual void visitWithStack(EqualsTerm* node) = 0;
+            virtual void visitWithStack(DistinctTerm* node) = 0;
+            virtual void visitWithStack(IteTerm* node) = 0;
+
+            virtual void visitWithStack(EmpTerm* node) = 0;
+            virtual void visitWithStack(SepTerm* node) = 0;
+            virtual void visitWithStack(WandTerm* node) = 0;
+            virtual void visitWithStack(PtoTerm* node) = 0;
+            virtual void visitWithStack(NilTerm* node) = 0;
+
+            virtual void visitWithStack(SortedVariable* node) = 0;
+            virtual void visitWithStack(VariableBinding* node) = 0;
 
         };
 
@@ -280,116 +283,116 @@ namespace smtlib {
          */
         class DummyVisitorWithStack0 : public virtual VisitorWithStack0 {
         public:
-            void visitWithStack(const SimpleAttributePtr& node) override;
-            void visitWithStack(const SExpressionAttributePtr& node) override;
-            void visitWithStack(const SymbolAttributePtr& node) override;
-            void visitWithStack(const BooleanAttributePtr& node) override;
-            void visitWithStack(const NumeralAttributePtr& node) override;
-            void visitWithStack(const DecimalAttributePtr& node) override;
-            void visitWithStack(const StringAttributePtr& node) override;
-            void visitWithStack(const TheoriesAttributePtr& node) override;
-            void visitWithStack(const SortsAttributePtr& node) override;
-            void visitWithStack(const FunsAttributePtr& node) override;
-
-            void visitWithStack(const SymbolPtr& node) override;
-            void visitWithStack(const KeywordPtr& node) override;
-            void visitWithStack(const MetaSpecConstantPtr& node) override;
-            void visitWithStack(const BooleanValuePtr& node) override;
-            void visitWithStack(const PropLiteralPtr& node) override;
-
-            void visitWithStack(const AssertCommandPtr& node) override;
-            void visitWithStack(const CheckSatCommandPtr& node) override;
-            void visitWithStack(const CheckUnsatCommandPtr& node) override;
-            void visitWithStack(const CheckSatAssumCommandPtr& node) override;
-            void visitWithStack(const DeclareConstCommandPtr& node) override;
-            void visitWithStack(const DeclareDatatypeCommandPtr& node) override;
-            void visitWithStack(const DeclareDatatypesCommandPtr& node) override;
-            void visitWithStack(const DeclareFunCommandPtr& node) override;
-            void visitWithStack(const DeclareSortCommandPtr& node) override;
-            void visitWithStack(const DeclareHeapCommandPtr& node) override;
-            void visitWithStack(const DefineFunCommandPtr& node) override;
-            void visitWithStack(const DefineFunRecCommandPtr& node) override;
-            void visitWithStack(const DefineFunsRecCommandPtr& node) override;
-            void visitWithStack(const DefineSortCommandPtr& node) override;
-            void visitWithStack(const EchoCommandPtr& node) override;
-            void visitWithStack(const ExitCommandPtr& node) override;
-            void visitWithStack(const GetAssertsCommandPtr& node) override;
-            void visitWithStack(const GetAssignsCommandPtr& node) override;
-            void visitWithStack(const GetInfoCommandPtr& node) override;
-            void visitWithStack(const GetModelCommandPtr& node) override;
-            void visitWithStack(const GetOptionCommandPtr& node) override;
-            void visitWithStack(const GetProofCommandPtr& node) override;
-            void visitWithStack(const GetUnsatAssumsCommandPtr& node) override;
-            void visitWithStack(const GetUnsatCoreCommandPtr& node) override;
-            void visitWithStack(const GetValueCommandPtr& node) override;
-            void visitWithStack(const PopCommandPtr& node) override;
-            void visitWithStack(const PushCommandPtr& node) override;
-            void visitWithStack(const ResetCommandPtr& node) override;
-            void visitWithStack(const ResetAssertsCommandPtr& node) override;
-            void visitWithStack(const SetInfoCommandPtr& node) override;
-            void visitWithStack(const SetLogicCommandPtr& node) override;
-            void visitWithStack(const SetOptionCommandPtr& node) override;
-
-            void visitWithStack(const SortDeclarationPtr& node) override;
-            void visitWithStack(const SelectorDeclarationPtr& node) override;
-            void visitWithStack(const ConstructorDeclarationPtr& node) override;
-            void visitWithStack(const SimpleDatatypeDeclarationPtr& node) override;
-            void visitWithStack(const ParametricDatatypeDeclarationPtr& node) override;
-
-            void visitWithStack(const FunctionDeclarationPtr& node) override;
-            void visitWithStack(const FunctionDefinitionPtr& node) override;
-
-            void visitWithStack(const SimpleIdentifierPtr& node) override;
-            void visitWithStack(const QualifiedIdentifierPtr& node) override;
-
-            void visitWithStack(const NumeralLiteralPtr& node) override;
-            void visitWithStack(const DecimalLiteralPtr& node) override;
-            void visitWithStack(const StringLiteralPtr& node) override;
-
-            void visitWithStack(const LogicPtr& node) override;
-            void visitWithStack(const TheoryPtr& node) override;
-            void visitWithStack(const ScriptPtr& node) override;
-
-            void visitWithStack(const QualifiedConstructorPtr& node) override;
-            void visitWithStack(const QualifiedPatternPtr& node) override;
-            void visitWithStack(const MatchCasePtr& node) override;
-
-            void visitWithStack(const CompSExpressionPtr& node) override;
-
-            void visitWithStack(const SortPtr& node) override;
-
-            void visitWithStack(const SortSymbolDeclarationPtr& node) override;
-            void visitWithStack(const SpecConstFunDeclarationPtr& node) override;
-            void visitWithStack(const MetaSpecConstFunDeclarationPtr& node) override;
-            void visitWithStack(const SimpleFunDeclarationPtr& node) override;
-            void visitWithStack(const ParametricFunDeclarationPtr& node) override;
-
-            void visitWithStack(const QualifiedTermPtr& node) override;
-            void visitWithStack(const LetTermPtr& node) override;
-            void visitWithStack(const ForallTermPtr& node) override;
-            void visitWithStack(const ExistsTermPtr& node) override;
-            void visitWithStack(const MatchTermPtr& node) override;
-            void visitWithStack(const AnnotatedTermPtr& node) override;
-
-            void visitWithStack(const TrueTermPtr& node) override;
-            void visitWithStack(const FalseTermPtr& node) override;
-            void visitWithStack(const NotTermPtr& node) override;
-            void visitWithStack(const ImpliesTermPtr& node) override;
-            void visitWithStack(const AndTermPtr& node) override;
-            void visitWithStack(const OrTermPtr& node) override;
-            void visitWithStack(const XorTermPtr& node) override;
-            void visitWithStack(const EqualsTermPtr& node) override;
-            void visitWithStack(const DistinctTermPtr& node) override;
-            void visitWithStack(const IteTermPtr& node) override;
-
-            void visitWithStack(const EmpTermPtr& node) override;
-            void visitWithStack(const SepTermPtr& node) override;
-            void visitWithStack(const WandTermPtr& node) override;
-            void visitWithStack(const PtoTermPtr& node) override;
-            void visitWithStack(const NilTermPtr& node) override;
-
-            void visitWithStack(const SortedVariablePtr& node) override;
-            void visitWithStack(const VariableBindingPtr& node) override;
+            void visitWithStack(SimpleAttribute* node) override;
+            void visitWithStack(SExpressionAttribute* node) override;
+            void visitWithStack(SymbolAttribute* node) override;
+            void visitWithStack(BooleanAttribute* node) override;
+            void visitWithStack(NumeralAttribute* node) override;
+            void visitWithStack(DecimalAttribute* node) override;
+            void visitWithStack(StringAttribute* node) override;
+            void visitWithStack(TheoriesAttribute* node) override;
+            void visitWithStack(SortsAttribute* node) override;
+            void visitWithStack(FunsAttribute* node) override;
+
+            void visitWithStack(Symbol* node) override;
+            void visitWithStack(Keyword* node) override;
+            void visitWithStack(MetaSpecConstant* node) override;
+            void visitWithStack(BooleanValue* node) override;
+            void visitWithStack(PropLiteral* node) override;
+
+            void visitWithStack(AssertCommand* node) override;
+            void visitWithStack(CheckSatCommand* node) override;
+            void visitWithStack(CheckUnsatCommand* node) override;
+            void visitWithStack(CheckSatAssumCommand* node) override;
+            void visitWithStack(DeclareConstCommand* node) override;
+            void visitWithStack(DeclareDatatypeCommand* node) override;
+            void visitWithStack(DeclareDatatypesCommand* node) override;
+            void visitWithStack(DeclareFunCommand* node) override;
+            void visitWithStack(DeclareSortCommand* node) override;
+            void visitWithStack(DeclareHeapCommand* node) override;
+            void visitWithStack(DefineFunCommand* node) override;
+            void visitWithStack(DefineFunRecCommand* node) override;
+            void visitWithStack(DefineFunsRecCommand* node) override;
+            void visitWithStack(DefineSortCommand* node) override;
+            void visitWithStack(EchoCommand* node) override;
+            void visitWithStack(ExitCommand* node) override;
+            void visitWithStack(GetAssertsCommand* node) override;
+            void visitWithStack(GetAssignsCommand* node) override;
+            void visitWithStack(GetInfoCommand* node) override;
+            void visitWithStack(GetModelCommand* node) override;
+            void visitWithStack(GetOptionCommand* node) override;
+            void visitWithStack(GetProofCommand* node) override;
+            void visitWithStack(GetUnsatAssumsCommand* node) override;
+            void visitWithStack(GetUnsatCoreCommand* node) override;
+            void visitWithStack(GetValueCommand* node) override;
+            void visitWithStack(PopCommand* node) override;
+            void visitWithStack(PushCommand* node) override;
+            void visitWithStack(ResetCommand* node) override;
+            void visitWithStack(ResetAssertsCommand* node) override;
+            void visitWithStack(SetInfoCommand* node) override;
+            void visitWithStack(SetLogicCommand* node) override;
+            void visitWithStack(SetOptionCommand* node) override;
+
+            void visitWithStack(SortDeclaration* node) override;
+            void visitWithStack(SelectorDeclaration* node) override;
+            void visitWithStack(ConstructorDeclaration* node) override;
+            void visitWithStack(SimpleDatatypeDeclaration* node) override;
+            void visitWithStack(ParametricDatatypeDeclaration* node) override;
+
+            void visitWithStack(FunctionDeclaration* node) override;
+            void visitWithStack(FunctionDefinition* node) override;
+
+            void visitWithStack(SimpleIdentifier* node) override;
+            void visitWithStack(QualifiedIdentifier* node) override;
+
+            void visitWithStack(NumeralLiteral* node) override;
+            void visitWithStack(DecimalLiteral* node) override;
+            void visitWithStack(StringLiteral* node) override;
+
+            void visitWithStack(Logic* node) override;
+            void visitWithStack(Theory* node) override;
+            void visitWithStack(Script* node) override;
+
+            void visitWithStack(QualifiedConstructor* node) override;
+            void visitWithStack(QualifiedPattern* node) override;
+            void visitWithStack(MatchCase* node) override;
+
+            void visitWithStack(CompSExpression* node) override;
+
+            void visitWithStack(Sort* node) override;
+
+            void visitWithStack(SortSymbolDeclaration* node) override;
+            void visitWithStack(SpecConstFunDeclaration* node) override;
+            void visitWithStack(MetaSpecConstFunDeclaration* node) override;
+            void visitWithStack(SimpleFunDeclaration* node) override;
+            void visitWithStack(ParametricFunDeclaration* node) override;
+
+            void visitWithStack(QualifiedTerm* node) override;
+            void visitWithStack(LetTerm* node) override;
+            void visitWithStack(ForallTerm* node) override;
+            void visitWithStack(ExistsTerm* node) override;
+            void visitWithStack(MatchTerm* node) override;
+            void visitWithStack(AnnotatedTerm* node) override;
+
+            void visitWithStack(TrueTerm* node) override;
+            void visitWithStack(FalseTerm* node) override;
+            void visitWithStack(NotTerm* node) override;
+            void visitWithStack(ImpliesTerm* node) override;
+            void visitWithStack(AndTerm* node) override;
+            void visitWithStack(OrTerm* node) override;
+            void visitWithStack(XorTerm* node) override;
+            void visitWithStack(EqualsTerm* node) override;
+            void visitWithStack(DistinctTerm* node) override;
+            void visitWithStack(IteTerm* node) override;
+
+            void visitWithStack(EmpTerm* node) override;
+            void visitWithStack(SepTerm* node) override;
+            void visitWithStack(WandTerm* node) override;
+            void visitWithStack(PtoTerm* node) override;
+            void visitWithStack(NilTerm* node) override;
+
+            void visitWithStack(SortedVariable* node) override;
+            void visitWithStack(VariableBinding* node) override;
         };
     }
 }
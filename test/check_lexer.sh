@@ -0,0 +1,35 @@
+#!/bin/sh
+# Check that the checked-in scanner, smtlib-flex-lexer.l.c, was generated from the current smtlib-flex-lexer.l,
+# against the hashes of both files recorded when it was last generated (by running make in smtlib/parser).
+# If a scanner generated by the build is also given, and the flex that generated it has the version
+# of the checked-in scanner, both scanners are compared, apart from their #line directives.
+# Usage: check_lexer.sh <parser directory> [<generated scanner> <flex version>]
+
+dir="$1"
+generated="$2"
+version="$3"
+
+if ! (cd "$dir" && sha256sum --status -c smtlib-flex-lexer.l.sha256); then
+    echo "smtlib-flex-lexer.l.c is not up to date with smtlib-flex-lexer.l: regenerate it by running make in $dir"
+    exit 1
+fi
+
+[ -n "$generated" ] || exit 0
+
+checked_in_version=$(awk '/^#define YY_FLEX_(MAJOR|MINOR|SUBMINOR)_VERSION/ { v = v (v == "" ? "" : ".") $3 } END { print v }' \
+                     "$dir/smtlib-flex-lexer.l.c")
+if [ "$version" != "$checked_in_version" ]; then
+    echo "Not comparing with the generated scanner: it was generated by flex $version, the checked-in one by flex $checked_in_version"
+    exit 0
+fi
+
+checked_in=$(mktemp)
+grep -v '^#line ' "$dir/smtlib-flex-lexer.l.c" > "$checked_in"
+grep -v '^#line ' "$generated" | diff -u "$checked_in" - > /dev/null
+status=$?
+rm -f "$checked_in"
+
+if [ $status -ne 0 ]; then
+    echo "smtlib-flex-lexer.l.c differs from the scanner generated from smtlib-flex-lexer.l: regenerate it by running make in $dir"
+    exit 1
+fi
@@ -0,0 +1,30 @@
+#!/bin/sh
+# Check that a script gives the same output whether its commands are checked
+# one after another or in parallel.
+# Usage: compare_jobs.sh <slcomp-parser> <script> [options...]
+# Runs from the project directory, where the theories and logics are found.
+
+parser="$1"
+script="$2"
+shift 2
+options="$*"
+
+# Only the name of the function reporting the errors differs between the modes
+normalize() {
+    sed 's/SmtExecution::check[A-Za-z]*()/SmtExecution::check()/'
+}
+
+expected=$("$parser" --jobs 1 "$@" "$script" 2>&1 | normalize)
+
+# Commands are split between the threads differently on each run
+for run in 1 2 3; do
+    actual=$("$parser" --jobs 4 "$@" "$script" 2>&1 | normalize)
+    if [ "$actual" != "$expected" ]; then
+        echo "Output of '$script' with --jobs 4${options:+ $options} differs from --jobs 1 (run $run)"
+        printf '%s\n' "$expected" > expected.out
+        printf '%s\n' "$actual" > actual.out
+        diff expected.out actual.out | head -40
+        rm -f expected.out actual.out
+        exit 1
+    fi
+done
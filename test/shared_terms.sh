@@ -0,0 +1,23 @@
+#!/bin/sh
+# Check that errors in shared terms are reported at the same occurrence
+# whether the commands of a script are checked in parallel or not.
+# Usage: shared_terms.sh <slcomp-parser> <output directory>
+
+parser="$1"
+script="$2/shared-terms.sl2"
+dir=$(dirname "$0")
+
+{
+    echo "(set-logic SEPLOG)"
+    echo "(declare-sort GTyp 0)"
+    echo "(declare-sort RefGTyp 0)"
+    echo "(declare-heap (RefGTyp GTyp))"
+    echo "(declare-const x GTyp)"
+    i=0
+    while [ $i -lt 3000 ]; do
+        echo "(assert (= x (as nil GTyp)))"
+        i=$((i + 1))
+    done
+} > "$script"
+
+sh "$dir/compare_jobs.sh" "$parser" "$script" --share-terms
@@ -0,0 +1,26 @@
+#!/bin/sh
+# Check that the memory used when commands are checked as they are parsed (--stream)
+# does not grow with the number of commands.
+# Usage: stream_memory.sh <slcomp-parser> <script-gen> <output directory>
+
+parser="$1"
+generator="$2"
+dir="$3"
+
+# Growth of the peak memory usage of the process over all phases, in KB
+peak_growth() {
+    "$parser" --stream --stats=json "$1" | grep -o '"peak_rss_delta_kb": [0-9]*' | awk '{ kb += $2 } END { print kb }'
+}
+
+"$generator" --assertions 5000 --output "$dir/stream-small.sl2" || exit 1
+"$generator" --assertions 20000 --output "$dir/stream-large.sl2" || exit 1
+
+small=$(peak_growth "$dir/stream-small.sl2")
+large=$(peak_growth "$dir/stream-large.sl2")
+echo "Peak memory growth: $small KB for 5000 assertions, $large KB for 20000 assertions"
+
+# Four times the commands should not take much more memory, let alone four times as much
+if [ "$large" -gt $((small * 2 + 1024)) ]; then
+    echo "Memory grows with the number of commands"
+    exit 1
+fi
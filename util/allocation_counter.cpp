@@ -0,0 +1,66 @@
+/**
+ * \file allocation_counter.cpp
+ * \brief Replacements of the global allocation functions, counting the allocations of each thread.
+ *
+ * Not part of the library: only the programs that report heap allocations (see ResourceUsage)
+ * are built with it, so that programs embedding the library keep the default allocation functions.
+ * All forms of operator new and delete are replaced (including the array and nothrow forms),
+ * so that every allocation through new is counted once. Memory allocated directly with malloc
+ * (e.g. by the scanner and the parser stacks) is not counted.
+ */
+
+#include "resource_usage.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+    inline void* allocate(size_t size) {
+        ResourceUsage::countAllocation(size);
+        return malloc(size ? size : 1);
+    }
+}
+
+void* operator new(size_t size) {
+    if (void* ptr = allocate(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    if (void* ptr = allocate(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    free(ptr);
+}
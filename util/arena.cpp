@@ -0,0 +1,50 @@
+#include "arena.h"
+
+#include <cstdint>
+#include <new>
+
+using namespace std;
+
+Arena::Arena(size_t blockSize)
+        : cursor(nullptr)
+        , end(nullptr)
+        , blockSize(blockSize)
+        , allocationCount(0)
+        , bytesAllocated(0) {}
+
+Arena::~Arena() {
+    for (const auto& block : blocks) {
+        ::operator delete(block);
+    }
+}
+
+namespace {
+    inline uintptr_t alignUp(uintptr_t addr, size_t alignment) {
+        return (addr + alignment - 1) & ~(uintptr_t) (alignment - 1);
+    }
+}
+
+void* Arena::allocate(size_t size, size_t alignment) {
+    allocationCount++;
+    bytesAllocated += size;
+
+    // Oversized objects get a block of their own, so that the current block stays in use
+    if (size + alignment > blockSize) {
+        auto block = static_cast<char*>(::operator new(size + alignment));
+        blocks.push_back(block);
+        return reinterpret_cast<void*>(alignUp(reinterpret_cast<uintptr_t>(block), alignment));
+    }
+
+    uintptr_t aligned = alignUp(reinterpret_cast<uintptr_t>(cursor), alignment);
+    if (!cursor || aligned + size > reinterpret_cast<uintptr_t>(end)) {
+        auto block = static_cast<char*>(::operator new(blockSize));
+        blocks.push_back(block);
+        cursor = block;
+        end = block + blockSize;
+
+        aligned = alignUp(reinterpret_cast<uintptr_t>(cursor), alignment);
+    }
+
+    cursor = reinterpret_cast<char*>(aligned + size);
+    return reinterpret_cast<void*>(aligned);
+}
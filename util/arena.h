@@ -0,0 +1,105 @@
+/**
+ * \file arena.h
+ * \brief Region allocator for AST and sep nodes.
+ */
+
+#ifndef SLCOMP_PARSER_ARENA_H
+#define SLCOMP_PARSER_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * Bump allocator that hands out memory from large contiguous blocks.
+ * Individual allocations are never released; all blocks are freed at once when
+ * the arena is destroyed. Not thread-safe: each arena is meant to be used by a
+ * single parse or translation run.
+ */
+class Arena {
+private:
+    std::vector<char*> blocks;
+    char* cursor;
+    char* end;
+    size_t blockSize;
+
+    size_t allocationCount;
+    size_t bytesAllocated;
+
+public:
+    static const size_t DEFAULT_BLOCK_SIZE = 1 << 20;
+
+    /**
+     * \param blockSize     Size of the blocks requested from the system
+     */
+    explicit Arena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena();
+
+    /** Allocate memory for an object of the given size and alignment */
+    void* allocate(size_t size, size_t alignment);
+
+    /** Number of allocations served so far */
+    inline size_t getAllocationCount() const { return allocationCount; }
+
+    /** Number of bytes handed out so far, not counting padding */
+    inline size_t getBytesAllocated() const { return bytesAllocated; }
+
+    /** Number of blocks requested from the system so far */
+    inline size_t getBlockCount() const { return blocks.size(); }
+};
+
+typedef std::shared_ptr<Arena> ArenaPtr;
+
+/**
+ * Standard allocator backed by an arena.
+ * Each allocator keeps the arena alive, so that objects created through
+ * std::allocate_shared can safely outlive the run that created them.
+ */
+template<class T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+
+    ArenaPtr arena;
+
+    inline explicit ArenaAllocator(ArenaPtr arena)
+            : arena(std::move(arena)) {}
+
+    template<class U>
+    inline ArenaAllocator(const ArenaAllocator<U>& other)
+            : arena(other.arena) {}
+
+    inline T* allocate(size_t n) {
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    inline void deallocate(T*, size_t) {}
+};
+
+template<class T, class U>
+inline bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena == b.arena;
+}
+
+template<class T, class U>
+inline bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena != b.arena;
+}
+
+/**
+ * Like std::make_shared, but places the object and its reference count in the
+ * given arena. Falls back to std::make_shared if no arena is given.
+ */
+template<class T, class... Args>
+inline std::shared_ptr<T> makeShared(const ArenaPtr& arena, Args&&... args) {
+    if (arena)
+        return std::allocate_shared<T>(ArenaAllocator<T>(arena), std::forward<Args>(args)...);
+    return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+#endif //SLCOMP_PARSER_ARENA_H
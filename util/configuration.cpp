@@ -3,6 +3,7 @@
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 
 using namespace std;
@@ -45,10 +46,14 @@ Configuration::Configuration(const string& path) {
 }
 
 void Configuration::populatePropNames() {
-    PROP_NAMES["LOC_LOGICS"] = Property::LOC_LOGICS;
-    PROP_NAMES["LOC_THEORIES"] = Property::LOC_THEORIES;
-    PROP_NAMES["FILE_EXT_LOGIC"] = Property::FILE_EXT_LOGIC;
-    PROP_NAMES["FILE_EXT_THEORY"] = Property::FILE_EXT_THEORY;
+    // The names are shared by all configurations, which may be created in different threads
+    static once_flag populated;
+    call_once(populated, [] {
+        PROP_NAMES["LOC_LOGICS"] = Property::LOC_LOGICS;
+        PROP_NAMES["LOC_THEORIES"] = Property::LOC_THEORIES;
+        PROP_NAMES["FILE_EXT_LOGIC"] = Property::FILE_EXT_LOGIC;
+        PROP_NAMES["FILE_EXT_THEORY"] = Property::FILE_EXT_THEORY;
+    });
 }
 
 void Configuration::loadDefaults() {
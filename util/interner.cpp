@@ -0,0 +1,106 @@
+#include "interner.h"
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    /** Number of independently locked shards, so that concurrent parsers rarely contend */
+    const size_t SHARD_BITS = 4;
+    const size_t SHARD_COUNT = 1 << SHARD_BITS;
+
+    /** Slot value for an empty position in the open-addressing table */
+    const uint32_t EMPTY_SLOT = 0;
+
+    /**
+     * One shard of the interner: an open-addressing hash table with linear probing.
+     * Slots hold the local index of the string plus one; the full hashes are kept
+     * alongside the strings, so that the table can grow without hashing again.
+     */
+    struct Shard {
+        mutex lock;
+        vector<uint32_t> slots = vector<uint32_t>(1024, EMPTY_SLOT);
+        deque<string> strings;
+        vector<size_t> hashes;
+
+        /** Local index of the string, or -1 if it is not present */
+        long find(const string& str, size_t hash) {
+            size_t mask = slots.size() - 1;
+            for (size_t pos = (hash >> SHARD_BITS) & mask; ; pos = (pos + 1) & mask) {
+                uint32_t slot = slots[pos];
+                if (slot == EMPTY_SLOT)
+                    return -1;
+                if (hashes[slot - 1] == hash && strings[slot - 1] == str)
+                    return slot - 1;
+            }
+        }
+
+        void place(uint32_t index) {
+            size_t mask = slots.size() - 1;
+            size_t pos = (hashes[index] >> SHARD_BITS) & mask;
+            while (slots[pos] != EMPTY_SLOT)
+                pos = (pos + 1) & mask;
+            slots[pos] = index + 1;
+        }
+
+        uint32_t insert(const string& str, size_t hash) {
+            auto index = (uint32_t) strings.size();
+            strings.push_back(str);
+            hashes.push_back(hash);
+
+            // Keep the load factor under 1/2
+            if (2 * strings.size() > slots.size()) {
+                slots.assign(2 * slots.size(), EMPTY_SLOT);
+                for (uint32_t i = 0; i <= index; i++)
+                    place(i);
+            } else {
+                place(index);
+            }
+
+            return index;
+        }
+    };
+
+    Shard* getShards() {
+        // Never destroyed, so that nodes outliving static destruction can still be looked up
+        static Shard* shards = new Shard[SHARD_COUNT];
+        return shards;
+    }
+}
+
+SymbolId Interner::intern(const string& str) {
+    size_t hash = std::hash<string>()(str);
+    size_t shardIdx = hash & (SHARD_COUNT - 1);
+    Shard& shard = getShards()[shardIdx];
+
+    lock_guard<mutex> guard(shard.lock);
+    long index = shard.find(str, hash);
+    if (index < 0)
+        index = shard.insert(str, hash);
+
+    return (SymbolId) ((index << SHARD_BITS) | shardIdx);
+}
+
+bool Interner::find(const string& str, SymbolId& id) {
+    size_t hash = std::hash<string>()(str);
+    size_t shardIdx = hash & (SHARD_COUNT - 1);
+    Shard& shard = getShards()[shardIdx];
+
+    lock_guard<mutex> guard(shard.lock);
+    long index = shard.find(str, hash);
+    if (index < 0)
+        return false;
+
+    id = (SymbolId) ((index << SHARD_BITS) | shardIdx);
+    return true;
+}
+
+const string& Interner::lookup(SymbolId id) {
+    Shard& shard = getShards()[id & (SHARD_COUNT - 1)];
+
+    lock_guard<mutex> guard(shard.lock);
+    return shard.strings[id >> SHARD_BITS];
+}
@@ -0,0 +1,36 @@
+/**
+ * \file interner.h
+ * \brief String interning for symbols, keywords and symbol table keys.
+ */
+
+#ifndef SLCOMP_PARSER_INTERNER_H
+#define SLCOMP_PARSER_INTERNER_H
+
+#include <cstdint>
+#include <string>
+
+/** Identifier of an interned string */
+typedef uint32_t SymbolId;
+
+/**
+ * Process-wide string interner.
+ * Equal strings are always given the same identifier, so that names coming from
+ * different parsers (e.g. the input file and the theory files it loads) can be
+ * compared as integers. All operations are thread-safe.
+ */
+class Interner {
+public:
+    /** Get the identifier of a string, interning it if it is not already known */
+    static SymbolId intern(const std::string& str);
+
+    /**
+     * Look up the identifier of a string, without interning it.
+     * \return Whether the string has already been interned
+     */
+    static bool find(const std::string& str, SymbolId& id);
+
+    /** Get the string with the given identifier */
+    static const std::string& lookup(SymbolId id);
+};
+
+#endif //SLCOMP_PARSER_INTERNER_H
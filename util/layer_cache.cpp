@@ -0,0 +1,13 @@
+#include "layer_cache.h"
+
+#include <sys/stat.h>
+
+bool getFileTime(const std::string& path, FileTime& time) {
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0)
+        return false;
+
+    time.seconds = info.st_mtim.tv_sec;
+    time.nanoseconds = info.st_mtim.tv_nsec;
+    return true;
+}
@@ -0,0 +1,116 @@
+/**
+ * \file layer_cache.h
+ * \brief Process-wide cache of the symbol table layers loaded from theory and logic files.
+ */
+
+#ifndef SLCOMP_PARSER_LAYER_CACHE_H
+#define SLCOMP_PARSER_LAYER_CACHE_H
+
+#include "source_map.h"
+
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/** Modification time of a file */
+struct FileTime {
+    time_t seconds;
+    long nanoseconds;
+
+    inline bool operator==(const FileTime& other) const {
+        return seconds == other.seconds && nanoseconds == other.nanoseconds;
+    }
+};
+
+/**
+ * Get the modification time of a file.
+ * \return Whether the file could be accessed
+ */
+bool getFileTime(const std::string& path, FileTime& time);
+
+/**
+ * Process-wide cache of the symbol table layers that result from loading theory and logic files.
+ * Checking a file depends on the layers already mounted in the symbol stack it is loaded into,
+ * so each load is cached together with these layers, as well as with the modification time
+ * of the file, so that changed files are loaded again.
+ * Cached layers are never modified after being added, so symbol stacks in different threads
+ * can mount them at the same time. All operations are thread-safe.
+ * \tparam Table Symbol table type
+ */
+template<class Table>
+class LayerCache {
+public:
+    typedef std::shared_ptr<Table> TablePtr;
+
+    /** Result of loading a file */
+    struct Entry {
+        /** Layers mounted before loading the file */
+        std::vector<TablePtr> bases;
+
+        /** Layers mounted by loading the file */
+        std::vector<TablePtr> layers;
+
+        /** Theories loaded along with the file */
+        std::vector<std::string> theories;
+
+        /** Source spans of the nodes referenced by the layers */
+        std::vector<SourceMapPtr> sourceMaps;
+    };
+
+    /**
+     * Look up the result of loading a file on top of the given layers.
+     * \return Whether such a result was cached for the current version of the file
+     */
+    static bool find(const std::string& path, const FileTime& time,
+                     const std::vector<TablePtr>& bases, Entry& entry) {
+        std::lock_guard<std::mutex> lock(getMutex());
+
+        auto it = getFiles().find(path);
+        if (it == getFiles().end() || !(it->second.time == time))
+            return false;
+
+        for (const auto& cached : it->second.entries) {
+            if (cached.bases == bases) {
+                entry = cached;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /** Add the result of loading a file, as it was when its modification time was taken */
+    static void add(const std::string& path, const FileTime& time, Entry entry) {
+        std::lock_guard<std::mutex> lock(getMutex());
+
+        FileEntries& file = getFiles()[path];
+        if (!(file.time == time)) {
+            file.time = time;
+            file.entries.clear();
+        }
+
+        file.entries.push_back(std::move(entry));
+    }
+
+private:
+    /** Cached results for the same version of a file, one for each set of base layers */
+    struct FileEntries {
+        FileTime time { 0, 0 };
+        std::vector<Entry> entries;
+    };
+
+    static std::mutex& getMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::unordered_map<std::string, FileEntries>& getFiles() {
+        static std::unordered_map<std::string, FileEntries> files;
+        return files;
+    }
+};
+
+#endif //SLCOMP_PARSER_LAYER_CACHE_H
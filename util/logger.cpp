@@ -1,49 +1,124 @@
 #include "logger.h"
 
-#include <cstdio>
+#include <cstdarg>
 #include <cstdlib>
 
+namespace {
+    /** Buffer capturing the output of the current thread, if any */
+    thread_local LogBuffer* threadBuffer = nullptr;
+}
+
+void LogBuffer::write(FILE* stream, const char* text, size_t length) {
+    if (parsingErrorLogged)
+        return;
+
+    if (chunks.empty() || chunks.back().first != stream)
+        chunks.emplace_back(stream, std::string());
+
+    chunks.back().second.append(text, length);
+}
+
+void LogBuffer::flush() {
+    for (const auto& chunk : chunks) {
+        // The output of the calling thread may be captured in turn
+        if (threadBuffer && threadBuffer != this) {
+            threadBuffer->write(chunk.first, chunk.second.data(), chunk.second.size());
+            continue;
+        }
+
+        fwrite(chunk.second.data(), 1, chunk.second.size(), chunk.first);
+        fflush(chunk.first);
+    }
+
+    chunks.clear();
+}
+
+void Logger::setThreadBuffer(LogBuffer* buffer) {
+    threadBuffer = buffer;
+}
+
+LogBuffer* Logger::getThreadBuffer() {
+    return threadBuffer;
+}
+
+void Logger::print(FILE* stream, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+
+    if (!threadBuffer) {
+        vfprintf(stream, format, args);
+        va_end(args);
+        return;
+    }
+
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    int length = vsnprintf(nullptr, 0, format, argsCopy);
+    va_end(argsCopy);
+
+    if (length > 0) {
+        std::string text((size_t) length + 1, '\0');
+        vsnprintf(&text[0], text.size(), format, args);
+        threadBuffer->write(stream, text.data(), (size_t) length);
+    }
+
+    va_end(args);
+}
+
 void Logger::message(const char* msg) {
-    fprintf(stdout, "%s\n", msg);
+    print(stdout, "%s\n", msg);
+}
+
+void Logger::echo(const char* text, size_t length) {
+    if (threadBuffer)
+        threadBuffer->write(stdout, text, length);
+    else
+        fwrite(text, 1, length, stdout);
 }
 
 void Logger::warning(const char* fun, const char* msg) {
-    fprintf(stderr, "Warning in %s: %s.\n", fun, msg);
+    print(stderr, "Warning in %s: %s.\n", fun, msg);
 }
 
 void Logger::error(const char* fun, const char* msg) {
-    fprintf(stderr, "Error in %s: %s.\n", fun, msg);
+    print(stderr, "Error in %s: %s.\n", fun, msg);
 }
 
 void Logger::syntaxError(const char* fun, const char* msg) {
-    fprintf(stderr, "%s: Syntax errors in \n%s", fun, msg);
+    print(stderr, "%s: Syntax errors in \n%s", fun, msg);
 }
 
 void Logger::syntaxError(const char* fun, const char* file, const char* msg) {
-    fprintf(stderr, "%s: Syntax errors in file '%s'\n%s", fun, file, msg);
+    print(stderr, "%s: Syntax errors in file '%s'\n%s", fun, file, msg);
 }
 
 void Logger::sortednessError(const char* fun, const char* file, const char* msg) {
-    fprintf(stderr, "%s: Well-sortedness errors when checking file '%s'\n\n%s", fun, file, msg);
+    print(stderr, "%s: Well-sortedness errors when checking file '%s'\n\n%s", fun, file, msg);
 }
 
 void Logger::sortednessError(const char* fun, const char* msg) {
-    fprintf(stderr, "%s: Well-sortedness errors\n\n%s", fun, msg);
+    print(stderr, "%s: Well-sortedness errors\n\n%s", fun, msg);
 }
 
 void Logger::heapError(const char* fun, const char* msg) {
-    fprintf(stderr, "\n%s: Heap check errors:\n%s", fun, msg);
+    print(stderr, "\n%s: Heap check errors:\n%s", fun, msg);
 }
 
 void Logger::parsingError(int rowLeft, int colLeft,
                           int rowRight, int colRight,
                           const char* filename, const char* msg) {
 
-    fprintf(stderr, "In %s from %d:%d to %d:%d - %s\n",
-            filename, rowLeft, colLeft, rowRight, colRight, msg);
+    print(stderr, "In %s from %d:%d to %d:%d - %s\n",
+          filename, rowLeft, colLeft, rowRight, colRight, msg);
+
+    if (threadBuffer) {
+        threadBuffer->parsingErrorLogged = true;
+        return;
+    }
+
     exit(Logger::ErrorCode::ERR_PARSE);
 }
 
 void Logger::predicateError(const char* msg) {
-    fprintf(stderr, "Error when loading inductive predicates:\n %s\n", msg);
+    print(stderr, "Error when loading inductive predicates:\n %s\n", msg);
 }
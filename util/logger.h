@@ -6,19 +6,72 @@
 #ifndef SLCOMP_PARSER_SMT_LOGGER_H
 #define SLCOMP_PARSER_SMT_LOGGER_H
 
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Output logged by a thread while it is captured (see Logger::setThreadBuffer()).
+ * The output is kept in the order it was logged, along with the stream it was meant for.
+ */
+class LogBuffer {
+private:
+    std::vector<std::pair<FILE*, std::string>> chunks;
+    bool parsingErrorLogged;
+
+    friend class Logger;
+
+    void write(FILE* stream, const char* text, size_t length);
+
+public:
+    LogBuffer() : parsingErrorLogged(false) { }
+
+    /** Whether a parsing error was logged, which ends the captured output */
+    inline bool hasParsingError() { return parsingErrorLogged; }
+
+    /**
+     * Print the captured output to the streams it was meant for,
+     * or add it to the buffer of the calling thread, if its output is captured
+     */
+    void flush();
+};
+
 /** Error, warning and message logger */
 class Logger {
+private:
+    static void print(FILE* stream, const char* format, ...);
+
 public:
     enum ErrorCode {
         ERR_PARSE = 1
     };
 
+    /**
+     * Capture the output logged by the calling thread in a buffer,
+     * or print it directly again if the buffer is null.
+     * While its output is captured, a thread is not terminated by parsing errors (see parsingError()).
+     */
+    static void setThreadBuffer(LogBuffer* buffer);
+
+    /** Get the buffer capturing the output logged by the calling thread (null if it is not captured) */
+    static LogBuffer* getThreadBuffer();
+
     static void message(const char *msg);
 
+    /** Print text which the scanner could not match, as is */
+    static void echo(const char *text, size_t length);
+
     static void warning(const char *fun, const char *msg);
 
     static void error(const char *fun, const char *msg);
 
+    /**
+     * Report a parsing error and terminate the process.
+     * If the output of the calling thread is captured, the process is not terminated.
+     * Instead, the error ends the captured output and any further output is discarded,
+     * so that the buffer holds what would have been printed before exiting.
+     */
     static void parsingError(int rowLeft, int colLeft,
                              int rowRight, int colRight,
                              const char *filename, const char *msg);
@@ -0,0 +1,42 @@
+#include "resource_usage.h"
+
+#include <sys/resource.h>
+
+#include <chrono>
+#include <ctime>
+
+namespace {
+    thread_local long long threadAllocations = 0;
+    thread_local long long threadAllocatedBytes = 0;
+    thread_local long long threadNodes = 0;
+}
+
+ResourceUsage ResourceUsage::current() {
+    ResourceUsage usage;
+
+    usage.wallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    struct timespec cpu;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu);
+    usage.cpuNs = (long long) cpu.tv_sec * 1000000000LL + cpu.tv_nsec;
+
+    usage.allocations = threadAllocations;
+    usage.allocatedBytes = threadAllocatedBytes;
+    usage.nodes = threadNodes;
+
+    struct rusage system;
+    getrusage(RUSAGE_SELF, &system);
+    usage.peakRssKb = system.ru_maxrss;
+
+    return usage;
+}
+
+void ResourceUsage::countNode() {
+    threadNodes++;
+}
+
+void ResourceUsage::countAllocation(size_t size) {
+    threadAllocations++;
+    threadAllocatedBytes += size;
+}
@@ -0,0 +1,48 @@
+/**
+ * \file resource_usage.h
+ * \brief Time, allocations, nodes and memory used by the current thread.
+ */
+
+#ifndef SLCOMP_PARSER_RESOURCE_USAGE_H
+#define SLCOMP_PARSER_RESOURCE_USAGE_H
+
+#include <cstddef>
+
+/**
+ * Snapshot of the resources used so far.
+ * Heap allocations are counted by the global operator new, and nodes by the constructors
+ * of the AST and sep nodes, separately for each thread. The CPU time is also that
+ * of the calling thread, while the peak resident set size is that of the whole process.
+ * Allocations are only counted in programs built with util/allocation_counter.cpp
+ * (slcomp-parser, alloc-bench and suite-bench), and are reported as 0 elsewhere.
+ */
+struct ResourceUsage {
+    /** Wall-clock time, in nanoseconds from an arbitrary point */
+    long long wallNs;
+
+    /** CPU time of the thread, in nanoseconds */
+    long long cpuNs;
+
+    /** Number of heap allocations made by the thread */
+    long long allocations;
+
+    /** Number of bytes requested by the heap allocations of the thread */
+    long long allocatedBytes;
+
+    /** Number of AST and sep nodes created by the thread */
+    long long nodes;
+
+    /** Peak resident set size of the process, in kilobytes */
+    long long peakRssKb;
+
+    /** Get the resources used so far */
+    static ResourceUsage current();
+
+    /** Count the creation of a node by the current thread */
+    static void countNode();
+
+    /** Count a heap allocation of the given size by the current thread */
+    static void countAllocation(size_t size);
+};
+
+#endif //SLCOMP_PARSER_RESOURCE_USAGE_H
@@ -0,0 +1,129 @@
+/**
+ * \file scoped_map.h
+ * \brief Hash map whose bindings are grouped into nested scopes.
+ */
+
+#ifndef SLCOMP_PARSER_SCOPED_MAP_H
+#define SLCOMP_PARSER_SCOPED_MAP_H
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Hash map whose bindings are grouped into nested scopes.
+ * All bindings of a key, whatever their scope, are kept in a single chain, where each
+ * binding shadows the ones before it. Keys are looked up with a single hash lookup,
+ * however many scopes are open.
+ * Bindings are also recorded in an undo log, so that opening a scope only notes the length
+ * of the log, and closing it only removes the bindings added since. Chains are kept
+ * once they are empty, so that binding the same keys again does not allocate.
+ * Bindings added while no scope is open are never removed, except by clear().
+ * \tparam K Key type
+ * \tparam V Value type
+ */
+template<class K, class V>
+class ScopedMap {
+public:
+    /** Binding of a key to a value */
+    struct Binding {
+        V value;
+
+        /** Depth of the scope of the binding */
+        size_t depth;
+    };
+
+    /** Bindings of a key, from the oldest to the most recent */
+    typedef std::vector<Binding> Chain;
+
+private:
+    std::unordered_map<K, Chain> index;
+
+    /** Keys of the bindings added in open scopes, in the order they were added */
+    std::vector<K> log;
+
+    /** Length of the log when each open scope was opened */
+    std::vector<size_t> marks;
+
+    const Chain* findChain(const K& key) const {
+        auto it = index.find(key);
+        if (it == index.end() || it->second.empty())
+            return nullptr;
+        return &it->second;
+    }
+
+public:
+    /** Number of open scopes */
+    inline size_t getDepth() const {
+        return marks.size();
+    }
+
+    /** Whether bindings were added in the innermost scope */
+    inline bool hasScopeBindings() const {
+        return !marks.empty() && log.size() > marks.back();
+    }
+
+    /** Open a new scope */
+    inline void push() {
+        marks.push_back(log.size());
+    }
+
+    /**
+     * Close the innermost scope, removing its bindings.
+     * \return Whether there was an open scope
+     */
+    bool pop() {
+        if (marks.empty())
+            return false;
+
+        size_t mark = marks.back();
+        marks.pop_back();
+
+        while (log.size() > mark) {
+            index[log.back()].pop_back();
+            log.pop_back();
+        }
+
+        return true;
+    }
+
+    /** Bind a key in the innermost scope */
+    void add(const K& key, const V& value) {
+        index[key].push_back({value, marks.size()});
+
+        if (!marks.empty())
+            log.push_back(key);
+    }
+
+    /** Get the most recent binding of a key (or a default value, if it is not bound) */
+    V get(const K& key) const {
+        const Chain* chain = findChain(key);
+        return chain ? chain->back().value : V();
+    }
+
+    /** Get the binding of a key in the innermost scope (or a default value, if there is none) */
+    V getInScope(const K& key) const {
+        const Chain* chain = findChain(key);
+        return chain && chain->back().depth == marks.size() ? chain->back().value : V();
+    }
+
+    /** Append the values of all bindings of a key, from the oldest to the most recent */
+    void getAll(const K& key, std::vector<V>& values) const {
+        const Chain* chain = findChain(key);
+        if (!chain)
+            return;
+
+        for (const auto& binding : *chain) {
+            values.push_back(binding.value);
+        }
+    }
+
+    /** Remove all bindings and close all scopes */
+    void clear() {
+        index.clear();
+        log.clear();
+        marks.clear();
+    }
+};
+
+#endif //SLCOMP_PARSER_SCOPED_MAP_H
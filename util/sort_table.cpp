@@ -0,0 +1,65 @@
+#include "sort_table.h"
+
+#include <mutex>
+#include <unordered_set>
+
+using namespace std;
+
+namespace {
+    /** Number of independently locked shards, so that concurrent checkers rarely contend */
+    const size_t SHARD_COUNT = 16;
+
+    struct CanonicalHash {
+        size_t operator()(const CanonicalSort* sort) const {
+            return sort->hash;
+        }
+    };
+
+    /** Arguments are already canonical, so they are compared as pointers */
+    struct CanonicalEqual {
+        bool operator()(const CanonicalSort* sort1, const CanonicalSort* sort2) const {
+            return sort1->name == sort2->name && sort1->arguments == sort2->arguments;
+        }
+    };
+
+    struct Shard {
+        mutex lock;
+        unordered_set<const CanonicalSort*, CanonicalHash, CanonicalEqual> sorts;
+    };
+
+    Shard* getShards() {
+        // Never destroyed, so that nodes outliving static destruction can still be compared
+        static Shard* shards = new Shard[SHARD_COUNT];
+        return shards;
+    }
+
+    size_t combine(size_t seed, size_t value) {
+        return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+    }
+}
+
+size_t CanonicalSortsHash::operator()(const vector<const CanonicalSort*>& sorts) const {
+    size_t hash = sorts.size();
+    for (const auto& sort : sorts) {
+        hash = combine(hash, sort->hash);
+    }
+    return hash;
+}
+
+const CanonicalSort* SortTable::get(SymbolId name, const vector<const CanonicalSort*>& arguments) {
+    CanonicalSort key { name, arguments, std::hash<SymbolId>()(name) };
+    for (const auto& arg : arguments) {
+        key.hash = combine(key.hash, arg->hash);
+    }
+
+    Shard& shard = getShards()[key.hash % SHARD_COUNT];
+
+    lock_guard<mutex> guard(shard.lock);
+    auto it = shard.sorts.find(&key);
+    if (it != shard.sorts.end())
+        return *it;
+
+    auto sort = new CanonicalSort(std::move(key));
+    shard.sorts.insert(sort);
+    return sort;
+}
@@ -0,0 +1,51 @@
+/**
+ * \file sort_table.h
+ * \brief Hash-consed, canonical representation of sorts.
+ */
+
+#ifndef SLCOMP_PARSER_SORT_TABLE_H
+#define SLCOMP_PARSER_SORT_TABLE_H
+
+#include "interner.h"
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Canonical form of a sort: its name and the canonical forms of its arguments.
+ * There is only one canonical form for each sort, so two sorts are equal
+ * if and only if their canonical forms are the same object.
+ */
+struct CanonicalSort {
+    /** Identifier of the sort name, with its indices if it is indexed */
+    SymbolId name;
+
+    /** Canonical forms of the sort arguments */
+    std::vector<const CanonicalSort*> arguments;
+
+    /** Structural hash of the sort */
+    size_t hash;
+};
+
+/** Hash of a list of canonical sorts, e.g. the sorts of the arguments of an application */
+struct CanonicalSortsHash {
+    size_t operator()(const std::vector<const CanonicalSort*>& sorts) const;
+};
+
+/**
+ * Process-wide table of canonical sorts.
+ * The sorts of the input file and of the theories it loads are compared
+ * across symbol tables and checkers, so they share a single table.
+ * Canonical sorts are never freed. All operations are thread-safe.
+ */
+class SortTable {
+public:
+    /**
+     * Get the canonical form of a sort, adding it if it is not already known
+     * \param name      Identifier of the sort name
+     * \param arguments Canonical forms of the sort arguments
+     */
+    static const CanonicalSort* get(SymbolId name, const std::vector<const CanonicalSort*>& arguments);
+};
+
+#endif //SLCOMP_PARSER_SORT_TABLE_H
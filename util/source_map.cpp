@@ -0,0 +1,118 @@
+#include "source_map.h"
+
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    /** Spans are stored in blocks of 2^BLOCK_BITS entries */
+    const size_t BLOCK_BITS = 10;
+    const size_t BLOCK_SIZE = 1 << BLOCK_BITS;
+    const size_t MAX_BLOCKS = ((size_t) 1) << (32 - BLOCK_BITS);
+
+    const SourceSpan emptySpan = {0, 0, 0, 0};
+}
+
+struct SourceMap::Block {
+    /** Interned name of the file of the table filling the block */
+    uint32_t fileId;
+
+    SourceSpan spans[BLOCK_SIZE];
+};
+
+namespace {
+    mutex blocksLock;
+
+    // The first block is never handed out, so that no span gets the identifier NO_SPAN
+    size_t blockCount = 1;
+
+    /** Indices of the blocks released by their tables */
+    vector<uint32_t> freeBlocks;
+
+    inline size_t getBlockIndex(SpanId span) {
+        return span >> BLOCK_BITS;
+    }
+}
+
+SourceMap::Block** SourceMap::getBlocks() {
+    // Zero-filled by calloc, so that only the pages actually used are backed by memory
+    static auto blocks = static_cast<Block**>(calloc(MAX_BLOCKS, sizeof(Block*)));
+    return blocks;
+}
+
+SourceMap::SourceMap(uint32_t fileId)
+        : fileId(fileId), next(0), end(0) {}
+
+SourceMap::~SourceMap() {
+    truncate(0);
+}
+
+const SourceSpan& SourceMap::getSpan(SpanId span) {
+    if (span == NO_SPAN)
+        return emptySpan;
+
+    return getBlocks()[getBlockIndex(span)]->spans[span & (BLOCK_SIZE - 1)];
+}
+
+uint32_t SourceMap::getFileId(SpanId span) {
+    return getBlocks()[getBlockIndex(span)]->fileId;
+}
+
+SpanId SourceMap::add(int rowLeft, int colLeft, int rowRight, int colRight) {
+    if (next == end) {
+        uint32_t index;
+        {
+            lock_guard<mutex> guard(blocksLock);
+            if (!freeBlocks.empty()) {
+                index = freeBlocks.back();
+                freeBlocks.pop_back();
+            } else {
+                if (blockCount == MAX_BLOCKS)
+                    throw bad_alloc();
+
+                getBlocks()[blockCount] = new Block();
+                index = (uint32_t) blockCount++;
+            }
+        }
+
+        blocks.push_back(index);
+        getBlocks()[index]->fileId = fileId;
+
+        next = (SpanId) (index << BLOCK_BITS);
+        end = (SpanId) (next + BLOCK_SIZE);
+    }
+
+    SourceSpan& span = getBlocks()[getBlockIndex(next)]->spans[next & (BLOCK_SIZE - 1)];
+    span.rowLeft = rowLeft;
+    span.colLeft = colLeft;
+    span.rowRight = rowRight;
+    span.colRight = colRight;
+
+    return next++;
+}
+
+size_t SourceMap::getSize() {
+    return blocks.size() * BLOCK_SIZE - (end - next);
+}
+
+void SourceMap::truncate(size_t size) {
+    if (size >= getSize())
+        return;
+
+    size_t kept = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    if (kept < blocks.size()) {
+        lock_guard<mutex> guard(blocksLock);
+        freeBlocks.insert(freeBlocks.end(), blocks.begin() + kept, blocks.end());
+        blocks.resize(kept);
+    }
+
+    if (blocks.empty()) {
+        next = end = 0;
+    } else {
+        end = (SpanId) ((blocks.back() << BLOCK_BITS) + BLOCK_SIZE);
+        next = (SpanId) (end - (kept * BLOCK_SIZE - size));
+    }
+}
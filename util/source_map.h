@@ -0,0 +1,89 @@
+/**
+ * \file source_map.h
+ * \brief Compact source locations for AST and sep nodes.
+ */
+
+#ifndef SLCOMP_PARSER_SOURCE_MAP_H
+#define SLCOMP_PARSER_SOURCE_MAP_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** Identifier of a source span */
+typedef uint32_t SpanId;
+
+/** Location of a node in its source file */
+struct SourceSpan {
+    int rowLeft;
+    int colLeft;
+    int rowRight;
+    int colRight;
+};
+
+class SourceMap;
+
+typedef std::shared_ptr<SourceMap> SourceMapPtr;
+
+/**
+ * Table of the source spans of the nodes from a single parse of a file.
+ * Nodes only store the 32-bit identifier of their span, which is copied between nodes
+ * (e.g. during translation) like any other integer.
+ * The table is kept along with the result of the parse (e.g. by the execution that parsed a script,
+ * or by the symbol stacks and cached layers that hold the entries of a theory), and all of its spans
+ * are released at once with it.
+ * Spans are recorded in blocks of a process-wide registry, indexed by the upper bits of the identifiers,
+ * so that looking up a span only needs its identifier. Each block is filled by a single table, without
+ * any locking, and is handed out to other tables once released. The identifiers of a table must thus
+ * not be looked up once the table is gone.
+ */
+class SourceMap {
+private:
+    struct Block;
+
+    /** Get the registry of blocks, indexed by the upper bits of the span identifiers */
+    static Block** getBlocks();
+
+    /** Interned name of the file, shared by all spans */
+    uint32_t fileId;
+
+    /** Indices of the blocks of the table, in the order they were filled */
+    std::vector<uint32_t> blocks;
+
+    /** Identifiers left in the last block */
+    SpanId next;
+    SpanId end;
+
+public:
+    /** Span of nodes that do not come from a source file */
+    static const SpanId NO_SPAN = 0;
+
+    explicit SourceMap(uint32_t fileId);
+
+    SourceMap(const SourceMap&) = delete;
+    SourceMap& operator=(const SourceMap&) = delete;
+
+    /** Releases the blocks of the table */
+    ~SourceMap();
+
+    /** Get a recorded span; NO_SPAN yields an all-zero location */
+    static const SourceSpan& getSpan(SpanId span);
+
+    /** Get the interned name of the file of a recorded span (other than NO_SPAN) */
+    static uint32_t getFileId(SpanId span);
+
+    /** Record a span and return its identifier. Not thread-safe. */
+    SpanId add(int rowLeft, int colLeft, int rowRight, int colRight);
+
+    /** Number of spans recorded */
+    size_t getSize();
+
+    /**
+     * Release the spans recorded after the first size ones (see getSize()).
+     * Their identifiers are handed out again by subsequent calls to add().
+     */
+    void truncate(size_t size);
+};
+
+#endif //SLCOMP_PARSER_SOURCE_MAP_H
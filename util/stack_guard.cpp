@@ -0,0 +1,115 @@
+#include "stack_guard.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+#endif
+
+#include <exception>
+#include <new>
+
+thread_local uintptr_t StackGuard::limit = 0;
+
+#ifdef __linux__
+namespace {
+    /** A function running on a new stack segment */
+    struct SegmentCall {
+        const std::function<void()>* fn;
+        std::exception_ptr error;
+        ucontext_t caller;
+    };
+
+    /** Call about to start on a new segment, taken over by its entry point */
+    thread_local SegmentCall* startingCall = nullptr;
+
+    /** Entry point of a new segment, which returns to the caller once the function is done */
+    void runSegmentCall() {
+        SegmentCall* call = startingCall;
+        try {
+            (*call->fn)();
+        } catch (...) {
+            call->error = std::current_exception();
+        }
+    }
+
+    /** Stack segment mapped above an inaccessible guard page, so that overflowing it faults right away */
+    class Segment {
+    private:
+        char* base;
+        size_t guardSize;
+
+    public:
+        Segment()
+                : guardSize((size_t) sysconf(_SC_PAGESIZE)) {
+            void* addr = mmap(nullptr, guardSize + StackGuard::SEGMENT_SIZE, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+            if (addr == MAP_FAILED)
+                throw std::bad_alloc();
+
+            base = static_cast<char*>(addr);
+            if (mprotect(base, guardSize, PROT_NONE) != 0) {
+                munmap(base, guardSize + StackGuard::SEGMENT_SIZE);
+                throw std::bad_alloc();
+            }
+        }
+
+        ~Segment() {
+            munmap(base, guardSize + StackGuard::SEGMENT_SIZE);
+        }
+
+        Segment(const Segment&) = delete;
+        Segment& operator=(const Segment&) = delete;
+
+        /** Lowest usable address of the segment */
+        inline char* getStack() const {
+            return base + guardSize;
+        }
+    };
+}
+#endif
+
+uintptr_t StackGuard::findLimit() {
+#ifdef __linux__
+    pthread_attr_t attr;
+    if (pthread_getattr_np(pthread_self(), &attr) == 0) {
+        void* addr;
+        size_t size;
+        int status = pthread_attr_getstack(&attr, &addr, &size);
+        pthread_attr_destroy(&attr);
+
+        if (status == 0 && addr)
+            return (uintptr_t) addr;
+    }
+#endif
+    return 1;
+}
+
+void StackGuard::runOnNewSegment(const std::function<void()>& fn) {
+#ifdef __linux__
+    Segment segment;
+
+    SegmentCall call;
+    call.fn = &fn;
+
+    ucontext_t context;
+    getcontext(&context);
+    context.uc_stack.ss_sp = segment.getStack();
+    context.uc_stack.ss_size = SEGMENT_SIZE;
+    context.uc_link = &call.caller;
+    makecontext(&context, runSegmentCall, 0);
+
+    uintptr_t callerLimit = limit;
+    limit = (uintptr_t) segment.getStack();
+    startingCall = &call;
+    swapcontext(&call.caller, &context);
+    limit = callerLimit;
+
+    if (call.error)
+        std::rethrow_exception(call.error);
+#else
+    // The stack bounds are not known, so isLow() never asks for a new segment
+    fn();
+#endif
+}
@@ -0,0 +1,60 @@
+/**
+ * \file stack_guard.h
+ * \brief Keeps deep recursions over the nodes from overflowing the native stack.
+ */
+
+#ifndef SLCOMP_PARSER_STACK_GUARD_H
+#define SLCOMP_PARSER_STACK_GUARD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/**
+ * Guard for the recursive traversals of deeply nested terms.
+ * The traversals check at each level whether the stack they run on is close to its end.
+ * If it is, they continue on a new stack segment mapped above an inaccessible guard page,
+ * which is released once they return to the previous level. The native stack of the thread,
+ * as well as each segment, is thus used only up to a bounded depth, whatever the nesting of the terms.
+ * The bounds of the stack are looked up once for each thread, so threads with small stacks
+ * switch to new segments sooner. They are only looked up on Linux; elsewhere, no segments are used.
+ */
+class StackGuard {
+private:
+    /** Lowest address of the stack segment the thread is running on (0 if not looked up yet) */
+    static thread_local uintptr_t limit;
+
+    /** Look up the lowest address of the native stack of the thread (1 if it is unknown) */
+    static uintptr_t findLimit();
+
+public:
+    /** Space that must remain on a stack segment for a traversal to continue on it */
+    static const size_t RED_ZONE = 64 * 1024;
+
+    /** Size of the new stack segments */
+    static const size_t SEGMENT_SIZE = 1024 * 1024;
+
+    /** Whether the current stack segment is close to its end */
+    inline static bool isLow() {
+        if (limit == 0)
+            limit = findLimit();
+        return (uintptr_t) __builtin_frame_address(0) < limit + RED_ZONE;
+    }
+
+    /**
+     * Run a function on a new stack segment (or on the current one, where segments are not used).
+     * Exceptions thrown by the function are rethrown on the current segment.
+     * Throws std::bad_alloc if the segment cannot be mapped.
+     */
+    static void runOnNewSegment(const std::function<void()>& fn);
+
+    /** Call a function on a new stack segment and return its result */
+    template<class T>
+    static T callOnNewSegment(const std::function<T()>& fn) {
+        T result;
+        runOnNewSegment([&] { result = fn(); });
+        return result;
+    }
+};
+
+#endif //SLCOMP_PARSER_STACK_GUARD_H
@@ -0,0 +1,102 @@
+#include "thread_pool.h"
+
+using namespace std;
+
+ThreadPool::ThreadPool(size_t threads)
+        : generation(0)
+        , stopping(false)
+        , iteration(nullptr)
+        , count(0)
+        , next(0)
+        , busy(0) {
+    for (size_t i = 1; i < threads; i++) {
+        this->threads.emplace_back(&ThreadPool::serve, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+    }
+    started.notify_all();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::work(size_t thread) {
+    for (size_t index = next++; index < count; index = next++) {
+        try {
+            (*iteration)(index, thread);
+        } catch (...) {
+            lock_guard<mutex> guard(lock);
+            if (!error)
+                error = current_exception();
+        }
+    }
+}
+
+void ThreadPool::serve(size_t thread) {
+    size_t seen = 0;
+
+    while (true) {
+        {
+            unique_lock<mutex> guard(lock);
+            started.wait(guard, [&] { return stopping || generation != seen; });
+
+            if (stopping)
+                return;
+
+            seen = generation;
+        }
+
+        work(thread);
+
+        {
+            lock_guard<mutex> guard(lock);
+            busy--;
+        }
+        finished.notify_all();
+    }
+}
+
+void ThreadPool::run(size_t count, const Iteration& iteration) {
+    if (count == 0)
+        return;
+
+    // Loops too short to share are not worth waking up the threads for
+    if (threads.empty() || count == 1) {
+        for (size_t i = 0; i < count; i++) {
+            iteration(i, 0);
+        }
+        return;
+    }
+
+    {
+        lock_guard<mutex> guard(lock);
+        this->iteration = &iteration;
+        this->count = count;
+        next = 0;
+        busy = threads.size();
+        error = nullptr;
+        generation++;
+    }
+    started.notify_all();
+
+    work(0);
+
+    exception_ptr loopError;
+    {
+        unique_lock<mutex> guard(lock);
+        finished.wait(guard, [&] { return busy == 0; });
+
+        this->iteration = nullptr;
+        loopError = error;
+        error = nullptr;
+    }
+
+    if (loopError)
+        rethrow_exception(loopError);
+}
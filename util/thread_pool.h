@@ -0,0 +1,83 @@
+/**
+ * \file thread_pool.h
+ * \brief Pool of threads running the iterations of parallel loops.
+ */
+
+#ifndef SLCOMP_PARSER_THREAD_POOL_H
+#define SLCOMP_PARSER_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Pool of threads running the iterations of parallel loops (see run()).
+ * The threads are started once, with the pool, and wait for the next loop in between,
+ * so that a pool can run many short loops. The thread calling run() takes part in the loop,
+ * so a pool of n threads starts n - 1 of its own.
+ * Each thread has a number, which is 0 for the calling thread, so that the iterations
+ * can use state owned by the thread running them.
+ */
+class ThreadPool {
+public:
+    /** Iteration of a loop, given its index and the number of the thread running it */
+    typedef std::function<void(size_t index, size_t thread)> Iteration;
+
+private:
+    std::vector<std::thread> threads;
+
+    std::mutex lock;
+    std::condition_variable started;
+    std::condition_variable finished;
+
+    /** Number of the current loop, which threads compare with the last one they took part in */
+    size_t generation;
+
+    /** Whether the threads should exit */
+    bool stopping;
+
+    /** Current loop */
+    const Iteration* iteration;
+    size_t count;
+
+    /** Index of the next iteration to run */
+    std::atomic<size_t> next;
+
+    /** Number of threads of the pool still running iterations of the current loop */
+    size_t busy;
+
+    /** First exception thrown by an iteration of the current loop */
+    std::exception_ptr error;
+
+    /** Run iterations of the current loop until there are none left */
+    void work(size_t thread);
+
+    /** Body of the threads of the pool */
+    void serve(size_t thread);
+
+public:
+    /** \param threads Number of threads running each loop, including the calling thread */
+    explicit ThreadPool(size_t threads);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool();
+
+    /** Number of threads running each loop, including the calling thread */
+    inline size_t getSize() const { return threads.size() + 1; }
+
+    /**
+     * Run a loop of the given number of iterations over all threads, and wait until it is done.
+     * Iterations are started in the order of their indices, each by the first thread to be free.
+     * If iterations throw, the first exception is rethrown once the loop is done.
+     */
+    void run(size_t count, const Iteration& iteration);
+};
+
+#endif //SLCOMP_PARSER_THREAD_POOL_H